@@ -245,6 +245,9 @@ namespace Constants {
     constexpr const char* FORM_IS_RECOVER_FORM_TO_HANDLE_CLICK_EVENT = "form_is_recover_form_to_handle_click_event";
     constexpr const char* FORM_STATUS_EVENT = "form_status_event";
     constexpr const char* FORM_STATUS_EVENT_ID = "form_status_event_id";
+    constexpr const char* FORM_DATA_REVISION = "form_data_revision";
+    constexpr const char* FORM_DATA_PATCH_BASE_REVISION = "form_data_patch_base_revision";
+    constexpr const char* FORM_DATA_PATCH_MISMATCH = "form_data_patch_mismatch";
 
     constexpr size_t MAX_LAYOUT = 8;
     constexpr int32_t MAX_FORMS = 512;
@@ -131,6 +131,7 @@ struct NewFormEventInfo {
     bool isDistributedForm = false;
     Constants::FormLocation formLocation = Constants::FormLocation::FORM_LOCATION_END;
     int32_t actualProxyRefreshTimes = 0;
+    int32_t alignedTimerRefreshTimes = 0;
 };
 
 struct FormAbnormalReportParams {
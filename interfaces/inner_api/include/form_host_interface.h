@@ -127,6 +127,21 @@ public:
      */
     virtual void OnCheckForm(const std::vector<int64_t> &formIds) {}
 
+    /**
+     * @brief Several forms are updated, delivered in one call.
+     * @param formInfos Form infos, at most MAX_BATCH_UPDATE_COUNT.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int32_t OnBatchUpdate(const std::vector<FormJsInfo> &formInfos)
+    {
+        for (const auto &formInfo : formInfos) {
+            OnUpdate(formInfo);
+        }
+        return ERR_OK;
+    }
+
+    static constexpr int32_t MAX_BATCH_UPDATE_COUNT = 32;
+
     enum class Message {
         // ipc id 1-1000 for kit
         // ipc id 1001-2000 for DMS
@@ -169,6 +184,9 @@ public:
 
         // ipc id for checking form (3693)
         FORM_HOST_ON_CHECK_FORM,
+
+        // ipc id for batched form update (3694)
+        FORM_HOST_ON_BATCH_UPDATE,
     };
 };
 }  // namespace AppExecFwk
@@ -47,6 +47,13 @@ public:
      */
     virtual void OnUpdate(const FormJsInfo &formInfo) override;
 
+    /**
+     * @brief Several forms are updated, delivered in one call.
+     * @param formInfos Form infos.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int32_t OnBatchUpdate(const std::vector<FormJsInfo> &formInfos) override;
+
     /**
      * @brief Form provider is uninstalled.
      * @param formIds The Id list of the forms.
@@ -57,6 +57,13 @@ private:
      * @return Returns ERR_OK on success, others on failure.
      */
     int HandleOnUpdate(MessageParcel &data, MessageParcel &reply);
+    /**
+     * @brief handle OnBatchUpdate message.
+     * @param data input param.
+     * @param reply output param.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int32_t HandleOnBatchUpdate(MessageParcel &data, MessageParcel &reply);
     /**
      * @brief handle OnUnInstall message.
      * @param data input param.
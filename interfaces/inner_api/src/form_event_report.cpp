@@ -48,6 +48,7 @@ constexpr const char *EVENT_KEY_DURATION = "DURATION";
 constexpr const char *EVENT_KEY_DURATION_TYPE = "DURATION_TYPE";
 constexpr const char *EVENT_KEY_DAILY_REFRESH_TIMES = "DAILY_REFRESH_TIMES";
 constexpr const char *EVENT_KEY_ACTUAL_PROXY_REFRESH_TIMES = "ACTUAL_PROXY_REFRESH_TIMES";
+constexpr const char *EVENT_KEY_ALIGNED_TIMER_REFRESH_TIMES = "ALIGNED_TIMER_REFRESH_TIMES";
 constexpr const char *EVENT_KEY_INVISIBLE_REFRESH_TIMES = "INVISIBLE_REFRESH_TIMES";
 constexpr const char *EVENT_KEY_HF_REFRESH_BLOCK_TIMES = "HF_REFRESH_BLOCK_TIMES";
 constexpr const char *EVENT_KEY_INVISIBLE_REFRESH_BLOCK_TIMES = "INVISIBLE_REFRESH_BLOCK_TIMES";
@@ -321,6 +322,8 @@ void FormEventReport::SendFormRefreshCountEvent(const FormEventName &eventName,
         builder.InsertParam(EVENT_KEY_FORM_LOCATION, static_cast<int8_t>(eventInfo.formLocation));
         builder.InsertParam(EVENT_KEY_ACTUAL_PROXY_REFRESH_TIMES,
             static_cast<int32_t>(eventInfo.actualProxyRefreshTimes));
+        builder.InsertParam(EVENT_KEY_ALIGNED_TIMER_REFRESH_TIMES,
+            static_cast<int32_t>(eventInfo.alignedTimerRefreshTimes));
         builder.Write("FORM_MANAGER", name, static_cast<HiSysEventEventType>(type));
     }
 }
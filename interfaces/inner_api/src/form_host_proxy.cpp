@@ -15,6 +15,8 @@
 
 #include "form_host_proxy.h"
 
+#include <cinttypes>
+
 #include "appexecfwk_errors.h"
 #include "string_ex.h"
 
@@ -85,6 +87,36 @@ void FormHostProxy::OnUpdate(const FormJsInfo &formInfo)
 }
 
 
+int32_t FormHostProxy::OnBatchUpdate(const std::vector<FormJsInfo> &formInfos)
+{
+    MessageParcel data;
+    if (!WriteInterfaceToken(data)) {
+        HILOG_ERROR("write interface token failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+
+    if (!data.WriteInt32(static_cast<int32_t>(formInfos.size()))) {
+        HILOG_ERROR("write size failed");
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    for (const auto &formInfo : formInfos) {
+        if (!data.WriteParcelable(&formInfo)) {
+            HILOG_ERROR("write formInfo failed, formId:%{public}" PRId64, formInfo.formId);
+            return ERR_APPEXECFWK_PARCEL_ERROR;
+        }
+    }
+
+    MessageParcel reply;
+    // Synchronous like OnUpdate, so a host whose stub does not know the call reports it.
+    MessageOption option;
+    int error = SendTransactCmd(IFormHost::Message::FORM_HOST_ON_BATCH_UPDATE, data, reply, option);
+    if (error != ERR_OK) {
+        HILOG_ERROR("SendRequest:%{public}d failed", error);
+        return error;
+    }
+    return ERR_OK;
+}
+
 /**
  * @brief Form provider is uninstalled
  * @param formIds The Id list of the forms.
@@ -75,6 +75,8 @@ int FormHostStub::OnRemoteRequest(uint32_t code, MessageParcel &data, MessagePar
             return HandleOnDueControlForm(data, reply);
         case static_cast<uint32_t>(IFormHost::Message::FORM_HOST_ON_CHECK_FORM):
             return HandleOnCheckForm(data, reply);
+        case static_cast<uint32_t>(IFormHost::Message::FORM_HOST_ON_BATCH_UPDATE):
+            return HandleOnBatchUpdate(data, reply);
         default:
             return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
     }
@@ -120,6 +122,34 @@ int FormHostStub::HandleOnUpdate(MessageParcel &data, MessageParcel &reply)
     return ERR_OK;
 }
 
+/**
+ * @brief handle OnBatchUpdate event.
+ * @param data input param.
+ * @param reply output param.
+ * @return Returns ERR_OK on success, others on failure.
+ */
+int32_t FormHostStub::HandleOnBatchUpdate(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t size = data.ReadInt32();
+    if (size <= 0 || size > IFormHost::MAX_BATCH_UPDATE_COUNT) {
+        HILOG_ERROR("invalid size:%{public}d", size);
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+    std::vector<FormJsInfo> formInfos;
+    formInfos.reserve(size);
+    for (int32_t i = 0; i < size; i++) {
+        std::unique_ptr<FormJsInfo> formInfo(data.ReadParcelable<FormJsInfo>());
+        if (!formInfo) {
+            HILOG_ERROR("ReadParcelable<FormJsInfo> failed");
+            return ERR_APPEXECFWK_PARCEL_ERROR;
+        }
+        formInfos.emplace_back(std::move(*formInfo));
+    }
+    OnBatchUpdate(formInfos);
+    reply.WriteInt32(ERR_OK);
+    return ERR_OK;
+}
+
 /**
  * @brief handle OnUnInstall event.
  * @param data input param.
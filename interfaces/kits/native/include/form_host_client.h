@@ -16,12 +16,14 @@
 #ifndef OHOS_FORM_FWK_FORM_HOST_CLIENT_H
 #define OHOS_FORM_FWK_FORM_HOST_CLIENT_H
 
+#include <array>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <vector>
 #include <set>
 #include <unordered_set>
+#include <utility>
 #include "form_callback_interface.h"
 #include "form_host_stub.h"
 #include "form_state_info.h"
@@ -229,19 +231,50 @@ public:
     void OnCheckForm(const std::vector<int64_t> &formIds) override;
 
 private:
+    using FormCallbacks = std::vector<std::shared_ptr<FormCallbackInterface>>;
+    using FormCallbacksList = std::vector<std::pair<int64_t, FormCallbacks>>;
+
+    /**
+     * @brief Part of the form callbacks, a form always lives in the shard picked by GetCallbackShardIndex.
+     */
+    struct CallbackShard {
+        std::mutex callbackMutex;
+        std::map<int64_t, std::set<std::shared_ptr<FormCallbackInterface>>> formCallbackMap;
+        std::unordered_set<int64_t> etsFormIds;
+    };
+
+    static constexpr size_t CALLBACK_SHARD_COUNT = 16;
+
+    static size_t GetCallbackShardIndex(int64_t formId);
+
+    CallbackShard &GetCallbackShard(int64_t formId);
+
+    /**
+     * @brief Copy the callbacks of a form, to be invoked out of the shard lock.
+     * @param formId The Id of the form.
+     * @return Returns the callbacks, empty if the form is not found.
+     */
+    FormCallbacks GetFormCallbacks(int64_t formId);
+
+    /**
+     * @brief Copy the callbacks of the forms, each shard is locked once.
+     * @param formIds The Id list of the forms.
+     * @param etsOnly Only take ets forms, ets forms without callbacks are dropped.
+     * @return Returns the found forms and their callbacks, in the order of formIds.
+     */
+    FormCallbacksList GetFormCallbacks(const std::vector<int64_t> &formIds, bool etsOnly = false);
+
     static std::mutex instanceMutex_;
     static sptr<FormHostClient> instance_;
-    mutable std::mutex callbackMutex_;
     mutable std::mutex formStateCallbackMutex_;
     mutable std::mutex uninstallCallbackMutex_;
     mutable std::mutex shareFormCallbackMutex_;
     mutable std::mutex AcquireDataCallbackMutex_;
-    std::map<int64_t, std::set<std::shared_ptr<FormCallbackInterface>>> formCallbackMap_;
+    std::array<CallbackShard, CALLBACK_SHARD_COUNT> callbackShards_;
     std::map<int64_t, std::shared_ptr<ShareFormCallBack>> shareFormCallbackMap_;
     std::map<int64_t, std::shared_ptr<FormDataCallbackInterface>> acquireDataCallbackMap_;
     std::map<std::string, std::set<std::shared_ptr<FormStateCallbackInterface>>> formStateCallbackMap_;
     UninstallCallback uninstallCallback_ = nullptr;
-    std::unordered_set<int64_t> etsFormIds_;
 
     DISALLOW_COPY_AND_MOVE(FormHostClient);
 };
@@ -69,18 +69,11 @@ void FormHostClient::AddForm(std::shared_ptr<FormCallbackInterface> formCallback
         HILOG_ERROR("invalid formId or formCallback");
         return;
     }
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    auto iter = formCallbackMap_.find(formId);
-    if (iter == formCallbackMap_.end()) {
-        std::set<std::shared_ptr<FormCallbackInterface>> callbacks;
-        callbacks.emplace(formCallback);
-        formCallbackMap_.emplace(formId, callbacks);
-    } else {
-        iter->second.emplace(formCallback);
-    }
-
+    CallbackShard &shard = GetCallbackShard(formId);
+    std::lock_guard<std::mutex> lock(shard.callbackMutex);
+    shard.formCallbackMap[formId].emplace(formCallback);
     if (formJsInfo.uiSyntax == FormType::ETS) {
-        etsFormIds_.emplace(formId);
+        shard.etsFormIds.emplace(formId);
     }
 }
 
@@ -98,17 +91,18 @@ void FormHostClient::RemoveForm(std::shared_ptr<FormCallbackInterface> formCallb
         HILOG_ERROR("invalid formId or formCallback");
         return;
     }
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    auto iter = formCallbackMap_.find(formId);
-    if (iter == formCallbackMap_.end()) {
+    CallbackShard &shard = GetCallbackShard(formId);
+    std::lock_guard<std::mutex> lock(shard.callbackMutex);
+    auto iter = shard.formCallbackMap.find(formId);
+    if (iter == shard.formCallbackMap.end()) {
         HILOG_ERROR("not find formId:%{public}s", std::to_string(formId).c_str());
         return;
     }
     iter->second.erase(formCallback);
     if (iter->second.empty()) {
         HILOG_INFO("All callbacks have been removed");
-        formCallbackMap_.erase(iter);
-        etsFormIds_.erase(formId);
+        shard.formCallbackMap.erase(iter);
+        shard.etsFormIds.erase(formId);
     }
 }
 
@@ -121,8 +115,9 @@ void FormHostClient::RemoveForm(std::shared_ptr<FormCallbackInterface> formCallb
 bool FormHostClient::ContainsForm(int64_t formId)
 {
     HILOG_INFO("call");
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    return formCallbackMap_.find(formId) != formCallbackMap_.end();
+    CallbackShard &shard = GetCallbackShard(formId);
+    std::lock_guard<std::mutex> lock(shard.callbackMutex);
+    return shard.formCallbackMap.find(formId) != shard.formCallbackMap.end();
 }
 
 /**
@@ -227,18 +222,9 @@ void FormHostClient::OnUninstall(const std::vector<int64_t> &formIds)
             uninstallCallback_(formIds);
         }
     }
-    for (auto &formId : formIds) {
-        if (formId < 0) {
-            HILOG_ERROR("the passed form id can't be negative");
-            continue;
-        }
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        auto iter = formCallbackMap_.find(formId);
-        if (iter == formCallbackMap_.end()) {
-            HILOG_ERROR("not find formId:%{public}s", std::to_string(formId).c_str());
-            continue;
-        }
-        for (const auto& callback : iter->second) {
+    for (const auto &formCallbacks : GetFormCallbacks(formIds)) {
+        int64_t formId = formCallbacks.first;
+        for (const auto& callback : formCallbacks.second) {
             HILOG_ERROR("uninstall formId:%{public}s", std::to_string(formId).c_str());
             if (callback == nullptr) {
                 HILOG_ERROR("null FormCallback");
@@ -267,21 +253,24 @@ void FormHostClient::OnAcquireState(FormState state, const AAFwk::Want &want)
         .append(want.GetStringParam(AppExecFwk::Constants::PARAM_FORM_NAME_KEY)).append(doubleColon)
         .append(std::to_string(want.GetIntParam(AppExecFwk::Constants::PARAM_FORM_DIMENSION_KEY, 1)));
 
-    std::lock_guard<std::mutex> lock(formStateCallbackMutex_);
-    auto iter = formStateCallbackMap_.find(key);
-    if (iter == formStateCallbackMap_.end()) {
-        HILOG_INFO("state callback not found");
-    } else {
-        std::set<std::shared_ptr<FormStateCallbackInterface>> &callbackSet = iter->second;
-        for (auto &callback: callbackSet) {
-            if (callback == nullptr) {
-                HILOG_ERROR("null FormCallback");
-                continue;
-            }
-            callback->ProcessAcquireState(state);
+    std::set<std::shared_ptr<FormStateCallbackInterface>> callbackSet;
+    {
+        std::lock_guard<std::mutex> lock(formStateCallbackMutex_);
+        auto iter = formStateCallbackMap_.find(key);
+        if (iter == formStateCallbackMap_.end()) {
+            HILOG_INFO("state callback not found");
+            return;
         }
+        callbackSet = std::move(iter->second);
         formStateCallbackMap_.erase(iter);
     }
+    for (auto &callback: callbackSet) {
+        if (callback == nullptr) {
+            HILOG_ERROR("null FormCallback");
+            continue;
+        }
+        callback->ProcessAcquireState(state);
+    }
     HILOG_INFO("done");
 }
 
@@ -316,17 +305,21 @@ bool FormHostClient::AddAcqiureFormDataCallback(const std::shared_ptr<FormDataCa
 void FormHostClient::OnAcquireDataResponse(const AAFwk::WantParams &wantParams, int64_t requestCode)
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
-    std::lock_guard<std::mutex> lock(AcquireDataCallbackMutex_);
-    auto iter = acquireDataCallbackMap_.find(requestCode);
-    if (iter == acquireDataCallbackMap_.end()) {
-        HILOG_DEBUG("acquire form data callback not found");
-        return;
+    std::shared_ptr<FormDataCallbackInterface> callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(AcquireDataCallbackMutex_);
+        auto iter = acquireDataCallbackMap_.find(requestCode);
+        if (iter == acquireDataCallbackMap_.end()) {
+            HILOG_DEBUG("acquire form data callback not found");
+            return;
+        }
+        callback = iter->second;
+        acquireDataCallbackMap_.erase(iter);
     }
 
-    if (iter->second) {
-        iter->second->ProcessAcquireFormData(wantParams);
+    if (callback) {
+        callback->ProcessAcquireFormData(wantParams);
     }
-    acquireDataCallbackMap_.erase(requestCode);
     HILOG_DEBUG("done");
 }
 
@@ -334,41 +327,51 @@ void FormHostClient::OnShareFormResponse(int64_t requestCode, int32_t result)
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     HILOG_DEBUG("result:%{public}d", result);
-    std::lock_guard<std::mutex> lock(shareFormCallbackMutex_);
-    auto iter = shareFormCallbackMap_.find(requestCode);
-    if (iter == shareFormCallbackMap_.end()) {
-        HILOG_DEBUG("invalid shareFormCallback");
-        return;
+    std::shared_ptr<ShareFormCallBack> callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(shareFormCallbackMutex_);
+        auto iter = shareFormCallbackMap_.find(requestCode);
+        if (iter == shareFormCallbackMap_.end()) {
+            HILOG_DEBUG("invalid shareFormCallback");
+            return;
+        }
+        callback = iter->second;
+        shareFormCallbackMap_.erase(iter);
     }
 
-    if (iter->second) {
-        iter->second->ProcessShareFormResponse(result);
+    if (callback) {
+        callback->ProcessShareFormResponse(result);
     }
-    shareFormCallbackMap_.erase(requestCode);
     HILOG_DEBUG("done");
 }
 
 void FormHostClient::OnError(int32_t errorCode, const std::string &errorMsg)
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    HILOG_ERROR("Receive error form FMS, errorCode:%{public}d, errorMsg:%{public}s, etsFormIds_ size:%{public}zu",
+    FormCallbacksList formCallbacksList;
+    for (auto &shard : callbackShards_) {
+        std::lock_guard<std::mutex> lock(shard.callbackMutex);
+        for (auto formIdIter = shard.etsFormIds.begin(); formIdIter != shard.etsFormIds.end();) {
+            int64_t formId = *formIdIter;
+            auto callbackMapIter = shard.formCallbackMap.find(formId);
+            if (callbackMapIter == shard.formCallbackMap.end()) {
+                HILOG_ERROR("Can't find form:%{public}" PRId64 " remove it", formId);
+                formIdIter = shard.etsFormIds.erase(formIdIter);
+                continue;
+            }
+            ++formIdIter;
+            formCallbacksList.emplace_back(formId,
+                FormCallbacks(callbackMapIter->second.begin(), callbackMapIter->second.end()));
+        }
+    }
+    HILOG_ERROR("Receive error form FMS, errorCode:%{public}d, errorMsg:%{public}s, etsFormIds size:%{public}zu",
         errorCode,
         errorMsg.c_str(),
-        etsFormIds_.size());
-    for (auto formIdIter = etsFormIds_.begin(); formIdIter != etsFormIds_.end();) {
-        int64_t formId = *formIdIter;
-        auto callbackMapIter = formCallbackMap_.find(formId);
-        if (callbackMapIter == formCallbackMap_.end()) {
-            HILOG_ERROR("Can't find form:%{public}" PRId64 " remove it", formId);
-            formIdIter = etsFormIds_.erase(formIdIter);
-            continue;
-        }
-        ++formIdIter;
+        formCallbacksList.size());
 
-        const std::set<std::shared_ptr<FormCallbackInterface>> &callbackSet = callbackMapIter->second;
-        HILOG_INFO("callbackSet.size:%{public}zu", callbackSet.size());
-        for (const auto &callback : callbackSet) {
+    for (const auto &formCallbacks : formCallbacksList) {
+        HILOG_INFO("callbackSet.size:%{public}zu", formCallbacks.second.size());
+        for (const auto &callback : formCallbacks.second) {
             if (callback == nullptr) {
                 HILOG_ERROR("null FormCallback");
                 continue;
@@ -382,21 +385,10 @@ void FormHostClient::OnError(int32_t errorCode, const std::string &errorMsg, std
 {
     HILOG_INFO("call");
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    for (auto formId : formIds) {
-        if (etsFormIds_.find(formId) == etsFormIds_.end()) {
-            continue;
-        }
-        auto callbackMapIter = formCallbackMap_.find(formId);
-        if (callbackMapIter == formCallbackMap_.end()) {
-            HILOG_ERROR("Can't find form:%{public}" PRId64 " remove it", formId);
-            etsFormIds_.erase(formId);
-            continue;
-        }
-        HILOG_ERROR("Receive error form FMS formId:%{public}s", std::to_string(formId).c_str());
-        const std::set<std::shared_ptr<FormCallbackInterface>> &callbackSet = callbackMapIter->second;
-        HILOG_DEBUG("callbackSet.size:%{public}zu", callbackSet.size());
-        for (const auto &callback : callbackSet) {
+    for (const auto &formCallbacks : GetFormCallbacks(formIds, true)) {
+        HILOG_ERROR("Receive error form FMS formId:%{public}s", std::to_string(formCallbacks.first).c_str());
+        HILOG_DEBUG("callbackSet.size:%{public}zu", formCallbacks.second.size());
+        for (const auto &callback : formCallbacks.second) {
             if (callback == nullptr) {
                 HILOG_ERROR("null FormCallback");
                 continue;
@@ -437,13 +429,7 @@ void FormHostClient::UpdateForm(const FormJsInfo &formJsInfo)
         HILOG_ERROR("the passed form id can't be negative");
         return;
     }
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    auto iter = formCallbackMap_.find(formId);
-    if (iter == formCallbackMap_.end()) {
-        HILOG_ERROR("not find formId:%{public}s", std::to_string(formId).c_str());
-        return;
-    }
-    for (const auto &callback : iter->second) {
+    for (const auto &callback : GetFormCallbacks(formId)) {
         HILOG_DEBUG("formId:%{public}" PRId64 ", jspath:%{public}s, data: %{private}s",
             formId, formJsInfo.jsFormCodePath.c_str(), formJsInfo.formData.c_str());
         if (callback == nullptr) {
@@ -463,13 +449,7 @@ void FormHostClient::OnRecycleForm(const int64_t &formId)
         HILOG_ERROR("the passed form id can't be negative");
         return;
     }
-    std::lock_guard<std::mutex> lock(callbackMutex_);
-    auto iter = formCallbackMap_.find(formId);
-    if (iter == formCallbackMap_.end()) {
-        HILOG_ERROR("can't find formId:%{public}s", std::to_string(formId).c_str());
-        return;
-    }
-    for (const auto &callback : iter->second) {
+    for (const auto &callback : GetFormCallbacks(formId)) {
         if (callback == nullptr) {
             HILOG_ERROR("null FormCallback");
             continue;
@@ -481,18 +461,8 @@ void FormHostClient::OnRecycleForm(const int64_t &formId)
 void FormHostClient::OnEnableForm(const std::vector<int64_t> &formIds, const bool enable)
 {
     HILOG_INFO("size:%{public}zu", formIds.size());
-    for (auto &formId : formIds) {
-        if (formId < 0) {
-            HILOG_ERROR("the passed form id can't be negative");
-            continue;
-        }
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        auto iter = formCallbackMap_.find(formId);
-        if (iter == formCallbackMap_.end()) {
-            HILOG_ERROR("not find formId:%{public}s", std::to_string(formId).c_str());
-            continue;
-        }
-        for (const auto& callback : iter->second) {
+    for (const auto &formCallbacks : GetFormCallbacks(formIds)) {
+        for (const auto& callback : formCallbacks.second) {
             if (!callback) {
                 HILOG_ERROR("null callback");
                 continue;
@@ -505,18 +475,8 @@ void FormHostClient::OnEnableForm(const std::vector<int64_t> &formIds, const boo
 void FormHostClient::OnLockForm(const std::vector<int64_t> &formIds, const bool lock)
 {
     HILOG_INFO("OnLockForm size:%{public}zu", formIds.size());
-    for (auto &formId : formIds) {
-        if (formId < 0) {
-            HILOG_ERROR("the passed form id can't be negative");
-            continue;
-        }
-        std::lock_guard<std::mutex> lockMutex(callbackMutex_);
-        auto iter = formCallbackMap_.find(formId);
-        if (iter == formCallbackMap_.end()) {
-            HILOG_ERROR("not find formId:%{public}s", std::to_string(formId).c_str());
-            continue;
-        }
-        for (const auto& callback : iter->second) {
+    for (const auto &formCallbacks : GetFormCallbacks(formIds)) {
+        for (const auto& callback : formCallbacks.second) {
             if (!callback) {
                 HILOG_ERROR("null callback");
                 continue;
@@ -530,20 +490,10 @@ void FormHostClient::OnDueControlForm(
     const std::vector<int64_t> &formIds, const bool isDisablePolicy, const bool isControl)
 {
     HILOG_INFO("call, size:%{public}zu", formIds.size());
-    for (auto &formId : formIds) {
-        if (formId < 0) {
-            HILOG_ERROR("the passed form id can't be negative");
-            continue;
-        }
-        std::lock_guard<std::mutex> lockMutex(callbackMutex_);
-        auto iter = formCallbackMap_.find(formId);
-        if (iter == formCallbackMap_.end()) {
-            HILOG_ERROR("not find formId:%{public}" PRId64, formId);
-            continue;
-        }
-        for (const auto& callback : iter->second) {
+    for (const auto &formCallbacks : GetFormCallbacks(formIds)) {
+        for (const auto& callback : formCallbacks.second) {
             if (!callback) {
-                HILOG_ERROR("null callback formId:%{public}" PRId64, formId);
+                HILOG_ERROR("null callback formId:%{public}" PRId64, formCallbacks.first);
                 continue;
             }
             callback->ProcessDueControlForm(isDisablePolicy, isControl);
@@ -554,25 +504,82 @@ void FormHostClient::OnDueControlForm(
 void FormHostClient::OnCheckForm(const std::vector<int64_t> &formIds)
 {
     HILOG_INFO("call, size:%{public}zu", formIds.size());
-    for (int64_t formId : formIds) {
-        if (formId < 0) {
-            HILOG_ERROR("the form id can't be negative");
+    for (const auto &formCallbacks : GetFormCallbacks(formIds)) {
+        for (const auto &callback : formCallbacks.second) {
+            if (!callback) {
+                HILOG_ERROR("null callback formId:%{public}" PRId64, formCallbacks.first);
+                continue;
+            }
+            callback->ProcessCheckForm();
+        }
+    }
+}
+
+size_t FormHostClient::GetCallbackShardIndex(int64_t formId)
+{
+    return static_cast<size_t>(static_cast<uint64_t>(formId) % CALLBACK_SHARD_COUNT);
+}
+
+FormHostClient::CallbackShard &FormHostClient::GetCallbackShard(int64_t formId)
+{
+    return callbackShards_[GetCallbackShardIndex(formId)];
+}
+
+FormHostClient::FormCallbacks FormHostClient::GetFormCallbacks(int64_t formId)
+{
+    CallbackShard &shard = GetCallbackShard(formId);
+    std::lock_guard<std::mutex> lock(shard.callbackMutex);
+    auto iter = shard.formCallbackMap.find(formId);
+    if (iter == shard.formCallbackMap.end()) {
+        HILOG_ERROR("not find formId:%{public}" PRId64, formId);
+        return {};
+    }
+    return FormCallbacks(iter->second.begin(), iter->second.end());
+}
+
+FormHostClient::FormCallbacksList FormHostClient::GetFormCallbacks(const std::vector<int64_t> &formIds,
+    bool etsOnly)
+{
+    std::array<std::vector<size_t>, CALLBACK_SHARD_COUNT> shardPositions;
+    for (size_t i = 0; i < formIds.size(); i++) {
+        if (formIds[i] < 0) {
+            HILOG_ERROR("the passed form id can't be negative");
             continue;
         }
-        std::lock_guard<std::mutex> lockMutex(callbackMutex_);
-        auto iter = formCallbackMap_.find(formId);
-        if (iter == formCallbackMap_.end()) {
-            HILOG_ERROR("not find callback formId:%{public}" PRId64, formId);
+        shardPositions[GetCallbackShardIndex(formIds[i])].push_back(i);
+    }
+
+    std::vector<FormCallbacks> callbacks(formIds.size());
+    for (size_t shardIndex = 0; shardIndex < CALLBACK_SHARD_COUNT; shardIndex++) {
+        if (shardPositions[shardIndex].empty()) {
             continue;
         }
-        for (const auto &callback : iter->second) {
-            if (!callback) {
-                HILOG_ERROR("null callback formId:%{public}" PRId64, formId);
+        CallbackShard &shard = callbackShards_[shardIndex];
+        std::lock_guard<std::mutex> lock(shard.callbackMutex);
+        for (size_t position : shardPositions[shardIndex]) {
+            int64_t formId = formIds[position];
+            if (etsOnly && shard.etsFormIds.find(formId) == shard.etsFormIds.end()) {
                 continue;
             }
-            callback->ProcessCheckForm();
+            auto iter = shard.formCallbackMap.find(formId);
+            if (iter == shard.formCallbackMap.end()) {
+                HILOG_ERROR("not find formId:%{public}" PRId64, formId);
+                if (etsOnly) {
+                    shard.etsFormIds.erase(formId);
+                }
+                continue;
+            }
+            callbacks[position].assign(iter->second.begin(), iter->second.end());
+        }
+    }
+
+    FormCallbacksList formCallbacksList;
+    for (size_t i = 0; i < formIds.size(); i++) {
+        if (!callbacks[i].empty()) {
+            formCallbacksList.emplace_back(formIds[i], std::move(callbacks[i]));
         }
     }
+    return formCallbacksList;
 }
 } // namespace AppExecFwk
 } // namespace OHOS
@@ -25,15 +25,18 @@
 
 #include "ffrt.h"
 #include "nocopyable.h"
+#include "queue/form_queue_metrics.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 namespace Common {
 
-// ffrt scheduling priority, QOS_DEADLINE_REQUEST for time-consuming critical tasks
+// ffrt scheduling priority, QOS_DEADLINE_REQUEST for time-consuming critical tasks,
+// QOS_BACKGROUND for speculative work that must not compete with them
 enum TaskQos {
     QOS_DEFAULT = 0,
-    QOS_DEADLINE_REQUEST
+    QOS_DEADLINE_REQUEST,
+    QOS_BACKGROUND
 };
 
 /**
@@ -68,6 +71,10 @@ struct TaskKeyComparator {
  * - One-shot task scheduling
  * - Delayed task scheduling with various key types
  * - Task cancellation
+ * - Depth and latency metrics, see FormQueueMetrics
+ *
+ * A delayed task removes its key from the task map once it starts, so the map only holds
+ * tasks that can still be cancelled.
  *
  * Uses std::variant (TaskKey) to unify handling of different task identifiers:
  * - int64_t: Single ID
@@ -117,13 +124,36 @@ public:
      */
     bool CancelDelayTask(const TaskKey &taskKey);
 
+    /**
+     * @brief Get the depth and latency metrics of the queue
+     * @return The metrics, registered to FormQueueMetricsRegistry
+     */
+    const std::shared_ptr<FormQueueMetrics> &GetMetrics() const
+    {
+        return metrics_;
+    }
+
 private:
+    struct DelayTask {
+        ffrt::task_handle handle;
+        // tells the task apart from a later task of the same key
+        uint64_t taskId = 0;
+    };
+
+    std::function<void()> WrapTask(std::function<void()> func, uint64_t ms, std::function<void()> onStart);
+    void RemoveStartedTask(const TaskKey &taskKey, uint64_t taskId);
+    bool CancelTaskNolock(std::map<TaskKey, DelayTask, TaskKeyComparator>::iterator iter);
+
     std::string queueName_;
-    ffrt::queue queue_;
+    std::shared_ptr<FormQueueMetrics> metrics_;
     std::mutex mutex_;
+    uint64_t taskIdSeq_ = 0;
 
     // Unified taskMap using std::variant as key
-    std::map<TaskKey, ffrt::task_handle, TaskKeyComparator> taskMap_;
+    std::map<TaskKey, DelayTask, TaskKeyComparator> taskMap_;
+
+    // declared last so it is destroyed first, the running task may still touch the task map
+    ffrt::queue queue_;
 };
 
 } // namespace Common
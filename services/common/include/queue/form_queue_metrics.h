@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_QUEUE_METRICS_H
+#define OHOS_FORM_FWK_FORM_QUEUE_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "nocopyable.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace Common {
+
+/**
+ * @brief Latency histogram with fixed millisecond buckets, lock free to record.
+ */
+class FormQueueLatencyHistogram {
+public:
+    // upper bounds of the buckets in ms, the last bucket takes everything above
+    static constexpr std::array<int64_t, 8> BUCKET_BOUNDS = { 1, 5, 10, 50, 100, 500, 1000, 5000 };
+    static constexpr size_t BUCKET_COUNT = BUCKET_BOUNDS.size() + 1;
+
+    FormQueueLatencyHistogram() = default;
+    ~FormQueueLatencyHistogram() = default;
+    DISALLOW_COPY_AND_MOVE(FormQueueLatencyHistogram);
+
+    void Record(int64_t costMs);
+
+    int64_t GetCount() const;
+
+    int64_t GetMax() const;
+
+    int64_t GetTotal() const;
+
+    int64_t GetBucketCount(size_t index) const;
+
+    void Dump(const std::string &name, std::string &result) const;
+
+private:
+    std::array<std::atomic<int64_t>, BUCKET_COUNT> buckets_ {};
+    std::atomic<int64_t> count_ = 0;
+    std::atomic<int64_t> total_ = 0;
+    std::atomic<int64_t> max_ = 0;
+};
+
+/**
+ * @brief Depth and latency statistics of one serial queue.
+ * The wait of a task is measured from the time it is due, so the requested delay is not counted.
+ */
+class FormQueueMetrics {
+public:
+    explicit FormQueueMetrics(const std::string &queueName);
+    ~FormQueueMetrics() = default;
+    DISALLOW_COPY_AND_MOVE(FormQueueMetrics);
+
+    void OnTaskSubmitted();
+
+    // the queue refused a task counted by OnTaskSubmitted
+    void OnTaskRejected();
+
+    void OnTaskCancelled();
+
+    void OnTaskStarted(int64_t waitMs);
+
+    void OnTaskFinished(int64_t costMs);
+
+    void SetDelayTaskCount(size_t count);
+
+    const std::string &GetQueueName() const
+    {
+        return queueName_;
+    }
+
+    int64_t GetDepth() const;
+
+    int64_t GetMaxDepth() const;
+
+    int64_t GetFinishedCount() const;
+
+    size_t GetDelayTaskCount() const;
+
+    const FormQueueLatencyHistogram &GetWaitHistogram() const
+    {
+        return waitHistogram_;
+    }
+
+    const FormQueueLatencyHistogram &GetExecuteHistogram() const
+    {
+        return executeHistogram_;
+    }
+
+    void Dump(std::string &result) const;
+
+private:
+    const std::string queueName_;
+    // tasks submitted and neither started nor cancelled
+    std::atomic<int64_t> depth_ = 0;
+    std::atomic<int64_t> maxDepth_ = 0;
+    std::atomic<int64_t> submittedCount_ = 0;
+    std::atomic<int64_t> cancelledCount_ = 0;
+    std::atomic<int64_t> finishedCount_ = 0;
+    std::atomic<size_t> delayTaskCount_ = 0;
+    FormQueueLatencyHistogram waitHistogram_;
+    FormQueueLatencyHistogram executeHistogram_;
+};
+
+/**
+ * @class FormQueueMetricsRegistry
+ * Process-wide list of the queue metrics, read by the dump of the process.
+ */
+class FormQueueMetricsRegistry final : public DelayedRefSingleton<FormQueueMetricsRegistry> {
+    DECLARE_DELAYED_REF_SINGLETON(FormQueueMetricsRegistry)
+public:
+    DISALLOW_COPY_AND_MOVE(FormQueueMetricsRegistry);
+
+    void Register(const std::shared_ptr<FormQueueMetrics> &metrics);
+
+    /**
+     * @brief Dump the metrics of the living queues, in registration order.
+     * @param result The dump result, appended.
+     */
+    void Dump(std::string &result);
+
+private:
+    std::mutex metricsMutex_;
+    std::vector<std::weak_ptr<FormQueueMetrics>> metrics_;
+};
+
+} // namespace Common
+} // namespace AppExecFwk
+} // namespace OHOS
+
+#endif // OHOS_FORM_FWK_FORM_QUEUE_METRICS_H
@@ -15,6 +15,7 @@
 
 #include "queue/form_base_serial_queue.h"
 
+#include <chrono>
 #include <limits>
 
 #include "fms_log_wrapper.h"
@@ -32,6 +33,8 @@ int Convert2FfrtQos(TaskQos qos)
             return ffrt::qos_default;
         case TaskQos::QOS_DEADLINE_REQUEST:
             return ffrt::qos_deadline_request;
+        case TaskQos::QOS_BACKGROUND:
+            return ffrt::qos_background;
         default:
             break;
     }
@@ -40,9 +43,10 @@ int Convert2FfrtQos(TaskQos qos)
 }
 
 FormBaseSerialQueue::FormBaseSerialQueue(const std::string &queueName)
-    : queueName_(queueName), queue_(queueName.c_str())
+    : queueName_(queueName), metrics_(std::make_shared<FormQueueMetrics>(queueName)), queue_(queueName.c_str())
 {
     HILOG_DEBUG("create FormBaseSerialQueue, queueName: %{public}s", queueName.c_str());
+    FormQueueMetricsRegistry::GetInstance().Register(metrics_);
 }
 
 FormBaseSerialQueue::~FormBaseSerialQueue()
@@ -50,11 +54,12 @@ FormBaseSerialQueue::~FormBaseSerialQueue()
     HILOG_DEBUG("destroy FormBaseSerialQueue");
     std::lock_guard<std::mutex> lock(mutex_);
     for (auto &it : taskMap_) {
-        if (it.second != nullptr) {
-            queue_.cancel(it.second);
+        if (it.second.handle != nullptr && queue_.cancel(it.second.handle) == 0) {
+            metrics_->OnTaskCancelled();
         }
     }
     taskMap_.clear();
+    metrics_->SetDelayTaskCount(0);
 }
 
 bool FormBaseSerialQueue::ScheduleTask(uint64_t ms, std::function<void()> func, TaskQos qos)
@@ -66,10 +71,12 @@ bool FormBaseSerialQueue::ScheduleTask(uint64_t ms, std::function<void()> func,
     }
 
     std::lock_guard<std::mutex> lock(mutex_);
-    ffrt::task_handle handle = queue_.submit_h(func,
+    metrics_->OnTaskSubmitted();
+    ffrt::task_handle handle = queue_.submit_h(WrapTask(std::move(func), ms, nullptr),
         ffrt::task_attr().delay(ms * CONVERSION_FACTOR).qos(Convert2FfrtQos(qos)));
     if (handle == nullptr) {
         HILOG_ERROR("submit_h return null");
+        metrics_->OnTaskRejected();
         return false;
     }
     return true;
@@ -89,18 +96,25 @@ bool FormBaseSerialQueue::ScheduleDelayTask(const TaskKey& taskKey,
     // If a task with the same key exists, cancel it first
     auto it = taskMap_.find(taskKey);
     if (it != taskMap_.end()) {
-        queue_.cancel(it->second);
-        taskMap_.erase(it);
+        CancelTaskNolock(it);
     }
 
-    ffrt::task_handle handle = queue_.submit_h(func,
+    uint64_t taskId = ++taskIdSeq_;
+    auto onStart = [this, taskKey, taskId]() {
+        RemoveStartedTask(taskKey, taskId);
+    };
+    metrics_->OnTaskSubmitted();
+    ffrt::task_handle handle = queue_.submit_h(WrapTask(std::move(func), ms, std::move(onStart)),
         ffrt::task_attr().delay(ms * CONVERSION_FACTOR).qos(Convert2FfrtQos(qos)));
     if (handle == nullptr) {
         HILOG_ERROR("submit_h return null");
+        metrics_->OnTaskRejected();
+        metrics_->SetDelayTaskCount(taskMap_.size());
         return false;
     }
 
-    taskMap_[taskKey] = std::move(handle);
+    taskMap_[taskKey] = DelayTask { std::move(handle), taskId };
+    metrics_->SetDelayTaskCount(taskMap_.size());
     return true;
 }
 
@@ -114,17 +128,54 @@ bool FormBaseSerialQueue::CancelDelayTask(const TaskKey& taskKey)
         HILOG_DEBUG("task not found");
         return false;
     }
+    return CancelTaskNolock(it);
+}
+
+std::function<void()> FormBaseSerialQueue::WrapTask(std::function<void()> func, uint64_t ms,
+    std::function<void()> onStart)
+{
+    auto dueTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+    return [metrics = metrics_, func = std::move(func), onStart = std::move(onStart), dueTime]() {
+        if (onStart) {
+            onStart();
+        }
+        auto startTime = std::chrono::steady_clock::now();
+        metrics->OnTaskStarted(
+            std::chrono::duration_cast<std::chrono::milliseconds>(startTime - dueTime).count());
+        if (func) {
+            func();
+        }
+        metrics->OnTaskFinished(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime).count());
+    };
+}
 
+void FormBaseSerialQueue::RemoveStartedTask(const TaskKey &taskKey, uint64_t taskId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = taskMap_.find(taskKey);
+    // the key may already belong to a task scheduled after this one
+    if (it != taskMap_.end() && it->second.taskId == taskId) {
+        taskMap_.erase(it);
+        metrics_->SetDelayTaskCount(taskMap_.size());
+    }
+}
+
+bool FormBaseSerialQueue::CancelTaskNolock(std::map<TaskKey, DelayTask, TaskKeyComparator>::iterator iter)
+{
     bool result = true;
-    if (it->second != nullptr) {
-        int32_t ret = queue_.cancel(it->second);
+    if (iter->second.handle != nullptr) {
+        int32_t ret = queue_.cancel(iter->second.handle);
         if (ret != 0) {
             HILOG_ERROR("Failed,errCode:%{public}d", ret);
             result = false;
+        } else {
+            metrics_->OnTaskCancelled();
         }
     }
 
-    taskMap_.erase(it);
+    taskMap_.erase(iter);
+    metrics_->SetDelayTaskCount(taskMap_.size());
     return result;
 }
 
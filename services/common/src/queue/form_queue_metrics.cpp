@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "queue/form_queue_metrics.h"
+
+#include <sstream>
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace Common {
+namespace {
+void UpdateMax(std::atomic<int64_t> &maxValue, int64_t value)
+{
+    int64_t current = maxValue.load(std::memory_order_relaxed);
+    while (value > current && !maxValue.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+}
+
+void FormQueueLatencyHistogram::Record(int64_t costMs)
+{
+    if (costMs < 0) {
+        costMs = 0;
+    }
+    size_t index = 0;
+    while (index < BUCKET_BOUNDS.size() && costMs >= BUCKET_BOUNDS[index]) {
+        index++;
+    }
+    buckets_[index].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    total_.fetch_add(costMs, std::memory_order_relaxed);
+    UpdateMax(max_, costMs);
+}
+
+int64_t FormQueueLatencyHistogram::GetCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+int64_t FormQueueLatencyHistogram::GetMax() const
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+int64_t FormQueueLatencyHistogram::GetTotal() const
+{
+    return total_.load(std::memory_order_relaxed);
+}
+
+int64_t FormQueueLatencyHistogram::GetBucketCount(size_t index) const
+{
+    return index < BUCKET_COUNT ? buckets_[index].load(std::memory_order_relaxed) : 0;
+}
+
+void FormQueueLatencyHistogram::Dump(const std::string &name, std::string &result) const
+{
+    int64_t count = GetCount();
+    std::stringstream stream;
+    stream << "  " << name << " count [ " << count << " ] avg [ "
+        << (count == 0 ? 0 : GetTotal() / count) << "ms ] max [ " << GetMax()
+        << "ms ]\n   ";
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        if (i < BUCKET_BOUNDS.size()) {
+            stream << " <" << BUCKET_BOUNDS[i] << "ms:";
+        } else {
+            stream << " >=" << BUCKET_BOUNDS.back() << "ms:";
+        }
+        stream << GetBucketCount(i);
+    }
+    stream << "\n";
+    result += stream.str();
+}
+
+FormQueueMetrics::FormQueueMetrics(const std::string &queueName) : queueName_(queueName)
+{}
+
+void FormQueueMetrics::OnTaskSubmitted()
+{
+    submittedCount_.fetch_add(1, std::memory_order_relaxed);
+    int64_t depth = depth_.fetch_add(1, std::memory_order_relaxed) + 1;
+    UpdateMax(maxDepth_, depth);
+}
+
+void FormQueueMetrics::OnTaskRejected()
+{
+    submittedCount_.fetch_sub(1, std::memory_order_relaxed);
+    depth_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void FormQueueMetrics::OnTaskCancelled()
+{
+    cancelledCount_.fetch_add(1, std::memory_order_relaxed);
+    depth_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void FormQueueMetrics::OnTaskStarted(int64_t waitMs)
+{
+    depth_.fetch_sub(1, std::memory_order_relaxed);
+    waitHistogram_.Record(waitMs);
+}
+
+void FormQueueMetrics::OnTaskFinished(int64_t costMs)
+{
+    finishedCount_.fetch_add(1, std::memory_order_relaxed);
+    executeHistogram_.Record(costMs);
+}
+
+void FormQueueMetrics::SetDelayTaskCount(size_t count)
+{
+    delayTaskCount_.store(count, std::memory_order_relaxed);
+}
+
+int64_t FormQueueMetrics::GetDepth() const
+{
+    return depth_.load(std::memory_order_relaxed);
+}
+
+int64_t FormQueueMetrics::GetMaxDepth() const
+{
+    return maxDepth_.load(std::memory_order_relaxed);
+}
+
+int64_t FormQueueMetrics::GetFinishedCount() const
+{
+    return finishedCount_.load(std::memory_order_relaxed);
+}
+
+size_t FormQueueMetrics::GetDelayTaskCount() const
+{
+    return delayTaskCount_.load(std::memory_order_relaxed);
+}
+
+void FormQueueMetrics::Dump(std::string &result) const
+{
+    std::stringstream stream;
+    stream << queueName_ << ":\n";
+    stream << "  depth [ " << GetDepth() << " ] maxDepth [ " << GetMaxDepth() << " ] delayTasks [ "
+        << GetDelayTaskCount() << " ]\n";
+    stream << "  submitted [ " << submittedCount_.load(std::memory_order_relaxed) << " ] cancelled [ "
+        << cancelledCount_.load(std::memory_order_relaxed) << " ] finished [ " << GetFinishedCount() << " ]\n";
+    result += stream.str();
+    // measured from the due time, a delayed task does not count its delay
+    waitHistogram_.Dump("waitSinceDue", result);
+    executeHistogram_.Dump("execute", result);
+}
+
+FormQueueMetricsRegistry::FormQueueMetricsRegistry()
+{}
+
+FormQueueMetricsRegistry::~FormQueueMetricsRegistry()
+{}
+
+void FormQueueMetricsRegistry::Register(const std::shared_ptr<FormQueueMetrics> &metrics)
+{
+    if (metrics == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(metricsMutex_);
+    for (auto iter = metrics_.begin(); iter != metrics_.end();) {
+        if (iter->expired()) {
+            iter = metrics_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    metrics_.emplace_back(metrics);
+}
+
+void FormQueueMetricsRegistry::Dump(std::string &result)
+{
+    std::vector<std::shared_ptr<FormQueueMetrics>> metrics;
+    {
+        std::lock_guard<std::mutex> lock(metricsMutex_);
+        for (const auto &item : metrics_) {
+            auto queueMetrics = item.lock();
+            if (queueMetrics != nullptr) {
+                metrics.emplace_back(queueMetrics);
+            }
+        }
+    }
+    for (const auto &queueMetrics : metrics) {
+        queueMetrics->Dump(result);
+    }
+}
+
+} // namespace Common
+} // namespace AppExecFwk
+} // namespace OHOS
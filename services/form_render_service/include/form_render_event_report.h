@@ -33,6 +33,16 @@ struct PerformanceEventInfo {
     int64_t timeStamp = 0;
 };
 
+struct RuntimeReapStatistic {
+    uint32_t liveRuntimeCount = 0;
+    int64_t reapCount = 0;
+    int64_t reapAvgCost = 0;
+    int64_t reapMaxCost = 0;
+    int64_t recoverCount = 0;
+    int64_t recoverAvgCost = 0;
+    int64_t recoverMaxCost = 0;
+};
+
 enum class SceneType {
     CPU_SCENE_ENTRY,
 };
@@ -48,6 +58,7 @@ public:
     static void StopReleaseTimeoutReportTimer(int64_t formId);
     static void SendRuntimeMemoryLeakEvent(const std::string &bundleName, uint64_t processMemory,
         uint64_t runtimeMemory, std::vector<std::string> &formName, std::vector<uint32_t> &formLocation);
+    static void SendRuntimeReapEvent(uint64_t processMemory, const RuntimeReapStatistic &statistic);
 
 private:
     static std::string ConvertEventName(const FormEventName &eventName);
@@ -16,6 +16,9 @@
 #ifndef OHOS_FORM_FWK_FORM_RENDER_RECORD_H
 #define OHOS_FORM_FWK_FORM_RENDER_RECORD_H
 
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -26,6 +29,7 @@
 #include "form_js_info.h"
 #include "form_mgr_errors.h"
 #include "form_supply_proxy.h"
+#include "nlohmann/json.hpp"
 #include "form_renderer_group.h"
 #include "js_form_runtime.h"
 #include "want.h"
@@ -72,6 +76,34 @@ struct FormLocationInfo {
     uint32_t formLocation;
 };
 
+struct FormDataCache {
+    int32_t revision = 0;
+    std::string data;
+    nlohmann::json parsed;
+    bool isParsed = false;
+    std::map<std::string, sptr<FormAshmem>> imageDataMap;
+};
+
+struct ReapedForm {
+    std::string statusData;
+    // set when the form becomes visible and its data is requested again
+    bool isRecovering = false;
+    std::chrono::steady_clock::time_point recoverTime;
+};
+
+/**
+ * @brief Cpu time the js threads spend on one configuration update, logged once the last of them is done.
+ */
+class ConfigUpdateCpuCost {
+public:
+    ~ConfigUpdateCpuCost();
+    void Add(int64_t cpuTimeUs);
+
+private:
+    std::atomic<int64_t> cpuTimeUs_ = 0;
+    std::atomic<int32_t> threadCount_ = 0;
+};
+
 class FormRenderRecord : public std::enable_shared_from_this<FormRenderRecord> {
 public:
     /**
@@ -103,6 +135,14 @@ public:
      */
     int32_t UpdateRenderRecord(const FormJsInfo &formJsInfo, const Want &want, const sptr<IRemoteObject> hostRemoteObj);
 
+    /**
+     * @brief Apply a form data merge patch to the data cached for the form.
+     * @param formJsInfo formJsInfo, formData holds the patch and becomes the full data on success.
+     * @param want want carrying the revision of the patch and of its base.
+     * @return Returns false if the cached data is not the base of the patch.
+     */
+    bool ApplyFormDataPatch(FormJsInfo &formJsInfo, const Want &want);
+
     /**
      * @brief When all forms of an bundle are deleted, the corresponding FormRenderRecord-record needs to be removed
      * @param formId formId.
@@ -142,7 +182,7 @@ public:
     bool HasRenderFormTask();
 
     void UpdateConfiguration(const std::shared_ptr<OHOS::AppExecFwk::Configuration>& config,
-        const sptr<IFormSupply> &formSupplyClient);
+        const sptr<IFormSupply> &formSupplyClient, const std::shared_ptr<ConfigUpdateCpuCost> &cpuCost = nullptr);
 
     void SetConfiguration(const std::shared_ptr<OHOS::AppExecFwk::Configuration>& config);
 
@@ -176,6 +216,21 @@ public:
 
     void GetRuntimeMemory(std::string &bundleNames, uint64_t &runtimeSize, std::vector<std::string> &formNames,
         std::vector<uint32_t> &formLocations);
+
+    /**
+     * @brief Recycle the forms and release the js thread and the runtime, when all the forms are invisible.
+     * The status data of the forms is kept, a form is recovered when it becomes visible.
+     * @return Returns true if the runtime is released.
+     */
+    bool ReapRuntime();
+
+    bool IsRuntimeAlive();
+
+    /**
+     * @brief Get the time of the last render, visibility change or recovery.
+     * @return Returns the steady clock time in ms.
+     */
+    int64_t GetLastActiveTime() const;
 private:
     class RemoteObjHash {
     public:
@@ -190,6 +245,20 @@ private:
 
     bool CreateRuntime(const FormJsInfo &formJsInfo);
 
+    /**
+     * @brief Build the options a runtime of the bundle is created with.
+     * @param formJsInfo The form js info of the first form.
+     * @param options The options of the runtime.
+     */
+    void BuildRuntimeOptions(const FormJsInfo &formJsInfo, AbilityRuntime::Runtime::Options &options);
+
+    /**
+     * @brief Bind the runtime claimed from FormRuntimePool to the bundle with the options of a cold start,
+     * in the js thread.
+     * @param options The options built by BuildRuntimeOptions.
+     */
+    void BindPrewarmedRuntime(const AbilityRuntime::Runtime::Options &options);
+
     bool UpdateRuntime(const FormJsInfo &formJsInfo);
 
     bool SetPkgContextInfoMap(const FormJsInfo &formJsInfo, AbilityRuntime::Runtime::Options &options);
@@ -223,7 +292,8 @@ private:
 
     void ReleaseHapFileHandle();
 
-    void HandleUpdateConfiguration(const std::shared_ptr<OHOS::AppExecFwk::Configuration>& config);
+    void HandleUpdateConfiguration(const std::shared_ptr<OHOS::AppExecFwk::Configuration>& config,
+        const std::shared_ptr<ConfigUpdateCpuCost> &cpuCost = nullptr);
 
     void AddWatchDogThreadMonitor();
 
@@ -258,6 +328,10 @@ private:
 
     void RecoverFormsByConfigUpdate(std::vector<int64_t> &formIds, const sptr<IFormSupply> &formSupplyClient);
 
+    /**
+     * @brief Re-add the released forms that are visible, the invisible ones are marked config stale.
+     * @param formSupplyClient The form supply client.
+     */
     void ReAddAllRecycledForms(const sptr<IFormSupply> &formSupplyClient);
 
     int32_t ReAddRecycledForms(const std::vector<FormJsInfo> &formJsInfos);
@@ -333,6 +407,19 @@ private:
 
     void RecordFormVisibility(int64_t formId, bool isVisible);
 
+    void MarkConfigStale(int64_t formId);
+    // Returns true if the form was config stale
+    bool TakeConfigStale(int64_t formId);
+    void RecoverConfigStaleReleasedForm(int64_t formId);
+    bool HasReleasedFormRequest(int64_t formId);
+
+    void MarkActive();
+    bool HandleReapInJsThread();
+    bool IsFormReaped(int64_t formId);
+    // Returns true if the form was reaped
+    bool TakeReapedForm(int64_t formId, ReapedForm &reapedForm);
+    void RecoverReapedForm(int64_t formId);
+
     void RecordFormLocation(int64_t formId, const FormLocationInfo &formLocation);
     void DeleteFormLocation(int64_t formId);
     void ParseFormLocationMap(std::vector<std::string> &formName, std::vector<uint32_t> &formLocation);
@@ -342,6 +429,10 @@ private:
         const sptr<IFormSupply> &formSupplyClient, int32_t renderType);
     void ResetFormConfiguration(const std::shared_ptr<OHOS::AppExecFwk::Configuration> &config, const Want &want);
 
+    void CacheFormData(const FormJsInfo &formJsInfo, const Want &want);
+
+    void DeleteFormDataCache(int64_t formId);
+
     pid_t jsThreadId_ = 0;
     pid_t processId_ = 0;
 
@@ -353,6 +444,11 @@ private:
     std::shared_mutex eventHandlerReset_;
     std::mutex eventHandlerMutex_;
     std::shared_ptr<JsFormRuntime> runtime_;
+    // claimed from FormRuntimePool with the js thread, becomes runtime_ on the first render
+    std::shared_ptr<JsFormRuntime> prewarmedRuntime_;
+    bool isPrewarmed_ = false;
+    std::chrono::steady_clock::time_point createTime_ = std::chrono::steady_clock::now();
+    std::atomic_bool isFirstRenderReported_ = false;
 
     // <formId, hostRemoteObj>
     std::mutex hostsMapMutex_;
@@ -373,8 +469,12 @@ private:
     std::unordered_map<int64_t, std::pair<std::vector<std::string>, std::string>> recycledFormCompIds_;
 
     std::string hapPath_;
+    // bumped by the tasks running in the js thread, read by FormRenderWatchdog
+    std::atomic<uint64_t> heartbeat_ = 0;
     std::mutex watchDogMutex_;
-    bool threadIsAlive_ = true;
+    // the heartbeat seen by the last check and whether a probe task waits for the js thread
+    uint64_t checkedHeartbeat_ = 0;
+    bool probePending_ = false;
     std::atomic_bool hasMonitor_ = false;
     std::unique_ptr<ThreadState> threadState_;
     std::mutex formSupplyMutex_;
@@ -382,12 +482,22 @@ private:
     std::atomic<int> renderFormTasksNum = 0;
     std::mutex visibilityMapMutex_;
     std::unordered_map<int64_t, bool> visibilityMap_;
+    // forms skipped by a configuration update while invisible, updated when they become visible
+    std::mutex configStaleMutex_;
+    std::unordered_set<int64_t> configStaleFormIds_;
+    std::atomic<int64_t> lastActiveTime_ = 0;
+    // forms recycled by ReapRuntime, <formId, reapedForm>
+    std::mutex reapedFormsMutex_;
+    std::unordered_map<int64_t, ReapedForm> reapedForms_;
     std::mutex formLocationMutex_;
     std::unordered_map<int64_t, FormLocationInfo> formLocationMap_;
     std::mutex formImperativeFwkMapMutex_;
     std::unordered_map<int64_t, std::string> formImperativeFwkMap_;
     std::mutex formImperativeFwkCntMapMutex_;
     std::unordered_map<std::string, int> formImperativeFwkCntMap_;
+    // <formId, last full form data>, the base of the next form data patch
+    std::mutex formDataCacheMutex_;
+    std::unordered_map<int64_t, FormDataCache> formDataCache_;
 };
 }  // namespace FormRender
 }  // namespace AppExecFwk
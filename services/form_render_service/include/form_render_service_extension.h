@@ -133,6 +133,13 @@ public:
      */
     void OnConfigurationUpdated(const AppExecFwk::Configuration& configuration) override;
 
+    /**
+     * @brief Called when the memory level of the system changes.
+     *
+     * @param level Indicates the memory level.
+     */
+    void OnMemoryLevel(int level) override;
+
 private:
     void GetSrcPath(std::string &srcPath);
 
@@ -18,6 +18,7 @@
 
 #include "form_render_stub.h"
 
+#include <atomic>
 #include <memory>
 #include <singleton.h>
 
@@ -118,6 +119,12 @@ public:
 
     int32_t SetRenderGroupParams(const int64_t formId, const Want &want);
 
+    /**
+     * @brief Called when the memory level of the system changes.
+     * @param level The memory level.
+     */
+    void OnMemoryLevel(int32_t level);
+
 private:
     void SetCriticalFalseOnAllFormInvisible();
     void FormRenderGCTask(const std::string &uid);
@@ -143,6 +150,11 @@ private:
     void InitMemoryMonitor();
     void RemoveMemoryMonitor();
     void ReportProcessMemory();
+    void SchedulePrewarmRuntime();
+    void PrewarmRuntime();
+    void ScheduleReapRuntime(int64_t delayMs);
+    void ReapRuntime();
+    void ReportRuntimeReap(uint64_t processMemory);
 
 private:
     std::mutex renderRecordMutex_;
@@ -154,12 +166,14 @@ private:
     std::shared_ptr<OHOS::AppExecFwk::Configuration> appliedConfig_;
     std::chrono::steady_clock::time_point configUpdateTime_ = std::chrono::steady_clock::now();
     std::shared_ptr<Common::FormBaseSerialQueue> serialQueue_ = nullptr;
+    std::shared_ptr<Common::FormBaseSerialQueue> prewarmQueue_ = nullptr;
     std::mutex formSupplyMutex_;
     sptr<IFormSupply> formSupplyClient_;
     bool isVerified_ = false;
     bool hasCachedConfig_ = false;
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> mainHandler_ = nullptr;
     std::function<void()> mainGcCb_ = nullptr;
+    std::atomic_bool isReapScheduled_ = false;
 };
 }  // namespace FormRender
 }  // namespace AppExecFwk
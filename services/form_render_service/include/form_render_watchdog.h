@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_RENDER_WATCHDOG_H
+#define OHOS_FORM_FWK_FORM_RENDER_WATCHDOG_H
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "singleton.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace FormRender {
+#ifdef VERIFY_PLAT_FPGA
+constexpr size_t THREAD_BLOCK_TIMEOUT = 200 * 1000;
+#else
+constexpr size_t THREAD_BLOCK_TIMEOUT = 10 * 1000;
+#endif
+
+class FormRenderRecord;
+
+/**
+ * @class FormRenderWatchdog
+ * One periodical task checks the JS threads of all the render records every THREAD_BLOCK_TIMEOUT.
+ * A thread is only probed when it has pending work and its heartbeat did not move, see FormRenderRecord::RunTask.
+ */
+class FormRenderWatchdog final : public DelayedRefSingleton<FormRenderWatchdog> {
+    DECLARE_DELAYED_REF_SINGLETON(FormRenderWatchdog)
+public:
+    DISALLOW_COPY_AND_MOVE(FormRenderWatchdog);
+
+    /**
+     * @brief Add a render record to check, the periodical task starts with the first record.
+     * @param renderRecord The render record.
+     */
+    void AddRecord(const std::shared_ptr<FormRenderRecord> &renderRecord);
+
+    /**
+     * @brief Remove a render record, the periodical task stops with the last record.
+     * @param renderRecord The render record, may be in destruction.
+     */
+    void RemoveRecord(const FormRenderRecord *renderRecord);
+
+    size_t GetRecordCount();
+
+private:
+    void CheckRecords();
+
+    std::mutex recordsMutex_;
+    std::unordered_map<const FormRenderRecord *, std::weak_ptr<FormRenderRecord>> records_;
+};
+} // namespace FormRender
+} // namespace AppExecFwk
+} // namespace OHOS
+#endif // OHOS_FORM_FWK_FORM_RENDER_WATCHDOG_H
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_RUNTIME_POOL_H
+#define OHOS_FORM_FWK_FORM_RUNTIME_POOL_H
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "event_handler.h"
+#include "js_form_runtime.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace FormRender {
+/**
+ * @brief A js thread whose runtime is initialized with the ArkUI modules loaded, not bound to any bundle yet.
+ */
+struct PrewarmedRuntime {
+    std::shared_ptr<EventRunner> eventRunner;
+    std::shared_ptr<EventHandler> eventHandler;
+    // created and released in the js thread
+    std::shared_ptr<JsFormRuntime> runtime;
+};
+
+/**
+ * @class FormRuntimePool
+ * Pre-warmed js threads claimed by the render records of new bundles, so that the first render does not wait
+ * for the thread and the runtime to start. The pool is refilled in the background and emptied on low memory.
+ */
+class FormRuntimePool final : public DelayedRefSingleton<FormRuntimePool> {
+    DECLARE_DELAYED_REF_SINGLETON(FormRuntimePool)
+public:
+    DISALLOW_COPY_AND_MOVE(FormRuntimePool);
+
+    /**
+     * @brief Claim a pre-warmed runtime.
+     * @return The pre-warmed runtime, nullptr if the pool is empty.
+     */
+    std::shared_ptr<PrewarmedRuntime> Acquire();
+
+    /**
+     * @brief Warm runtimes up to the capacity and the memory budget of the pool, blocks until they are initialized.
+     */
+    void Refill();
+
+    /**
+     * @brief Release all the idle runtimes.
+     */
+    void Clear();
+
+    /**
+     * @brief The pool is emptied and not refilled while the memory level is low or critical.
+     * @param level The memory level of the system.
+     */
+    void OnMemoryLevel(int32_t level);
+
+    /**
+     * @brief Set the number of runtimes to keep warm, 0 disables the pool.
+     * @param capacity The number of runtimes.
+     */
+    void SetCapacity(size_t capacity);
+
+    size_t GetIdleCount();
+
+private:
+    bool IsRefillAllowedNolock();
+    std::shared_ptr<PrewarmedRuntime> CreatePrewarmedRuntime();
+    void DestroyPrewarmedRuntime(const std::shared_ptr<PrewarmedRuntime> &prewarmed);
+
+    std::mutex poolMutex_;
+    std::deque<std::shared_ptr<PrewarmedRuntime>> idleRuntimes_;
+    size_t capacity_ = 0;
+    bool isMemoryLow_ = false;
+};
+} // namespace FormRender
+} // namespace AppExecFwk
+} // namespace OHOS
+#endif // OHOS_FORM_FWK_FORM_RUNTIME_POOL_H
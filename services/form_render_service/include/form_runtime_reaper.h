@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_RUNTIME_REAPER_H
+#define OHOS_FORM_FWK_FORM_RUNTIME_REAPER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "queue/form_queue_metrics.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace FormRender {
+class FormRenderRecord;
+
+/**
+ * @class FormRuntimeReaper
+ * Bounds the number of live js threads of the render records. Once the live runtimes exceed the limit, the
+ * least recently active records whose forms have all been invisible for the idle time are reaped, see
+ * FormRenderRecord::ReapRuntime. Records with a visible form are never reaped.
+ */
+class FormRuntimeReaper final : public DelayedRefSingleton<FormRuntimeReaper> {
+    DECLARE_DELAYED_REF_SINGLETON(FormRuntimeReaper)
+public:
+    DISALLOW_COPY_AND_MOVE(FormRuntimeReaper);
+
+    /**
+     * @brief Select the records to reap, least recently active first.
+     * @param renderRecords All the render records.
+     * @param nextCheckDelayMs Out, the delay after which more records become idle enough to reap, 0 if none.
+     * @return The records to reap.
+     */
+    std::vector<std::shared_ptr<FormRenderRecord>> SelectReapRecords(
+        const std::vector<std::shared_ptr<FormRenderRecord>> &renderRecords, int64_t &nextCheckDelayMs);
+
+    /**
+     * @brief All the idle runtimes are reaped regardless of the limit while the memory level is low or critical.
+     * @param level The memory level of the system.
+     */
+    void OnMemoryLevel(int32_t level);
+
+    void SetMaxLiveRuntimes(size_t maxLiveRuntimes);
+
+    void SetIdleTime(int64_t idleTimeMs);
+
+    int64_t GetIdleTime();
+
+    void OnRuntimeReaped(int64_t costMs);
+
+    void OnFormRecovered(int64_t costMs);
+
+    size_t GetLiveRuntimeCount() const;
+
+    const Common::FormQueueLatencyHistogram &GetReapHistogram() const
+    {
+        return reapHistogram_;
+    }
+
+    const Common::FormQueueLatencyHistogram &GetRecoverHistogram() const
+    {
+        return recoverHistogram_;
+    }
+
+private:
+    std::mutex reaperMutex_;
+    size_t maxLiveRuntimes_ = 0;
+    int64_t idleTimeMs_ = 0;
+    bool isMemoryLow_ = false;
+    // counted by the last selection
+    std::atomic<size_t> liveRuntimeCount_ = 0;
+    Common::FormQueueLatencyHistogram reapHistogram_;
+    // from the form becoming visible to the form recovered in the js thread
+    Common::FormQueueLatencyHistogram recoverHistogram_;
+};
+} // namespace FormRender
+} // namespace AppExecFwk
+} // namespace OHOS
+#endif // OHOS_FORM_FWK_FORM_RUNTIME_REAPER_H
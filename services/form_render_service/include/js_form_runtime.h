@@ -26,6 +26,10 @@ namespace FormRender {
 class JsFormRuntime : public AbilityRuntime::JsRuntime {
 public:
     ~JsFormRuntime();
+    bool Init(const Options &options);
+    bool IsBindable(const Options &options) const;
+    void BindBundle(const Options &options);
+    const Options &GetOptions() const;
     void SetLocalFontCollectionMaxSize();
     bool InsertHapPath(
         const std::string& bundleName, const std::string& moduleName, const std::string& hapPath);
@@ -35,6 +39,8 @@ public:
 private:
     std::string bundleName_;
     std::unordered_set<std::string> moduleNameSet_;
+    // the options the runtime was initialized with, and the bundle options bound to it afterwards
+    Options options_;
 };
 }  // namespace FormRender
 }  // namespace AppExecFwk
@@ -37,6 +37,13 @@ constexpr const char *EVENT_KEY_ERROR_CODE = "ERROR_CODE";
 constexpr const char *EVENT_KEY_PROCESS_MEMORY = "PROCESS_MEMORY";
 constexpr const char *EVENT_KEY_BUNDLE_MEMORY = "BUNDLE_MEMORY";
 constexpr const char *EVENT_KEY_FORM_LOCATION = "FORM_LOCATION";
+constexpr const char *EVENT_KEY_LIVE_RUNTIME_COUNT = "LIVE_RUNTIME_COUNT";
+constexpr const char *EVENT_KEY_REAP_COUNT = "REAP_COUNT";
+constexpr const char *EVENT_KEY_REAP_AVG_COST = "REAP_AVG_COST";
+constexpr const char *EVENT_KEY_REAP_MAX_COST = "REAP_MAX_COST";
+constexpr const char *EVENT_KEY_RECOVER_COUNT = "RECOVER_COUNT";
+constexpr const char *EVENT_KEY_RECOVER_AVG_COST = "RECOVER_AVG_COST";
+constexpr const char *EVENT_KEY_RECOVER_MAX_COST = "RECOVER_MAX_COST";
 constexpr const char *INVALIDEVENTNAME = "INVALIDEVENTNAME";
 constexpr int64_t RECYCLE_FORM_FAILED = 1;
 constexpr int64_t WAIT_RELEASE_RENDERER_ERROR_CODE = 400;
@@ -152,5 +159,24 @@ void FormRenderEventReport::SendRuntimeMemoryLeakEvent(const std::string &bundle
     builder.InsertParam(EVENT_KEY_FORM_LOCATION, formLocation);
     builder.Write("FORM_MANAGER", "FORM_MEMORY_LEAK", HISYSEVENT_STATISTIC);
 }
+
+void FormRenderEventReport::SendRuntimeReapEvent(uint64_t processMemory, const RuntimeReapStatistic &statistic)
+{
+    HILOG_INFO("live runtimes: %{public}u, reaped: %{public}" PRId64 " avg %{public}" PRId64 "ms max %{public}" PRId64
+        "ms, recovered: %{public}" PRId64 " avg %{public}" PRId64 "ms max %{public}" PRId64 "ms",
+        statistic.liveRuntimeCount, statistic.reapCount, statistic.reapAvgCost, statistic.reapMaxCost,
+        statistic.recoverCount, statistic.recoverAvgCost, statistic.recoverMaxCost);
+
+    FormHiSysEventBuilder builder;
+    builder.InsertParam(EVENT_KEY_PROCESS_MEMORY, processMemory);
+    builder.InsertParam(EVENT_KEY_LIVE_RUNTIME_COUNT, statistic.liveRuntimeCount);
+    builder.InsertParam(EVENT_KEY_REAP_COUNT, statistic.reapCount);
+    builder.InsertParam(EVENT_KEY_REAP_AVG_COST, statistic.reapAvgCost);
+    builder.InsertParam(EVENT_KEY_REAP_MAX_COST, statistic.reapMaxCost);
+    builder.InsertParam(EVENT_KEY_RECOVER_COUNT, statistic.recoverCount);
+    builder.InsertParam(EVENT_KEY_RECOVER_AVG_COST, statistic.recoverAvgCost);
+    builder.InsertParam(EVENT_KEY_RECOVER_MAX_COST, statistic.recoverMaxCost);
+    builder.Write("FORM_MANAGER", "FORM_RUNTIME_REAP", HISYSEVENT_STATISTIC);
+}
 } // namespace AppExecFwk
 } // namespace OHOS
\ No newline at end of file
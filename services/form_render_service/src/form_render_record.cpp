@@ -16,7 +16,9 @@
 #include "form_render_record.h"
 
 #include <chrono>
+#include <cinttypes>
 #include <cstdio>
+#include <ctime>
 #include <iostream>
 #include <securec.h>
 #include <string>
@@ -24,6 +26,7 @@
 #include <unistd.h>
 #include <utility>
 #include <fstream>
+#include <pthread.h>
 #include <sstream>
 
 #include "configuration_convertor.h"
@@ -41,6 +44,9 @@
 #include "form_module_checker.h"
 #include "form_render_event_report.h"
 #include "form_render_service_mgr.h"
+#include "form_render_watchdog.h"
+#include "form_runtime_pool.h"
+#include "form_runtime_reaper.h"
 #include "form_scoped_qos_promotion.h"
 #include "status_mgr_center/form_render_status_task_mgr.h"
 
@@ -56,18 +62,14 @@ using namespace OHOS::AppExecFwk::ConfigurationInner;
 constexpr int32_t RENDER_FORM_FAILED = -1;
 constexpr int32_t RELOAD_FORM_FAILED = -1;
 constexpr int32_t RECYCLE_FORM_FAILED = -1;
-#ifdef VERIFY_PLAT_FPGA
-constexpr size_t THREAD_BLOCK_TIMEOUT = 200 * 1000;
-#else
-constexpr size_t THREAD_BLOCK_TIMEOUT = 10 * 1000;
-#endif
 constexpr int32_t SET_RENDERGROUPENABLEFLAG_CHANGE_FAILED = -1;
 constexpr int32_t SET_VISIBLE_CHANGE_FAILED = -1;
 constexpr int32_t CHECK_THREAD_TIME = 3;
 constexpr size_t THREAD_NAME_LEN = 15;
 constexpr const char *FORM_RENDERER_PROCESS_ON_ADD_SURFACE = "ohos.extra.param.key.process_on_add_surface";
-constexpr const char *RENDERING_BLOCK_MONITOR_PREFIX = "RenderingBlockMonitorTask_";
 constexpr const char *MEMORY_MONITOR_PREFIX = "MemoryMonitorTask_";
+constexpr int64_t US_PER_SECOND = 1000000;
+constexpr int64_t NS_PER_US = 1000;
 
 const static std::unordered_map<std::string, int> FORM_IMPERATIVE_MAP = {
     {Constants::TEMPLATE_FORM_IMPERATIVE_FWK_LITE, 0},
@@ -81,6 +83,15 @@ inline std::string GetThreadNameByBundle(const std::string &bundleName)
     }
     return bundleName.substr(bundleName.length() - THREAD_NAME_LEN);
 }
+
+int64_t GetThreadCpuTimeUs()
+{
+    struct timespec ts = {};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(ts.tv_sec) * US_PER_SECOND + ts.tv_nsec / NS_PER_US;
+}
 }
 
 ThreadState::ThreadState(int32_t maxState) : maxState_(maxState) {}
@@ -121,6 +132,18 @@ std::string HandlerDumper::GetDumpInfo()
     return dumpInfo_;
 }
 
+ConfigUpdateCpuCost::~ConfigUpdateCpuCost()
+{
+    HILOG_INFO("configuration updated on %{public}d js threads, cpu cost:%{public}" PRId64 "us",
+        threadCount_.load(), cpuTimeUs_.load());
+}
+
+void ConfigUpdateCpuCost::Add(int64_t cpuTimeUs)
+{
+    cpuTimeUs_.fetch_add(cpuTimeUs, std::memory_order_relaxed);
+    threadCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
 std::shared_ptr<FormRenderRecord> FormRenderRecord::Create(
     const std::string &bundleName, const std::string &uid, bool needMonitored, sptr<IFormSupply> client)
 {
@@ -215,6 +238,7 @@ void FormRenderRecord::HandleDeleteRendererGroup(int64_t formId)
     std::lock_guard<std::mutex> lock(formRendererGroupMutex_);
     formRendererGroupMap_.erase(formId);
     DeleteFormLocation(formId);
+    TakeConfigStale(formId);
 }
 
 bool FormRenderRecord::CreateEventHandler(const std::string &bundleName, bool needMonitored)
@@ -225,7 +249,14 @@ bool FormRenderRecord::CreateEventHandler(const std::string &bundleName, bool ne
     }
     // Create event runner
     if (eventRunner_ == nullptr) {
-        eventRunner_ = EventRunner::Create(GetThreadNameByBundle(bundleName));
+        auto prewarmed = FormRuntimePool::GetInstance().Acquire();
+        if (prewarmed != nullptr) {
+            eventRunner_ = prewarmed->eventRunner;
+            prewarmedRuntime_ = prewarmed->runtime;
+            isPrewarmed_ = true;
+        } else {
+            eventRunner_ = EventRunner::Create(GetThreadNameByBundle(bundleName));
+        }
         if (eventRunner_ == nullptr) {
             HILOG_ERROR("Create event runner Failed");
             return false;
@@ -265,20 +296,13 @@ void FormRenderRecord::AddWatchDogThreadMonitor()
     HILOG_INFO("add watchDog monitor, bundleName is %{public}s, uid is %{public}s",
         bundleName_.c_str(), uid_.c_str());
 
-    auto threadBlockMonitorTask = [weak = weak_from_this()]() {
-        auto renderRecord = weak.lock();
-        if (renderRecord) {
-            renderRecord->Timer();
-        }
-    };
-    OHOS::HiviewDFX::Watchdog::GetInstance().RunPeriodicalTask(RENDERING_BLOCK_MONITOR_PREFIX + bundleName_,
-        threadBlockMonitorTask, THREAD_BLOCK_TIMEOUT);
+    FormRenderWatchdog::GetInstance().AddRecord(shared_from_this());
 }
 
 void FormRenderRecord::RemoveWatchDogThreadMonitor()
 {
     HILOG_INFO("remove watchDog monitor, bundleName: %{public}s", bundleName_.c_str());
-    OHOS::HiviewDFX::Watchdog::GetInstance().RemovePeriodicalTask(RENDERING_BLOCK_MONITOR_PREFIX + bundleName_);
+    FormRenderWatchdog::GetInstance().RemoveRecord(this);
     OHOS::HiviewDFX::Watchdog::GetInstance().RemovePeriodicalTask(MEMORY_MONITOR_PREFIX + bundleName_);
 }
 
@@ -334,7 +358,16 @@ TaskState FormRenderRecord::RunTask()
     }
 
     std::unique_lock<std::mutex> lock(watchDogMutex_);
-    if (!threadIsAlive_) {
+    uint64_t heartbeat = heartbeat_.load(std::memory_order_relaxed);
+    if (heartbeat != checkedHeartbeat_) {
+        // the js thread ran tasks since the last check
+        checkedHeartbeat_ = heartbeat;
+        probePending_ = false;
+        threadState_->ResetState();
+        return TaskState::RUNNING;
+    }
+
+    if (probePending_) {
         threadState_->NextState();
         HILOG_INFO("FRS block happened with threadState is %{public}d when bundleName is %{public}s",
             threadState_->GetCurrentState(), bundleName_.c_str());
@@ -342,7 +375,13 @@ TaskState FormRenderRecord::RunTask()
         return threadState_->IsMaxState() ? TaskState::BLOCK : TaskState::RUNNING;
     }
 
-    threadIsAlive_ = false;
+    if (eventHandler->IsIdle()) {
+        // nothing to run, do not wake the js thread up
+        return TaskState::NO_RUNNING;
+    }
+
+    // pending work without progress, the probe tells whether the js thread still runs tasks
+    probePending_ = true;
     std::weak_ptr<FormRenderRecord> thisWeakPtr(shared_from_this());
     auto checkTask = [thisWeakPtr] () {
         auto renderRecord = thisWeakPtr.lock();
@@ -378,9 +417,7 @@ void FormRenderRecord::DumpEventHandler()
 
 void FormRenderRecord::MarkThreadAlive()
 {
-    std::unique_lock<std::mutex> lock(watchDogMutex_);
-    threadIsAlive_ = true;
-    threadState_->ResetState();
+    heartbeat_.fetch_add(1, std::memory_order_relaxed);
 }
 
 void FormRenderRecord::MarkRenderFormTaskDone(int32_t renderType)
@@ -409,9 +446,20 @@ int32_t FormRenderRecord::UpdateRenderRecord(const FormJsInfo &formJsInfo, const
         bool formIsVisible = want.GetBoolParam(Constants::FORM_IS_VISIBLE, false);
         RecordFormVisibility(formJsInfo.formId, formIsVisible);
     }
+    MarkActive();
     int32_t formLocation = want.GetIntParam(Constants::FORM_LOCATION_KEY, -1);
     FormLocationInfo location = { formJsInfo.formName, formLocation };
     RecordFormLocation(formJsInfo.formId, location);
+    CacheFormData(formJsInfo, want);
+    if (renderType != Constants::RENDER_FORM && !IsFormVisible(formJsInfo.formId) &&
+        IsFormReaped(formJsInfo.formId)) {
+        // the form data is requested again when the form becomes visible
+        HILOG_INFO("skip update of reaped form, formId:%{public}" PRId64, formJsInfo.formId);
+        std::string eventId = want.GetStringParam(Constants::FORM_STATUS_EVENT_ID);
+        FormRenderStatusTaskMgr::GetInstance().OnRenderFormDone(formJsInfo.formId,
+            FormFsmEvent::RENDER_FORM_DONE, eventId, GetFormSupplyClient());
+        return AddHostByFormId(formJsInfo.formId, hostRemoteObj);
+    }
     {
         // Some resources need to be initialized in a JS thread
         if (GetEventHandler(true, formJsInfo.isDynamic) == nullptr) {
@@ -450,12 +498,77 @@ int32_t FormRenderRecord::UpdateRenderRecord(const FormJsInfo &formJsInfo, const
     return AddHostByFormId(formJsInfo.formId, hostRemoteObj);
 }
 
+void FormRenderRecord::CacheFormData(const FormJsInfo &formJsInfo, const Want &want)
+{
+    if (want.HasParameter(Constants::FORM_DATA_PATCH_BASE_REVISION)) {
+        // already cached by ApplyFormDataPatch
+        return;
+    }
+    int32_t revision = want.GetIntParam(Constants::FORM_DATA_REVISION, 0);
+    std::lock_guard<std::mutex> lock(formDataCacheMutex_);
+    if (revision == 0) {
+        formDataCache_.erase(formJsInfo.formId);
+        return;
+    }
+    FormDataCache &cache = formDataCache_[formJsInfo.formId];
+    cache.revision = revision;
+    cache.data = formJsInfo.formData;
+    cache.parsed = nlohmann::json();
+    cache.isParsed = false;
+    cache.imageDataMap = formJsInfo.imageDataMap;
+}
+
+bool FormRenderRecord::ApplyFormDataPatch(FormJsInfo &formJsInfo, const Want &want)
+{
+    int32_t baseRevision = want.GetIntParam(Constants::FORM_DATA_PATCH_BASE_REVISION, 0);
+    int32_t revision = want.GetIntParam(Constants::FORM_DATA_REVISION, 0);
+    std::lock_guard<std::mutex> lock(formDataCacheMutex_);
+    auto iter = formDataCache_.find(formJsInfo.formId);
+    if (iter == formDataCache_.end() || iter->second.revision != baseRevision) {
+        HILOG_WARN("formId:%{public}" PRId64 " patch base %{public}d not cached", formJsInfo.formId, baseRevision);
+        formDataCache_.erase(formJsInfo.formId);
+        return false;
+    }
+    FormDataCache &cache = iter->second;
+    if (!cache.isParsed) {
+        cache.parsed = nlohmann::json::parse(cache.data, nullptr, false);
+        cache.isParsed = true;
+    }
+    nlohmann::json patch = nlohmann::json::parse(formJsInfo.formData, nullptr, false);
+    if (cache.parsed.is_discarded() || patch.is_discarded()) {
+        HILOG_ERROR("formId:%{public}" PRId64 " invalid form data patch", formJsInfo.formId);
+        formDataCache_.erase(iter);
+        return false;
+    }
+    cache.parsed.merge_patch(patch);
+    cache.data = cache.parsed.dump();
+    cache.revision = revision;
+    for (const auto &image : formJsInfo.imageDataMap) {
+        cache.imageDataMap[image.first] = image.second;
+    }
+    formJsInfo.formData = cache.data;
+    formJsInfo.imageDataMap = cache.imageDataMap;
+    return true;
+}
+
+void FormRenderRecord::DeleteFormDataCache(int64_t formId)
+{
+    std::lock_guard<std::mutex> lock(formDataCacheMutex_);
+    formDataCache_.erase(formId);
+}
+
 void FormRenderRecord::HandleUpdateRenderRecord(const FormJsInfo &formJsInfo, const Want &want,
     const sptr<IFormSupply> &formSupplyClient, int32_t renderType)
 {
     FormScopedQosPromotion scopedPromotion(want.GetIntParam(Constants::FORM_LOCATION_KEY, -1));
     HandleUpdateInJsThread(formJsInfo, want);
     MarkRenderFormTaskDone(renderType);
+    if (renderType == Constants::RENDER_FORM && !isFirstRenderReported_.exchange(true)) {
+        auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - createTime_).count();
+        HILOG_INFO("first render of %{public}s cost %{public}" PRId64 "ms, prewarmed:%{public}d",
+            bundleName_.c_str(), static_cast<int64_t>(cost), isPrewarmed_);
+    }
     std::string eventId = want.GetStringParam(Constants::FORM_STATUS_EVENT_ID);
     FormRenderStatusTaskMgr::GetInstance().OnRenderFormDone(formJsInfo.formId,
         FormFsmEvent::RENDER_FORM_DONE, eventId, formSupplyClient);
@@ -471,6 +584,7 @@ void FormRenderRecord::DeleteRenderRecord(int64_t formId, const std::string &com
 {
     // Some resources need to be deleted in a JS thread
     HILOG_INFO("Delete some resources formId:%{public}" PRId64 ",%{public}s", formId, compId.c_str());
+    DeleteFormDataCache(formId);
     std::shared_ptr<EventHandler> eventHandler = GetEventHandler();
     if (eventHandler == nullptr) {
         HILOG_ERROR("null eventHandler");
@@ -533,28 +647,27 @@ bool FormRenderRecord::CreateRuntime(const FormJsInfo &formJsInfo)
     }
 
     AbilityRuntime::Runtime::Options options;
-    options.bundleName = formJsInfo.bundleName;
-    options.codePath = Constants::LOCAL_CODE_PATH;
-    BundleInfo bundleInfo;
-    options.eventRunner = eventRunner_;
-    options.hapPath = formJsInfo.jsFormCodePath;
-    options.loadAce = true;
-    options.isBundle = true;
-    options.isUnique = true;
-    options.moduleCheckerDelegate = std::make_shared<FormModuleChecker>();
-
-    SetPkgContextInfoMap(formJsInfo, options);
-
-    runtime_ = std::make_shared<JsFormRuntime>();
-    if (runtime_ == nullptr) {
-        HILOG_ERROR("Create runtime Failed");
-        return false;
-    }
-    if (!runtime_->Init(options)) {
-        HILOG_ERROR("Init runtime Failed");
+    BuildRuntimeOptions(formJsInfo, options);
+    if (prewarmedRuntime_ != nullptr && !prewarmedRuntime_->IsBindable(options)) {
+        HILOG_WARN("prewarmed runtime does not match %{public}s, cold start", formJsInfo.bundleName.c_str());
+        prewarmedRuntime_.reset();
+        isPrewarmed_ = false;
+    }
+    if (prewarmedRuntime_ != nullptr) {
+        runtime_ = std::move(prewarmedRuntime_);
+        BindPrewarmedRuntime(options);
+    } else {
+        runtime_ = std::make_shared<JsFormRuntime>();
+        if (runtime_ == nullptr) {
+            HILOG_ERROR("Create runtime Failed");
+            return false;
+        }
+        if (!runtime_->Init(options)) {
+            HILOG_ERROR("Init runtime Failed");
+        }
+        runtime_->SetLocalFontCollectionMaxSize();
     }
     hapPath_ = formJsInfo.jsFormCodePath;
-    runtime_->SetLocalFontCollectionMaxSize();
     RegisterResolveBufferCallback();
     bool ret = runtime_->InsertHapPath(formJsInfo.bundleName, formJsInfo.moduleName, formJsInfo.jsFormCodePath);
     if (!ret) {
@@ -575,6 +688,27 @@ bool FormRenderRecord::CreateRuntime(const FormJsInfo &formJsInfo)
     return true;
 }
 
+void FormRenderRecord::BuildRuntimeOptions(const FormJsInfo &formJsInfo, AbilityRuntime::Runtime::Options &options)
+{
+    options.bundleName = formJsInfo.bundleName;
+    options.codePath = Constants::LOCAL_CODE_PATH;
+    options.eventRunner = eventRunner_;
+    options.hapPath = formJsInfo.jsFormCodePath;
+    options.loadAce = true;
+    options.isBundle = true;
+    options.isUnique = true;
+    options.moduleCheckerDelegate = std::make_shared<FormModuleChecker>();
+
+    SetPkgContextInfoMap(formJsInfo, options);
+}
+
+void FormRenderRecord::BindPrewarmedRuntime(const AbilityRuntime::Runtime::Options &options)
+{
+    HILOG_INFO("bind prewarmed runtime to %{public}s", options.bundleName.c_str());
+    pthread_setname_np(pthread_self(), GetThreadNameByBundle(bundleName_).c_str());
+    runtime_->BindBundle(options);
+}
+
 bool FormRenderRecord::UpdateRuntime(const FormJsInfo &formJsInfo)
 {
     if (IsFormContextExist(formJsInfo)) {
@@ -830,6 +964,10 @@ std::shared_ptr<Ace::FormRendererGroup> FormRenderRecord::GetFormRendererGroup(c
         HILOG_INFO("formRendererGroupMap emplace formId:%{public}s", std::to_string(key).c_str());
         formRendererGroupMap_.emplace(key, formRendererGroup);
         RecordFormVisibility(key, true);
+        // a new group is created with the current configuration of the context
+        TakeConfigStale(key);
+        ReapedForm reapedForm;
+        TakeReapedForm(key, reapedForm);
     }
     return formRendererGroup;
 }
@@ -916,6 +1054,8 @@ int32_t FormRenderRecord::HandleUpdateForm(const FormJsInfo &formJsInfo, const W
         }
     }
 
+    ReapedForm reapedForm;
+    bool isReaped = TakeReapedForm(formJsInfo.formId, reapedForm);
     bool isDynamicFormNeedRecover = false;
     for (const auto& iter : formRequests) {
         auto formRequest = iter.second;
@@ -935,10 +1075,20 @@ int32_t FormRenderRecord::HandleUpdateForm(const FormJsInfo &formJsInfo, const W
 
     if (isDynamicFormNeedRecover) {
         std::string statusData = want.GetStringParam(Constants::FORM_STATUS_DATA);
+        if (statusData.empty() && isReaped) {
+            statusData = reapedForm.statusData;
+        }
         bool isHandleClickEvent = false;
         HandleRecoverForm(formJsInfo, statusData, isHandleClickEvent);
     }
 
+    if (isReaped && reapedForm.isRecovering) {
+        auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - reapedForm.recoverTime).count();
+        FormRuntimeReaper::GetInstance().OnFormRecovered(cost);
+        HILOG_INFO("recover reaped form %{public}" PRId64 " cost %{public}" PRId64 "ms",
+            formJsInfo.formId, static_cast<int64_t>(cost));
+    }
     return ERR_OK;
 }
 
@@ -1000,6 +1150,7 @@ bool FormRenderRecord::HandleDeleteInJsThread(int64_t formId, const std::string
         search->second->DeleteForm();
         formRendererGroupMap_.erase(formId);
         DeleteFormLocation(formId);
+        TakeConfigStale(formId);
     }
     RemoveHostByFormId(formId);
     return true;
@@ -1067,6 +1218,9 @@ void FormRenderRecord::DeleteFormRequest(int64_t formId, const std::string &comp
     }
     if (isRequestEmpty) {
         DeleteRecycledFormCompIds(formId);
+        TakeConfigStale(formId);
+        ReapedForm reapedForm;
+        TakeReapedForm(formId, reapedForm);
     }
     HILOG_INFO("delete request formId:%{public}" PRId64 " compId:%{public}s request empty:%{public}d",
         formId, compId.c_str(), isRequestEmpty);
@@ -1100,6 +1254,7 @@ void FormRenderRecord::ReleaseRenderer(
 {
     HILOG_INFO("Release renderer which formId:%{public}s, compId:%{public}s start.",
         std::to_string(formId).c_str(), compId.c_str());
+    DeleteFormDataCache(formId);
     std::shared_ptr<EventHandler> eventHandler = GetEventHandler();
     if (eventHandler == nullptr) {
         HILOG_ERROR("null eventHandler");
@@ -1198,6 +1353,7 @@ void FormRenderRecord::HandleReleaseInJsThread()
     if (runtime_) {
         runtime_.reset();
     }
+    prewarmedRuntime_.reset();
     ReleaseHapFileHandle();
 }
 
@@ -1225,13 +1381,21 @@ void FormRenderRecord::ReAddAllRecycledForms(const sptr<IFormSupply> &formSupply
     }
 
     std::vector<int64_t> formIds;
-    std::lock_guard<std::mutex> lock(formRequestsMutex_);
-    for (const auto& formRequests : formRequests_) {
-        for (const auto& formRequest : formRequests.second) {
-            if (!formRequest.second.hasRelease) {
-                continue;
+    {
+        std::lock_guard<std::mutex> lock(formRequestsMutex_);
+        for (const auto& formRequests : formRequests_) {
+            for (const auto& formRequest : formRequests.second) {
+                if (!formRequest.second.hasRelease) {
+                    continue;
+                }
+                int64_t formId = formRequest.second.formJsInfo.formId;
+                if (!IsFormVisible(formId)) {
+                    // recovered when the form becomes visible
+                    MarkConfigStale(formId);
+                    continue;
+                }
+                formIds.push_back(formId);
             }
-            formIds.push_back(formRequest.second.formJsInfo.formId);
         }
     }
 
@@ -1511,6 +1675,10 @@ int32_t FormRenderRecord::SetVisibleChange(const int64_t &formId, bool isVisible
 {
     HILOG_INFO("formId:%{public}s", std::to_string(formId).c_str());
     RecordFormVisibility(formId, isVisible);
+    MarkActive();
+    if (isVisible) {
+        RecoverReapedForm(formId);
+    }
     std::shared_ptr<EventHandler> eventHandler = GetEventHandler();
     if (eventHandler == nullptr) {
         HILOG_ERROR("null eventHandler");
@@ -1535,18 +1703,27 @@ int32_t FormRenderRecord::HandleSetVisibleChange(const int64_t &formId, bool isV
     HILOG_INFO("formId:%{public}s", std::to_string(formId).c_str());
     MarkThreadAlive();
 
-    std::lock_guard<std::mutex> lock(formRendererGroupMutex_);
-    auto search = formRendererGroupMap_.find(formId);
-    if (search == formRendererGroupMap_.end()) {
-        HILOG_ERROR("invalid FormRendererGroup");
-        return SET_VISIBLE_CHANGE_FAILED;
+    {
+        std::lock_guard<std::mutex> lock(formRendererGroupMutex_);
+        auto search = formRendererGroupMap_.find(formId);
+        if (search != formRendererGroupMap_.end()) {
+            if (!search->second) {
+                HILOG_ERROR("FormRendererGroup was found but null");
+                return SET_VISIBLE_CHANGE_FAILED;
+            }
+            if (isVisible && TakeConfigStale(formId)) {
+                HILOG_INFO("apply deferred configuration, formId:%{public}" PRId64, formId);
+                search->second->UpdateConfiguration(GetConfiguration());
+            }
+            search->second->SetVisibleChange(isVisible);
+            return ERR_OK;
+        }
     }
-    if (!search->second) {
-        HILOG_ERROR("FormRendererGroup was found but null");
-        return SET_VISIBLE_CHANGE_FAILED;
+    HILOG_ERROR("invalid FormRendererGroup");
+    if (isVisible) {
+        RecoverConfigStaleReleasedForm(formId);
     }
-    search->second->SetVisibleChange(isVisible);
-    return ERR_OK;
+    return SET_VISIBLE_CHANGE_FAILED;
 }
 
 int32_t FormRenderRecord::HandleReloadFormRecord(const std::vector<FormJsInfo> &&formJsInfos, const Want &want)
@@ -1584,8 +1761,8 @@ size_t FormRenderRecord::FormCount()
     return formRequests_.size();
 }
 
-void FormRenderRecord::UpdateConfiguration(
-    const std::shared_ptr<OHOS::AppExecFwk::Configuration>& config, const sptr<IFormSupply> &formSupplyClient)
+void FormRenderRecord::UpdateConfiguration(const std::shared_ptr<OHOS::AppExecFwk::Configuration>& config,
+    const sptr<IFormSupply> &formSupplyClient, const std::shared_ptr<ConfigUpdateCpuCost> &cpuCost)
 {
     if (!config) {
         HILOG_ERROR("UpdateConfiguration failed due to null config");
@@ -1605,13 +1782,13 @@ void FormRenderRecord::UpdateConfiguration(
     }
 
     std::weak_ptr<FormRenderRecord> thisWeakPtr(shared_from_this());
-    auto task = [thisWeakPtr, config]() {
+    auto task = [thisWeakPtr, config, cpuCost]() {
         auto renderRecord = thisWeakPtr.lock();
         if (renderRecord == nullptr) {
             HILOG_ERROR("null renderRecord");
             return;
         }
-        renderRecord->HandleUpdateConfiguration(config);
+        renderRecord->HandleUpdateConfiguration(config, cpuCost);
     };
 
     auto eventHandler = GetEventHandler();
@@ -1621,8 +1798,9 @@ void FormRenderRecord::UpdateConfiguration(
 }
 
 void FormRenderRecord::HandleUpdateConfiguration(
-    const std::shared_ptr<OHOS::AppExecFwk::Configuration>& config)
+    const std::shared_ptr<OHOS::AppExecFwk::Configuration>& config, const std::shared_ptr<ConfigUpdateCpuCost> &cpuCost)
 {
+    int64_t startCpuTimeUs = GetThreadCpuTimeUs();
     MarkThreadAlive();
     std::lock_guard<std::mutex> lock(formRendererGroupMutex_);
     if (!config) {
@@ -1630,10 +1808,23 @@ void FormRenderRecord::HandleUpdateConfiguration(
         return;
     }
 
+    size_t staleCount = 0;
     for (auto iter = formRendererGroupMap_.begin(); iter != formRendererGroupMap_.end(); ++iter) {
-        if (iter->second) {
-            iter->second->UpdateConfiguration(config);
+        if (!iter->second) {
+            continue;
         }
+        if (!IsFormVisible(iter->first)) {
+            // applied when the form becomes visible
+            MarkConfigStale(iter->first);
+            staleCount++;
+            continue;
+        }
+        iter->second->UpdateConfiguration(config);
+    }
+    HILOG_INFO("%{public}zu groups updated, %{public}zu invisible groups deferred",
+        formRendererGroupMap_.size() - staleCount, staleCount);
+    if (cpuCost != nullptr) {
+        cpuCost->Add(GetThreadCpuTimeUs() - startCpuTimeUs);
     }
 }
 
@@ -1671,6 +1862,17 @@ void FormRenderRecord::HandleFormRenderGC()
 int32_t FormRenderRecord::RecycleForm(const int64_t &formId, std::string &statusData)
 {
     HILOG_INFO("RecycleForm begin, formId:%{public}s", std::to_string(formId).c_str());
+    DeleteFormDataCache(formId);
+    {
+        std::lock_guard<std::mutex> lock(reapedFormsMutex_);
+        auto iter = reapedForms_.find(formId);
+        if (iter != reapedForms_.end()) {
+            // recycled by ReapRuntime, the form manager takes over the status data
+            statusData = iter->second.statusData;
+            reapedForms_.erase(iter);
+            return ERR_OK;
+        }
+    }
     int32_t result = ERR_APPEXECFWK_FORM_COMMON_CODE;
     if (GetEventHandler(true, true) == nullptr) {
         HILOG_ERROR("null eventHandler_");
@@ -1720,6 +1922,7 @@ int32_t FormRenderRecord::RecoverForm(const FormJsInfo &formJsInfo, const std::s
 {
     auto formId = formJsInfo.formId;
     HILOG_INFO("RecoverForm begin, formId:%{public}s", std::to_string(formId).c_str());
+    MarkActive();
     if (GetEventHandler(true, true) == nullptr) {
         HILOG_ERROR("null eventHandler_");
         return RENDER_FORM_FAILED;
@@ -2213,6 +2416,170 @@ void FormRenderRecord::RecordFormVisibility(int64_t formId, bool isVisible)
     }
 }
 
+void FormRenderRecord::MarkConfigStale(int64_t formId)
+{
+    std::lock_guard<std::mutex> lock(configStaleMutex_);
+    configStaleFormIds_.insert(formId);
+}
+
+bool FormRenderRecord::TakeConfigStale(int64_t formId)
+{
+    std::lock_guard<std::mutex> lock(configStaleMutex_);
+    return configStaleFormIds_.erase(formId) > 0;
+}
+
+bool FormRenderRecord::HasReleasedFormRequest(int64_t formId)
+{
+    std::lock_guard<std::mutex> lock(formRequestsMutex_);
+    auto iter = formRequests_.find(formId);
+    if (iter == formRequests_.end()) {
+        return false;
+    }
+    for (const auto& formRequest : iter->second) {
+        if (formRequest.second.hasRelease) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FormRenderRecord::RecoverConfigStaleReleasedForm(int64_t formId)
+{
+    if (!HasReleasedFormRequest(formId) || !TakeConfigStale(formId)) {
+        return;
+    }
+    HILOG_INFO("recover released form skipped by configuration update, formId:%{public}" PRId64, formId);
+    std::vector<int64_t> formIds = { formId };
+    RecoverFormsByConfigUpdate(formIds, GetFormSupplyClient());
+}
+
+void FormRenderRecord::MarkActive()
+{
+    lastActiveTime_.store(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+}
+
+int64_t FormRenderRecord::GetLastActiveTime() const
+{
+    return lastActiveTime_.load(std::memory_order_relaxed);
+}
+
+bool FormRenderRecord::IsRuntimeAlive()
+{
+    return GetEventHandler() != nullptr;
+}
+
+bool FormRenderRecord::ReapRuntime()
+{
+    std::shared_ptr<EventHandler> eventHandler = GetEventHandler();
+    if (eventHandler == nullptr || !IsAllFormsInvisible() || HasRenderFormTask()) {
+        return false;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    bool isReaped = false;
+    auto task = [weak = weak_from_this(), &isReaped]() {
+        auto renderRecord = weak.lock();
+        if (renderRecord == nullptr) {
+            HILOG_ERROR("null renderRecord");
+            return;
+        }
+        FormMemoryGuard memoryGuard;
+        isReaped = renderRecord->HandleReapInJsThread();
+    };
+    eventHandler->PostSyncTask(task, "ReapRuntime");
+    if (!isReaped) {
+        return false;
+    }
+    if (!IsAllFormsInvisible() || HasRenderFormTask()) {
+        // a form was shown or rendered after the reap, it is recovered on the running js thread
+        HILOG_INFO("%{public}s became active, keep the js thread", uid_.c_str());
+        return false;
+    }
+    Release();
+    auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    FormRuntimeReaper::GetInstance().OnRuntimeReaped(cost);
+    HILOG_INFO("reap runtime of %{public}s cost %{public}" PRId64 "ms", uid_.c_str(), static_cast<int64_t>(cost));
+    return true;
+}
+
+bool FormRenderRecord::HandleReapInJsThread()
+{
+    MarkThreadAlive();
+    if (!IsAllFormsInvisible()) {
+        HILOG_INFO("form became visible, skip reap");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(formRendererGroupMutex_);
+    for (const auto &iter : formRendererGroupMap_) {
+        if (!iter.second) {
+            continue;
+        }
+        int64_t formId = iter.first;
+        ReapedForm reapedForm;
+        iter.second->RecycleForm(reapedForm.statusData);
+        std::pair<std::vector<std::string>, std::string> compIds = iter.second->GetOrderedAndCurrentCompIds();
+        iter.second->DeleteForm();
+        DeleteFormLocation(formId);
+        DeleteRecycledFormCompIds(formId);
+        InsertRecycledFormCompIds(formId, compIds);
+        {
+            std::lock_guard<std::mutex> requestsLock(formRequestsMutex_);
+            auto requestsIter = formRequests_.find(formId);
+            if (requestsIter != formRequests_.end()) {
+                for (auto &formRequest : requestsIter->second) {
+                    formRequest.second.hasRelease = true;
+                }
+            }
+        }
+        std::lock_guard<std::mutex> reapedLock(reapedFormsMutex_);
+        reapedForms_[formId] = std::move(reapedForm);
+    }
+    HILOG_INFO("reap %{public}zu forms of %{public}s", formRendererGroupMap_.size(), uid_.c_str());
+    formRendererGroupMap_.clear();
+    return true;
+}
+
+bool FormRenderRecord::IsFormReaped(int64_t formId)
+{
+    std::lock_guard<std::mutex> lock(reapedFormsMutex_);
+    return reapedForms_.find(formId) != reapedForms_.end();
+}
+
+bool FormRenderRecord::TakeReapedForm(int64_t formId, ReapedForm &reapedForm)
+{
+    std::lock_guard<std::mutex> lock(reapedFormsMutex_);
+    auto iter = reapedForms_.find(formId);
+    if (iter == reapedForms_.end()) {
+        return false;
+    }
+    reapedForm = std::move(iter->second);
+    reapedForms_.erase(iter);
+    return true;
+}
+
+void FormRenderRecord::RecoverReapedForm(int64_t formId)
+{
+    {
+        std::lock_guard<std::mutex> lock(reapedFormsMutex_);
+        auto iter = reapedForms_.find(formId);
+        if (iter == reapedForms_.end()) {
+            return;
+        }
+        iter->second.isRecovering = true;
+        iter->second.recoverTime = std::chrono::steady_clock::now();
+    }
+    HILOG_INFO("recover reaped form, formId:%{public}" PRId64, formId);
+    // the form is rendered again with the current configuration
+    TakeConfigStale(formId);
+    // start the js thread while the form manager sends the form data
+    GetEventHandler(true, true);
+    std::vector<int64_t> formIds = { formId };
+    RecoverFormsByConfigUpdate(formIds, GetFormSupplyClient());
+}
+
 void FormRenderRecord::RecordFormLocation(int64_t formId, const FormLocationInfo &formLocation)
 {
     std::lock_guard<std::mutex> lock(formLocationMutex_);
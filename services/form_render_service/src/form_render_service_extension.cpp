@@ -127,5 +127,11 @@ void FormRenderServiceExtension::OnConfigurationUpdated(const AppExecFwk::Config
     HILOG_INFO("configuration detail: %{public}s", config->GetName().c_str());
     FormRenderServiceMgr::GetInstance().OnConfigurationUpdated(config);
 }
+
+void FormRenderServiceExtension::OnMemoryLevel(int level)
+{
+    Extension::OnMemoryLevel(level);
+    FormRenderServiceMgr::GetInstance().OnMemoryLevel(level);
+}
 }
 }
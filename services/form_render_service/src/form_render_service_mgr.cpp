@@ -15,6 +15,7 @@
 
 #include "form_render_service_mgr.h"
 
+#include <cinttypes>
 #include <cstddef>
 #include <memory>
 #include <fstream>
@@ -24,6 +25,8 @@
 #include "fms_log_wrapper.h"
 #include "form_constants.h"
 #include "form_render_event_report.h"
+#include "form_runtime_pool.h"
+#include "form_runtime_reaper.h"
 #include "form_render_service_extension.h"
 #include "js_runtime.h"
 #include "service_extension.h"
@@ -49,11 +52,16 @@ constexpr int32_t ENABLE_FORM_FAILED = -1;
 constexpr int32_t UPDATE_FORM_SIZE_FAILED = -1;
 constexpr int64_t MIN_DURATION_MS = 1500;
 constexpr int64_t TASK_ONCONFIGURATIONUPDATED_DELAY_MS = 1000;
+// the runtime pool is refilled once no form has been rendered for a while
+constexpr int64_t TASK_PREWARM_RUNTIME_DELAY_MS = 5000;
 constexpr int32_t MEMORY_MONITOR_INTERVAL = Constants::MS_PER_DAY * 2;
 constexpr uint64_t MEMORY_LEAK_THRESHOLD = 300 * 1024 * 1024;
 constexpr size_t BYTE_PER_KB = 1024;
 constexpr const char *FORM_RENDER_SERIAL_QUEUE = "FormRenderSerialQueue";
+constexpr const char *FORM_RUNTIME_PREWARM_QUEUE = "FormRuntimePrewarmQueue";
 constexpr const char *TASK_ONCONFIGURATIONUPDATED = "FormRenderServiceMgr::OnConfigurationUpdated";
+constexpr const char *TASK_PREWARM_RUNTIME = "FormRenderServiceMgr::PrewarmRuntime";
+constexpr const char *TASK_REAP_RUNTIME = "FormRenderServiceMgr::ReapRuntime";
 constexpr const char *FRS_MEMORY_MONITOR = "FormRenderMemoryMonitor";
 
 uint64_t GetPss()
@@ -98,6 +106,7 @@ FormRenderServiceMgr::FormRenderServiceMgr()
 {
     serialQueue_ = std::make_shared<Common::FormBaseSerialQueue>(FORM_RENDER_SERIAL_QUEUE);
     FormRenderStatusTaskMgr::GetInstance().SetSerialQueue(serialQueue_);
+    prewarmQueue_ = std::make_shared<Common::FormBaseSerialQueue>(FORM_RUNTIME_PREWARM_QUEUE);
     appliedConfig_ = std::make_shared<AppExecFwk::Configuration>();
     mainHandler_ = std::make_shared<AppExecFwk::EventHandler>(AppExecFwk::EventRunner::GetMainEventRunner());
     InitMemoryMonitor();
@@ -164,6 +173,9 @@ int32_t FormRenderServiceMgr::ProcessRenderForm(const FormJsInfo &formJsInfo, co
     Want formRenderWant(want);
     const auto result = UpdateRenderRecordByUid(uid, formRenderWant, formJsInfo, formSupplyClient);
     formSupplyClient->OnRenderTaskDone(formJsInfo.formId, formRenderWant);
+    SchedulePrewarmRuntime();
+    // a new record may take the live runtimes over the limit
+    ScheduleReapRuntime(FormRuntimeReaper::GetInstance().GetIdleTime());
     return result;
 }
 
@@ -449,6 +461,9 @@ int32_t FormRenderServiceMgr::SetVisibleChange(const int64_t formId, bool isVisi
             HILOG_ERROR("SetVisibleChange %{public}" PRId64 " failed.", formId);
             return ret;
         }
+        if (!isVisible) {
+            ScheduleReapRuntime(FormRuntimeReaper::GetInstance().GetIdleTime());
+        }
     } else {
         HILOG_ERROR("can't find render record of %{public}" PRId64, formId);
         return SET_VISIBLE_CHANGE_FAILED;
@@ -507,17 +522,25 @@ void FormRenderServiceMgr::OnConfigurationUpdatedInner()
     // Update all configuration item caches
     CacheAppliedConfig();
     configUpdateTime_ = std::chrono::steady_clock::now();
-    size_t allFormCount = 0;
+    std::vector<std::shared_ptr<FormRenderRecord>> renderRecords;
     {
         std::lock_guard<std::mutex> lock(renderRecordMutex_);
+        renderRecords.reserve(renderRecordMap_.size());
         for (auto iter = renderRecordMap_.begin(); iter != renderRecordMap_.end(); ++iter) {
             if (iter->second) {
-                iter->second->UpdateConfiguration(applyConfig, formSupplyClient);
-                allFormCount += iter->second->FormCount();
+                renderRecords.emplace_back(iter->second);
             }
         }
     }
-    HILOG_INFO("OnConfigurationUpdated %{public}zu forms updated.", allFormCount);
+    size_t allFormCount = 0;
+    // the update runs on the js thread of each record, the cost is logged when the last one is done
+    auto cpuCost = std::make_shared<ConfigUpdateCpuCost>();
+    for (const auto &renderRecord : renderRecords) {
+        renderRecord->UpdateConfiguration(applyConfig, formSupplyClient, cpuCost);
+        allFormCount += renderRecord->FormCount();
+    }
+    HILOG_INFO("OnConfigurationUpdated %{public}zu forms of %{public}zu records updated.",
+        allFormCount, renderRecords.size());
     hasCachedConfig_ = false;
     PerformanceEventInfo eventInfo;
     eventInfo.timeStamp = Common::FormTimeUtil::GetNowMillisecond();
@@ -757,6 +780,19 @@ int32_t FormRenderServiceMgr::UpdateRenderRecordByUid(const std::string &uid, Wa
     std::lock_guard<std::mutex> lock(renderRecordMutex_);
     ConfirmUnlockState(formRenderWant);
     auto search = renderRecordMap_.find(uid);
+    if (formRenderWant.HasParameter(Constants::FORM_DATA_PATCH_BASE_REVISION)) {
+        FormJsInfo patchedFormJsInfo = formJsInfo;
+        if (search == renderRecordMap_.end() ||
+            !search->second->ApplyFormDataPatch(patchedFormJsInfo, formRenderWant)) {
+            // FMS resends the full data once it sees the mismatch in OnRenderTaskDone
+            formRenderWant.SetParam(Constants::FORM_DATA_PATCH_MISMATCH, true);
+            std::string eventId = formRenderWant.GetStringParam(Constants::FORM_STATUS_EVENT_ID);
+            FormRenderStatusTaskMgr::GetInstance().OnRenderFormDone(formJsInfo.formId,
+                FormFsmEvent::RENDER_FORM_DONE, eventId, formSupplyClient);
+            return ERR_OK;
+        }
+        return search->second->UpdateRenderRecord(patchedFormJsInfo, formRenderWant, hostToken);
+    }
     if (search != renderRecordMap_.end()) {
         result = search->second->UpdateRenderRecord(formJsInfo, formRenderWant, hostToken);
     } else {
@@ -984,9 +1020,89 @@ void FormRenderServiceMgr::RemoveMemoryMonitor()
     OHOS::HiviewDFX::Watchdog::GetInstance().RemovePeriodicalTask(FRS_MEMORY_MONITOR);
 }
 
+void FormRenderServiceMgr::OnMemoryLevel(int32_t level)
+{
+    HILOG_INFO("memory level:%{public}d", level);
+    FormRuntimePool::GetInstance().OnMemoryLevel(level);
+    FormRuntimeReaper::GetInstance().OnMemoryLevel(level);
+    ScheduleReapRuntime(0);
+}
+
+void FormRenderServiceMgr::SchedulePrewarmRuntime()
+{
+    // warming blocks for the runtime init, keep it off the serial queue of the render requests
+    prewarmQueue_->CancelDelayTask(TASK_PREWARM_RUNTIME);
+    auto prewarmRuntimeFunc = []() {
+        FormRenderServiceMgr::GetInstance().PrewarmRuntime();
+    };
+    prewarmQueue_->ScheduleDelayTask(TASK_PREWARM_RUNTIME, TASK_PREWARM_RUNTIME_DELAY_MS, prewarmRuntimeFunc,
+        Common::TaskQos::QOS_BACKGROUND);
+}
+
+void FormRenderServiceMgr::PrewarmRuntime()
+{
+    FormRuntimePool::GetInstance().Refill();
+}
+
+void FormRenderServiceMgr::ScheduleReapRuntime(int64_t delayMs)
+{
+    // a pending check reschedules itself for the records not idle yet, unless the check is urgent
+    if (isReapScheduled_.exchange(true) && delayMs > 0) {
+        return;
+    }
+    auto reapRuntimeFunc = []() {
+        FormRenderServiceMgr::GetInstance().ReapRuntime();
+    };
+    if (!serialQueue_->ScheduleDelayTask(TASK_REAP_RUNTIME, delayMs, reapRuntimeFunc)) {
+        isReapScheduled_ = false;
+    }
+}
+
+void FormRenderServiceMgr::ReapRuntime()
+{
+    isReapScheduled_ = false;
+    std::vector<std::shared_ptr<FormRenderRecord>> renderRecords;
+    {
+        std::lock_guard<std::mutex> lock(renderRecordMutex_);
+        renderRecords.reserve(renderRecordMap_.size());
+        for (const auto &iter : renderRecordMap_) {
+            if (iter.second) {
+                renderRecords.emplace_back(iter.second);
+            }
+        }
+    }
+
+    int64_t nextCheckDelayMs = 0;
+    auto reapRecords = FormRuntimeReaper::GetInstance().SelectReapRecords(renderRecords, nextCheckDelayMs);
+    size_t reapedCount = 0;
+    for (const auto &renderRecord : reapRecords) {
+        {
+            // the record may be deleted since it was selected
+            std::lock_guard<std::mutex> lock(renderRecordMutex_);
+            auto search = renderRecordMap_.find(renderRecord->GetUid());
+            if (search == renderRecordMap_.end() || search->second != renderRecord) {
+                continue;
+            }
+        }
+        // waits for the js thread, the record checks by itself that it is still idle
+        if (renderRecord->ReapRuntime()) {
+            reapedCount++;
+        }
+    }
+    if (reapedCount > 0) {
+        // release the abc file cache as after the forms recycled by the form manager
+        MainThreadForceFullGC();
+        OHOS::Rosen::FontCollection::Create()->ClearCaches();
+    }
+    if (nextCheckDelayMs > 0) {
+        ScheduleReapRuntime(nextCheckDelayMs);
+    }
+}
+
 void FormRenderServiceMgr::ReportProcessMemory()
 {
     uint64_t processMemory = GetPss();
+    ReportRuntimeReap(processMemory);
     if (processMemory < MEMORY_LEAK_THRESHOLD) {
         return;
     }
@@ -1014,6 +1130,31 @@ void FormRenderServiceMgr::ReportProcessMemory()
             formLocations);
     }
 }
+
+void FormRenderServiceMgr::ReportRuntimeReap(uint64_t processMemory)
+{
+    size_t liveRuntimeCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(renderRecordMutex_);
+        for (const auto &iter : renderRecordMap_) {
+            if (iter.second && iter.second->IsRuntimeAlive()) {
+                liveRuntimeCount++;
+            }
+        }
+    }
+    auto &reaper = FormRuntimeReaper::GetInstance();
+    const auto &reapHistogram = reaper.GetReapHistogram();
+    const auto &recoverHistogram = reaper.GetRecoverHistogram();
+    RuntimeReapStatistic statistic;
+    statistic.liveRuntimeCount = static_cast<uint32_t>(liveRuntimeCount);
+    statistic.reapCount = reapHistogram.GetCount();
+    statistic.reapAvgCost = statistic.reapCount == 0 ? 0 : reapHistogram.GetTotal() / statistic.reapCount;
+    statistic.reapMaxCost = reapHistogram.GetMax();
+    statistic.recoverCount = recoverHistogram.GetCount();
+    statistic.recoverAvgCost = statistic.recoverCount == 0 ? 0 : recoverHistogram.GetTotal() / statistic.recoverCount;
+    statistic.recoverMaxCost = recoverHistogram.GetMax();
+    FormRenderEventReport::SendRuntimeReapEvent(processMemory, statistic);
+}
 }  // namespace FormRender
 }  // namespace AppExecFwk
 }  // namespace OHOS
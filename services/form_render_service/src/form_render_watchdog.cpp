@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_render_watchdog.h"
+
+#include <vector>
+
+#include "fms_log_wrapper.h"
+#include "form_render_record.h"
+#include "xcollie/watchdog.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace FormRender {
+namespace {
+constexpr const char *RENDERING_BLOCK_MONITOR = "RenderingBlockMonitorTask";
+}
+
+FormRenderWatchdog::FormRenderWatchdog()
+{}
+
+FormRenderWatchdog::~FormRenderWatchdog()
+{}
+
+void FormRenderWatchdog::AddRecord(const std::shared_ptr<FormRenderRecord> &renderRecord)
+{
+    if (renderRecord == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(recordsMutex_);
+    records_[renderRecord.get()] = renderRecord;
+    if (records_.size() != 1) {
+        return;
+    }
+    HILOG_INFO("start rendering block monitor");
+    auto threadBlockMonitorTask = []() {
+        FormRenderWatchdog::GetInstance().CheckRecords();
+    };
+    OHOS::HiviewDFX::Watchdog::GetInstance().RunPeriodicalTask(RENDERING_BLOCK_MONITOR,
+        threadBlockMonitorTask, THREAD_BLOCK_TIMEOUT);
+}
+
+void FormRenderWatchdog::RemoveRecord(const FormRenderRecord *renderRecord)
+{
+    std::lock_guard<std::mutex> lock(recordsMutex_);
+    if (records_.erase(renderRecord) == 0 || !records_.empty()) {
+        return;
+    }
+    HILOG_INFO("stop rendering block monitor");
+    OHOS::HiviewDFX::Watchdog::GetInstance().RemovePeriodicalTask(RENDERING_BLOCK_MONITOR);
+}
+
+size_t FormRenderWatchdog::GetRecordCount()
+{
+    std::lock_guard<std::mutex> lock(recordsMutex_);
+    return records_.size();
+}
+
+void FormRenderWatchdog::CheckRecords()
+{
+    std::vector<std::shared_ptr<FormRenderRecord>> renderRecords;
+    {
+        std::lock_guard<std::mutex> lock(recordsMutex_);
+        renderRecords.reserve(records_.size());
+        for (const auto &item : records_) {
+            auto renderRecord = item.second.lock();
+            if (renderRecord != nullptr) {
+                renderRecords.emplace_back(renderRecord);
+            }
+        }
+    }
+    // the records are checked out of the lock, a blocked record takes a while to dump its stack
+    for (const auto &renderRecord : renderRecords) {
+        renderRecord->Timer();
+    }
+}
+} // namespace FormRender
+} // namespace AppExecFwk
+} // namespace OHOS
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_runtime_pool.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "fms_log_wrapper.h"
+#include "form_constants.h"
+#include "form_module_checker.h"
+#include "parameters.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace FormRender {
+namespace {
+constexpr int32_t DEFAULT_RUNTIME_POOL_SIZE = 1;
+constexpr int32_t MAX_RUNTIME_POOL_SIZE = 4;
+// same as MEMORY_LEVEL_LOW of the app memory levels
+constexpr int32_t MEMORY_LEVEL_LOW = 1;
+// a runtime with the ArkUI modules loaded, before any form page
+constexpr uint64_t RUNTIME_MEMORY_ESTIMATE = 15 * 1024 * 1024;
+// the idle runtimes never take more than this, whatever the capacity
+constexpr uint64_t RUNTIME_POOL_MEMORY_BUDGET = 30 * 1024 * 1024;
+constexpr const char *RUNTIME_POOL_SIZE_PARAM = "persist.form.runtime_pool_size";
+constexpr const char *RUNTIME_POOL_THREAD_NAME = "FormRuntimePool";
+
+std::shared_ptr<JsFormRuntime> InitRuntime(const std::shared_ptr<EventRunner> &eventRunner)
+{
+    AbilityRuntime::Runtime::Options options;
+    options.codePath = Constants::LOCAL_CODE_PATH;
+    options.eventRunner = eventRunner;
+    options.loadAce = true;
+    options.isBundle = true;
+    options.isUnique = true;
+    options.moduleCheckerDelegate = std::make_shared<FormModuleChecker>();
+
+    auto runtime = std::make_shared<JsFormRuntime>();
+    if (!runtime->Init(options)) {
+        HILOG_ERROR("Init runtime failed");
+        return nullptr;
+    }
+    runtime->SetLocalFontCollectionMaxSize();
+    return runtime;
+}
+}
+
+FormRuntimePool::FormRuntimePool()
+{
+    capacity_ = static_cast<size_t>(OHOS::system::GetIntParameter<int32_t>(RUNTIME_POOL_SIZE_PARAM,
+        DEFAULT_RUNTIME_POOL_SIZE, 0, MAX_RUNTIME_POOL_SIZE));
+    HILOG_INFO("runtime pool capacity:%{public}zu", capacity_);
+}
+
+FormRuntimePool::~FormRuntimePool()
+{}
+
+std::shared_ptr<PrewarmedRuntime> FormRuntimePool::Acquire()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    if (idleRuntimes_.empty()) {
+        return nullptr;
+    }
+    auto prewarmed = idleRuntimes_.front();
+    idleRuntimes_.pop_front();
+    HILOG_INFO("acquire prewarmed runtime, idle count:%{public}zu", idleRuntimes_.size());
+    return prewarmed;
+}
+
+void FormRuntimePool::Refill()
+{
+    uint64_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        if (!IsRefillAllowedNolock()) {
+            return;
+        }
+        count = std::min<uint64_t>(capacity_, RUNTIME_POOL_MEMORY_BUDGET / RUNTIME_MEMORY_ESTIMATE) -
+            idleRuntimes_.size();
+    }
+
+    for (uint64_t i = 0; i < count; i++) {
+        auto prewarmed = CreatePrewarmedRuntime();
+        if (prewarmed == nullptr) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            if (IsRefillAllowedNolock()) {
+                idleRuntimes_.emplace_back(prewarmed);
+                continue;
+            }
+        }
+        // the memory became low or the capacity shrank while warming
+        DestroyPrewarmedRuntime(prewarmed);
+        return;
+    }
+    HILOG_INFO("runtime pool refilled, idle count:%{public}zu", GetIdleCount());
+}
+
+void FormRuntimePool::Clear()
+{
+    std::deque<std::shared_ptr<PrewarmedRuntime>> idleRuntimes;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        idleRuntimes.swap(idleRuntimes_);
+    }
+    if (idleRuntimes.empty()) {
+        return;
+    }
+    HILOG_INFO("release %{public}zu prewarmed runtimes", idleRuntimes.size());
+    for (const auto &prewarmed : idleRuntimes) {
+        DestroyPrewarmedRuntime(prewarmed);
+    }
+}
+
+void FormRuntimePool::OnMemoryLevel(int32_t level)
+{
+    bool isMemoryLow = level >= MEMORY_LEVEL_LOW;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        isMemoryLow_ = isMemoryLow;
+    }
+    if (isMemoryLow) {
+        Clear();
+    }
+}
+
+void FormRuntimePool::SetCapacity(size_t capacity)
+{
+    std::vector<std::shared_ptr<PrewarmedRuntime>> extraRuntimes;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        capacity_ = capacity;
+        while (idleRuntimes_.size() > capacity_) {
+            extraRuntimes.emplace_back(idleRuntimes_.back());
+            idleRuntimes_.pop_back();
+        }
+    }
+    for (const auto &prewarmed : extraRuntimes) {
+        DestroyPrewarmedRuntime(prewarmed);
+    }
+}
+
+size_t FormRuntimePool::GetIdleCount()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    return idleRuntimes_.size();
+}
+
+bool FormRuntimePool::IsRefillAllowedNolock()
+{
+    return !isMemoryLow_ && idleRuntimes_.size() < capacity_ &&
+        (idleRuntimes_.size() + 1) * RUNTIME_MEMORY_ESTIMATE <= RUNTIME_POOL_MEMORY_BUDGET;
+}
+
+std::shared_ptr<PrewarmedRuntime> FormRuntimePool::CreatePrewarmedRuntime()
+{
+    auto prewarmed = std::make_shared<PrewarmedRuntime>();
+    prewarmed->eventRunner = EventRunner::Create(RUNTIME_POOL_THREAD_NAME);
+    if (prewarmed->eventRunner == nullptr) {
+        HILOG_ERROR("Create event runner failed");
+        return nullptr;
+    }
+    prewarmed->eventHandler = std::make_shared<EventHandler>(prewarmed->eventRunner);
+    // the runtime has to be initialized in its own js thread
+    auto initTask = [prewarmed]() {
+        prewarmed->runtime = InitRuntime(prewarmed->eventRunner);
+    };
+    prewarmed->eventHandler->PostSyncTask(initTask, "PrewarmRuntime");
+    if (prewarmed->runtime == nullptr) {
+        DestroyPrewarmedRuntime(prewarmed);
+        return nullptr;
+    }
+    return prewarmed;
+}
+
+void FormRuntimePool::DestroyPrewarmedRuntime(const std::shared_ptr<PrewarmedRuntime> &prewarmed)
+{
+    if (prewarmed == nullptr || prewarmed->eventHandler == nullptr) {
+        return;
+    }
+    auto releaseTask = [prewarmed]() {
+        prewarmed->runtime.reset();
+    };
+    prewarmed->eventHandler->PostSyncTask(releaseTask, "ReleasePrewarmedRuntime");
+    if (prewarmed->eventRunner != nullptr) {
+        prewarmed->eventRunner->Stop();
+    }
+}
+} // namespace FormRender
+} // namespace AppExecFwk
+} // namespace OHOS
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_runtime_reaper.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <utility>
+
+#include "fms_log_wrapper.h"
+#include "form_render_record.h"
+#include "parameters.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace FormRender {
+namespace {
+constexpr int32_t DEFAULT_MAX_LIVE_RUNTIMES = 8;
+constexpr int32_t MAX_LIVE_RUNTIMES_LIMIT = 64;
+constexpr int32_t DEFAULT_RUNTIME_IDLE_TIME_S = 60;
+constexpr int32_t MIN_RUNTIME_IDLE_TIME_S = 10;
+constexpr int32_t MAX_RUNTIME_IDLE_TIME_S = 3600;
+constexpr int64_t MS_PER_SECOND = 1000;
+// same as MEMORY_LEVEL_LOW of the app memory levels
+constexpr int32_t MEMORY_LEVEL_LOW = 1;
+constexpr const char *MAX_LIVE_RUNTIMES_PARAM = "persist.form.max_live_runtimes";
+constexpr const char *RUNTIME_IDLE_TIME_PARAM = "persist.form.runtime_idle_time";
+}
+
+FormRuntimeReaper::FormRuntimeReaper()
+{
+    maxLiveRuntimes_ = static_cast<size_t>(OHOS::system::GetIntParameter<int32_t>(MAX_LIVE_RUNTIMES_PARAM,
+        DEFAULT_MAX_LIVE_RUNTIMES, 1, MAX_LIVE_RUNTIMES_LIMIT));
+    idleTimeMs_ = OHOS::system::GetIntParameter<int32_t>(RUNTIME_IDLE_TIME_PARAM,
+        DEFAULT_RUNTIME_IDLE_TIME_S, MIN_RUNTIME_IDLE_TIME_S, MAX_RUNTIME_IDLE_TIME_S) * MS_PER_SECOND;
+    HILOG_INFO("max live runtimes:%{public}zu, idle time:%{public}" PRId64 "ms", maxLiveRuntimes_, idleTimeMs_);
+}
+
+FormRuntimeReaper::~FormRuntimeReaper()
+{}
+
+std::vector<std::shared_ptr<FormRenderRecord>> FormRuntimeReaper::SelectReapRecords(
+    const std::vector<std::shared_ptr<FormRenderRecord>> &renderRecords, int64_t &nextCheckDelayMs)
+{
+    nextCheckDelayMs = 0;
+    size_t maxLiveRuntimes = 0;
+    int64_t idleTimeMs = 0;
+    {
+        std::lock_guard<std::mutex> lock(reaperMutex_);
+        maxLiveRuntimes = isMemoryLow_ ? 0 : maxLiveRuntimes_;
+        // on low memory every invisible runtime goes, however recently it was active
+        idleTimeMs = isMemoryLow_ ? 0 : idleTimeMs_;
+    }
+
+    // <last active time, record>
+    std::vector<std::pair<int64_t, std::shared_ptr<FormRenderRecord>>> candidates;
+    size_t liveCount = 0;
+    for (const auto &renderRecord : renderRecords) {
+        if (renderRecord == nullptr || !renderRecord->IsRuntimeAlive()) {
+            continue;
+        }
+        liveCount++;
+        if (!renderRecord->IsAllFormsInvisible() || renderRecord->HasRenderFormTask()) {
+            continue;
+        }
+        candidates.emplace_back(renderRecord->GetLastActiveTime(), renderRecord);
+    }
+    liveRuntimeCount_.store(liveCount, std::memory_order_relaxed);
+    if (liveCount <= maxLiveRuntimes) {
+        return {};
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+        [](const auto &left, const auto &right) { return left.first < right.first; });
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    size_t reapCount = liveCount - maxLiveRuntimes;
+    std::vector<std::shared_ptr<FormRenderRecord>> reapRecords;
+    for (const auto &candidate : candidates) {
+        if (reapRecords.size() >= reapCount) {
+            break;
+        }
+        int64_t idleMs = now - candidate.first;
+        if (idleMs < idleTimeMs) {
+            // the rest are active more recently
+            nextCheckDelayMs = idleTimeMs - idleMs;
+            break;
+        }
+        reapRecords.emplace_back(candidate.second);
+    }
+    HILOG_INFO("live runtimes:%{public}zu, limit:%{public}zu, candidates:%{public}zu, reap:%{public}zu",
+        liveCount, maxLiveRuntimes, candidates.size(), reapRecords.size());
+    return reapRecords;
+}
+
+void FormRuntimeReaper::OnMemoryLevel(int32_t level)
+{
+    std::lock_guard<std::mutex> lock(reaperMutex_);
+    isMemoryLow_ = level >= MEMORY_LEVEL_LOW;
+}
+
+void FormRuntimeReaper::SetMaxLiveRuntimes(size_t maxLiveRuntimes)
+{
+    std::lock_guard<std::mutex> lock(reaperMutex_);
+    maxLiveRuntimes_ = maxLiveRuntimes;
+}
+
+void FormRuntimeReaper::SetIdleTime(int64_t idleTimeMs)
+{
+    std::lock_guard<std::mutex> lock(reaperMutex_);
+    idleTimeMs_ = idleTimeMs;
+}
+
+int64_t FormRuntimeReaper::GetIdleTime()
+{
+    std::lock_guard<std::mutex> lock(reaperMutex_);
+    return idleTimeMs_;
+}
+
+void FormRuntimeReaper::OnRuntimeReaped(int64_t costMs)
+{
+    reapHistogram_.Record(costMs);
+}
+
+void FormRuntimeReaper::OnFormRecovered(int64_t costMs)
+{
+    recoverHistogram_.Record(costMs);
+}
+
+size_t FormRuntimeReaper::GetLiveRuntimeCount() const
+{
+    return liveRuntimeCount_.load(std::memory_order_relaxed);
+}
+} // namespace FormRender
+} // namespace AppExecFwk
+} // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "js_form_runtime.h"
 
+#include "ecmascript/napi/include/jsnapi.h"
 #include "rosen_text/font_collection_mgr.h"
 #include "fms_log_wrapper.h"
 #include "form_constants.h"
@@ -32,6 +33,53 @@ const static std::unordered_map<std::string, Ace::FormJsXNodeLoadMode> FORM_IMPE
 };
 }
 
+bool JsFormRuntime::Init(const Options &options)
+{
+    options_ = options;
+    // the runtime lives in the js thread of the runner, it must not keep the runner alive
+    options_.eventRunner = nullptr;
+    return JsRuntime::Init(options);
+}
+
+bool JsFormRuntime::IsBindable(const Options &options) const
+{
+    // only a runtime not bound to any bundle yet, initialized as a cold start would be
+    return options_.bundleName.empty() && options_.hapPath.empty() && options_.codePath == options.codePath &&
+        options_.loadAce == options.loadAce && options_.isBundle == options.isBundle &&
+        options_.isUnique == options.isUnique &&
+        (options_.moduleCheckerDelegate != nullptr) == (options.moduleCheckerDelegate != nullptr);
+}
+
+void JsFormRuntime::BindBundle(const Options &options)
+{
+    auto vm = GetEcmaVm();
+    if (vm != nullptr) {
+        panda::JSNApi::SetBundle(vm, options.isBundle);
+        panda::JSNApi::SetBundleName(vm, options.bundleName);
+    }
+    options_.bundleName = options.bundleName;
+    options_.hapPath = options.hapPath;
+    options_.pkgContextInfoJsonStringMap = options.pkgContextInfoJsonStringMap;
+    options_.packageNameList = options.packageNameList;
+    if (options.pkgContextInfoJsonStringMap.empty()) {
+        return;
+    }
+    for (const auto &contextInfo : options.pkgContextInfoJsonStringMap) {
+        std::string packageName;
+        auto pkgNameInfo = options.packageNameList.find(contextInfo.first);
+        if (pkgNameInfo != options.packageNameList.end()) {
+            packageName = pkgNameInfo->second;
+        }
+        SetPkgContextInfoJson(contextInfo.first, contextInfo.second, packageName);
+    }
+    ReloadFormComponent();
+}
+
+const AbilityRuntime::Runtime::Options &JsFormRuntime::GetOptions() const
+{
+    return options_;
+}
+
 void JsFormRuntime::SetTemplateFormImperativeFwk(const std::string &templateFormImperativeFwk)
 {
     auto nativeEngine = GetNativeEnginePointer();
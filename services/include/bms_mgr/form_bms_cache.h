@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_BMS_CACHE_H
+#define OHOS_FORM_FWK_FORM_BMS_CACHE_H
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class FormBmsCache
+ * Bounded LRU cache of bundle manager query results, with hit and miss counters for dump.
+ */
+template <typename Key, typename Value>
+class FormBmsCache {
+public:
+    explicit FormBmsCache(size_t capacity) : capacity_(capacity) {}
+
+    bool Get(const Key &key, Value &value)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = index_.find(key);
+        if (iter == index_.end()) {
+            missCount_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        entries_.splice(entries_.begin(), entries_, iter->second);
+        value = iter->second->second;
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void Put(const Key &key, const Value &value)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = index_.find(key);
+        if (iter != index_.end()) {
+            iter->second->second = value;
+            entries_.splice(entries_.begin(), entries_, iter->second);
+            return;
+        }
+        entries_.emplace_front(key, value);
+        index_[key] = entries_.begin();
+        if (entries_.size() > capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    void EraseIf(const std::function<bool(const Key &, const Value &)> &predicate)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto iter = entries_.begin(); iter != entries_.end();) {
+            if (predicate(iter->first, iter->second)) {
+                index_.erase(iter->first);
+                iter = entries_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        index_.clear();
+    }
+
+    size_t Size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    size_t Capacity() const
+    {
+        return capacity_;
+    }
+
+    int64_t GetHitCount() const
+    {
+        return hitCount_.load(std::memory_order_relaxed);
+    }
+
+    int64_t GetMissCount() const
+    {
+        return missCount_.load(std::memory_order_relaxed);
+    }
+
+private:
+    const size_t capacity_;
+    mutable std::mutex mutex_;
+    // Most recently used entry at the front.
+    std::list<std::pair<Key, Value>> entries_;
+    std::unordered_map<Key, typename std::list<std::pair<Key, Value>>::iterator> index_;
+    std::atomic<int64_t> hitCount_ = 0;
+    std::atomic<int64_t> missCount_ = 0;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif // OHOS_FORM_FWK_FORM_BMS_CACHE_H
@@ -17,9 +17,11 @@
 #define OHOS_FORM_FWK_FORM_BMS_HELPER_H
 
 #include <singleton.h>
+#include <utility>
 #include "ability_manager_interface.h"
 #include "bundle_mgr_interface.h"
 #include "bundle_installer_interface.h"
+#include "bms_mgr/form_bms_cache.h"
 #include "bms_mgr/form_bundle_event_callback.h"
 #include "form_info.h"
 #include "want.h"
@@ -30,7 +32,8 @@ using Want = OHOS::AAFwk::Want;
 
 /**
  * @class FormBmsHelper
- * Bms helpler.
+ * Bms helpler. Uid to bundle name, system app and bundle info queries are cached, the caches are
+ * dropped by the package events of a bundle and whenever the bundle manager proxy changes.
  */
 class FormBmsHelper final : public DelayedRefSingleton<FormBmsHelper> {
     DECLARE_DELAYED_REF_SINGLETON(FormBmsHelper)
@@ -269,7 +272,28 @@ public:
      */
     bool GetBundleInfos(int32_t flag, std::vector<BundleInfo> &bundleInfos, int32_t userId);
 
+    /**
+     * @brief Drop the cached queries of a bundle, called on its package events.
+     * @param bundleName The bundle name.
+     * @param uid The uid of the bundle, 0 if unknown.
+     */
+    void InvalidateBundleCache(const std::string &bundleName, int32_t uid = 0);
+
+    /**
+     * @brief Drop all cached queries.
+     */
+    void ClearBundleCache();
+
+    /**
+     * @brief Dump the size and hit rate of the query caches.
+     * @param result The dump result.
+     */
+    void DumpCacheStatistics(std::string &result) const;
+
     static constexpr int64_t INVALID_UID = -1;
+    static constexpr size_t UID_CACHE_CAPACITY = 256;
+    static constexpr size_t BUNDLE_INFO_CACHE_CAPACITY = 64;
+    static constexpr int64_t NON_SYSTEM_APP_CACHE_TTL_MS = 5000;
 private:
     /**
      * @brief Generate module key.
@@ -283,6 +307,12 @@ private:
 
     void SetBundleManager(const sptr<IBundleMgr> &bundleManager);
 
+    /**
+     * @brief Get the bundle manager, dropping the caches filled through a previous one.
+     * @return The bundle manager, nullptr on failure.
+     */
+    sptr<IBundleMgr> GetBundleMgrForCache();
+
 private:
     sptr<IBundleMgr> iBundleMgr_ = nullptr;
     sptr<IBundleInstaller> bundleInstallerProxy_ = nullptr;
@@ -290,6 +320,13 @@ private:
     std::mutex ibundleMutex_;
     std::mutex registerMutex_;
     bool hasRegisterBundleEvent_ = false;
+    std::mutex cacheBundleMgrMutex_;
+    wptr<IBundleMgr> cacheBundleMgr_;
+    FormBmsCache<int32_t, std::string> uidBundleNameCache_ { UID_CACHE_CAPACITY };
+    // value: whether the uid is a system app and the steady time of the query
+    FormBmsCache<int32_t, std::pair<bool, int64_t>> systemAppCache_ { UID_CACHE_CAPACITY };
+    // key: userId, flags and bundle name, see GetBundleInfoByFlags
+    FormBmsCache<std::string, BundleInfo> bundleInfoCache_ { BUNDLE_INFO_CACHE_CAPACITY };
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -16,6 +16,8 @@
 #ifndef OHOS_FORM_FWK_FORM_ABILITY_CONNECTION_H
 #define OHOS_FORM_FWK_FORM_ABILITY_CONNECTION_H
 
+#include <atomic>
+
 #include "app_mgr_interface.h"
 #include "ability_connect_callback_stub.h"
 #include "want.h"
@@ -187,6 +189,17 @@ public:
      */
     int32_t GetAppFormPid();
 
+    /**
+     * @brief Mark the connection as riding on a pooled provider connection instead of its own.
+     * @param pooled Indicates whether the connection is pooled.
+     */
+    void SetPooled(bool pooled);
+
+    /**
+     * @brief Whether the connection rides on a pooled provider connection.
+     */
+    bool IsPooled() const;
+
 protected:
     /**
      * @brief Execute task after connection success - subclass must implement.
@@ -278,6 +291,7 @@ private:
     int32_t appFormPid_ = -1;
     sptr<IRemoteObject> hostToken_ = nullptr;
     sptr<IRemoteObject> providerToken_ = nullptr;
+    std::atomic<bool> pooled_{false};
 
     DISALLOW_COPY_AND_MOVE(FormAbilityConnection);
 };
@@ -58,6 +58,7 @@ private:
     void RecycleForms(int32_t userId);
     void HandleUserStopped(const int32_t userId);
     void HandleUserStarted(const int32_t userId);
+    void HandleShutdown();
 private:
     int32_t lastUserId_ = 0;
     std::mutex lastUserIdMutex_;
@@ -16,10 +16,11 @@
 #ifndef OHOS_FORM_FWK_FORM_TIMER_MGR_H
 #define OHOS_FORM_FWK_FORM_TIMER_MGR_H
 
-#include <list>
 #include <map>
 #include <mutex>
+#include <set>
 #include <singleton.h>
+#include <unordered_map>
 #include <vector>
 
 #include "common_event_subscriber.h"
@@ -311,6 +312,12 @@ private:
      */
     void ExecTimerTask(const FormTimer &task);
 
+    /**
+     * @brief Execute timer tasks of one provider as a single batched refresh.
+     * @param tasks Form timer tasks sharing bundle, ability and user.
+     */
+    void ExecAlignedTimerTasks(const std::vector<FormTimer> &tasks);
+
     /**
      * @brief create limiter timer
      * @return Returns true on success, false on failure.
@@ -333,6 +340,54 @@ private:
      * @brief Ensure init interval timer resource.
      */
     void EnsureInitIntervalTimer();
+    /**
+     * @brief Arm the interval timer for the earliest interval task deadline.
+     * @return Returns true on success, false on failure.
+     */
+    bool ArmIntervalTimerNolock();
+    /**
+     * @brief Queue interval timer task by its next fire time.
+     * @param task Interval timer task.
+     */
+    void EnqueueIntervalTaskNolock(const FormTimer &task);
+    /**
+     * @brief Remove interval timer task from the fire time queue.
+     * @param task Interval timer task.
+     */
+    void DequeueIntervalTaskNolock(const FormTimer &task);
+    /**
+     * @brief Check whether a SetNextRefreshTime is pending for an interval timer task.
+     * @param task Interval timer task.
+     * @return Returns true if the periodic refresh should be skipped.
+     */
+    bool IsNextRefreshPending(const FormTimer &task);
+    /**
+     * @brief Pull interval tasks due within the align window forward onto the providers already woken
+     *        by the due tasks, and group all of them by provider.
+     * @param currentTime Current time in milliseconds.
+     * @param dueTasks The due interval tasks, pulled tasks are appended.
+     * @param groups The due tasks grouped by provider, in the order of their first task.
+     */
+    void AlignIntervalTasksNolock(int64_t currentTime, std::vector<FormTimer> &dueTasks,
+        std::vector<std::vector<FormTimer>> &groups);
+    /**
+     * @brief Add or replace dynamic refresh item.
+     * @param item Dynamic refresh item.
+     */
+    void AddDynamicItemNolock(const DynamicRefreshItem &item);
+    /**
+     * @brief Find dynamic refresh item by form id.
+     * @param formId The Id of the form.
+     * @return Returns the item iterator, or end if not exist.
+     */
+    std::multimap<int64_t, DynamicRefreshItem>::iterator FindDynamicItemNolock(int64_t formId);
+    /**
+     * @brief Erase dynamic refresh item.
+     * @param iter The item iterator.
+     * @return Returns the iterator following the erased item.
+     */
+    std::multimap<int64_t, DynamicRefreshItem>::iterator EraseDynamicItemNolock(
+        std::multimap<int64_t, DynamicRefreshItem>::iterator iter);
     /**
      * @brief Clear interval timer resource.
      */
@@ -384,13 +439,6 @@ private:
         virtual void OnReceiveEvent(const EventFwk::CommonEventData &eventData) override;
     };
 
-    struct {
-        bool operator()(const DynamicRefreshItem& a, const DynamicRefreshItem& b) const
-        {
-            return a.settedTime < b.settedTime;
-        }
-    } CompareDynamicRefreshItem;
-
     bool IsNeedUpdate();
 
     void FormPeriodReport();
@@ -405,11 +453,18 @@ private:
     mutable std::mutex dynamicMutex_;
     FormRefreshLimiter refreshLimiter_;
     std::map<int64_t, FormTimer> intervalTimerTasks_;
-    std::list<UpdateAtItem> updateAtTimerTasks_;
-    std::list<DynamicRefreshItem> dynamicRefreshTasks_;
+    // (next fire time, formId) of interval tasks, a tick only visits the due head of the queue.
+    std::set<std::pair<int64_t, int64_t>> intervalTimerQueue_;
+    // keyed by update at time (minute of day)
+    std::multimap<long, UpdateAtItem> updateAtTimerTasks_;
+    // keyed by setted time, dynamicRefreshTimes_ maps formId to the key of its item.
+    std::multimap<int64_t, DynamicRefreshItem> dynamicRefreshTasks_;
+    std::unordered_map<int64_t, int64_t> dynamicRefreshTimes_;
     std::shared_ptr<TimerReceiver> systemTimerEventReceiver_ = nullptr;
     std::shared_ptr<TimerReceiver> customTimerEventReceiver_ = nullptr;
     int32_t timeSpeed_ = 1;
+    // Interval tasks due within this window of a refresh of the same provider join it, 0 disables alignment.
+    int64_t alignWindow_ = 0;
 
     uint64_t intervalTimerId_ = 0L;
     uint64_t updateAtTimerId_ = 0L;
@@ -427,6 +482,7 @@ private:
     std::shared_ptr<WantAgent> currentLimiterWantAgent_ = nullptr;
 
     int64_t dynamicWakeUpTime_ = INT64_MAX;
+    int64_t intervalWakeUpTime_ = INT64_MAX;
     long atTimerWakeUpTime_ = LONG_MAX;
 };
 }  // namespace AppExecFwk
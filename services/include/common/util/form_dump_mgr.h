@@ -108,6 +108,12 @@ public:
 
     void AppendLiveFormStatus(const std::string &formId,
         const std::unordered_map<std::string, std::string> &liveFormStatusMap, std::string &formInfo) const;
+
+    /**
+     * @brief Dump depth, wait and execute time histograms of the serial queues of the process.
+     * @param queueInfos The dump info of the queues.
+     */
+    void DumpQueueInfos(std::string &queueInfos) const;
 private:
     void AppendBundleFormInfo(const FormRecord &formRecordInfo, std::string &formInfo) const;
     void AppendFormStatus(const int64_t formId, std::string &formInfo) const;
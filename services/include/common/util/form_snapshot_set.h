@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_SNAPSHOT_SET_H
+#define OHOS_FORM_FWK_FORM_SNAPSHOT_SET_H
+
+#include <memory>
+#include <set>
+#include <string>
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class FormSnapshotSet
+ * A string set read through an immutable snapshot that is swapped atomically, so a lookup never
+ * waits on a writer. A write copies the set and publishes the copy; writers are rare and must be
+ * serialized by the caller.
+ */
+class FormSnapshotSet {
+public:
+    using Snapshot = std::shared_ptr<const std::set<std::string>>;
+
+    FormSnapshotSet() : snapshot_(std::make_shared<const std::set<std::string>>()) {}
+
+    Snapshot GetSnapshot() const
+    {
+        return std::atomic_load_explicit(&snapshot_, std::memory_order_acquire);
+    }
+
+    bool Contains(const std::string &key) const
+    {
+        return GetSnapshot()->count(key) != 0;
+    }
+
+    void Reset(std::set<std::string> &&keys)
+    {
+        Publish(std::make_shared<const std::set<std::string>>(std::move(keys)));
+    }
+
+    /**
+     * @brief Publish a snapshot with the key added.
+     * @param key The key to add.
+     * @return Returns false if the key is already present.
+     */
+    bool Insert(const std::string &key)
+    {
+        Snapshot current = GetSnapshot();
+        if (current->count(key) != 0) {
+            return false;
+        }
+        auto next = std::make_shared<std::set<std::string>>(*current);
+        next->insert(key);
+        Publish(std::move(next));
+        return true;
+    }
+
+    /**
+     * @brief Publish a snapshot with the key removed.
+     * @param key The key to remove.
+     * @return Returns false if the key is absent.
+     */
+    bool Erase(const std::string &key)
+    {
+        Snapshot current = GetSnapshot();
+        if (current->count(key) == 0) {
+            return false;
+        }
+        auto next = std::make_shared<std::set<std::string>>(*current);
+        next->erase(key);
+        Publish(std::move(next));
+        return true;
+    }
+
+private:
+    void Publish(Snapshot next)
+    {
+        std::atomic_store_explicit(&snapshot_, std::move(next), std::memory_order_release);
+    }
+
+    Snapshot snapshot_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif // OHOS_FORM_FWK_FORM_SNAPSHOT_SET_H
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_BINARY_CODEC_H
+#define OHOS_FORM_FWK_FORM_BINARY_CODEC_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @brief Kind of record carried by a binary encoded value.
+ */
+enum class FormBinaryRecordType : uint8_t {
+    INNER_FORM_INFO = 1,
+    FORM_INFO_STORAGES = 2,
+};
+
+/**
+ * @brief Schema version written into the header of every binary record.
+ */
+constexpr uint8_t FORM_BINARY_SCHEMA_VERSION = 1;
+
+/**
+ * @brief A field payload referenced by FormBinaryReader, valid while the decoded buffer is alive.
+ */
+struct FormBinaryField {
+    uint32_t tag = 0;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+
+/**
+ * @class FormBinaryWriter
+ * Encodes a record as [magic][schema version][record type] followed by fields laid out as
+ * [varint tag][varint length][payload]. A writer built without a record type emits bare
+ * fields, used for records nested into a field of another record.
+ */
+class FormBinaryWriter {
+public:
+    FormBinaryWriter() = default;
+
+    explicit FormBinaryWriter(FormBinaryRecordType type);
+
+    void WriteInt32(uint32_t tag, int32_t value);
+
+    void WriteInt64(uint32_t tag, int64_t value);
+
+    void WriteBool(uint32_t tag, bool value);
+
+    void WriteString(uint32_t tag, const std::string &value);
+
+    void WriteBytes(uint32_t tag, const std::vector<uint8_t> &value);
+
+    void WriteInt32Array(uint32_t tag, const std::vector<int32_t> &values);
+
+    const std::vector<uint8_t> &GetData() const
+    {
+        return data_;
+    }
+
+private:
+    void WriteVarint(uint64_t value);
+
+    void WriteFixed(uint32_t tag, uint64_t value, size_t size);
+
+    void WriteField(uint32_t tag, const uint8_t *payload, size_t size);
+
+    std::vector<uint8_t> data_;
+};
+
+/**
+ * @class FormBinaryReader
+ * Indexes the fields of a record without decoding them, payloads are decoded on access so
+ * fields a caller never asks for cost nothing beyond the index. Unknown tags are ignored,
+ * which keeps records written by a newer schema readable.
+ */
+class FormBinaryReader {
+public:
+    /**
+     * @brief Check whether a stored value is a binary record rather than a legacy JSON text.
+     * @param data The stored value.
+     * @return Returns true if the value starts with the binary record magic.
+     */
+    static bool IsBinary(const std::string &data);
+
+    /**
+     * @brief Validate the header of a top-level record and index its fields.
+     * @param data The stored value, must outlive the reader.
+     * @param type The expected record type.
+     * @return Returns true on success, false if the value is malformed.
+     */
+    bool Init(const std::string &data, FormBinaryRecordType type);
+
+    /**
+     * @brief Index the fields of a record nested into a field of another record.
+     * @param field The field holding the nested record.
+     * @return Returns true on success, false if the value is malformed.
+     */
+    bool InitNested(const FormBinaryField &field);
+
+    uint8_t GetSchemaVersion() const
+    {
+        return schemaVersion_;
+    }
+
+    bool ReadInt32(uint32_t tag, int32_t &value) const;
+
+    bool ReadInt64(uint32_t tag, int64_t &value) const;
+
+    bool ReadBool(uint32_t tag, bool &value) const;
+
+    bool ReadString(uint32_t tag, std::string &value) const;
+
+    bool ReadInt32Array(uint32_t tag, std::vector<int32_t> &values) const;
+
+    /**
+     * @brief Get all occurrences of a repeated field, in written order.
+     * @param tag The field tag.
+     * @param fields The field payloads.
+     */
+    void ReadRepeated(uint32_t tag, std::vector<FormBinaryField> &fields) const;
+
+private:
+    bool IndexFields(const uint8_t *data, size_t size);
+
+    const FormBinaryField *FindField(uint32_t tag) const;
+
+    bool ReadFixed(uint32_t tag, size_t size, uint64_t &value) const;
+
+    uint8_t schemaVersion_ = 0;
+    std::vector<FormBinaryField> fields_;
+    // <tag, index of its first field>
+    std::unordered_map<uint32_t, size_t> fieldIndexes_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // OHOS_FORM_FWK_FORM_BINARY_CODEC_H
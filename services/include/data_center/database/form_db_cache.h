@@ -18,7 +18,10 @@
 
 #include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <singleton.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "common/util/form_id_key.h"
@@ -222,8 +225,41 @@ private:
         std::vector<FormDBInfo> &dbFormInfos);
     void GetFormDBInfoCacheByUserId(const int32_t providerUserId, std::vector<FormDBInfo> &dbFormInfos);
 
-    mutable std::mutex formDBInfosMutex_;
-    std::vector<FormDBInfo> formDBInfos_;
+    /**
+     * @brief Insert or replace form data in DbCache and keep all indexes in sync.(NoLock)
+     * @param formDBInfo Form data.
+     */
+    void InsertFormDBInfoNolock(const FormDBInfo &formDBInfo);
+
+    /**
+     * @brief Erase form data from DbCache and keep all indexes in sync.(NoLock)
+     * @param formId form data Id.
+     * @return Returns true if the form data existed.
+     */
+    bool EraseFormDBInfoNolock(int64_t formId);
+
+    void AddFormDBInfoIndexNolock(const FormDBInfo &formDBInfo);
+    void RemoveFormDBInfoIndexNolock(const FormDBInfo &formDBInfo);
+
+    struct BundleUserKeyHash {
+        size_t operator()(const std::pair<std::string, int32_t> &key) const
+        {
+            return std::hash<std::string>()(key.first) ^ (std::hash<int32_t>()(key.second) << 1);
+        }
+    };
+
+    mutable std::shared_mutex formDBInfosMutex_;
+    // formId -> form data, the primary store.
+    std::unordered_map<int64_t, FormDBInfo> formDBInfos_;
+    // (bundleName, providerUserId) -> formIds.
+    std::unordered_map<std::pair<std::string, int32_t>, std::unordered_set<int64_t>, BundleUserKeyHash>
+        bundleUserIndex_;
+    // providerUserId -> formIds.
+    std::unordered_map<int32_t, std::unordered_set<int64_t>> providerUserIndex_;
+    // userId -> form counts.
+    std::unordered_map<int32_t, int32_t> userIdFormCounts_;
+    // host uid -> form counts, resolved to host bundle name on query.
+    std::unordered_map<int32_t, int32_t> hostUidFormCounts_;
     mutable std::mutex multiAppFormVersionCodeMutex_;
     std::map<std::string, uint32_t> multiAppFormVersionCodeMap_;
 };
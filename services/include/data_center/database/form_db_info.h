@@ -238,6 +238,19 @@ public:
      */
     bool FromJson(const nlohmann::json &jsonObject);
 
+    /**
+     * @brief Encode the InnerFormInfo object as a binary record.
+     * @return Returns the encoded record.
+     */
+    std::vector<uint8_t> ToBinary() const;
+
+    /**
+     * @brief Decode a binary record produced by ToBinary.
+     * @param data Indicates the stored value.
+     * @return Returns true on success, false on failure.
+     */
+    bool FromBinary(const std::string &data);
+
     /**
      * @brief Get application form id.
      * @return Returns the form id.
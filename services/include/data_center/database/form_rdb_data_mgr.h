@@ -55,6 +55,62 @@ private:
     std::string rdbPath_;
 };
 
+/**
+ * @class FormRdbWriteBatch
+ * Puts and deletes across tables, committed together by FormRdbDataMgr::WriteBatch.
+ */
+class FormRdbWriteBatch {
+public:
+    /**
+     * @brief Insert or replace the value of key.
+     * @param tableName The name of a key-value table.
+     * @param key The data's key.
+     * @param value The data's value.
+     */
+    void Put(const std::string &tableName, const std::string &key, const std::string &value);
+
+    /**
+     * @brief Insert or replace the value of key together with its binary encoding.
+     * @param tableName The name of a key-value table.
+     * @param key The data's key.
+     * @param value The data's json value, read by versions that do not know the binary encoding.
+     * @param binaryValue The data's binary value, preferred by QueryData.
+     */
+    void Put(const std::string &tableName, const std::string &key, const std::string &value,
+        const std::vector<uint8_t> &binaryValue);
+
+    /**
+     * @brief Insert or replace a row.
+     * @param tableName The name of table to be insert.
+     * @param valuesBucket The bucket of values.
+     */
+    void Put(const std::string &tableName, const NativeRdb::ValuesBucket &valuesBucket);
+
+    /**
+     * @brief Delete the value of key.
+     * @param tableName The name of a key-value table.
+     * @param key The data's key.
+     */
+    void Delete(const std::string &tableName, const std::string &key);
+
+    bool IsEmpty() const;
+
+    size_t Size() const;
+
+private:
+    friend class FormRdbDataMgr;
+
+    struct Operation {
+        std::string tableName;
+        std::string key;
+        NativeRdb::ValuesBucket valuesBucket;
+        bool isDelete = false;
+    };
+
+    std::vector<Operation> operations_;
+    size_t dataSize_ = 0;
+};
+
 /**
  * @class FormRdbDataMgr
  * Form Rdb Data Manager.
@@ -83,6 +139,17 @@ public:
      */
     ErrCode InsertData(const std::string &tableName, const std::string &key, const std::string &value);
 
+    /**
+     * @brief Insert the form data in DB together with its binary encoding.
+     * @param tableName The name of table to be inserted
+     * @param key The data's key.
+     * @param value the data's json value, read by versions that do not know the binary encoding.
+     * @param binaryValue the data's binary value, read back as a byte string by QueryData.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode InsertData(const std::string &tableName, const std::string &key, const std::string &value,
+        const std::vector<uint8_t> &binaryValue);
+
     /**
      * @brief Delete the form data in DB.
      * @param tableName The name of table to be excute deleted action.
@@ -164,6 +231,13 @@ public:
     bool InsertData(
         const std::string &tableName, const NativeRdb::ValuesBucket &valuesBucket, int64_t &rowId);
 
+    /**
+     * @brief Commit all operations of a batch in one transaction.
+     * @param batch The puts and deletes to be committed, in order.
+     * @return Returns ERR_OK when every operation is committed, others when the batch is rolled back.
+     */
+    ErrCode WriteBatch(const FormRdbWriteBatch &batch);
+
     /**
      * @brief Delete data in DB.
      * @param absRdbPredicates The rdb's predicates to be delete.
@@ -192,6 +266,15 @@ private:
 
     void UpdateWriteCount(size_t dataSize);
 
+    ErrCode InsertKeyValueData(const std::string &tableName, const std::string &key,
+        const NativeRdb::ValuesBucket &valuesBucket, size_t dataSize);
+
+    void AddBinaryValueColumn(const std::shared_ptr<NativeRdb::RdbStore> &rdbStore, const std::string &tableName);
+
+    void UpdateBatchStatistics(size_t batchSize, int64_t commitCost);
+
+    int32_t ExecuteWriteBatch(const std::shared_ptr<NativeRdb::RdbStore> &rdbStore, const FormRdbWriteBatch &batch);
+
     void PrintStatistics();
 
     std::map<std::string, FormRdbTableConfig> formRdbTableCfgMap_;
@@ -202,6 +285,11 @@ private:
     std::atomic<int64_t> readCount_ = 0;
     std::atomic<int64_t> writeCount_ = 0;
     std::atomic<int64_t> writeSize_ = 0;
+    std::atomic<int64_t> batchCount_ = 0;
+    std::atomic<int64_t> batchOperationCount_ = 0;
+    std::atomic<int64_t> maxBatchSize_ = 0;
+    std::atomic<int64_t> batchCommitCost_ = 0;
+    std::atomic<int64_t> maxBatchCommitCost_ = 0;
     std::atomic<bool> timerInitialized_ = false;
 };
 } // namespace AppExecFwk
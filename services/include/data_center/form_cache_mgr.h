@@ -15,11 +15,15 @@
 #ifndef OHOS_FORM_FWK_FORM_CACHE_MGR_H
 #define OHOS_FORM_FWK_FORM_CACHE_MGR_H
 
+#include <atomic>
+#include <list>
 #include <map>
 #include <mutex>
 #include <singleton.h>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "form_provider_data.h"
 #include "data_center/database/form_rdb_data_mgr.h"
@@ -71,6 +75,18 @@ public:
      * @return Returns true on success, false otherwise.
      */
     bool GetFormCacheIds(std::unordered_set<int64_t> &formIds);
+
+    /**
+     * @brief Write every pending cache entry to db in one transaction.
+     * @param isReleaseMemory Also drop the in-memory LRU tier, used on low memory.
+     */
+    void FlushDirtyData(bool isReleaseMemory = false);
+
+    /**
+     * @brief Dump hit rate, dirty entry count and flush latency of the in-memory tier.
+     * @param result The dump result.
+     */
+    void DumpStatistics(std::string &result) const;
 private:
     void CreateFormCacheTable();
     bool GetDataCacheFromDb(int64_t formId, FormCache &formCache) const;
@@ -80,6 +96,9 @@ private:
     bool SaveImgCacheToDb(const std::vector<uint8_t> &value, int32_t size, int64_t &rowId);
     bool DeleteImgCacheInDb(const std::string &rowId);
     bool DeleteImgCachesInDb(const std::vector<std::string> &rowIds);
+    bool GetImgFromStore(const std::string &hash, std::vector<uint8_t> &blob, int32_t &size) const;
+    bool SaveImgToStore(const std::string &hash, const std::vector<uint8_t> &value, int32_t size);
+    bool DeleteImgsInStore(const std::vector<std::string> &hashes);
 
     bool AddCacheData(const FormProviderData &formProviderData, FormCache &formCache);
     bool AddImgData(const FormProviderData &formProviderData, FormCache &formCache);
@@ -89,9 +108,54 @@ private:
         const std::string& picName, const sptr<Ashmem> &ashmem, int32_t len, std::vector<uint8_t> &value);
     bool InnerGetImageData(const FormCache &formCache,
         std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> &imageDataMap) const;
+    bool GetImageDataByHash(const std::string &picName, const std::string &hash,
+        std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> &imageDataMap) const;
+    void AddStaleImgNolock(const nlohmann::json &imgCacheObj);
     void ResetCacheStateAfterReboot();
 
+    bool GetFormCacheNolock(int64_t formId, FormCache &formCache) const;
+    void PutLruCacheNolock(int64_t formId, const FormCache &formCache) const;
+    void EraseCacheNolock(int64_t formId);
+    bool AddDirtyCacheNolock(int64_t formId, const FormCache &formCache);
+    void LoadImgRefCountsNolock();
+    bool AcquireImgNolock(const std::string &hash, const std::vector<uint8_t> &value, int32_t size);
+    void ReleaseImgsNolock(const std::vector<std::string> &hashes);
+    void PutImgAshmemNolock(const std::string &hash, const std::pair<sptr<FormAshmem>, int32_t> &imageData) const;
+    void EraseImgAshmemNolock(const std::string &hash);
+
     mutable std::mutex cacheMutex_;
+    // Serializes flush commits with DeleteData so a flush never resurrects a deleted row.
+    std::mutex flushMutex_;
+    // Most recently used entry at the front, bounded by LRU_CACHE_CAPACITY.
+    mutable std::list<std::pair<int64_t, FormCache>> lruCaches_;
+    mutable std::unordered_map<int64_t, std::list<std::pair<int64_t, FormCache>>::iterator> lruIndex_;
+    // Write-behind entries waiting for the next flush, one per formId.
+    std::unordered_map<int64_t, FormCache> dirtyCaches_;
+    // Entries taken by the running flush, still readable until their batch commits.
+    std::unordered_map<int64_t, FormCache> inFlightCaches_;
+    // Image rows replaced by a pending entry, deleted once the entry is committed.
+    std::vector<std::string> staleImgRowIds_;
+    // Image hashes replaced by a pending entry, released once the entry is committed.
+    std::vector<std::string> staleImgHashes_;
+    // References of img_store rows held by form_cache rows and pending entries, rebuilt on first use.
+    std::unordered_map<std::string, int32_t> imgRefCounts_;
+    bool isImgRefCountLoaded_ = false;
+    // Rows are only deleted when every reference in form_cache has been counted.
+    bool isImgRefCountReliable_ = false;
+    // Materialised ashmem per image hash, shared by every read of that image, most recently used at the front.
+    mutable std::list<std::pair<std::string, std::pair<sptr<FormAshmem>, int32_t>>> imgAshmems_;
+    mutable std::unordered_map<std::string,
+        std::list<std::pair<std::string, std::pair<sptr<FormAshmem>, int32_t>>>::iterator> imgAshmemIndex_;
+    bool isFlushScheduled_ = false;
+    mutable std::atomic<int64_t> hitCount_ = 0;
+    mutable std::atomic<int64_t> missCount_ = 0;
+    std::atomic<int64_t> coalescedCount_ = 0;
+    std::atomic<int64_t> imgReuseCount_ = 0;
+    mutable std::atomic<int64_t> ashmemReuseCount_ = 0;
+    std::atomic<int64_t> flushCount_ = 0;
+    std::atomic<int64_t> lastFlushCost_ = 0;
+    std::atomic<int64_t> maxFlushCost_ = 0;
+    std::atomic<int64_t> totalFlushCost_ = 0;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -17,11 +17,13 @@
 #define OHOS_FORM_FWK_FORM_FORM_DATA_MGR_H
 
 #include <map>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <set>
 #include <singleton.h>
 #include <string>
+#include <unordered_map>
 
 #include "bundle_pack_info.h"
 #include "form_constants.h"
@@ -175,6 +177,12 @@ public:
      * @return Returns true if this function is successfully called; returns false otherwise.
      */
     bool GetFormRecord(const int64_t formId, FormRecord &formRecord) const;
+    /**
+     * @brief Get an immutable snapshot of form record, the stored record is shared until it is modified.
+     * @param formId The Id of the form.
+     * @return Returns the snapshot, or nullptr if the form does not exist.
+     */
+    std::shared_ptr<const FormRecord> GetFormRecordSnapshot(const int64_t formId) const;
     /**
      * @brief Get form record.
      * @param bundleName Bundle name.
@@ -1301,6 +1309,55 @@ private:
     ErrCode CheckEnoughFormOnDevice(const int callingUid,
         const int32_t currentUserId = Constants::DEFAULT_USER_ID) const;
 
+    /**
+     * @brief Emplace form record and add it to the query indexes, keep the record if formId exists.(NoLock)
+     * @param formId The Id of the form.
+     * @param record The form record.
+     * @return Returns true if the record is inserted.
+     */
+    bool EmplaceFormRecordNolock(const int64_t formId, const FormRecord &record);
+
+    /**
+     * @brief Erase form record and remove it from the query indexes.(NoLock)
+     * @param formId The Id of the form.
+     * @return Returns true if the record existed.
+     */
+    bool EraseFormRecordNolock(const int64_t formId);
+
+    /**
+     * @brief Erase form record and remove it from the query indexes.(NoLock)
+     * @param iter The iterator of the form record.
+     * @return Returns the iterator following the removed record.
+     */
+    std::map<int64_t, std::shared_ptr<FormRecord>>::iterator EraseFormRecordNolock(
+        std::map<int64_t, std::shared_ptr<FormRecord>>::iterator iter);
+
+    /**
+     * @brief Get form record for writing, copy it first if a snapshot still shares it.(NoLock)
+     * @param record The stored form record.
+     * @return Returns the form record that is safe to modify.
+     */
+    FormRecord &MutableFormRecordNolock(std::shared_ptr<FormRecord> &record);
+
+    /**
+     * @brief Clear all form records and query indexes.(NoLock)
+     */
+    void ClearFormRecordsNolock();
+
+    void AddFormRecordIndexNolock(const int64_t formId, const FormRecord &record);
+    void RemoveFormRecordIndexNolock(const int64_t formId, const FormRecord &record);
+
+    /**
+     * @brief Get form ids from index by key, form ids are in ascending order.(NoLock)
+     */
+    template<typename Key, typename Index>
+    const std::set<int64_t> &GetIndexedFormIdsNolock(const Index &index, const Key &key) const
+    {
+        static const std::set<int64_t> emptyFormIds;
+        auto iter = index.find(key);
+        return iter == index.end() ? emptyFormIds : iter->second;
+    }
+
     mutable std::mutex formRecordMutex_;
     mutable std::mutex formHostRecordMutex_;
     mutable std::mutex formTempMutex_;
@@ -1310,7 +1367,13 @@ private:
     mutable std::mutex formConfigMapMutex_;
     mutable std::mutex formCloudUpdateDurationMapMutex_;
     mutable std::shared_mutex formVisibleMapMutex_;
-    std::map<int64_t, FormRecord> formRecords_;
+    // Copy on write: a record shared with a snapshot is copied before it is modified.
+    std::map<int64_t, std::shared_ptr<FormRecord>> formRecords_;
+    // Secondary indexes of formRecords_, guarded by formRecordMutex_.
+    std::unordered_map<std::string, std::set<int64_t>> bundleFormIds_;
+    std::map<std::pair<std::string, std::string>, std::set<int64_t>> moduleFormIds_;
+    std::unordered_map<int32_t, std::set<int64_t>> userFormIds_;
+    std::unordered_map<int32_t, std::set<int64_t>> providerUserFormIds_;
     std::vector<FormHostRecord> clientRecords_;
     std::vector<int64_t> tempForms_;
     std::map<std::string, FormHostRecord> formStateRecord_;
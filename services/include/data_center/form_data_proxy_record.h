@@ -21,6 +21,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "data_center/form_data_proxy_subscription_registry.h"
 #include "datashare_helper.h"
 #include "form_ashmem.h"
 #include "form_provider_data_proxy.h"
@@ -51,6 +52,16 @@ public:
     void UnRegisterPermissionListener();
     void PermStateChangeCallback(const int32_t permStateChangeType, const std::string permissionName);
     void SetWant(const AAFwk::Want &want);
+    /**
+     * @brief Update the form with rdb data decoded by the subscription registry.
+     * @param formDataStr The merged rdb data.
+     */
+    void ApplyRdbDataChange(const std::string &formDataStr);
+    /**
+     * @brief Update the form with published data decoded by the subscription registry.
+     * @param change The decoded change, its image items are prepared for this form.
+     */
+    void ApplyPublishedDataChange(const FormDataProxyChange &change);
 private:
     struct FormDataProxyRequest {
         int64_t subscribeId;
@@ -104,7 +115,8 @@ private:
     void GetSubscribeFormDataProxies(const FormDataProxy formdataProxy,
         std::vector<FormDataProxy> &subscribeFormDataProxies, std::vector<FormDataProxy> &unsubscribeFormDataProxies);
 
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper_;
+    // shared with the other forms of the provider bundle
+    std::shared_ptr<FormDataShareClient> dataShareHelper_;
     std::shared_ptr<Security::AccessToken::PermStateChangeCallbackCustomize> callbackPtr_;
     int64_t formId_ = -1;
     std::string bundleName_;
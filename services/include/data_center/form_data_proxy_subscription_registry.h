@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_DATA_PROXY_SUBSCRIPTION_REGISTRY_H
+#define OHOS_FORM_FWK_FORM_DATA_PROXY_SUBSCRIPTION_REGISTRY_H
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <singleton.h>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "datashare_helper.h"
+#include "nlohmann/json.hpp"
+
+namespace OHOS {
+namespace AppExecFwk {
+class FormDataProxyRecord;
+
+/**
+ * @class FormDataShareClient
+ * DataShare helper of one provider bundle, shared by all data proxy forms of the bundle.
+ */
+class FormDataShareClient {
+public:
+    using RdbCallback = std::function<void(const DataShare::RdbChangeNode &changeNode)>;
+    using PublishedCallback = std::function<void(const DataShare::PublishedDataChangeNode &changeNode)>;
+
+    FormDataShareClient(const std::string &bundleName, std::shared_ptr<DataShare::DataShareHelper> dataShareHelper);
+    virtual ~FormDataShareClient();
+
+    /**
+     * @brief Create the client of a provider bundle.
+     * @param bundleName The provider bundle name.
+     * @return Returns nullptr if the DataShare helper could not be created.
+     */
+    static std::shared_ptr<FormDataShareClient> Create(const std::string &bundleName);
+
+    virtual std::vector<DataShare::OperationResult> SubscribeRdbData(const std::vector<std::string> &uris,
+        int64_t subscriberId, const RdbCallback &callback);
+    virtual std::vector<DataShare::OperationResult> SubscribePublishedData(const std::vector<std::string> &uris,
+        int64_t subscriberId, const PublishedCallback &callback);
+    virtual std::vector<DataShare::OperationResult> Unsubscribe(bool isRdbType,
+        const std::vector<std::string> &uris, int64_t subscriberId);
+    virtual std::vector<DataShare::OperationResult> SetSubsState(bool isRdbType,
+        const std::vector<std::string> &uris, int64_t subscriberId, bool subsState);
+
+    const std::string &GetBundleName() const
+    {
+        return bundleName_;
+    }
+
+private:
+    std::string bundleName_;
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper_;
+};
+
+/**
+ * @brief A decoded published data change, shared by the forms that observe the same items.
+ */
+struct FormDataProxyChange {
+    // parsed json items, the image items are added per form
+    nlohmann::json object;
+    // dumped object, valid when there is no image item
+    std::string formDataStr;
+    std::string formDataKeys;
+    // items of the change node, only valid while the change is dispatched
+    std::vector<const DataShare::PublishedDataItem *> imageItems;
+};
+
+/**
+ * @class FormDataProxySubscriptionRegistry
+ * Process-wide registry of the DataShare subscriptions of data proxy forms. Forms observing the same
+ * (type, uri, subscriberId) share one subscription, the uri carries the user id. A change is decoded
+ * once and fanned out to every form of the subscription.
+ */
+class FormDataProxySubscriptionRegistry final : public DelayedRefSingleton<FormDataProxySubscriptionRegistry> {
+    DECLARE_DELAYED_REF_SINGLETON(FormDataProxySubscriptionRegistry)
+public:
+    DISALLOW_COPY_AND_MOVE(FormDataProxySubscriptionRegistry);
+
+    /**
+     * @brief Get the client of a provider bundle, created when no form of the bundle holds one.
+     * @param bundleName The provider bundle name.
+     * @return Returns nullptr if the client could not be created.
+     */
+    std::shared_ptr<FormDataShareClient> AcquireClient(const std::string &bundleName);
+
+    /**
+     * @brief Attach a form to the subscriptions of the uris, only uris nobody subscribed successfully yet
+     *        are subscribed at DataShare.
+     * @return Returns the subscribe result of each uri.
+     */
+    std::vector<DataShare::OperationResult> Subscribe(bool isRdbType, int64_t formId,
+        const std::shared_ptr<FormDataProxyRecord> &record, const std::shared_ptr<FormDataShareClient> &client,
+        const std::vector<std::string> &uris, int64_t subscriberId);
+
+    /**
+     * @brief Detach a form from the subscriptions of the uris, a subscription without forms is unsubscribed.
+     */
+    void Unsubscribe(bool isRdbType, int64_t formId, const FormDataProxyRecord *record,
+        const std::vector<std::string> &uris, int64_t subscriberId);
+
+    /**
+     * @brief Enable or disable a form, a subscription is enabled at DataShare while any of its forms is.
+     * @return Returns the result of each uri.
+     */
+    std::vector<DataShare::OperationResult> SetSubsState(bool isRdbType, int64_t formId,
+        const FormDataProxyRecord *record, const std::vector<std::string> &uris, int64_t subscriberId,
+        bool subsState);
+
+    /**
+     * @brief Detach a destroyed form from all of its subscriptions.
+     */
+    void DetachForm(int64_t formId, const FormDataProxyRecord *record);
+
+    size_t GetSubscriptionCount();
+
+    int64_t GetDecodeCount() const;
+
+    static std::string DecodeRdbData(const std::vector<std::string> &data);
+
+    static void DecodePublishedData(const std::vector<DataShare::PublishedDataItem> &data,
+        FormDataProxyChange &change);
+
+private:
+    // isRdbType, uri, subscriberId
+    using SubscriptionKey = std::tuple<bool, std::string, int64_t>;
+
+    struct FormSubscriber {
+        std::weak_ptr<FormDataProxyRecord> record;
+        // identifies the record after it expired
+        const FormDataProxyRecord *recordPtr = nullptr;
+        bool isEnabled = true;
+    };
+
+    struct Subscription {
+        std::shared_ptr<FormDataShareClient> client;
+        int32_t ret = 0;
+        std::map<int64_t, FormSubscriber> subscribers;
+        // the data items last changed, sent to the forms joining the subscription
+        nlohmann::json lastData = nlohmann::json::object();
+    };
+
+    struct SubscriptionRelease {
+        std::shared_ptr<FormDataShareClient> client;
+        std::vector<std::string> unsubscribeUris;
+        std::vector<std::string> disableUris;
+    };
+
+    // client, isRdbType, subscriberId
+    using ReleaseKey = std::tuple<const FormDataShareClient *, bool, int64_t>;
+
+    void OnRdbDataChange(const std::vector<std::string> &uris, int64_t subscriberId,
+        const DataShare::RdbChangeNode &changeNode);
+    void OnPublishedDataChange(const std::vector<std::string> &uris, int64_t subscriberId,
+        const DataShare::PublishedDataChangeNode &changeNode);
+    void SendInitialData(bool isRdbType, const std::shared_ptr<FormDataProxyRecord> &record,
+        const nlohmann::json &data);
+    void CollectRecordsNolock(const Subscription &subscription,
+        std::map<const FormDataProxyRecord *, std::shared_ptr<FormDataProxyRecord>> &records) const;
+    void DetachSubscriberNolock(std::map<SubscriptionKey, Subscription>::iterator iter, int64_t formId,
+        const FormDataProxyRecord *record, std::map<ReleaseKey, SubscriptionRelease> &releases);
+    void ApplyReleases(const std::map<ReleaseKey, SubscriptionRelease> &releases);
+    static bool IsSubscriptionEnabled(const Subscription &subscription);
+    static nlohmann::json ParseRdbData(const std::vector<std::string> &data);
+    static std::vector<nlohmann::json> ParsePublishedData(const std::vector<DataShare::PublishedDataItem> &data);
+    static void BuildPublishedDataChange(const std::vector<DataShare::PublishedDataItem> &data,
+        const std::vector<nlohmann::json> &parsedData, const std::vector<size_t> &indexes,
+        FormDataProxyChange &change);
+
+    // serializes the writers, which call DataShare outside subscriptionMutex_
+    std::mutex subscribeMutex_;
+    std::mutex subscriptionMutex_;
+    std::map<SubscriptionKey, Subscription> subscriptions_;
+    std::mutex clientMutex_;
+    std::map<std::string, std::weak_ptr<FormDataShareClient>> clients_;
+    std::function<std::shared_ptr<FormDataShareClient>(const std::string &)> clientCreator_;
+    std::atomic<int64_t> decodeCount_ = 0;
+};
+} // namespace AppExecFwk
+} // namespace OHOS
+
+#endif // OHOS_FORM_FWK_FORM_DATA_PROXY_SUBSCRIPTION_REGISTRY_H
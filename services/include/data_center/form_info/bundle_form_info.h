@@ -29,6 +29,8 @@
 
 namespace OHOS {
 namespace AppExecFwk {
+class FormRdbWriteBatch;
+
 class BundleFormInfo {
 public:
     explicit BundleFormInfo(const std::string &bundleName);
@@ -37,6 +39,8 @@ public:
 
     ErrCode UpdateStaticFormInfos(std::vector<FormInfo> &formInfos, int32_t userId);
 
+    ErrCode UpdateStaticFormInfos(std::vector<FormInfo> &formInfos, int32_t userId, FormRdbWriteBatch &batch);
+
     ErrCode Remove(int32_t userId);
 
     ErrCode AddDynamicFormInfo(const FormInfo &formInfo, int32_t userId);
@@ -67,6 +71,12 @@ public:
 private:
     ErrCode UpdateFormInfoStorageLocked();
 
+    ErrCode UpdateFormInfoStorageLocked(FormRdbWriteBatch &batch);
+
+    ErrCode SerializeFormInfoStorageLocked(std::string &formInfoStoragesStr) const;
+
+    void UpdateStaticFormInfosLocked(std::vector<FormInfo> &formInfos, int32_t userId);
+
     void HandleFormInfosMaxLimit(std::vector<FormInfo> &inFormInfos,
         std::vector<FormInfo> &outFormInfos, const std::vector<FormDBInfo> &formDBInfos);
 
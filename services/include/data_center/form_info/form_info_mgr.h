@@ -23,6 +23,7 @@
 
 #include "appexecfwk_errors.h"
 #include "bundle_form_info.h"
+#include "data_center/form_info/form_info_query_index.h"
 #include "form_custom_config.h"
 #include "bundle_info.h"
 #include "form_info.h"
@@ -65,6 +66,23 @@ public:
 
     ErrCode GetFormsInfoByRecord(const FormRecord &formRecord, FormInfo &formInfo);
 
+    /**
+     * @brief Get all forms of the user as a shared snapshot, which is not copied per query.
+     * @param formInfos The snapshot, valid until the caller drops it.
+     * @param userId The user id.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode GetAllFormsInfo(FormInfosSnapshot &formInfos, int32_t userId = Constants::INVALID_USER_ID);
+
+    ErrCode GetFormsInfoByBundle(
+        const std::string &bundleName, FormInfosSnapshot &formInfos, int32_t userId = Constants::INVALID_USER_ID);
+
+    ErrCode GetFormsInfoByModule(const std::string &bundleName, const std::string &moduleName,
+        FormInfosSnapshot &formInfos, int32_t userId = Constants::INVALID_USER_ID);
+
+    ErrCode GetFormsInfoByFilter(
+        const FormInfoFilter &filter, FormInfosSnapshot &formInfos, int32_t userId = Constants::INVALID_USER_ID);
+
     ErrCode GetFormsInfoByModuleWithoutCheck(const std::string &bundleName, const std::string &moduleName,
         std::vector<FormInfo> &formInfos, int32_t userId = Constants::INVALID_USER_ID);
 
@@ -99,18 +117,29 @@ public:
 private:
     std::shared_ptr<BundleFormInfo> GetOrCreateBundleFromInfo(const std::string &bundleName);
     static bool IsCaller(const std::string& bundleName);
+    static int32_t GetQueryUserId(int32_t userId);
+    static void AppendFormInfos(const FormInfosSnapshot &snapshot, std::vector<FormInfo> &formInfos);
+    ErrCode GetBundleFormsInfo(const std::string &bundleName, const std::string &moduleName, bool isTemplate,
+        FormInfosSnapshot &formInfos, int32_t userId);
     static bool CheckBundlePermission();
     static ErrCode CheckDynamicFormInfo(FormInfo &formInfo, const BundleInfo &bundleInfo);
     ErrCode LoadFormInfosFromDb();
+    static void MigrateFormInfoStorages(const std::string &bundleName, const std::string &formInfoStoragesJson,
+        FormRdbWriteBatch &batch);
     static ErrCode GetBundleVersionMap(std::map<std::string, std::uint32_t> &bundleVersionMap, int32_t userId);
     void UpdateBundleFormInfos(std::map<std::string, std::uint32_t> &bundleVersionMap, int32_t userId);
     void AddBundleFormInfos(const std::map<std::string, std::uint32_t>& bundleVersionMap, int32_t userId);
+    void UpdateBundleFormInfos(std::map<std::string, std::uint32_t> &bundleVersionMap, int32_t userId,
+        FormRdbWriteBatch &batch);
+    void AddBundleFormInfos(const std::map<std::string, std::uint32_t>& bundleVersionMap, int32_t userId,
+        FormRdbWriteBatch &batch);
     void ProcessBundleVersionMap(bool isNeedUpdateAll, int32_t userId,
         std::map<std::string, std::uint32_t> &bundleVersionMap,
         std::vector<std::string> &needUpdateBundleNames);
 
     mutable std::shared_timed_mutex bundleFormInfoMapMutex_ {};
     std::unordered_map<std::string, std::shared_ptr<BundleFormInfo>> bundleFormInfoMap_ {};
+    FormInfoQueryIndex queryIndex_;
     mutable std::shared_mutex reloadUserIdsMutex_;
     std::unordered_set<int32_t> reloadUserIds_;
     std::once_flag startOnceFlag_;
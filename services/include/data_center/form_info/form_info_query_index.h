@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_INFO_QUERY_INDEX_H
+#define OHOS_FORM_FWK_FORM_INFO_QUERY_INDEX_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "data_center/form_info/bundle_form_info.h"
+#include "form_info.h"
+#include "form_info_filter.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+using FormInfosSnapshot = std::shared_ptr<const std::vector<FormInfo>>;
+
+/**
+ * @class FormInfoQueryIndex
+ * Immutable form info query results, keyed by bundle, module, user and filter dimensions and shapes.
+ * Results are built from BundleFormInfo on the first query and shared until the bundle changes.
+ * Callers hold the lock of the bundle form info map while querying, writers invalidate after a change.
+ */
+class FormInfoQueryIndex {
+public:
+    using BundleFormInfoMap = std::unordered_map<std::string, std::shared_ptr<BundleFormInfo>>;
+
+    FormInfoQueryIndex() = default;
+    ~FormInfoQueryIndex() = default;
+
+    /**
+     * @brief Get the forms of a bundle, or of a module of the bundle if moduleName is not empty.
+     * @return Returns nullptr if bundleFormInfo is nullptr.
+     */
+    FormInfosSnapshot GetFormsInfo(const std::shared_ptr<BundleFormInfo> &bundleFormInfo,
+        const std::string &bundleName, const std::string &moduleName, int32_t userId, bool isTemplate);
+
+    FormInfosSnapshot GetAllFormsInfo(const BundleFormInfoMap &bundleFormInfoMap, int32_t userId, bool isTemplate);
+
+    FormInfosSnapshot GetFormsInfoByFilter(const BundleFormInfoMap &bundleFormInfoMap, const FormInfoFilter &filter,
+        int32_t userId);
+
+    void Invalidate(const std::string &bundleName);
+
+    void InvalidateAll();
+
+    int64_t GetBuildCount() const;
+
+private:
+    struct BundleIndex {
+        FormInfosSnapshot formInfos;
+        FormInfosSnapshot templateFormInfos;
+        std::unordered_map<std::string, FormInfosSnapshot> moduleFormInfos;
+        std::unordered_map<std::string, FormInfosSnapshot> moduleTemplateFormInfos;
+    };
+
+    std::shared_ptr<const BundleIndex> GetBundleIndex(const std::shared_ptr<BundleFormInfo> &bundleFormInfo,
+        const std::string &bundleName, int32_t userId);
+    static std::shared_ptr<const BundleIndex> BuildBundleIndex(BundleFormInfo &bundleFormInfo, int32_t userId);
+    static std::string GetFilterKey(const FormInfoFilter &filter, int32_t userId);
+
+    mutable std::mutex indexMutex_;
+    // bumped by every invalidation, results built across an invalidation are not kept
+    uint64_t generation_ = 0;
+    int64_t buildCount_ = 0;
+    // bundleName: userId: index
+    std::unordered_map<std::string, std::unordered_map<int32_t, std::shared_ptr<const BundleIndex>>> bundleIndex_;
+    std::unordered_map<int32_t, FormInfosSnapshot> allFormInfos_;
+    std::unordered_map<int32_t, FormInfosSnapshot> allTemplateFormInfos_;
+    std::unordered_map<std::string, FormInfosSnapshot> filterFormInfos_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif // OHOS_FORM_FWK_FORM_INFO_QUERY_INDEX_H
@@ -54,6 +54,45 @@ public:
      */
     ErrCode UpdateBundleFormInfos(const std::string &bundleName, const std::string &formInfoStorages);
 
+    /**
+     * @brief Add the deletion of the form info to a batch.
+     * @param bundleName The form info bundleName.
+     * @param batch The batch committed later by WriteBatch.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode RemoveBundleFormInfos(const std::string &bundleName, FormRdbWriteBatch &batch);
+
+    /**
+     * @brief Add the save or update of the form info to a batch.
+     * @param bundleName The form info bundleName.
+     * @param formInfoStorages The form info.
+     * @param batch The batch committed later by WriteBatch.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode UpdateBundleFormInfos(const std::string &bundleName, const std::string &formInfoStorages,
+        FormRdbWriteBatch &batch);
+
+    /**
+     * @brief Save or update the form info in json and binary encoding.
+     * @param bundleName The form info bundleName.
+     * @param formInfoStorages The form info json, kept for versions that do not know the binary encoding.
+     * @param binaryFormInfoStorages The form info encoded by FormInfoStoragesToBinary.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode UpdateBundleFormInfos(const std::string &bundleName, const std::string &formInfoStorages,
+        const std::vector<uint8_t> &binaryFormInfoStorages);
+
+    /**
+     * @brief Add the save or update of the form info in json and binary encoding to a batch.
+     * @param bundleName The form info bundleName.
+     * @param formInfoStorages The form info json, kept for versions that do not know the binary encoding.
+     * @param binaryFormInfoStorages The form info encoded by FormInfoStoragesToBinary.
+     * @param batch The batch committed later by WriteBatch.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode UpdateBundleFormInfos(const std::string &bundleName, const std::string &formInfoStorages,
+        const std::vector<uint8_t> &binaryFormInfoStorages, FormRdbWriteBatch &batch);
+
     /**
      * @brief Load all form data from DB to innerFormInfos.
      * @param innerFormInfos Storage all form data.
@@ -82,6 +121,13 @@ public:
      */
     ErrCode DeleteStorageFormData(const std::string &formId);
 
+    /**
+     * @brief Delete the form data and status data of several forms in one transaction.
+     * @param formIds The form data Ids.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode DeleteStorageFormDatas(const std::vector<std::string> &formIds);
+
     /**
      * @brief Load status data of form from DB.
      * @param formId The form data Id.
@@ -111,6 +157,19 @@ public:
      */
     ErrCode UpdateFormVersionCode();
 
+    /**
+     * @brief Add the save or update of the version code of form to a batch.
+     * @param batch The batch committed later by WriteBatch.
+     */
+    void UpdateFormVersionCode(FormRdbWriteBatch &batch);
+
+    /**
+     * @brief Commit a batch built by the batch variants above.
+     * @param batch The batch to be committed.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode WriteBatch(const FormRdbWriteBatch &batch);
+
     /**
      * @brief Get multi app version code of form from DB.
      * @param bundleName Bundlename.
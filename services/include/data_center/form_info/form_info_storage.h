@@ -46,6 +46,21 @@ private:
 
 void to_json(nlohmann::json &jsonObject, const FormInfoStorage &formInfoStorage);
 void from_json(const nlohmann::json &jsonObject, FormInfoStorage &formInfoStorage);
+
+/**
+ * @brief Encode the form info storages of a bundle as a binary record.
+ * @param formInfoStorages The form info storages of every user.
+ * @return Returns the encoded record.
+ */
+std::vector<uint8_t> FormInfoStoragesToBinary(const std::vector<FormInfoStorage> &formInfoStorages);
+
+/**
+ * @brief Decode a binary record produced by FormInfoStoragesToBinary.
+ * @param data The stored value.
+ * @param formInfoStorages The decoded form info storages.
+ * @return Returns true on success, false on failure.
+ */
+bool FormInfoStoragesFromBinary(const std::string &data, std::vector<FormInfoStorage> &formInfoStorages);
 } // namespace AAFwk
 } // namespace OHOS
 #endif // OHOS_FORM_FWK_FORM_INFO_STORAGE_H
@@ -20,6 +20,9 @@
 #include <string>
 #include <mutex>
 #include <map>
+#include <deque>
+#include <utility>
+#include <vector>
 #include "form_render/form_render_mgr.h"
 
 namespace OHOS {
@@ -36,6 +39,7 @@ enum HiSysEventPointType {
     TYPE_OFFLOAD_RECOVER_UPDATE,
     TYPE_DISABLE_FORM_INTERCEPT,
     TYPE_ACTUAL_PROXY_REFRESH,
+    TYPE_ALIGNED_TIMER_REFRESH,
 };
 
 struct FormRecordReportInfo {
@@ -50,6 +54,7 @@ struct FormRecordReportInfo {
     int32_t offloadRecoverRefreshTimes;
     int32_t disableFormRefreshTimes;
     int32_t actualProxyRefreshTimes = 0;
+    int32_t alignedTimerRefreshTimes = 0;
 };
 
 class FormRecordReport final : public DelayedRefSingleton<FormRecordReport> {
@@ -63,9 +68,18 @@ public:
     void SetFormRecordRecordInfo(int64_t formId, const Want &want);
     void HandleFormRefreshCount();
     void AddNewDayReportInfo();
+
+    /**
+     * @brief Get provider wake-ups saved by aligned timer refreshes, as (hours since epoch, count)
+     *        pairs covering the last day.
+     */
+    std::vector<std::pair<int64_t, int32_t>> GetSavedWakeupsPerHour() const;
 private:
+    void IncreaseSavedWakeupsNolock();
+
     mutable std::mutex formRecordReportMutex_;
     std::map<int64_t, std::queue<FormRecordReportInfo>> formRecordReportMap_;
+    std::deque<std::pair<int64_t, int32_t>> savedWakeupsPerHour_;
 };
 } // namespace AppExecFwk
 } // namespace OHOS
@@ -15,19 +15,22 @@
 #ifndef OHOS_FORM_FWK_FORM_BUNDLE_FORBID_MGR_H
 #define OHOS_FORM_FWK_FORM_BUNDLE_FORBID_MGR_H
 
+#include <atomic>
 #include <map>
-#include <shared_mutex>
+#include <mutex>
 #include <singleton.h>
 #include <string>
 
 #include "want.h"
+#include "common/util/form_snapshot_set.h"
 #include "data_center/database/form_rdb_data_mgr.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 /**
  * @class FormBundleForbidMgr
- * Form bundle forbid manager.
+ * Form bundle forbid manager. Queries read a published snapshot of the forbidden bundles and take
+ * no lock once the table is loaded.
  */
 class FormBundleForbidMgr final : public DelayedRefSingleton<FormBundleForbidMgr> {
     DECLARE_DELAYED_REF_SINGLETON(FormBundleForbidMgr)
@@ -56,9 +59,10 @@ private:
     bool Init();
 
 private:
-    bool isInitialized_ = false;
-    std::set<std::string> formBundleForbiddenSet_;
-    mutable std::shared_mutex bundleForbiddenSetMutex_;
+    std::atomic<bool> isInitialized_ = false;
+    FormSnapshotSet formBundleForbiddenSet_;
+    // serializes init and writers, never taken by queries
+    std::mutex bundleForbiddenSetMutex_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
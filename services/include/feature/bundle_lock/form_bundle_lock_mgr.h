@@ -15,19 +15,22 @@
 #ifndef OHOS_FORM_FWK_FORM_BUNDLE_LOCK_MGR_H
 #define OHOS_FORM_FWK_FORM_BUNDLE_LOCK_MGR_H
 
+#include <atomic>
 #include <map>
-#include <shared_mutex>
+#include <mutex>
 #include <singleton.h>
 #include <string>
 
 #include "want.h"
+#include "common/util/form_snapshot_set.h"
 #include "data_center/database/form_rdb_data_mgr.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 /**
  * @class FormBundleLockMgr
- * Form bundle lock manager.
+ * Form bundle lock manager. Lock and protect queries read published snapshots and take no lock
+ * once the lock table is loaded.
  */
 class FormBundleLockMgr final : public DelayedRefSingleton<FormBundleLockMgr> {
     DECLARE_DELAYED_REF_SINGLETON(FormBundleLockMgr)
@@ -84,12 +87,13 @@ private:
     bool Init();
 
 private:
-    bool isInitialized_ = false;
+    std::atomic<bool> isInitialized_ = false;
     std::atomic<bool> isLockServiceInitialized_{false};
-    std::set<std::string> formBundleLockSet_;
-    mutable std::shared_mutex bundleLockSetMutex_;
-    std::set<std::string> formBundleProtectSet_;
-    mutable std::shared_mutex bundleProtectSetMutex_;
+    FormSnapshotSet formBundleLockSet_;
+    // serializes init and writers, never taken by queries
+    std::mutex bundleLockSetMutex_;
+    FormSnapshotSet formBundleProtectSet_;
+    std::mutex bundleProtectSetMutex_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
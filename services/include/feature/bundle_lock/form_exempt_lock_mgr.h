@@ -15,12 +15,14 @@
 #ifndef OHOS_FORM_FWK_FORM_EXEMPT_LOCK_MGR_H
 #define OHOS_FORM_FWK_FORM_EXEMPT_LOCK_MGR_H
 
+#include <atomic>
 #include <map>
-#include <shared_mutex>
+#include <mutex>
 #include <singleton.h>
 #include <string>
 
 #include "want.h"
+#include "common/util/form_snapshot_set.h"
 #include "data_center/database/form_rdb_data_mgr.h"
 
 namespace OHOS {
@@ -56,9 +58,10 @@ private:
     bool Init();
 
 private:
-    bool isInitialized_ = false;
-    std::set<std::string> formExemptLockSet_;
-    mutable std::shared_mutex exemptLockSetMutex_;
+    std::atomic<bool> isInitialized_ = false;
+    FormSnapshotSet formExemptLockSet_;
+    // serializes init and writers, never taken by queries
+    std::mutex exemptLockSetMutex_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -16,8 +16,14 @@
 #ifndef OHOS_FORM_FWK_FORM_HOST_TASK_MGR_H
 #define OHOS_FORM_FWK_FORM_HOST_TASK_MGR_H
 
+#include <mutex>
 #include <singleton.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 #include "iremote_object.h"
+#include "form_host_interface.h"
 #include "form_state_info.h"
 #include "data_center/form_record/form_record.h"
 
@@ -221,6 +227,31 @@ private:
      * @param remoteObject Form host proxy object.
      */
     void CheckFormsTaskToHost(const std::vector<int64_t> &formIds, const sptr<IRemoteObject> &remoteObject);
+
+    /**
+     * @brief Send the updates buffered for a host, one call per MAX_BATCH_UPDATE_COUNT forms.
+     * @param remoteObject Form host proxy object.
+     */
+    void FlushUpdatesToHost(const sptr<IRemoteObject> &remoteObject);
+
+    /**
+     * @brief Send a batch of updates, falls back to one OnUpdate per form for hosts without the batch call.
+     * @param remoteFormHost Form host proxy.
+     * @param remoteObject Form host proxy object.
+     * @param formJsInfos Form infos of the batch.
+     */
+    void BatchUpdateToHost(const sptr<IFormHost> &remoteFormHost, const sptr<IRemoteObject> &remoteObject,
+        const std::vector<FormJsInfo> &formJsInfos);
+
+    struct HostUpdateBuffer {
+        sptr<IRemoteObject> remoteObject = nullptr;
+        std::vector<std::pair<int64_t, FormRecord>> updates;
+    };
+
+    std::mutex updateBufferMutex_;
+    std::unordered_map<IRemoteObject *, HostUpdateBuffer> updateBuffers_;
+    // Hosts whose stub rejected OnBatchUpdate as an unknown call, cleared when the host dies.
+    std::unordered_set<IRemoteObject *> batchUpdateUnsupported_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -1027,6 +1027,8 @@ private:
         KEY_DUMP_VISIBLE,
         KEY_DUMP_RUNNING,
         KEY_DUMP_BLOCKED_APPS,
+        KEY_DUMP_CACHE,
+        KEY_DUMP_QUEUE,
     };
     /**
      * @brief initialization of form manager service.
@@ -1051,6 +1053,8 @@ private:
     void HiDumpFormInfoByFormId(const std::string &args, std::string &result);
     void HiDumpFormRunningFormInfos([[maybe_unused]] const std::string &args, std::string &result);
     void HiDumpFormBlockedApps([[maybe_unused]] const std::string &args, std::string &result);
+    void HiDumpFormCacheInfos([[maybe_unused]] const std::string &args, std::string &result);
+    void HiDumpFormQueueInfos([[maybe_unused]] const std::string &args, std::string &result);
     bool CheckCallerIsSystemApp() const;
     static std::string GetCurrentDateTime();
     bool PublishFormCrossBundleControl(const Want &want);
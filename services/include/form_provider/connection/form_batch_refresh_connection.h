@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_BATCH_REFRESH_CONNECTION_H
+#define OHOS_FORM_FWK_FORM_BATCH_REFRESH_CONNECTION_H
+
+#include <vector>
+
+#include "common/connection/form_ability_connection.h"
+#include "data_center/form_record/form_record.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @brief One form refreshed through a shared provider connection.
+ */
+struct FormBatchRefreshItem {
+    int64_t formId = 0;
+    FormRecord record;
+    Want want;
+};
+
+/**
+ * @class FormBatchRefreshConnection
+ * Form batch refresh connection stub, delivers the refreshes of several forms of one provider
+ * over a single ability connection.
+ */
+class FormBatchRefreshConnection : public FormAbilityConnection {
+public:
+    FormBatchRefreshConnection(const std::vector<FormBatchRefreshItem> &items, const std::string &bundleName,
+        const std::string &abilityName, const int32_t userId);
+    virtual ~FormBatchRefreshConnection() = default;
+
+    /**
+     * @brief A provider dying while connected leaves the updates of the batch unconfirmed,
+     *        the forms are marked to refresh again.
+     * @param element Element name of the ability.
+     * @param resultCode Result code of disconnect operation.
+     */
+    void OnAbilityDisconnectDone(const AppExecFwk::ElementName &element, int resultCode) override;
+
+protected:
+    /**
+     * @brief Execute batch refresh task after connection success. Only the last update carries the
+     *        connect id, so the provider releases the connection once every form has been updated.
+     * @param want Task Want parameter.
+     * @param remoteObject Remote object.
+     */
+    void OnExecuteConnectTask(const Want &want, const sptr<IRemoteObject> &remoteObject) override;
+
+    /**
+     * @brief The batch is dropped, every form of it is marked to refresh again.
+     * @param resultCode Error code.
+     * @param element Connection element.
+     */
+    void OnConnectError(int resultCode, const AppExecFwk::ElementName &element) override;
+
+private:
+    void MarkFormsNeedRefresh();
+
+    std::vector<FormBatchRefreshItem> items_;
+    DISALLOW_COPY_AND_MOVE(FormBatchRefreshConnection);
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+
+#endif // OHOS_FORM_FWK_FORM_BATCH_REFRESH_CONNECTION_H
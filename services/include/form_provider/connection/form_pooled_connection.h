@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef OHOS_FORM_FWK_FORM_POOLED_CONNECTION_H
+#define OHOS_FORM_FWK_FORM_POOLED_CONNECTION_H
+
+#include "common/connection/form_ability_connection.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+
+/**
+ * @class FormPooledConnection
+ * The ability connection FormConnectionPool keeps to a provider, per form connections are attached to it
+ * instead of connecting on their own.
+ */
+class FormPooledConnection : public FormAbilityConnection {
+public:
+    FormPooledConnection(const Want &connectWant, const int32_t userId);
+    virtual ~FormPooledConnection() = default;
+
+    void OnAbilityConnectDone(
+        const AppExecFwk::ElementName &element, const sptr<IRemoteObject> &remoteObject, int resultCode) override;
+
+    void OnAbilityDisconnectDone(const AppExecFwk::ElementName &element, int resultCode) override;
+
+    const AppExecFwk::ElementName &GetElement() const
+    {
+        return element_;
+    }
+
+protected:
+    /**
+     * @brief Hand the provider token to the pool, which attaches the waiting per form connections.
+     * @param want Task Want parameter.
+     * @param remoteObject Remote object.
+     */
+    void OnExecuteConnectTask(const Want &want, const sptr<IRemoteObject> &remoteObject) override;
+
+    void OnConnectError(int resultCode, const AppExecFwk::ElementName &element) override;
+
+    /**
+     * @brief The pooled connection is owned by the pool, attached connections register on their own.
+     * @return false.
+     */
+    bool NeedRegisterToSupplyCallback() const override { return false; }
+
+private:
+    AppExecFwk::ElementName element_;
+    DISALLOW_COPY_AND_MOVE(FormPooledConnection);
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+
+#endif // OHOS_FORM_FWK_FORM_POOLED_CONNECTION_H
@@ -17,6 +17,7 @@
 #define OHOS_FORM_FWK_FORM_REFRESH_CONNECTION_H
 
 #include <atomic>
+#include <memory>
 
 #include "common/connection/form_ability_connection.h"
 #include "data_center/form_record/form_record.h"
@@ -32,6 +33,10 @@ namespace AppExecFwk {
 class FormRefreshConnection : public FormAbilityConnection {
 public:
     FormRefreshConnection(const int64_t formId, const Want &want, const FormRecord &record);
+    /**
+     * @brief Construct from a shared record snapshot, retries reuse it instead of copying the record.
+     */
+    FormRefreshConnection(const int64_t formId, const Want &want, const std::shared_ptr<const FormRecord> &record);
     virtual ~FormRefreshConnection() = default;
 
     /**
@@ -73,7 +78,7 @@ protected:
 
 private:
     Want want_;
-    FormRecord record_;
+    std::shared_ptr<const FormRecord> record_;
     DISALLOW_COPY_AND_MOVE(FormRefreshConnection);
 };
 }  // namespace AppExecFwk
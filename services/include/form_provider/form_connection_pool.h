@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_CONNECTION_POOL_H
+#define OHOS_FORM_FWK_FORM_CONNECTION_POOL_H
+
+#include <mutex>
+#include <singleton.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/connection/form_ability_connection.h"
+#include "form_provider/connection/form_pooled_connection.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class FormConnectionPool
+ * Keeps one ability connection per provider (bundle, ability, user) and multiplexes per form
+ * connections over it. An attached connection behaves as if it had connected on its own: it gets
+ * its connect id and runs its task on connect, and its RemoveConnection detaches it rather than
+ * disconnecting the provider. The provider connection is released once idle for a while.
+ */
+class FormConnectionPool final : public DelayedRefSingleton<FormConnectionPool> {
+    DECLARE_DELAYED_REF_SINGLETON(FormConnectionPool)
+public:
+    DISALLOW_COPY_AND_MOVE(FormConnectionPool);
+
+    /**
+     * @brief Connect a per form connection through the pooled connection of its provider.
+     * @param connection The per form connection.
+     * @param userId The provider user id.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode Connect(const sptr<FormAbilityConnection> &connection, int32_t userId);
+
+    /**
+     * @brief Detach a per form connection, called where a standalone connection would be disconnected.
+     * @param connection The per form connection.
+     */
+    void Release(const sptr<FormAbilityConnection> &connection);
+
+    void OnPooledConnected(const sptr<FormPooledConnection> &pooled, const AppExecFwk::ElementName &element,
+        const sptr<IRemoteObject> &remoteObject);
+
+    void OnPooledConnectFailed(const sptr<FormPooledConnection> &pooled, const AppExecFwk::ElementName &element,
+        int resultCode);
+
+    void OnPooledDisconnected(const sptr<FormPooledConnection> &pooled, const AppExecFwk::ElementName &element,
+        int resultCode);
+
+private:
+    struct ProviderConnection {
+        sptr<FormPooledConnection> pooled = nullptr;
+        sptr<IRemoteObject> providerToken = nullptr;
+        bool connected = false;
+        int64_t connectTime = 0;
+        int64_t lastActiveTime = 0;
+        std::vector<sptr<FormAbilityConnection>> pending;
+        std::unordered_map<FormAbilityConnection *, sptr<FormAbilityConnection>> attached;
+    };
+
+    void ReleaseIdle(const std::string &providerKey, const sptr<FormPooledConnection> &pooled);
+
+    void ConnectStandalone(const std::vector<sptr<FormAbilityConnection>> &connections, int32_t userId);
+
+    std::mutex poolMutex_;
+    std::unordered_map<std::string, ProviderConnection> providers_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+
+#endif // OHOS_FORM_FWK_FORM_CONNECTION_POOL_H
@@ -21,6 +21,7 @@
 #include "form_provider_info.h"
 #include "data_center/form_record/form_record.h"
 #include "form_state_info.h"
+#include "form_provider/connection/form_batch_refresh_connection.h"
 #include "want.h"
 #include "configuration.h"
 
@@ -85,6 +86,13 @@ public:
      */
     ErrCode ConnectAmsForRefresh(const int64_t formId, const FormRecord &record, const Want &want);
 
+    /**
+     * @brief Connect ams once for refreshing several forms of one provider.
+     * @param items The forms to refresh, all of them must share bundle, ability and provider user.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode ConnectAmsForBatchRefresh(const std::vector<FormBatchRefreshItem> &items);
+
     /**
      * @brief Connect provider ability for notify config update
      * @param configuration system config.
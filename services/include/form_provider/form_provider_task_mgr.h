@@ -17,6 +17,8 @@
 #define OHOS_FORM_FWK_FORM_PROVIDER_TASK_MGR_H
 
 #include <singleton.h>
+#include <utility>
+#include <vector>
 #include "configuration.h"
 #include "iremote_object.h"
 #include "want.h"
@@ -66,6 +68,14 @@ public:
     void PostProviderBatchDeleteTask(std::set<int64_t> &formIds, const Want &want,
         const sptr<IRemoteObject> &remoteObject);
 
+    /**
+     * @brief Refresh several forms of one provider in a single task, updates are sent in order.
+     * @param updates The form ids and the wants of the forms.
+     * @param remoteObject Form provider proxy object.
+     */
+    void PostBatchRefreshTask(const std::vector<std::pair<int64_t, Want>> &updates,
+        const sptr<IRemoteObject> &remoteObject);
+
     /**
      * @brief Cast temp form data from form provider(task).
      *
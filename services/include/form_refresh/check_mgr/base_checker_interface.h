@@ -16,6 +16,8 @@
 #ifndef OHOS_FORM_FWK_BASE_CHECKER_INTERFACE_H
 #define OHOS_FORM_FWK_BASE_CHECKER_INTERFACE_H
 
+#include <memory>
+
 #include "data_center/form_record/form_record.h"
 #include "form_mgr_errors.h"
 #include "fms_log_wrapper.h"
@@ -27,7 +29,7 @@ using Want = OHOS::AAFwk::Want;
 struct CheckValidFactor {
     int64_t formId;
     int32_t callingUid;
-    FormRecord record;
+    std::shared_ptr<const FormRecord> record;
     sptr<IRemoteObject> callerToken;
     Want want;
 };
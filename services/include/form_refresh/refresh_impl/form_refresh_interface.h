@@ -16,6 +16,8 @@
 #ifndef OHOS_FORM_FWK_FORM_REFRESH_INTERFACE_H
 #define OHOS_FORM_FWK_FORM_REFRESH_INTERFACE_H
 
+#include <memory>
+
 #include "data_center/form_record/form_record.h"
 #include "common/timer_mgr/form_timer.h"
 #include "fms_log_wrapper.h"
@@ -28,7 +30,8 @@ struct RefreshData {
     int64_t formId;
     int64_t nextTime;
     int32_t callingUid;
-    FormRecord record;
+    // Immutable snapshot shared by every stage of one refresh, copy it before mutating.
+    std::shared_ptr<const FormRecord> record;
     FormTimer formTimer;
     sptr<IRemoteObject> callerToken;
     Want want;
@@ -18,6 +18,7 @@
 
 #include <singleton.h>
 
+#include "form_provider/connection/form_batch_refresh_connection.h"
 #include "form_refresh/refresh_impl/form_refresh_interface.h"
 
 namespace OHOS {
@@ -33,9 +34,20 @@ public:
 
     int RefreshFormRequest(RefreshData &data) override;
 
+    /**
+     * @brief Refresh timer forms of one provider, the forms passing the checks share one connection.
+     * @param batch The timer refresh of each form.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int RefreshFormBatchRequest(std::vector<RefreshData> &batch);
+
 private:
     int DealRefresh(const RefreshData &data);
 
+    void DealBatchRefresh(const std::vector<RefreshData> &batch);
+
+    int PrepareRefresh(const RefreshData &data, FormBatchRefreshItem &item, bool &needConnect);
+
     bool DetectControlPoint(RefreshData &newData, const bool isCountTimerRefresh, const bool isTimerRefresh);
 
     void BuildTimerWant(const FormTimer &timerTask, Want &want);
@@ -78,7 +78,7 @@ public:
      * @param want The want of the form to refresh.
      * @param record The form record.
      */
-    void AddFlagByScreenOff(const int64_t formId, const Want &want, FormRecord &record);
+    void AddFlagByScreenOff(const int64_t formId, const Want &want, const FormRecord &record);
 
     /**
      * @brief Receive screen unlock, consume cache flag.
@@ -63,7 +63,7 @@ public:
     /**
      * @brief Whether the form need fresh.
      */
-    bool IsNeedToFresh(FormRecord &record, bool isVisibleToFresh);
+    bool IsNeedToFresh(const FormRecord &record, bool isVisibleToFresh);
 
     /**
      * @brief Whether the form add finish.
@@ -19,6 +19,7 @@
 #include "data_center/form_record/form_record.h"
 #include "form_constants.h"
 #include "form_provider_data.h"
+#include "form_provider/connection/form_batch_refresh_connection.h"
 
 namespace OHOS {
 namespace AppExecFwk {
@@ -36,6 +37,12 @@ public:
      */
     static ErrCode AskForProviderData(const int64_t formId, const FormRecord &record, const Want &want);
 
+    /**
+     * @brief Ask one provider for the data of several forms over a shared connection.
+     * @param items The forms to refresh, all of them belong to the same provider.
+     */
+    static ErrCode AskForProviderDataBatch(const std::vector<FormBatchRefreshItem> &items);
+
     /**
      * @brief update provider data to form page.
      * @param formId The formId.
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FORM_FWK_FORM_RENDER_DELTA_MGR_H
+#define OHOS_FORM_FWK_FORM_RENDER_DELTA_MGR_H
+
+#include <map>
+#include <mutex>
+#include <singleton.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "form_ashmem.h"
+#include "form_js_info.h"
+#include "form_provider_data.h"
+#include "nlohmann/json.hpp"
+#include "want.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+using Want = OHOS::AAFwk::Want;
+/**
+ * @class FormRenderDeltaMgr
+ * Tracks, per form, the data revision last sent to the form render service and whether the service
+ * acknowledged it. An update of a form whose last revision was acknowledged is sent as a JSON merge
+ * patch (RFC 7386) against that revision, carrying only the images that changed. Anything that may
+ * leave the service without the revision, recycle, reload or its death, drops the form back to a
+ * full payload.
+ */
+class FormRenderDeltaMgr final : public DelayedRefSingleton<FormRenderDeltaMgr> {
+    DECLARE_DELAYED_REF_SINGLETON(FormRenderDeltaMgr)
+public:
+    DISALLOW_COPY_AND_MOVE(FormRenderDeltaMgr);
+
+    /**
+     * @brief Assign a revision to the data about to be rendered, and turn it into a patch when possible.
+     * @param formJsInfo The form js info to send, formData becomes the patch when one is sent and
+     * formProviderData then only keeps the changed images.
+     * @param want The want sent with it, gets the revision and, for a patch, its base revision.
+     */
+    void PrepareRenderData(FormJsInfo &formJsInfo, Want &want);
+
+    /**
+     * @brief Handle the render task done of the form render service.
+     * @param formId The Id of the form.
+     * @param want The want returned by the form render service.
+     * @param formProviderData The full data to render again when the service could not apply a patch.
+     * @return Returns true if the full data has to be rendered again.
+     */
+    bool OnRenderTaskDone(int64_t formId, const Want &want, FormProviderData &formProviderData);
+
+    /**
+     * @brief Send the next update of a form as a full payload.
+     * @param formId The Id of the form.
+     */
+    void Invalidate(int64_t formId);
+
+    /**
+     * @brief Send the next update of every form as a full payload, used when the service died.
+     */
+    void InvalidateAll();
+
+    /**
+     * @brief Create the JSON merge patch turning source into target.
+     * @param source The document the patch applies to.
+     * @param target The document the patch produces.
+     * @param patch The merge patch.
+     * @return Returns false if target holds a null, which a merge patch cannot express.
+     */
+    static bool CreateMergePatch(const nlohmann::json &source, const nlohmann::json &target, nlohmann::json &patch);
+
+private:
+    struct RenderDataState {
+        int32_t revision = 0;
+        int32_t ackedRevision = 0;
+        nlohmann::json data;
+        std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> images;
+    };
+
+    std::mutex stateMutex_;
+    std::unordered_map<int64_t, RenderDataState> states_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif // OHOS_FORM_FWK_FORM_RENDER_DELTA_MGR_H
@@ -16,6 +16,7 @@
 #ifndef OHOS_FORM_FWK_FORM_STATUS_MGR_H
 #define OHOS_FORM_FWK_FORM_STATUS_MGR_H
 
+#include <atomic>
 #include <singleton.h>
 #include <string>
 #include <unordered_map>
@@ -28,6 +29,14 @@
 
 namespace OHOS {
 namespace AppExecFwk {
+/**
+ * @brief Per-form state of the status machine: the queue of pending events and the id of the event
+ *        whose timeout is armed. An event id of 0 means there is none.
+ */
+struct FormEventState {
+    std::shared_ptr<FormEventQueue> eventQueue;
+    int64_t eventId = 0;
+};
 
 class FormStatusMgr final : public DelayedRefSingleton<FormStatusMgr> {
     DECLARE_DELAYED_REF_SINGLETON(FormStatusMgr)
@@ -179,13 +188,16 @@ private:
      */
     bool ReportStatusInfoError(const int64_t formId, const FormFsmStatus status, const FormFsmEvent event);
 
-    // <formId, formEventQueue>
-    std::shared_mutex formEventQueueMutex_;
-    std::unordered_map<int64_t, std::shared_ptr<FormEventQueue>> formEventQueueMap_;
+    /**
+     * @brief Erase the state of a form once it has neither queue nor event id, caller holds formEventStateMutex_
+     * @param iter Iterator of formEventStateMap_
+     */
+    void EraseFormEventStateIfEmptyNolock(std::unordered_map<int64_t, FormEventState>::iterator iter);
 
-    // <formId, eventId>
-    std::shared_mutex formEventIdMapMutex_;
-    std::unordered_map<int64_t, std::string> formEventIdMap_;
+    // <formId, formEventState>
+    std::shared_mutex formEventStateMutex_;
+    std::unordered_map<int64_t, FormEventState> formEventStateMap_;
+    std::atomic<int64_t> nextEventId_ = 1;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -44,6 +44,14 @@ public:
      * @return Whether successful or not
      */
     bool GetFormStatusInfo(FormFsmStatus curStatus, FormFsmEvent event, FormStatusMachineInfo &info);
+
+    /**
+     * @brief Gets the form status information without copying it
+     * @param curStatus The current form status
+     * @param event The event that triggers the status change
+     * @return The entry of the static transition table, nullptr if the event is not allowed in curStatus
+     */
+    const FormStatusMachineInfo *GetFormStatusInfo(FormFsmStatus curStatus, FormFsmEvent event) const;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
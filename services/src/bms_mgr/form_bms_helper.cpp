@@ -15,7 +15,12 @@
 
 #include "bms_mgr/form_bms_helper.h"
 
+#include <iomanip>
+#include <set>
+#include <sstream>
+
 #include "ability_manager_interface.h"
+#include "common/util/form_util.h"
 #include "fms_log_wrapper.h"
 #include "form_mgr_errors.h"
 #include "if_system_ability_manager.h"
@@ -26,6 +31,26 @@
 
 namespace OHOS {
 namespace AppExecFwk {
+namespace {
+constexpr double PERCENTAGE = 100.0;
+
+std::string GenerateBundleInfoKey(const std::string &bundleName, int32_t flags, int32_t userId)
+{
+    return std::to_string(userId) + "_" + std::to_string(flags) + "_" + bundleName;
+}
+
+template <typename Key, typename Value>
+void DumpCache(const std::string &name, const FormBmsCache<Key, Value> &cache, std::stringstream &stream)
+{
+    int64_t hitCount = cache.GetHitCount();
+    int64_t missCount = cache.GetMissCount();
+    double hitRate = (hitCount + missCount) == 0 ? 0 :
+        PERCENTAGE * static_cast<double>(hitCount) / static_cast<double>(hitCount + missCount);
+    stream << "  " << name << " [ " << cache.Size() << "/" << cache.Capacity() << " ] hitCount [ " << hitCount
+        << " ] missCount [ " << missCount << " ] hitRate [ " << hitRate << "% ]\n";
+}
+}
+
 FormBmsHelper::FormBmsHelper()
 {
     HILOG_INFO("call");
@@ -90,6 +115,21 @@ void FormBmsHelper::SetBundleManager(const sptr<IBundleMgr> &bundleManager)
     iBundleMgr_ = bundleManager;
 }
 
+sptr<IBundleMgr> FormBmsHelper::GetBundleMgrForCache()
+{
+    sptr<IBundleMgr> iBundleMgr = GetBundleMgr();
+    if (iBundleMgr == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(cacheBundleMgrMutex_);
+    if (cacheBundleMgr_.promote() != iBundleMgr) {
+        // the caches were filled through a bundle manager that is gone, e.g. before it restarted
+        ClearBundleCache();
+        cacheBundleMgr_ = iBundleMgr;
+    }
+    return iBundleMgr;
+}
+
 /**
  * @brief Notify module removable.
  * @param bundleName Provider ability bundleName.
@@ -229,12 +269,20 @@ bool FormBmsHelper::GetBundleInfoByFlags(const std::string& bundleName, int32_t
 {
     HILOG_DEBUG("call");
     uint32_t flag = static_cast<uint32_t>(flags) | static_cast<uint32_t>(BundleFlag::GET_BUNDLE_INFO_EXCLUDE_EXT);
-    sptr<IBundleMgr> iBundleMgr = GetBundleMgr();
+    sptr<IBundleMgr> iBundleMgr = GetBundleMgrForCache();
     if (iBundleMgr == nullptr) {
         HILOG_ERROR("null iBundleMgr");
         return false;
     }
-    return (IN_PROCESS_CALL(iBundleMgr->GetBundleInfo(bundleName, static_cast<int32_t>(flag), bundleInfo, userId)));
+    std::string key = GenerateBundleInfoKey(bundleName, static_cast<int32_t>(flag), userId);
+    if (bundleInfoCache_.Get(key, bundleInfo)) {
+        return true;
+    }
+    if (!IN_PROCESS_CALL(iBundleMgr->GetBundleInfo(bundleName, static_cast<int32_t>(flag), bundleInfo, userId))) {
+        return false;
+    }
+    bundleInfoCache_.Put(key, bundleInfo);
+    return true;
 }
 
 ErrCode FormBmsHelper::GetBundleInfoV9(const std::string& bundleName, int32_t userId, BundleInfo &bundleInfo)
@@ -263,31 +311,25 @@ ErrCode FormBmsHelper::GetBundleInfoV9(const std::string& bundleName, int32_t us
 
 int32_t FormBmsHelper::GetCallerBundleName(std::string &callerBundleName)
 {
-    sptr<IBundleMgr> iBundleMgr = GetBundleMgr();
-    if (iBundleMgr == nullptr) {
-        HILOG_ERROR("get IBundleMgr failed");
-        return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
-    }
-    auto callingUid = IPCSkeleton::GetCallingUid();
-    if (IN_PROCESS_CALL(iBundleMgr->GetNameForUid(callingUid, callerBundleName)) != ERR_OK) {
-        HILOG_ERROR("fail get form config info");
-        return ERR_APPEXECFWK_FORM_GET_INFO_FAILED;
-    }
-    return ERR_OK;
+    return GetBundleNameByUid(IPCSkeleton::GetCallingUid(), callerBundleName);
 }
 
 int32_t FormBmsHelper::GetBundleNameByUid(const int32_t uid, std::string &bundleName)
 {
-    sptr<IBundleMgr> iBundleMgr = GetBundleMgr();
+    sptr<IBundleMgr> iBundleMgr = GetBundleMgrForCache();
     if (iBundleMgr == nullptr) {
         HILOG_ERROR("get IBundleMgr failed");
         return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
     }
+    if (uidBundleNameCache_.Get(uid, bundleName)) {
+        return ERR_OK;
+    }
 
     if (IN_PROCESS_CALL(iBundleMgr->GetNameForUid(uid, bundleName)) != ERR_OK) {
         HILOG_ERROR("fail get bundle name by uid");
         return ERR_APPEXECFWK_FORM_GET_INFO_FAILED;
     }
+    uidBundleNameCache_.Put(uid, bundleName);
     return ERR_OK;
 }
 
@@ -430,12 +472,20 @@ ErrCode FormBmsHelper::UnregisterBundleEventCallback()
 bool FormBmsHelper::CheckIsSystemAppByUid(int32_t uid)
 {
     HILOG_DEBUG("call");
-    sptr<IBundleMgr> iBundleMgr = GetBundleMgr();
+    sptr<IBundleMgr> iBundleMgr = GetBundleMgrForCache();
     if (iBundleMgr == nullptr) {
         HILOG_ERROR("null iBundleMgr");
         return false;
     }
-    return IN_PROCESS_CALL(iBundleMgr->CheckIsSystemAppByUid(uid));
+    // a failed ipc also answers false, so a negative answer is only trusted for a short while
+    int64_t now = FormUtil::GetCurrentSteadyClockMillseconds();
+    std::pair<bool, int64_t> cached;
+    if (systemAppCache_.Get(uid, cached) && (cached.first || now - cached.second < NON_SYSTEM_APP_CACHE_TTL_MS)) {
+        return cached.first;
+    }
+    bool isSystemApp = IN_PROCESS_CALL(iBundleMgr->CheckIsSystemAppByUid(uid));
+    systemAppCache_.Put(uid, std::make_pair(isSystemApp, now));
+    return isSystemApp;
 }
 
 bool FormBmsHelper::GetApplicationInfoByFlag(const std::string &bundleName, int32_t flag,
@@ -546,5 +596,44 @@ bool FormBmsHelper::GetBundleInfos(int32_t flag, std::vector<BundleInfo> &bundle
     }
     return IN_PROCESS_CALL(iBundleMgr->GetBundleInfos(flag, bundleInfos, userId));
 }
+void FormBmsHelper::InvalidateBundleCache(const std::string &bundleName, int32_t uid)
+{
+    HILOG_DEBUG("bundleName:%{public}s, uid:%{public}d", bundleName.c_str(), uid);
+    std::set<int32_t> uids;
+    if (uid > 0) {
+        uids.insert(uid);
+    }
+    uidBundleNameCache_.EraseIf([&bundleName, &uids](const int32_t &key, const std::string &value) {
+        if (value != bundleName) {
+            return false;
+        }
+        uids.insert(key);
+        return true;
+    });
+    systemAppCache_.EraseIf([&uids](const int32_t &key, const std::pair<bool, int64_t> &) {
+        return uids.count(key) != 0;
+    });
+    bundleInfoCache_.EraseIf([&bundleName](const std::string &, const BundleInfo &value) {
+        return value.name == bundleName;
+    });
+}
+
+void FormBmsHelper::ClearBundleCache()
+{
+    uidBundleNameCache_.Clear();
+    systemAppCache_.Clear();
+    bundleInfoCache_.Clear();
+}
+
+void FormBmsHelper::DumpCacheStatistics(std::string &result) const
+{
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(2);
+    stream << "BmsCache:\n";
+    DumpCache("uidBundleName", uidBundleNameCache_, stream);
+    DumpCache("systemApp", systemAppCache_, stream);
+    DumpCache("bundleInfo", bundleInfoCache_, stream);
+    result += stream.str();
+}
 } // namespace AppExecFwk
 } // namespace OHOS
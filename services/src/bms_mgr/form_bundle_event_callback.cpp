@@ -15,6 +15,7 @@
 
 #include "bms_mgr/form_bundle_event_callback.h"
 
+#include "bms_mgr/form_bms_helper.h"
 #include "feature/bundle_forbidden/form_bundle_forbid_mgr.h"
 #include "form_mgr/form_mgr_queue.h"
 #include "feature/bundle_distributed/form_distributed_mgr.h"
@@ -25,6 +26,7 @@ namespace AppExecFwk {
 namespace {
 constexpr const char *BMS_EVENT_ADDITIONAL_INFO_CHANGED = "bms.event.ADDITIONAL_INFO_CHANGED";
 constexpr const char *KEY_USER_ID = "userId";
+constexpr const char *KEY_UID = "uid";
 } // namespace
 
 FormBundleEventCallback::FormBundleEventCallback()
@@ -51,6 +53,7 @@ void FormBundleEventCallback::OnReceiveEvent(const EventFwk::CommonEventData eve
     }
 
     HILOG_INFO("action:%{public}s, userId:%{public}d", action.c_str(), userId);
+    FormBmsHelper::GetInstance().InvalidateBundleCache(bundleName, want.GetIntParam(KEY_UID, 0));
 
     wptr<FormBundleEventCallback> weakThis = this;
     if (action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED) {
@@ -227,6 +227,16 @@ void FormAbilityConnection::SetProviderKey(const std::string &bundleName, const
     userId_ = userId;
 }
 
+void FormAbilityConnection::SetPooled(bool pooled)
+{
+    pooled_.store(pooled);
+}
+
+bool FormAbilityConnection::IsPooled() const
+{
+    return pooled_.load();
+}
+
 void FormAbilityConnection::SetModuleName(const std::string &moduleName)
 {
     moduleName_ = moduleName;
@@ -21,6 +21,7 @@
 #include "fms_log_wrapper.h"
 #include "bms_mgr/form_bms_helper.h"
 #include "form_constants.h"
+#include "data_center/form_cache_mgr.h"
 #include "data_center/form_data_mgr.h"
 #include "data_center/database/form_db_cache.h"
 #include "data_center/form_info/form_info_mgr.h"
@@ -49,7 +50,8 @@ const std::unordered_set<std::string> actionSet {
     EventFwk::CommonEventSupport::COMMON_EVENT_SCREEN_ON,
     EventFwk::CommonEventSupport::COMMON_EVENT_SCREEN_UNLOCKED,
     EventFwk::CommonEventSupport::COMMON_EVENT_USER_STOPPED,
-    EventFwk::CommonEventSupport::COMMON_EVENT_USER_STARTED
+    EventFwk::CommonEventSupport::COMMON_EVENT_USER_STARTED,
+    EventFwk::CommonEventSupport::COMMON_EVENT_SHUTDOWN
 };
 } // namespace
 /**
@@ -126,9 +128,11 @@ void FormSysEventReceiver::OnReceiveEvent(const EventFwk::CommonEventData &event
     HILOG_INFO("action:%{public}s", action.c_str());
     std::weak_ptr<FormSysEventReceiver> weakThis = shared_from_this();
     if (action == EventFwk::CommonEventSupport::COMMON_EVENT_ABILITY_UPDATED) {
+        FormBmsHelper::GetInstance().InvalidateBundleCache(bundleName);
         HandleAbilityUpdate(want, bundleName);
     } else if (action == EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED) {
         int32_t userId = eventData.GetCode();
+        FormBmsHelper::GetInstance().ClearBundleCache();
         HandleUserIdRemoved(userId);
     } else if (action == EventFwk::CommonEventSupport::COMMON_EVENT_BUNDLE_SCAN_FINISHED) {
         HandleBundleScanFinished();
@@ -153,6 +157,8 @@ void FormSysEventReceiver::OnReceiveEvent(const EventFwk::CommonEventData &event
     } else if (action == EventFwk::CommonEventSupport::COMMON_EVENT_USER_STARTED) {
         int32_t userId = eventData.GetCode();
         HandleUserStarted(userId);
+    } else if (action == EventFwk::CommonEventSupport::COMMON_EVENT_SHUTDOWN) {
+        HandleShutdown();
     } else {
         HILOG_WARN("invalid action");
     }
@@ -285,5 +291,12 @@ void FormSysEventReceiver::HandleUserStarted(const int32_t userId)
     };
     FormMgrQueue::GetInstance().ScheduleTask(0, task, Common::TaskQos::QOS_DEADLINE_REQUEST);
 }
+
+void FormSysEventReceiver::HandleShutdown()
+{
+    HILOG_INFO("device shutdown or reboot, flush form cache");
+    // Flush in place, the queue may not get a chance to run before power off.
+    FormCacheMgr::GetInstance().FlushDirtyData();
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
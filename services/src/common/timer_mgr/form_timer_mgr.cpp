@@ -16,6 +16,7 @@
 #include "common/timer_mgr/form_timer_mgr.h"
 
 #include <cinttypes>
+#include <unordered_map>
 
 #include "common_event_manager.h"
 #include "common_event_support.h"
@@ -35,11 +36,14 @@
 #include "want.h"
 #include "form_event_report.h"
 #include "data_center/form_record/form_record_report.h"
+#include "data_center/form_basic_info_mgr.h"
 #include "data_center/form_data_mgr.h"
 #include "form_refresh/form_refresh_mgr.h"
+#include "form_refresh/refresh_impl/form_timer_refresh_impl.h"
 #include "feature/form_check/form_abnormal_reporter.h"
 #include "feature/memory_mgr/form_render_report.h"
 #include "feature/param_update/param_manager.h"
+#include "parameters.h"
 
 namespace OHOS {
 namespace AppExecFwk {
@@ -57,6 +61,26 @@ constexpr int64_t TIMER_UPDATEAT_CREATE_BEHIND_TRIGGER = 10 * 1000;
 constexpr int64_t CHECK_INTERVAL = 6 * 60 * 60 * 1000;
 constexpr int TIME_MIN_SIZE = 2;
 constexpr int PERIODIC_REFRESH_MULTIPLE = 2;
+constexpr const char *TIMER_ALIGN_WINDOW_PARAM = "persist.form.timer_align_window";
+constexpr int64_t DEFAULT_TIMER_ALIGN_WINDOW = 3 * 60 * 1000;
+
+int64_t GetNextFireTime(const FormTimer &task)
+{
+    if (task.period > 0 && task.refreshTime > INT64_MAX - task.period) {
+        return INT64_MAX;
+    }
+    return task.refreshTime + task.period;
+}
+
+// Forms sharing bundle, ability and user are served by the same provider process.
+std::string GetProviderKey(const FormTimer &task)
+{
+    FormBasicInfo basicInfo;
+    if (!FormBasicInfoMgr::GetInstance().GetBasicInfoByFormId(task.formId, basicInfo)) {
+        return "";
+    }
+    return basicInfo.bundleName + "/" + basicInfo.abilityName + "/" + std::to_string(task.userId);
+}
 } // namespace
 
 FormTimerMgr::FormTimerMgr()
@@ -247,7 +271,10 @@ bool FormTimerMgr::UpdateIntervalValue(int64_t formId, const FormTimerCfg &timer
     std::lock_guard<std::mutex> lock(intervalMutex_);
     auto intervalTask = intervalTimerTasks_.find(formId);
     if (intervalTask != intervalTimerTasks_.end()) {
+        DequeueIntervalTaskNolock(intervalTask->second);
         intervalTask->second.period = timerCfg.updateDuration / timeSpeed_;
+        EnqueueIntervalTaskNolock(intervalTask->second);
+        ArmIntervalTimerNolock();
         return true;
     } else {
         HILOG_ERROR("intervalTimer not exist");
@@ -264,11 +291,9 @@ bool FormTimerMgr::UpdateIntervalValue(int64_t formId, const FormTimerCfg &timer
 bool FormTimerMgr::UpdateTimerValue(int64_t formId, const FormTimerCfg &timerCfg, UpdateAtItem &changedItem)
 {
     std::lock_guard<std::mutex> lock(updateAtMutex_);
-    std::list<UpdateAtItem>::iterator itItem;
-
-    for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end();) {
-        if (itItem->refreshTask.formId == formId) {
-            changedItem = *itItem;
+    for (auto itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end();) {
+        if (itItem->second.refreshTask.formId == formId) {
+            changedItem = itItem->second;
             itItem = updateAtTimerTasks_.erase(itItem);
         } else {
             itItem++;
@@ -351,6 +376,7 @@ bool FormTimerMgr::IntervalToAtTimer(int64_t formId, const FormTimerCfg &timerCf
     auto intervalTask = intervalTimerTasks_.find(formId);
     if (intervalTask != intervalTimerTasks_.end()) {
         timerTask = intervalTask->second;
+        DequeueIntervalTaskNolock(intervalTask->second);
         intervalTimerTasks_.erase(intervalTask);
 
         std::vector<std::vector<int>> updateAtTimes = timerCfg.updateAtTimes;
@@ -401,10 +427,9 @@ bool FormTimerMgr::AtTimerToIntervalTimer(int64_t formId, const FormTimerCfg &ti
     UpdateAtItem targetItem;
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end();) {
-            if (itItem->refreshTask.formId == formId) {
-                targetItem = *itItem;
+        for (auto itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end();) {
+            if (itItem->second.refreshTask.formId == formId) {
+                targetItem = itItem->second;
                 itItem = updateAtTimerTasks_.erase(itItem);
             } else {
                 itItem++;
@@ -476,23 +501,16 @@ bool FormTimerMgr::SetNextRefreshTime(int64_t formId, long nextGapTime, int32_t
     int64_t refreshTime = timeInSec + nextGapTime * Constants::MS_PER_SECOND / timeSpeed_;
     HILOG_INFO("currentTime:%{public}s refreshTime:%{public}s",
         std::to_string(timeInSec).c_str(), std::to_string(refreshTime).c_str());
-    bool isExist = false;
 
     {
         std::lock_guard<std::mutex> lock(dynamicMutex_);
-        for (auto &refreshItem : dynamicRefreshTasks_) {
-            if ((refreshItem.formId == formId) && (refreshItem.userId == userId)) {
-                refreshItem.settedTime = refreshTime;
-                isExist = true;
-                break;
-            }
-        }
-        if (!isExist) {
-            DynamicRefreshItem theItem(formId, refreshTime, userId);
-            theItem.nextRefreshFlag = true;
-            dynamicRefreshTasks_.emplace_back(theItem);
+        DynamicRefreshItem theItem(formId, refreshTime, userId);
+        theItem.nextRefreshFlag = true;
+        auto itItem = FindDynamicItemNolock(formId);
+        if (itItem != dynamicRefreshTasks_.end() && itItem->second.userId == userId) {
+            theItem.nextRefreshFlag = itItem->second.nextRefreshFlag;
         }
-        dynamicRefreshTasks_.sort(CompareDynamicRefreshItem);
+        AddDynamicItemNolock(theItem);
     }
 
     if (!UpdateDynamicAlarm()) {
@@ -549,8 +567,9 @@ bool FormTimerMgr::AddUpdateAtTimer(const FormTimer &task)
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
         auto updateAtTime = task.hour * Constants::MIN_PER_HOUR + task.min;
-        for (const auto &updateAtTimer : updateAtTimerTasks_) {
-            if (updateAtTimer.refreshTask.formId == task.formId && updateAtTimer.updateAtTime == updateAtTime) {
+        auto range = updateAtTimerTasks_.equal_range(updateAtTime);
+        for (auto itItem = range.first; itItem != range.second; ++itItem) {
+            if (itItem->second.refreshTask.formId == task.formId) {
                 HILOG_WARN("already exist formTimer, formId:%{public}" PRId64 " task",
                     task.formId);
                 return true;
@@ -586,12 +605,15 @@ bool FormTimerMgr::AddIntervalTimer(const FormTimer &task)
     HILOG_INFO("call");
     {
         std::lock_guard<std::mutex> lock(intervalMutex_);
-        EnsureInitIntervalTimer();
         if (intervalTimerTasks_.find(task.formId) != intervalTimerTasks_.end()) {
             HILOG_WARN("already exist formTimer, formId:%{public}" PRId64 " task", task.formId);
+            EnsureInitIntervalTimer();
             return true;
         }
         intervalTimerTasks_.emplace(task.formId, task);
+        EnqueueIntervalTaskNolock(task);
+        EnsureInitIntervalTimer();
+        ArmIntervalTimerNolock();
     }
     if (!UpdateLimiterAlarm()) {
         HILOG_ERROR("UpdateLimiterAlarm failed");
@@ -605,30 +627,8 @@ bool FormTimerMgr::AddIntervalTimer(const FormTimer &task)
  */
 void FormTimerMgr::AddUpdateAtItem(const UpdateAtItem &atItem)
 {
-    if (updateAtTimerTasks_.empty()) {
-        updateAtTimerTasks_.emplace_back(atItem);
-        return;
-    }
-
-    UpdateAtItem firstItem = updateAtTimerTasks_.front();
-    if (atItem.updateAtTime < firstItem.updateAtTime) {
-        updateAtTimerTasks_.emplace_front(atItem);
-        return;
-    }
-
-    bool isInsert = false;
-    std::list<UpdateAtItem>::iterator itItem;
-    for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-        if (atItem.updateAtTime < itItem->updateAtTime) {
-            updateAtTimerTasks_.insert(itItem, atItem);
-            isInsert = true;
-            break;
-        }
-    }
-
-    if (!isInsert) {
-        updateAtTimerTasks_.emplace_back(atItem);
-    }
+    // equal keys keep insertion order, items of the same time trigger in the order they were added.
+    updateAtTimerTasks_.emplace(atItem.updateAtTime, atItem);
 }
 /**
  * @brief Handle system time changed.
@@ -637,6 +637,12 @@ void FormTimerMgr::AddUpdateAtItem(const UpdateAtItem &atItem)
 bool FormTimerMgr::HandleSystemTimeChanged()
 {
     HILOG_INFO("start");
+    {
+        // Interval deadlines are wall clock based, re-arm for the shifted earliest deadline.
+        std::lock_guard<std::mutex> lock(intervalMutex_);
+        intervalWakeUpTime_ = INT64_MAX;
+        ArmIntervalTimerNolock();
+    }
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
         if (updateAtTimerTasks_.empty()) {
@@ -685,10 +691,10 @@ bool FormTimerMgr::OnUpdateAtTrigger(long updateTime)
     std::vector<UpdateAtItem> updateList;
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->updateAtTime == updateTime && itItem->refreshTask.isEnable) {
-                updateList.emplace_back(*itItem);
+        auto range = updateAtTimerTasks_.equal_range(updateTime);
+        for (auto itItem = range.first; itItem != range.second; ++itItem) {
+            if (itItem->second.refreshTask.isEnable) {
+                updateList.emplace_back(itItem->second);
             }
         }
     }
@@ -722,19 +728,15 @@ bool FormTimerMgr::OnDynamicTimeTrigger(int64_t updateTime)
         std::lock_guard<std::mutex> lock(dynamicMutex_);
         auto timeInSec = Common::FormTimeUtil::GetBootTimeMs();
         int64_t markedTime = timeInSec + Constants::ABS_REFRESH_MS;
-        std::list<DynamicRefreshItem>::iterator itItem;
-        for (itItem = dynamicRefreshTasks_.begin(); itItem != dynamicRefreshTasks_.end();) {
-            if (itItem->settedTime <= updateTime || itItem->settedTime <= markedTime) {
-                if (refreshLimiter_.IsEnableRefresh(itItem->formId)) {
-                    FormTimer timerTask(itItem->formId, true, itItem->userId);
-                    updateList.emplace_back(timerTask);
-                }
-                itItem = dynamicRefreshTasks_.erase(itItem);
-            } else {
-                itItem++;
+        int64_t dueTime = std::max(updateTime, markedTime);
+        auto itItem = dynamicRefreshTasks_.begin();
+        while (itItem != dynamicRefreshTasks_.end() && itItem->first <= dueTime) {
+            if (refreshLimiter_.IsEnableRefresh(itItem->second.formId)) {
+                FormTimer timerTask(itItem->second.formId, true, itItem->second.userId);
+                updateList.emplace_back(timerTask);
             }
+            itItem = EraseDynamicItemNolock(itItem);
         }
-        dynamicRefreshTasks_.sort(CompareDynamicRefreshItem);
     }
 
     if (!UpdateDynamicAlarm()) {
@@ -824,11 +826,10 @@ bool FormTimerMgr::GetUpdateAtTimer(int64_t formId, UpdateAtItem &updateAtItem)
     HILOG_INFO("start");
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
-                updateAtItem.refreshTask = itItem->refreshTask;
-                updateAtItem.updateAtTime = itItem->updateAtTime;
+        for (const auto &item : updateAtTimerTasks_) {
+            if (item.second.refreshTask.formId == formId) {
+                updateAtItem.refreshTask = item.second.refreshTask;
+                updateAtItem.updateAtTime = item.second.updateAtTime;
                 HILOG_INFO("get update at timer successfully");
                 return true;
             }
@@ -847,13 +848,12 @@ bool FormTimerMgr::GetDynamicItem(int64_t formId, DynamicRefreshItem &dynamicIte
     HILOG_INFO("start");
     {
         std::lock_guard<std::mutex> lock(dynamicMutex_);
-        for (auto itItem = dynamicRefreshTasks_.begin(); itItem != dynamicRefreshTasks_.end(); ++itItem) {
-            if (itItem->formId == formId) {
-                dynamicItem.formId = itItem->formId;
-                dynamicItem.settedTime = itItem->settedTime;
-                dynamicItem.userId = itItem->userId;
-                return true;
-            }
+        auto itItem = FindDynamicItemNolock(formId);
+        if (itItem != dynamicRefreshTasks_.end()) {
+            dynamicItem.formId = itItem->second.formId;
+            dynamicItem.settedTime = itItem->second.settedTime;
+            dynamicItem.userId = itItem->second.userId;
+            return true;
         }
     }
     HILOG_INFO("dynamic item not find");
@@ -893,6 +893,7 @@ bool FormTimerMgr::DeleteIntervalTimer(int64_t formId)
     std::lock_guard<std::mutex> lock(intervalMutex_);
     auto intervalTask = intervalTimerTasks_.find(formId);
     if (intervalTask != intervalTimerTasks_.end()) {
+        DequeueIntervalTaskNolock(intervalTask->second);
         intervalTimerTasks_.erase(intervalTask);
         isExist = true;
     }
@@ -912,9 +913,8 @@ bool FormTimerMgr::DeleteUpdateAtTimer(int64_t formId)
 {
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
+        for (auto itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); ++itItem) {
+            if (itItem->second.refreshTask.formId == formId) {
                 updateAtTimerTasks_.erase(itItem);
                 break;
             }
@@ -936,15 +936,10 @@ bool FormTimerMgr::DeleteDynamicItem(int64_t formId)
     HILOG_INFO("start");
     {
         std::lock_guard<std::mutex> lock(dynamicMutex_);
-        std::list<DynamicRefreshItem>::iterator itItem;
-        for (itItem = dynamicRefreshTasks_.begin(); itItem != dynamicRefreshTasks_.end();) {
-            if (itItem->formId == formId) {
-                itItem = dynamicRefreshTasks_.erase(itItem);
-                break;
-            }
-            ++itItem;
+        auto itItem = FindDynamicItemNolock(formId);
+        if (itItem != dynamicRefreshTasks_.end()) {
+            EraseDynamicItemNolock(itItem);
         }
-        dynamicRefreshTasks_.sort(CompareDynamicRefreshItem);
     }
 
     if (!UpdateDynamicAlarm()) {
@@ -959,52 +954,158 @@ bool FormTimerMgr::DeleteDynamicItem(int64_t formId)
 void FormTimerMgr::OnIntervalTimeOut()
 {
     HILOG_DEBUG("start");
-    std::lock_guard<std::mutex> lock(intervalMutex_);
-    std::vector<FormTimer> updateList;
-    int64_t currentTime = FormUtil::GetCurrentMillisecond();
-    for (auto &intervalPair : intervalTimerTasks_) {
-        FormTimer &intervalTask = intervalPair.second;
-        HILOG_BRIEF("intervalTask formId:%{public}" PRId64 ", period:%{public}" PRId64 " "
-            "currentTime:%{public}" PRId64 ", refreshTime:%{public}" PRId64 ", isEnable:%{public}d",
-            intervalTask.formId, intervalTask.period, currentTime,
-            intervalTask.refreshTime, intervalTask.isEnable);
-        if (!((currentTime - intervalTask.refreshTime) >= intervalTask.period ||
-            std::abs((currentTime - intervalTask.refreshTime) - intervalTask.period) <
-            (Constants::ABS_TIME / timeSpeed_))) {
-            continue;
-        }
-
-        if (!refreshLimiter_.IsEnableRefresh(intervalTask.formId)) {
-            continue;
-        }
+    std::vector<std::vector<FormTimer>> groups;
+    {
+        std::lock_guard<std::mutex> lock(intervalMutex_);
+        int64_t currentTime = FormUtil::GetCurrentMillisecond();
+        int64_t dueTime = currentTime + Constants::ABS_TIME / timeSpeed_;
+        // Skipped tasks keep their deadline and are retried on the next tick.
+        std::vector<std::pair<int64_t, int64_t>> skippedTasks;
+        std::vector<FormTimer> rescheduledTasks;
+        while (!intervalTimerQueue_.empty() && intervalTimerQueue_.begin()->first <= dueTime) {
+            auto entry = *intervalTimerQueue_.begin();
+            intervalTimerQueue_.erase(intervalTimerQueue_.begin());
+            auto intervalPair = intervalTimerTasks_.find(entry.second);
+            if (intervalPair == intervalTimerTasks_.end()) {
+                continue;
+            }
+            FormTimer &intervalTask = intervalPair->second;
+            if (!refreshLimiter_.IsEnableRefresh(intervalTask.formId)) {
+                skippedTasks.emplace_back(entry);
+                continue;
+            }
 
-        // If a SetNextRefreshTime exists for this form, skip this periodic refresh
-        // unless the next refresh gap time is delayed beyond twice the configured period.
-        {
-            std::lock_guard<std::mutex> dynLock(dynamicMutex_);
-            auto itItem = std::find_if(dynamicRefreshTasks_.begin(), dynamicRefreshTasks_.end(),
-                [&intervalTask](const auto &it) {
-                    return it.nextRefreshFlag && it.formId == intervalTask.formId;
-                });
-            int64_t bootTime = Common::FormTimeUtil::GetBootTimeMs();
-            int64_t exceedTime = PERIODIC_REFRESH_MULTIPLE * intervalTask.period;
-            if (itItem != dynamicRefreshTasks_.end() && bootTime - itItem->settedTime  <= exceedTime) {
+            // If a SetNextRefreshTime exists for this form, skip this periodic refresh
+            // unless the next refresh gap time is delayed beyond twice the configured period.
+            if (IsNextRefreshPending(intervalTask)) {
                 HILOG_INFO("skip periodic refresh for formId:%{public}" PRId64 " due to SetNextRefreshTime",
                     intervalTask.formId);
+                skippedTasks.emplace_back(entry);
                 continue;
             }
-        }
 
-        intervalTask.refreshTime = currentTime;
-        updateList.emplace_back(intervalTask);
+            intervalTask.refreshTime = currentTime;
+            rescheduledTasks.emplace_back(intervalTask);
+        }
+        AlignIntervalTasksNolock(currentTime, rescheduledTasks, groups);
+        intervalTimerQueue_.insert(skippedTasks.begin(), skippedTasks.end());
+        for (const auto &task : rescheduledTasks) {
+            EnqueueIntervalTaskNolock(task);
+        }
+        HILOG_DEBUG("due:%{public}zu, providers:%{public}zu, skipped:%{public}zu, total:%{public}zu",
+            rescheduledTasks.size(), groups.size(), skippedTasks.size(), intervalTimerTasks_.size());
+        intervalWakeUpTime_ = INT64_MAX;
+        ArmIntervalTimerNolock();
     }
 
-    if (!updateList.empty()) {
-        for (auto &task : updateList) {
+    for (auto &group : groups) {
+        for (auto &task : group) {
             task.refreshType = RefreshType::TYPE_INTERVAL;
-            ExecTimerTask(task);
         }
+        if (group.size() == 1) {
+            ExecTimerTask(group.front());
+        } else {
+            ExecAlignedTimerTasks(group);
+        }
+    }
+}
+
+void FormTimerMgr::AlignIntervalTasksNolock(int64_t currentTime, std::vector<FormTimer> &dueTasks,
+    std::vector<std::vector<FormTimer>> &groups)
+{
+    if (alignWindow_ <= 0) {
+        for (const auto &task : dueTasks) {
+            groups.push_back({ task });
+        }
+        return;
+    }
+
+    std::unordered_map<std::string, size_t> groupIndex;
+    auto addToGroup = [&groups, &groupIndex](const std::string &providerKey, const FormTimer &task) {
+        if (providerKey.empty()) {
+            groups.push_back({ task });
+            return;
+        }
+        auto result = groupIndex.emplace(providerKey, groups.size());
+        if (result.second) {
+            groups.emplace_back();
+        }
+        groups[result.first->second].emplace_back(task);
+    };
+    for (const auto &task : dueTasks) {
+        addToGroup(GetProviderKey(task), task);
+    }
+
+    // Refreshing a little early rather than waking a provider twice makes the phases of its forms converge.
+    int64_t alignDueTime = currentTime + alignWindow_ / timeSpeed_;
+    auto itQueue = intervalTimerQueue_.begin();
+    while (itQueue != intervalTimerQueue_.end() && itQueue->first <= alignDueTime) {
+        auto intervalPair = intervalTimerTasks_.find(itQueue->second);
+        if (intervalPair == intervalTimerTasks_.end()) {
+            ++itQueue;
+            continue;
+        }
+        FormTimer &intervalTask = intervalPair->second;
+        std::string providerKey = GetProviderKey(intervalTask);
+        if (groupIndex.find(providerKey) == groupIndex.end() ||
+            !refreshLimiter_.IsEnableRefresh(intervalTask.formId) || IsNextRefreshPending(intervalTask)) {
+            ++itQueue;
+            continue;
+        }
+        intervalTask.refreshTime = currentTime;
+        dueTasks.emplace_back(intervalTask);
+        addToGroup(providerKey, intervalTask);
+        itQueue = intervalTimerQueue_.erase(itQueue);
+    }
+}
+
+bool FormTimerMgr::IsNextRefreshPending(const FormTimer &task)
+{
+    std::lock_guard<std::mutex> lock(dynamicMutex_);
+    auto itItem = FindDynamicItemNolock(task.formId);
+    if (itItem == dynamicRefreshTasks_.end() || !itItem->second.nextRefreshFlag) {
+        return false;
+    }
+    int64_t bootTime = Common::FormTimeUtil::GetBootTimeMs();
+    int64_t exceedTime = PERIODIC_REFRESH_MULTIPLE * task.period;
+    return bootTime - itItem->second.settedTime <= exceedTime;
+}
+
+void FormTimerMgr::EnqueueIntervalTaskNolock(const FormTimer &task)
+{
+    intervalTimerQueue_.emplace(GetNextFireTime(task), task.formId);
+}
+
+void FormTimerMgr::DequeueIntervalTaskNolock(const FormTimer &task)
+{
+    intervalTimerQueue_.erase(std::make_pair(GetNextFireTime(task), task.formId));
+}
+
+bool FormTimerMgr::ArmIntervalTimerNolock()
+{
+    if (intervalTimerId_ == 0L || intervalTimerQueue_.empty()) {
+        return true;
+    }
+    // Wake up no more often than the base interval, overdue tasks held back by the limiter are
+    // retried at the base pace and deadlines close to each other share one wakeup.
+    int64_t baseInterval = TIMER_UPDATE_INTERVAL / timeSpeed_;
+    int64_t waitTime = intervalTimerQueue_.begin()->first - FormUtil::GetCurrentMillisecond() -
+        Constants::ABS_TIME / timeSpeed_;
+    waitTime = std::clamp(waitTime, baseInterval, static_cast<int64_t>(Constants::MAX_PERIOD));
+    int64_t wakeUpTime = Common::FormTimeUtil::GetBootTimeMs() + waitTime;
+    if (wakeUpTime >= intervalWakeUpTime_) {
+        return true;
+    }
+    MiscServices::TimeServiceClient::GetInstance()->StopTimerV9(intervalTimerId_);
+    bool bRet = MiscServices::TimeServiceClient::GetInstance()->StartTimer(intervalTimerId_,
+        static_cast<uint64_t>(wakeUpTime));
+    if (!bRet) {
+        HILOG_ERROR("start intervalTimer error");
+        return false;
     }
+    intervalWakeUpTime_ = wakeUpTime;
+    HILOG_DEBUG("intervalWakeUpTime_:%{public}" PRId64, intervalWakeUpTime_);
+    return true;
 }
 
 /**
@@ -1180,7 +1281,7 @@ bool FormTimerMgr::UpdateDynamicAlarm()
     timerOption->SetRepeat(false);
     timerOption->SetInterval(0);
     timerOption->SetName("fms_next_refresh_timer");
-    std::shared_ptr<WantAgent> wantAgent = GetDynamicWantAgent(dynamicWakeUpTime_, firstTask->userId);
+    std::shared_ptr<WantAgent> wantAgent = GetDynamicWantAgent(dynamicWakeUpTime_, firstTask->second.userId);
     if (!wantAgent) {
         HILOG_ERROR("create wantAgent failed");
         return false;
@@ -1204,19 +1305,21 @@ bool FormTimerMgr::UpdateDynamicAlarm()
 
 bool FormTimerMgr::IsNeedUpdate()
 {
+    if (dynamicRefreshTasks_.empty()) {
+        return false;
+    }
     auto firstTask = dynamicRefreshTasks_.begin();
-    if (dynamicWakeUpTime_ != firstTask->settedTime) {
-        dynamicWakeUpTime_ = firstTask->settedTime;
+    if (dynamicWakeUpTime_ != firstTask->first) {
+        dynamicWakeUpTime_ = firstTask->first;
         return true;
     }
-    if (dynamicWakeUpTime_ == firstTask->settedTime &&
-        Common::FormTimeUtil::GetBootTimeMs() - Constants::ABS_REFRESH_MS > dynamicWakeUpTime_) {
+    if (Common::FormTimeUtil::GetBootTimeMs() - Constants::ABS_REFRESH_MS > dynamicWakeUpTime_) {
         HILOG_WARN("invalid dynamicWakeUpTime_ less than currentTime, remove it");
-        firstTask = dynamicRefreshTasks_.erase(dynamicRefreshTasks_.begin());
+        firstTask = EraseDynamicItemNolock(firstTask);
         if (firstTask == dynamicRefreshTasks_.end()) {
             return false;
         }
-        dynamicWakeUpTime_ = firstTask->settedTime;
+        dynamicWakeUpTime_ = firstTask->first;
         return true;
     }
     return false;
@@ -1279,17 +1382,11 @@ bool FormTimerMgr::FindNextAtTimerItem(long nowTime, UpdateAtItem &updateAtItem)
         return false;
     }
 
-    std::list<UpdateAtItem>::iterator itItem;
-    for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-        if (itItem->updateAtTime > nowTime) {
-            updateAtItem = *itItem;
-            break;
-        }
-    }
-
+    auto itItem = updateAtTimerTasks_.upper_bound(nowTime);
     if (itItem == updateAtTimerTasks_.end()) {
-        updateAtItem = updateAtTimerTasks_.front();
+        itItem = updateAtTimerTasks_.begin();
     }
+    updateAtItem = itItem->second;
     HILOG_INFO("end");
     return true;
 }
@@ -1310,24 +1407,20 @@ void FormTimerMgr::EnsureInitIntervalTimer()
     int32_t flag = ((unsigned int)(timerOption->TIMER_TYPE_REALTIME))
       | ((unsigned int)(timerOption->TIMER_TYPE_EXACT));
     timerOption->SetType(flag);
-    timerOption->SetRepeat(true);
-    int64_t interval = TIMER_UPDATE_INTERVAL / timeSpeed_;
-    timerOption->SetInterval(interval);
+    // One shot, every tick re-arms the timer for the earliest task deadline.
+    timerOption->SetRepeat(false);
+    timerOption->SetInterval(0);
     timerOption->SetName("fms_cyclical_refresh_timer");
     auto timeCallback = []() { FormTimerMgr::GetInstance().OnIntervalTimeOut(); };
     timerOption->SetCallbackInfo(timeCallback);
 
     // 2. Create Timer and get TimerId
     intervalTimerId_ = MiscServices::TimeServiceClient::GetInstance()->CreateTimer(timerOption);
-    int64_t timeInSec = Common::FormTimeUtil::GetBootTimeMs();
-    HILOG_INFO("TimerId:%{public}" PRId64 ", timeInSec:%{public}" PRId64 ", interval:%{public}" PRId64,
-        intervalTimerId_, timeInSec, interval);
+    HILOG_INFO("TimerId:%{public}" PRId64, intervalTimerId_);
 
     // 3. Start Timer
-    int64_t startTime = timeInSec + interval;
-    bool bRet = MiscServices::TimeServiceClient::GetInstance()->StartTimer(intervalTimerId_,
-        static_cast<uint64_t>(startTime));
-    if (!bRet) {
+    intervalWakeUpTime_ = INT64_MAX;
+    if (!ArmIntervalTimerNolock()) {
         HILOG_ERROR("init intervalTimer task error");
         InnerClearIntervalTimer();
     }
@@ -1465,6 +1558,7 @@ void FormTimerMgr::InnerClearIntervalTimer()
         MiscServices::TimeServiceClient::GetInstance()->DestroyTimerAsync(intervalTimerId_);
         intervalTimerId_ = 0L;
     }
+    intervalWakeUpTime_ = INT64_MAX;
     HILOG_INFO("end");
 }
 
@@ -1519,12 +1613,31 @@ void FormTimerMgr::ExecTimerTask(const FormTimer &timerTask)
     FormRefreshMgr::GetInstance().RequestRefresh(data, TYPE_TIMER);
 }
 
+/**
+ * @brief Execute timer tasks of one provider as a single batched refresh.
+ * @param tasks Form timer tasks sharing bundle, ability and user.
+ */
+void FormTimerMgr::ExecAlignedTimerTasks(const std::vector<FormTimer> &tasks)
+{
+    std::vector<RefreshData> batch;
+    batch.reserve(tasks.size());
+    for (const auto &task : tasks) {
+        RefreshData data;
+        data.formId = task.formId;
+        data.formTimer = task;
+        batch.emplace_back(data);
+    }
+    FormTimerRefreshImpl::GetInstance().RefreshFormBatchRequest(batch);
+}
+
 /**
  * @brief Init.
  */
 void FormTimerMgr::Init()
 {
     HILOG_INFO("start");
+    alignWindow_ = OHOS::system::GetIntParameter<int64_t>(TIMER_ALIGN_WINDOW_PARAM, DEFAULT_TIMER_ALIGN_WINDOW,
+        0, TIMER_UPDATE_INTERVAL);
     systemTimerEventReceiver_ = nullptr;
     EventFwk::MatchingSkills systemEventMatchingSkills;
     systemEventMatchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_TIME_CHANGED);
@@ -1635,26 +1748,56 @@ bool FormTimerMgr::IsActiveUser(int32_t userId)
 bool FormTimerMgr::IsDynamicTimerExpired(int64_t formId)
 {
     std::lock_guard<std::mutex> lock(dynamicMutex_);
-    auto itItem = std::find_if(dynamicRefreshTasks_.begin(), dynamicRefreshTasks_.end(),
-        [formId](const auto &it) { return it.formId == formId; });
+    auto itItem = FindDynamicItemNolock(formId);
     if (itItem == dynamicRefreshTasks_.end()) {
         HILOG_WARN("can't find dynamic refresh task, just restore. formId:%{public}" PRId64, formId);
         return true;
     }
 
     auto timeInSec = Common::FormTimeUtil::GetBootTimeMs();
-    if (itItem->settedTime > timeInSec) {
+    if (itItem->second.settedTime > timeInSec) {
         HILOG_INFO("dynamic refresh task wait trigger. formId:%{public}" PRId64, formId);
         return false;
     }
 
     HILOG_WARN("dynamic refresh timed out without triggering. formId:%{public}" PRId64, formId);
-    dynamicRefreshTasks_.erase(itItem);
-    dynamicRefreshTasks_.sort(CompareDynamicRefreshItem);
+    EraseDynamicItemNolock(itItem);
     UpdateDynamicAlarm();
     return true;
 }
 
+void FormTimerMgr::AddDynamicItemNolock(const DynamicRefreshItem &item)
+{
+    auto itItem = FindDynamicItemNolock(item.formId);
+    if (itItem != dynamicRefreshTasks_.end()) {
+        dynamicRefreshTasks_.erase(itItem);
+    }
+    dynamicRefreshTasks_.emplace(item.settedTime, item);
+    dynamicRefreshTimes_[item.formId] = item.settedTime;
+}
+
+std::multimap<int64_t, DynamicRefreshItem>::iterator FormTimerMgr::FindDynamicItemNolock(int64_t formId)
+{
+    auto timeItem = dynamicRefreshTimes_.find(formId);
+    if (timeItem == dynamicRefreshTimes_.end()) {
+        return dynamicRefreshTasks_.end();
+    }
+    auto range = dynamicRefreshTasks_.equal_range(timeItem->second);
+    for (auto itItem = range.first; itItem != range.second; ++itItem) {
+        if (itItem->second.formId == formId) {
+            return itItem;
+        }
+    }
+    return dynamicRefreshTasks_.end();
+}
+
+std::multimap<int64_t, DynamicRefreshItem>::iterator FormTimerMgr::EraseDynamicItemNolock(
+    std::multimap<int64_t, DynamicRefreshItem>::iterator iter)
+{
+    dynamicRefreshTimes_.erase(iter->second.formId);
+    return dynamicRefreshTasks_.erase(iter);
+}
+
 bool FormTimerMgr::UpdateAtTimerAlarmDetail(FormTimer &timerTask)
 {
     struct tm tmAtTime = {0};
@@ -24,6 +24,7 @@
 #include "data_center/form_data_mgr.h"
 #include "form_mgr/form_mgr_adapter_facade.h"
 #include "form_refresh/strategy/refresh_control_mgr.h"
+#include "queue/form_queue_metrics.h"
 #include "status_mgr_center/form_status.h"
 #ifdef SUPPORT_POWER
 #include "power_mgr_client.h"
@@ -358,6 +359,13 @@ void FormDumpMgr::DumpRunningFormInfos(const std::vector<RunningFormInfo> &runni
     }
 }
 
+void FormDumpMgr::DumpQueueInfos(std::string &queueInfos) const
+{
+    HILOG_INFO("call");
+    queueInfos += "  ================SerialQueueInfo=================\n";
+    Common::FormQueueMetricsRegistry::GetInstance().Dump(queueInfos);
+}
+
 void FormDumpMgr::AppendBundleFormInfo(const FormRecord &formRecordInfo, std::string &formInfo) const
 {
     FormInfo bundleFormInfo;
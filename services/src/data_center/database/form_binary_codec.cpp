@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_center/database/form_binary_codec.h"
+
+#include "fms_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+// 0xFB can never start a JSON text, so legacy rows are told apart by the first byte.
+constexpr uint8_t BINARY_MAGIC_FIRST = 0xFB;
+constexpr uint8_t BINARY_MAGIC_SECOND = 0x46;
+constexpr size_t BINARY_HEADER_SIZE = 4;
+constexpr size_t SCHEMA_VERSION_INDEX = 2;
+constexpr size_t RECORD_TYPE_INDEX = 3;
+constexpr size_t INT32_SIZE = 4;
+constexpr size_t INT64_SIZE = 8;
+constexpr size_t BOOL_SIZE = 1;
+constexpr uint32_t BITS_PER_BYTE = 8;
+constexpr uint32_t VARINT_PAYLOAD_BITS = 7;
+constexpr uint8_t VARINT_PAYLOAD_MASK = 0x7F;
+constexpr uint8_t VARINT_CONTINUE_FLAG = 0x80;
+constexpr uint32_t MAX_VARINT_SHIFT = 63;
+
+bool ReadVarint(const uint8_t *data, size_t size, size_t &offset, uint64_t &value)
+{
+    value = 0;
+    for (uint32_t shift = 0; offset < size && shift <= MAX_VARINT_SHIFT; shift += VARINT_PAYLOAD_BITS) {
+        uint8_t byte = data[offset++];
+        value |= static_cast<uint64_t>(byte & VARINT_PAYLOAD_MASK) << shift;
+        if ((byte & VARINT_CONTINUE_FLAG) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t DecodeFixed(const uint8_t *data, size_t size)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i++) {
+        value |= static_cast<uint64_t>(data[i]) << (i * BITS_PER_BYTE);
+    }
+    return value;
+}
+} // namespace
+
+FormBinaryWriter::FormBinaryWriter(FormBinaryRecordType type)
+{
+    data_.reserve(BINARY_HEADER_SIZE);
+    data_.push_back(BINARY_MAGIC_FIRST);
+    data_.push_back(BINARY_MAGIC_SECOND);
+    data_.push_back(FORM_BINARY_SCHEMA_VERSION);
+    data_.push_back(static_cast<uint8_t>(type));
+}
+
+void FormBinaryWriter::WriteInt32(uint32_t tag, int32_t value)
+{
+    WriteFixed(tag, static_cast<uint32_t>(value), INT32_SIZE);
+}
+
+void FormBinaryWriter::WriteInt64(uint32_t tag, int64_t value)
+{
+    WriteFixed(tag, static_cast<uint64_t>(value), INT64_SIZE);
+}
+
+void FormBinaryWriter::WriteBool(uint32_t tag, bool value)
+{
+    WriteFixed(tag, value ? 1 : 0, BOOL_SIZE);
+}
+
+void FormBinaryWriter::WriteString(uint32_t tag, const std::string &value)
+{
+    WriteField(tag, reinterpret_cast<const uint8_t *>(value.data()), value.size());
+}
+
+void FormBinaryWriter::WriteBytes(uint32_t tag, const std::vector<uint8_t> &value)
+{
+    WriteField(tag, value.data(), value.size());
+}
+
+void FormBinaryWriter::WriteInt32Array(uint32_t tag, const std::vector<int32_t> &values)
+{
+    WriteVarint(tag);
+    WriteVarint(values.size() * INT32_SIZE);
+    for (int32_t value : values) {
+        uint32_t bits = static_cast<uint32_t>(value);
+        for (size_t i = 0; i < INT32_SIZE; i++) {
+            data_.push_back(static_cast<uint8_t>(bits >> (i * BITS_PER_BYTE)));
+        }
+    }
+}
+
+void FormBinaryWriter::WriteVarint(uint64_t value)
+{
+    while (value > VARINT_PAYLOAD_MASK) {
+        data_.push_back(static_cast<uint8_t>(value & VARINT_PAYLOAD_MASK) | VARINT_CONTINUE_FLAG);
+        value >>= VARINT_PAYLOAD_BITS;
+    }
+    data_.push_back(static_cast<uint8_t>(value));
+}
+
+void FormBinaryWriter::WriteFixed(uint32_t tag, uint64_t value, size_t size)
+{
+    WriteVarint(tag);
+    WriteVarint(size);
+    for (size_t i = 0; i < size; i++) {
+        data_.push_back(static_cast<uint8_t>(value >> (i * BITS_PER_BYTE)));
+    }
+}
+
+void FormBinaryWriter::WriteField(uint32_t tag, const uint8_t *payload, size_t size)
+{
+    WriteVarint(tag);
+    WriteVarint(size);
+    data_.insert(data_.end(), payload, payload + size);
+}
+
+bool FormBinaryReader::IsBinary(const std::string &data)
+{
+    return data.size() >= BINARY_HEADER_SIZE && static_cast<uint8_t>(data[0]) == BINARY_MAGIC_FIRST &&
+        static_cast<uint8_t>(data[1]) == BINARY_MAGIC_SECOND;
+}
+
+bool FormBinaryReader::Init(const std::string &data, FormBinaryRecordType type)
+{
+    if (!IsBinary(data)) {
+        HILOG_ERROR("not a binary record");
+        return false;
+    }
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data.data());
+    if (bytes[RECORD_TYPE_INDEX] != static_cast<uint8_t>(type)) {
+        HILOG_ERROR("record type mismatch, type:%{public}u", bytes[RECORD_TYPE_INDEX]);
+        return false;
+    }
+    schemaVersion_ = bytes[SCHEMA_VERSION_INDEX];
+    return IndexFields(bytes + BINARY_HEADER_SIZE, data.size() - BINARY_HEADER_SIZE);
+}
+
+bool FormBinaryReader::InitNested(const FormBinaryField &field)
+{
+    schemaVersion_ = FORM_BINARY_SCHEMA_VERSION;
+    return IndexFields(field.data, field.size);
+}
+
+bool FormBinaryReader::IndexFields(const uint8_t *data, size_t size)
+{
+    fields_.clear();
+    fieldIndexes_.clear();
+    size_t offset = 0;
+    while (offset < size) {
+        uint64_t tag = 0;
+        uint64_t length = 0;
+        if (!ReadVarint(data, size, offset, tag) || !ReadVarint(data, size, offset, length) ||
+            length > size - offset) {
+            HILOG_ERROR("truncated field at offset:%{public}zu", offset);
+            fields_.clear();
+            fieldIndexes_.clear();
+            return false;
+        }
+        fieldIndexes_.emplace(static_cast<uint32_t>(tag), fields_.size());
+        fields_.push_back({ static_cast<uint32_t>(tag), data + offset, static_cast<size_t>(length) });
+        offset += length;
+    }
+    return true;
+}
+
+const FormBinaryField *FormBinaryReader::FindField(uint32_t tag) const
+{
+    auto iter = fieldIndexes_.find(tag);
+    return iter == fieldIndexes_.end() ? nullptr : &fields_[iter->second];
+}
+
+bool FormBinaryReader::ReadFixed(uint32_t tag, size_t size, uint64_t &value) const
+{
+    const FormBinaryField *field = FindField(tag);
+    if (field == nullptr || field->size != size) {
+        return false;
+    }
+    value = DecodeFixed(field->data, size);
+    return true;
+}
+
+bool FormBinaryReader::ReadInt32(uint32_t tag, int32_t &value) const
+{
+    uint64_t bits = 0;
+    if (!ReadFixed(tag, INT32_SIZE, bits)) {
+        return false;
+    }
+    value = static_cast<int32_t>(static_cast<uint32_t>(bits));
+    return true;
+}
+
+bool FormBinaryReader::ReadInt64(uint32_t tag, int64_t &value) const
+{
+    uint64_t bits = 0;
+    if (!ReadFixed(tag, INT64_SIZE, bits)) {
+        return false;
+    }
+    value = static_cast<int64_t>(bits);
+    return true;
+}
+
+bool FormBinaryReader::ReadBool(uint32_t tag, bool &value) const
+{
+    uint64_t bits = 0;
+    if (!ReadFixed(tag, BOOL_SIZE, bits)) {
+        return false;
+    }
+    value = bits != 0;
+    return true;
+}
+
+bool FormBinaryReader::ReadString(uint32_t tag, std::string &value) const
+{
+    const FormBinaryField *field = FindField(tag);
+    if (field == nullptr) {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char *>(field->data), field->size);
+    return true;
+}
+
+bool FormBinaryReader::ReadInt32Array(uint32_t tag, std::vector<int32_t> &values) const
+{
+    const FormBinaryField *field = FindField(tag);
+    if (field == nullptr || field->size % INT32_SIZE != 0) {
+        return false;
+    }
+    values.clear();
+    values.reserve(field->size / INT32_SIZE);
+    for (size_t offset = 0; offset < field->size; offset += INT32_SIZE) {
+        values.push_back(static_cast<int32_t>(static_cast<uint32_t>(DecodeFixed(field->data + offset, INT32_SIZE))));
+    }
+    return true;
+}
+
+void FormBinaryReader::ReadRepeated(uint32_t tag, std::vector<FormBinaryField> &fields) const
+{
+    for (const auto &field : fields_) {
+        if (field.tag == tag) {
+            fields.push_back(field);
+        }
+    }
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
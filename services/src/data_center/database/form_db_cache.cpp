@@ -44,18 +44,21 @@ FormDbCache::~FormDbCache()
  */
 void FormDbCache::Start()
 {
+    int64_t startTime = FormUtil::GetCurrentSteadyClockMillseconds();
     std::vector<InnerFormInfo> innerFormInfos;
-    innerFormInfos.clear();
     if (FormInfoRdbStorageMgr::GetInstance().LoadFormData(innerFormInfos) != ERR_OK) {
         HILOG_ERROR("LoadFormData failed");
         return;
     }
-    HILOG_INFO("load form data, size: %{public}zu", innerFormInfos.size());
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (unsigned int i = 0; i < innerFormInfos.size(); i++) {
-        FormDBInfo formDBInfo = innerFormInfos.at(i).GetFormDBInfo();
-        formDBInfos_.emplace_back(formDBInfo);
+    {
+        std::unique_lock<std::shared_mutex> lock(formDBInfosMutex_);
+        formDBInfos_.reserve(innerFormInfos.size());
+        for (const auto &innerFormInfo : innerFormInfos) {
+            InsertFormDBInfoNolock(innerFormInfo.GetFormDBInfo());
+        }
     }
+    HILOG_INFO("load form data, size: %{public}zu, cost: %{public}" PRId64 "ms", innerFormInfos.size(),
+        FormUtil::GetCurrentSteadyClockMillseconds() - startTime);
 }
 
 /**
@@ -90,11 +93,11 @@ ErrCode FormDbCache::SaveFormInfo(const FormDBInfo &formDBInfo)
 ErrCode FormDbCache::SaveFormInfoNolock(const FormDBInfo &formDBInfo)
 {
     HILOG_INFO("formId:%{public}" PRId64, formDBInfo.formId);
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), formDBInfo);
+    auto iter = formDBInfos_.find(formDBInfo.formId);
     if (iter != formDBInfos_.end()) {
-        if (iter->Compare(formDBInfo) == false) {
+        if (iter->second.Compare(formDBInfo) == false) {
             HILOG_WARN("need update, formId[%{public}" PRId64 "].", formDBInfo.formId);
-            *iter = formDBInfo;
+            InsertFormDBInfoNolock(formDBInfo);
             InnerFormInfo innerFormInfo(formDBInfo);
             return FormInfoRdbStorageMgr::GetInstance().ModifyStorageFormData(innerFormInfo);
         } else {
@@ -102,7 +105,7 @@ ErrCode FormDbCache::SaveFormInfoNolock(const FormDBInfo &formDBInfo)
             return ERR_OK;
         }
     } else {
-        formDBInfos_.emplace_back(formDBInfo);
+        InsertFormDBInfoNolock(formDBInfo);
         InnerFormInfo innerFormInfo(formDBInfo);
         return FormInfoRdbStorageMgr::GetInstance().SaveStorageFormData(innerFormInfo);
     }
@@ -130,15 +133,22 @@ ErrCode FormDbCache::DeleteFormInfoByBundleName(const std::string &bundleName, c
 {
     HILOG_INFO("bundleName: %{public}s", bundleName.c_str());
     GetFormDBInfoCacheByBundleName(bundleName, userId, removedDBForms);
+    if (removedDBForms.empty()) {
+        return ERR_OK;
+    }
 
-    for (auto iter = removedDBForms.begin(); iter != removedDBForms.end();) {
-        if (FormInfoRdbStorageMgr::GetInstance().DeleteStorageFormData(std::to_string(iter->formId)) == ERR_OK) {
-            DeleteFormDBInfoCache(iter->formId);
-            iter++;
-        } else {
-            HILOG_WARN("delete storage form data failed, formId:%{public}" PRId64, iter->formId);
-            iter = removedDBForms.erase(iter);
-        }
+    std::vector<std::string> formIds;
+    formIds.reserve(removedDBForms.size());
+    for (const auto &dbInfo : removedDBForms) {
+        formIds.emplace_back(std::to_string(dbInfo.formId));
+    }
+    if (FormInfoRdbStorageMgr::GetInstance().DeleteStorageFormDatas(formIds) != ERR_OK) {
+        HILOG_WARN("delete storage form datas failed, bundleName:%{public}s", bundleName.c_str());
+        removedDBForms.clear();
+        return ERR_OK;
+    }
+    for (const auto &dbInfo : removedDBForms) {
+        DeleteFormDBInfoCache(dbInfo.formId);
     }
     return ERR_OK;
 }
@@ -151,8 +161,12 @@ ErrCode FormDbCache::DeleteFormInfoByBundleName(const std::string &bundleName, c
 void FormDbCache::GetAllFormInfo(std::vector<FormDBInfo> &formDBInfos)
 {
     HILOG_INFO("call");
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    formDBInfos = formDBInfos_;
+    std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    formDBInfos.clear();
+    formDBInfos.reserve(formDBInfos_.size());
+    for (const auto &item : formDBInfos_) {
+        formDBInfos.emplace_back(item.second);
+    }
 }
 
 /**
@@ -164,8 +178,9 @@ void FormDbCache::GetAllFormInfo(std::vector<FormDBInfo> &formDBInfos)
 void FormDbCache::GetAllFormDBInfoByBundleName(const std::string &bundleName, const int32_t userId,
     std::vector<FormDBInfo> &formDBInfos)
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (auto dbInfo : formDBInfos_) {
+    std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    for (const auto &item : formDBInfos_) {
+        const FormDBInfo &dbInfo = item.second;
         if (bundleName == dbInfo.bundleName && dbInfo.userId == userId) {
             formDBInfos.push_back(dbInfo);
         }
@@ -180,21 +195,21 @@ void FormDbCache::GetAllFormDBInfoByBundleName(const std::string &bundleName, co
  */
 ErrCode FormDbCache::GetDBRecord(const int64_t formId, FormRecord &record) const
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const FormDBInfo &dbInfo : formDBInfos_) {
-        if (dbInfo.formId == formId) {
-            record.userId = dbInfo.userId;
-            record.providerUserId= dbInfo.providerUserId;
-            record.formName = dbInfo.formName;
-            record.bundleName = dbInfo.bundleName;
-            record.moduleName = dbInfo.moduleName;
-            record.abilityName = dbInfo.abilityName;
-            record.formUserUids = dbInfo.formUserUids;
-            record.formLocation = dbInfo.formLocation;
-            record.enableForm = dbInfo.enableForm;
-            record.lockForm = dbInfo.lockForm;
-            return ERR_OK;
-        }
+    std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    auto iter = formDBInfos_.find(formId);
+    if (iter != formDBInfos_.end()) {
+        const FormDBInfo &dbInfo = iter->second;
+        record.userId = dbInfo.userId;
+        record.providerUserId= dbInfo.providerUserId;
+        record.formName = dbInfo.formName;
+        record.bundleName = dbInfo.bundleName;
+        record.moduleName = dbInfo.moduleName;
+        record.abilityName = dbInfo.abilityName;
+        record.formUserUids = dbInfo.formUserUids;
+        record.formLocation = dbInfo.formLocation;
+        record.enableForm = dbInfo.enableForm;
+        record.lockForm = dbInfo.lockForm;
+        return ERR_OK;
     }
     HILOG_ERROR("not find formId[%{public}" PRId64 "]", formId);
     return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
@@ -207,12 +222,11 @@ ErrCode FormDbCache::GetDBRecord(const int64_t formId, FormRecord &record) const
  */
 ErrCode FormDbCache::GetDBRecord(const int64_t formId, FormDBInfo &record) const
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const FormDBInfo &dbInfo : formDBInfos_) {
-        if (dbInfo.formId == formId) {
-            record = dbInfo;
-            return ERR_OK;
-        }
+    std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    auto iter = formDBInfos_.find(formId);
+    if (iter != formDBInfos_.end()) {
+        record = iter->second;
+        return ERR_OK;
     }
     HILOG_ERROR("not find formId[%{public}" PRId64 "]", formId);
     return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
@@ -243,10 +257,13 @@ ErrCode FormDbCache::UpdateDBRecord(const int64_t formId, const FormRecord &reco
 ErrCode FormDbCache::GetNoHostDBForms(const int uid, std::map<FormIdKey,
     std::set<int64_t>> &noHostFormDBList, std::map<int64_t, bool> &foundFormsMap)
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (FormDBInfo& dbInfo : formDBInfos_) {
+    std::unique_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    for (auto &item : formDBInfos_) {
+        FormDBInfo &dbInfo = item.second;
         if (dbInfo.Contains(uid)) {
+            RemoveFormDBInfoIndexNolock(dbInfo);
             dbInfo.Remove(uid);
+            AddFormDBInfoIndexNolock(dbInfo);
             if (dbInfo.formUserUids.empty()) {
                 FormIdKey formIdKey(dbInfo.bundleName, dbInfo.abilityName, dbInfo.moduleName);
                 auto itIdsSet = noHostFormDBList.find(formIdKey);
@@ -275,9 +292,9 @@ ErrCode FormDbCache::GetNoHostDBForms(const int uid, std::map<FormIdKey,
 int FormDbCache::GetMatchCount(const std::string &bundleName, const std::string &moduleName)
 {
     int32_t matchCount = 0;
-    std::vector<FormDBInfo> formDBInfos;
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const FormDBInfo &dbInfo : formDBInfos_) {
+    std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    for (const auto &item : formDBInfos_) {
+        const FormDBInfo &dbInfo = item.second;
         if (dbInfo.bundleName == bundleName && dbInfo.moduleName == moduleName) {
             ++matchCount;
         }
@@ -294,12 +311,21 @@ void FormDbCache::DeleteDBFormsByUserId(const int32_t userId)
     HILOG_INFO("userId: %{public}d", userId);
     std::vector<FormDBInfo> removedDBForms;
     GetFormDBInfoCacheByUserId(userId, removedDBForms);
-    for (auto &info : removedDBForms) {
-        if (FormInfoRdbStorageMgr::GetInstance().DeleteStorageFormData(std::to_string(info.formId)) == ERR_OK) {
-            DeleteFormDBInfoCache(info.formId);
-        } else {
-            HILOG_ERROR("fail delete form, formId[%{public}" PRId64 "]", info.formId);
-        }
+    if (removedDBForms.empty()) {
+        return;
+    }
+
+    std::vector<std::string> formIds;
+    formIds.reserve(removedDBForms.size());
+    for (const auto &info : removedDBForms) {
+        formIds.emplace_back(std::to_string(info.formId));
+    }
+    if (FormInfoRdbStorageMgr::GetInstance().DeleteStorageFormDatas(formIds) != ERR_OK) {
+        HILOG_ERROR("fail delete forms, userId[%{public}d]", userId);
+        return;
+    }
+    for (const auto &info : removedDBForms) {
+        DeleteFormDBInfoCache(info.formId);
     }
 }
 
@@ -315,8 +341,9 @@ void FormDbCache::GetNoHostInvalidDBForms(int32_t userId, int32_t callingUid, st
                                           std::map<FormIdKey, std::set<int64_t>> &noHostDBFormsMap,
                                           std::map<int64_t, bool> &foundFormsMap)
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (auto &formRecord: formDBInfos_) {
+    std::unique_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    for (auto &item : formDBInfos_) {
+        FormDBInfo &formRecord = item.second;
         int64_t formId = formRecord.formId;
         // check UID
         auto iter = std::find(formRecord.formUserUids.begin(), formRecord.formUserUids.end(), callingUid);
@@ -333,7 +360,9 @@ void FormDbCache::GetNoHostInvalidDBForms(int32_t userId, int32_t callingUid, st
         }
 
         HILOG_WARN("found invalid form:%{public}" PRId64, formId);
+        RemoveFormDBInfoIndexNolock(formRecord);
         formRecord.formUserUids.erase(iter);
+        AddFormDBInfoIndexNolock(formRecord);
         if (formRecord.formUserUids.empty()) {
             FormIdKey formIdKey(formRecord.bundleName, formRecord.abilityName, formRecord.moduleName);
             auto itIdsSet = noHostDBFormsMap.find(formIdKey);
@@ -362,6 +391,7 @@ void FormDbCache::BatchDeleteNoHostDBForms(int32_t callingUid, std::map<FormIdKe
                                            std::map<int64_t, bool> &foundFormsMap)
 {
     std::set<FormIdKey> removableModuleSet;
+    std::vector<std::string> removedFormIds;
     for (auto &element : noHostDBFormsMap) {
         std::set<int64_t> &formIds = element.second;
         FormIdKey formIdKey = element.first;
@@ -378,12 +408,17 @@ void FormDbCache::BatchDeleteNoHostDBForms(int32_t callingUid, std::map<FormIdKe
             if (errCode == ERR_OK) {
                 FormIdKey removableModuleFormIdKey(dbInfo.bundleName, dbInfo.moduleName);
                 removableModuleSet.emplace(removableModuleFormIdKey);
-                DeleteFormInfo(formId);
+                DeleteFormDBInfoCache(formId);
+                removedFormIds.emplace_back(std::to_string(formId));
             }
             FormDataMgr::GetInstance().StopRenderingForm(formId);
             FormDataMgr::GetInstance().DeleteFormRecord(formId);
         }
     }
+    if (!removedFormIds.empty() &&
+        FormInfoRdbStorageMgr::GetInstance().DeleteStorageFormDatas(removedFormIds) != ERR_OK) {
+        HILOG_ERROR("delete %{public}zu no host forms failed", removedFormIds.size());
+    }
 
     for (const FormIdKey &item : removableModuleSet) {
         int32_t matchCount = GetMatchCount(item.bundleName, item.moduleName);
@@ -483,15 +518,9 @@ ErrCode FormDbCache::UpdateFormLocation(const int64_t formId, const int32_t form
  */
 int FormDbCache::GetFormCountsByUserId(const int32_t userId)
 {
-    int userIdFormCounts = 0;
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const auto &record : formDBInfos_) {
-        if (record.userId != userId) {
-            continue;
-        }
-        userIdFormCounts++;
-    }
-    return userIdFormCounts;
+    std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    auto iter = userIdFormCounts_.find(userId);
+    return iter == userIdFormCounts_.end() ? 0 : iter->second;
 }
 
 /**
@@ -501,20 +530,23 @@ int FormDbCache::GetFormCountsByUserId(const int32_t userId)
  */
 int32_t FormDbCache::GetFormCountsByHostBundleName(const std::string &hostBundleName)
 {
+    std::unordered_map<int32_t, int32_t> hostUidFormCounts;
+    {
+        std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
+        hostUidFormCounts = hostUidFormCounts_;
+    }
+    // Resolve each distinct host uid once and outside the lock instead of once per form.
     int32_t formCounts = 0;
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const auto& record : formDBInfos_) {
-        for (const auto &hostUid : record.formUserUids) {
-            std::string recordHostBundleName;
-            int32_t ret = FormBmsHelper::GetInstance().GetBundleNameByUid(hostUid, recordHostBundleName);
-            if (ret != ERR_OK) {
-                continue;
-            }
-            if (recordHostBundleName != hostBundleName) {
-                continue;
-            }
-            formCounts++;
+    for (const auto &item : hostUidFormCounts) {
+        std::string recordHostBundleName;
+        int32_t ret = FormBmsHelper::GetInstance().GetBundleNameByUid(item.first, recordHostBundleName);
+        if (ret != ERR_OK) {
+            continue;
+        }
+        if (recordHostBundleName != hostBundleName) {
+            continue;
         }
+        formCounts += item.second;
     }
     return formCounts;
 }
@@ -526,7 +558,7 @@ int32_t FormDbCache::GetFormCountsByHostBundleName(const std::string &hostBundle
 int32_t FormDbCache::GetAllFormInfoSize()
 {
     HILOG_INFO("call");
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
+    std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
     return static_cast<int32_t>(formDBInfos_.size());
 }
 
@@ -560,41 +592,34 @@ void FormDbCache::UpdateMultiAppFormVersionCode(const std::string &bundleName, u
 
 void FormDbCache::DeleteFormDBInfoCache(int64_t formId)
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    FormDBInfo tmpForm;
-    tmpForm.formId = formId;
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), tmpForm);
-    if (iter == formDBInfos_.end()) {
+    std::unique_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    if (!EraseFormDBInfoNolock(formId)) {
         HILOG_WARN("not find form:%{public}" PRId64, formId);
-    } else {
-        formDBInfos_.erase(iter);
     }
 }
 
 bool FormDbCache::FindAndSaveFormDBInfoCache(const FormDBInfo &formDBInfo, FormDBInfo &findInfo)
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), formDBInfo);
+    std::unique_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    auto iter = formDBInfos_.find(formDBInfo.formId);
     if (iter != formDBInfos_.end()) {
-        findInfo = *iter;
-        if (iter->Compare(formDBInfo) == false) {
-            *iter = formDBInfo;
+        findInfo = iter->second;
+        if (iter->second.Compare(formDBInfo) == false) {
+            InsertFormDBInfoNolock(formDBInfo);
         }
         return true;
     }
-    formDBInfos_.emplace_back(formDBInfo);
+    InsertFormDBInfoNolock(formDBInfo);
     return false;
 }
 
 bool FormDbCache::FindAndUpdateFormLocation(int64_t formId, int32_t formLocation, FormDBInfo &findInfo)
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    FormDBInfo tmpForm;
-    tmpForm.formId = formId;
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), tmpForm);
+    std::unique_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    auto iter = formDBInfos_.find(formId);
     if (iter != formDBInfos_.end()) {
-        findInfo = *iter;
-        iter->formLocation = static_cast<Constants::FormLocation>(formLocation);
+        findInfo = iter->second;
+        iter->second.formLocation = static_cast<Constants::FormLocation>(formLocation);
         return true;
     }
     return false;
@@ -603,20 +628,93 @@ bool FormDbCache::FindAndUpdateFormLocation(int64_t formId, int32_t formLocation
 void FormDbCache::GetFormDBInfoCacheByBundleName(const std::string &bundleName, const int32_t providerUserId,
     std::vector<FormDBInfo> &dbFormInfos)
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const auto &info : formDBInfos_) {
-        if ((bundleName == info.bundleName) && (providerUserId == info.providerUserId)) {
-            dbFormInfos.emplace_back(info);
+    std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    auto indexIter = bundleUserIndex_.find(std::make_pair(bundleName, providerUserId));
+    if (indexIter == bundleUserIndex_.end()) {
+        return;
+    }
+    dbFormInfos.reserve(dbFormInfos.size() + indexIter->second.size());
+    for (int64_t formId : indexIter->second) {
+        auto iter = formDBInfos_.find(formId);
+        if (iter != formDBInfos_.end()) {
+            dbFormInfos.emplace_back(iter->second);
         }
     }
 }
 
 void FormDbCache::GetFormDBInfoCacheByUserId(const int32_t providerUserId, std::vector<FormDBInfo> &dbFormInfos)
 {
-    std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const auto &info : formDBInfos_) {
-        if (providerUserId == info.providerUserId) {
-            dbFormInfos.emplace_back(info);
+    std::shared_lock<std::shared_mutex> lock(formDBInfosMutex_);
+    auto indexIter = providerUserIndex_.find(providerUserId);
+    if (indexIter == providerUserIndex_.end()) {
+        return;
+    }
+    dbFormInfos.reserve(dbFormInfos.size() + indexIter->second.size());
+    for (int64_t formId : indexIter->second) {
+        auto iter = formDBInfos_.find(formId);
+        if (iter != formDBInfos_.end()) {
+            dbFormInfos.emplace_back(iter->second);
+        }
+    }
+}
+
+void FormDbCache::InsertFormDBInfoNolock(const FormDBInfo &formDBInfo)
+{
+    auto iter = formDBInfos_.find(formDBInfo.formId);
+    if (iter != formDBInfos_.end()) {
+        RemoveFormDBInfoIndexNolock(iter->second);
+        iter->second = formDBInfo;
+    } else {
+        formDBInfos_.emplace(formDBInfo.formId, formDBInfo);
+    }
+    AddFormDBInfoIndexNolock(formDBInfo);
+}
+
+bool FormDbCache::EraseFormDBInfoNolock(int64_t formId)
+{
+    auto iter = formDBInfos_.find(formId);
+    if (iter == formDBInfos_.end()) {
+        return false;
+    }
+    RemoveFormDBInfoIndexNolock(iter->second);
+    formDBInfos_.erase(iter);
+    return true;
+}
+
+void FormDbCache::AddFormDBInfoIndexNolock(const FormDBInfo &formDBInfo)
+{
+    bundleUserIndex_[std::make_pair(formDBInfo.bundleName, formDBInfo.providerUserId)].emplace(formDBInfo.formId);
+    providerUserIndex_[formDBInfo.providerUserId].emplace(formDBInfo.formId);
+    userIdFormCounts_[formDBInfo.userId]++;
+    for (const auto &hostUid : formDBInfo.formUserUids) {
+        hostUidFormCounts_[hostUid]++;
+    }
+}
+
+void FormDbCache::RemoveFormDBInfoIndexNolock(const FormDBInfo &formDBInfo)
+{
+    auto bundleIter = bundleUserIndex_.find(std::make_pair(formDBInfo.bundleName, formDBInfo.providerUserId));
+    if (bundleIter != bundleUserIndex_.end()) {
+        bundleIter->second.erase(formDBInfo.formId);
+        if (bundleIter->second.empty()) {
+            bundleUserIndex_.erase(bundleIter);
+        }
+    }
+    auto userIter = providerUserIndex_.find(formDBInfo.providerUserId);
+    if (userIter != providerUserIndex_.end()) {
+        userIter->second.erase(formDBInfo.formId);
+        if (userIter->second.empty()) {
+            providerUserIndex_.erase(userIter);
+        }
+    }
+    auto countIter = userIdFormCounts_.find(formDBInfo.userId);
+    if (countIter != userIdFormCounts_.end() && --countIter->second <= 0) {
+        userIdFormCounts_.erase(countIter);
+    }
+    for (const auto &hostUid : formDBInfo.formUserUids) {
+        auto hostIter = hostUidFormCounts_.find(hostUid);
+        if (hostIter != hostUidFormCounts_.end() && --hostIter->second <= 0) {
+            hostUidFormCounts_.erase(hostIter);
         }
     }
 }
@@ -15,6 +15,7 @@
 
 #include "data_center/database/form_db_info.h"
 
+#include "data_center/database/form_binary_codec.h"
 #include "json_util_form.h"
 
 namespace OHOS {
@@ -32,6 +33,22 @@ constexpr const char *INNER_FORM_INFO_FORM_LOCATION = "formLocation";
 constexpr const char *INNER_FORM_INFO_FORM_ENABLE = "enableForm";
 constexpr const char *INNER_FORM_INFO_FORM_LOCK = "lockForm";
 constexpr const char *INNER_FORM_INFO_IS_THEMEFORM = "isThemeForm";
+
+// Tags of the binary record, never reuse a retired tag.
+enum InnerFormInfoTag : uint32_t {
+    TAG_FORM_ID = 1,
+    TAG_USER_ID,
+    TAG_PROVIDER_USER_ID,
+    TAG_FORM_NAME,
+    TAG_BUNDLE_NAME,
+    TAG_MODULE_NAME,
+    TAG_ABILITY_NAME,
+    TAG_FORM_USER_UIDS,
+    TAG_FORM_LOCATION,
+    TAG_FORM_ENABLE,
+    TAG_FORM_LOCK,
+    TAG_IS_THEMEFORM,
+};
 } // namespace
 
 /**
@@ -101,6 +118,49 @@ bool InnerFormInfo::FromJson(const nlohmann::json &jsonObject)
     return parseResult == ERR_OK;
 }
 
+std::vector<uint8_t> InnerFormInfo::ToBinary() const
+{
+    FormBinaryWriter writer(FormBinaryRecordType::INNER_FORM_INFO);
+    writer.WriteInt64(TAG_FORM_ID, formDBInfo_.formId);
+    writer.WriteInt32(TAG_USER_ID, formDBInfo_.userId);
+    writer.WriteInt32(TAG_PROVIDER_USER_ID, formDBInfo_.providerUserId);
+    writer.WriteString(TAG_FORM_NAME, formDBInfo_.formName);
+    writer.WriteString(TAG_BUNDLE_NAME, formDBInfo_.bundleName);
+    writer.WriteString(TAG_MODULE_NAME, formDBInfo_.moduleName);
+    writer.WriteString(TAG_ABILITY_NAME, formDBInfo_.abilityName);
+    writer.WriteInt32Array(TAG_FORM_USER_UIDS, formDBInfo_.formUserUids);
+    writer.WriteInt32(TAG_FORM_LOCATION, static_cast<int32_t>(formDBInfo_.formLocation));
+    writer.WriteBool(TAG_FORM_ENABLE, formDBInfo_.enableForm);
+    writer.WriteBool(TAG_FORM_LOCK, formDBInfo_.lockForm);
+    writer.WriteBool(TAG_IS_THEMEFORM, formDBInfo_.isThemeForm);
+    return writer.GetData();
+}
+
+bool InnerFormInfo::FromBinary(const std::string &data)
+{
+    FormBinaryReader reader;
+    if (!reader.Init(data, FormBinaryRecordType::INNER_FORM_INFO) ||
+        !reader.ReadInt64(TAG_FORM_ID, formDBInfo_.formId)) {
+        return false;
+    }
+    // Like FromJson, every field except formId is optional so older records keep loading.
+    reader.ReadInt32(TAG_USER_ID, formDBInfo_.userId);
+    reader.ReadInt32(TAG_PROVIDER_USER_ID, formDBInfo_.providerUserId);
+    reader.ReadString(TAG_FORM_NAME, formDBInfo_.formName);
+    reader.ReadString(TAG_BUNDLE_NAME, formDBInfo_.bundleName);
+    reader.ReadString(TAG_MODULE_NAME, formDBInfo_.moduleName);
+    reader.ReadString(TAG_ABILITY_NAME, formDBInfo_.abilityName);
+    reader.ReadInt32Array(TAG_FORM_USER_UIDS, formDBInfo_.formUserUids);
+    int32_t formLocation = 0;
+    if (reader.ReadInt32(TAG_FORM_LOCATION, formLocation)) {
+        formDBInfo_.formLocation = static_cast<Constants::FormLocation>(formLocation);
+    }
+    reader.ReadBool(TAG_FORM_ENABLE, formDBInfo_.enableForm);
+    reader.ReadBool(TAG_FORM_LOCK, formDBInfo_.lockForm);
+    reader.ReadBool(TAG_IS_THEMEFORM, formDBInfo_.isThemeForm);
+    return true;
+}
+
 void InnerFormInfo::AddUserUid(const int callingUid)
 {
     auto iter = std::find(formDBInfo_.formUserUids.begin(), formDBInfo_.formUserUids.end(), callingUid);
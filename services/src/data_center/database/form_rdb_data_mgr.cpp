@@ -20,6 +20,7 @@
 #include <sstream>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <variant>
 #include "fms_log_wrapper.h"
 #include "form_constants.h"
 #include "form_mgr_errors.h"
@@ -34,9 +35,34 @@ namespace {
 constexpr const char *FORM_KEY = "KEY";
 constexpr const char *FORM_VALUE = "VALUE";
 constexpr const char *FORM_DB_STATICS_MONITOR = "FormRdbStatisticsMonitor";
+// Binary encoding of VALUE, NULL when the row was written as json only (by an older version).
+constexpr const char *FORM_BINARY_VALUE = "BINARY_VALUE";
 const int32_t FORM_KEY_INDEX = 0;
 const int32_t FORM_VALUE_INDEX = 1;
+const int32_t FORM_BINARY_VALUE_INDEX = 2;
 const int64_t MIN_FORM_RDB_REBUILD_INTERVAL = 10000; // 10s
+
+std::string BuildKeyValueTableSql(const std::string &tableName)
+{
+    return "CREATE TABLE IF NOT EXISTS " + tableName
+        + " (KEY TEXT NOT NULL PRIMARY KEY, VALUE TEXT NOT NULL, " + FORM_BINARY_VALUE + " BLOB);";
+}
+
+int32_t GetFormValue(const std::shared_ptr<NativeRdb::AbsSharedResultSet> &resultSet, std::string &value)
+{
+    // VALUE always holds json so a downgraded version can still load the row, the binary value is preferred.
+    NativeRdb::ColumnType columnType = NativeRdb::ColumnType::TYPE_NULL;
+    int32_t ret = resultSet->GetColumnType(FORM_BINARY_VALUE_INDEX, columnType);
+    if (ret != NativeRdb::E_OK || columnType != NativeRdb::ColumnType::TYPE_BLOB) {
+        return resultSet->GetString(FORM_VALUE_INDEX, value);
+    }
+    std::vector<uint8_t> blob;
+    ret = resultSet->GetBlob(FORM_BINARY_VALUE_INDEX, blob);
+    if (ret == NativeRdb::E_OK) {
+        value.assign(blob.begin(), blob.end());
+    }
+    return ret;
+}
 } // namespace
 RdbStoreDataCallBackFormInfoStorage::RdbStoreDataCallBackFormInfoStorage(const std::string &rdbPath)
     : rdbPath_(rdbPath)
@@ -113,8 +139,7 @@ ErrCode FormRdbDataMgr::InitFormRdbTable(const FormRdbTableConfig &formRdbTableC
     }
 
     std::string createTableSql = !formRdbTableConfig.createTableSql.empty() ? formRdbTableConfig.createTableSql
-        : "CREATE TABLE IF NOT EXISTS " + formRdbTableConfig.tableName
-            + " (KEY TEXT NOT NULL PRIMARY KEY, VALUE TEXT NOT NULL);";
+        : BuildKeyValueTableSql(formRdbTableConfig.tableName);
 
     int32_t ret = rdbStore->ExecuteSql(createTableSql);
     if (ret != NativeRdb::E_OK) {
@@ -122,9 +147,44 @@ ErrCode FormRdbDataMgr::InitFormRdbTable(const FormRdbTableConfig &formRdbTableC
         return ERR_APPEXECFWK_FORM_COMMON_CODE;
     }
 
+    if (formRdbTableConfig.createTableSql.empty()) {
+        AddBinaryValueColumn(rdbStore, formRdbTableConfig.tableName);
+    }
     return ERR_OK;
 }
 
+void FormRdbDataMgr::AddBinaryValueColumn(
+    const std::shared_ptr<NativeRdb::RdbStore> &rdbStore, const std::string &tableName)
+{
+    auto absSharedResultSet = rdbStore->QuerySql("PRAGMA table_info(" + tableName + ")", std::vector<std::string>());
+    if (absSharedResultSet == nullptr) {
+        HILOG_ERROR("query columns of %{public}s failed", tableName.c_str());
+        return;
+    }
+    ScopeGuard stateGuard([absSharedResultSet] {
+        absSharedResultSet->Close();
+    });
+    int32_t nameIndex = 0;
+    if (absSharedResultSet->GetColumnIndex("name", nameIndex) != NativeRdb::E_OK) {
+        HILOG_ERROR("no column name in table info of %{public}s", tableName.c_str());
+        return;
+    }
+    while (absSharedResultSet->GoToNextRow() == NativeRdb::E_OK) {
+        std::string columnName;
+        if (absSharedResultSet->GetString(nameIndex, columnName) == NativeRdb::E_OK &&
+            columnName == FORM_BINARY_VALUE) {
+            return;
+        }
+    }
+
+    // Tables created before the binary encoding get the column, their json rows are migrated on load.
+    std::string sql = "ALTER TABLE " + tableName + " ADD COLUMN " + FORM_BINARY_VALUE + " BLOB;";
+    int32_t ret = rdbStore->ExecuteSql(sql);
+    if (ret != NativeRdb::E_OK) {
+        HILOG_ERROR("add binary column to %{public}s failed, ret:%{public}" PRId32, tableName.c_str(), ret);
+    }
+}
+
 ErrCode FormRdbDataMgr::ExecuteSql(const std::string &sql)
 {
     auto rdbStore = GetRdbStore();
@@ -209,6 +269,26 @@ ErrCode FormRdbDataMgr::InsertData(const std::string &tableName, const std::stri
 ErrCode FormRdbDataMgr::InsertData(const std::string &tableName, const std::string &key, const std::string &value)
 {
     HILOG_DEBUG("InsertData start");
+    NativeRdb::ValuesBucket valuesBucket;
+    valuesBucket.PutString(FORM_KEY, key);
+    valuesBucket.PutString(FORM_VALUE, value);
+    return InsertKeyValueData(tableName, key, valuesBucket, key.size() + value.size());
+}
+
+ErrCode FormRdbDataMgr::InsertData(const std::string &tableName, const std::string &key,
+    const std::string &value, const std::vector<uint8_t> &binaryValue)
+{
+    HILOG_DEBUG("InsertData start");
+    NativeRdb::ValuesBucket valuesBucket;
+    valuesBucket.PutString(FORM_KEY, key);
+    valuesBucket.PutString(FORM_VALUE, value);
+    valuesBucket.PutBlob(FORM_BINARY_VALUE, binaryValue);
+    return InsertKeyValueData(tableName, key, valuesBucket, key.size() + value.size() + binaryValue.size());
+}
+
+ErrCode FormRdbDataMgr::InsertKeyValueData(const std::string &tableName, const std::string &key,
+    const NativeRdb::ValuesBucket &valuesBucket, size_t dataSize)
+{
     if (!CheckFormRdbTable(tableName)) {
         HILOG_ERROR("Form rdb hasn't initialized this table:%{public}s", tableName.c_str());
         return ERR_APPEXECFWK_FORM_COMMON_CODE;
@@ -220,9 +300,6 @@ ErrCode FormRdbDataMgr::InsertData(const std::string &tableName, const std::stri
         return ERR_APPEXECFWK_FORM_COMMON_CODE;
     }
 
-    NativeRdb::ValuesBucket valuesBucket;
-    valuesBucket.PutString(FORM_KEY, key);
-    valuesBucket.PutString(FORM_VALUE, value);
     int32_t ret = NativeRdb::E_OK;
     int64_t rowId = -1;
     ret = rdbStore->InsertWithConflictResolution(rowId, tableName, valuesBucket,
@@ -247,7 +324,7 @@ ErrCode FormRdbDataMgr::InsertData(const std::string &tableName, const std::stri
     }
 
     if (ret == NativeRdb::E_OK) {
-        UpdateWriteCount(key.size() + value.size());
+        UpdateWriteCount(dataSize);
         return ERR_OK;
     }
 
@@ -338,7 +415,7 @@ ErrCode FormRdbDataMgr::QueryData(const std::string &tableName, const std::strin
     if (ret != NativeRdb::E_OK) {
         HILOG_ERROR("GoToFirstRow failed, ret:%{public}" PRId32 "", ret);
     } else {
-        ret = absSharedResultSet->GetString(FORM_VALUE_INDEX, value);
+        ret = GetFormValue(absSharedResultSet, value);
     }
     absSharedResultSet->Close();
 
@@ -398,7 +475,7 @@ ErrCode FormRdbDataMgr::QueryData(const std::string &tableName, const std::strin
             }
 
             std::string resultValue;
-            ret = absSharedResultSet->GetString(FORM_VALUE_INDEX, resultValue);
+            ret = GetFormValue(absSharedResultSet, resultValue);
             if (ret != NativeRdb::E_OK) {
                 HILOG_ERROR("GetString value failed");
                 break;
@@ -463,7 +540,7 @@ ErrCode FormRdbDataMgr::QueryAllData(const std::string &tableName,
             }
 
             std::string resultValue;
-            ret = absSharedResultSet->GetString(FORM_VALUE_INDEX, resultValue);
+            ret = GetFormValue(absSharedResultSet, resultValue);
             if (ret != NativeRdb::E_OK) {
                 HILOG_ERROR("GetString value failed");
                 break;
@@ -628,6 +705,90 @@ bool FormRdbDataMgr::InsertData(
     return false;
 }
 
+ErrCode FormRdbDataMgr::WriteBatch(const FormRdbWriteBatch &batch)
+{
+    HILOG_DEBUG("WriteBatch start, size:%{public}zu", batch.Size());
+    if (batch.IsEmpty()) {
+        return ERR_OK;
+    }
+    for (const auto &operation : batch.operations_) {
+        if (!CheckFormRdbTable(operation.tableName)) {
+            HILOG_ERROR("Form rdb hasn't initialized this table:%{public}s", operation.tableName.c_str());
+            return ERR_APPEXECFWK_FORM_COMMON_CODE;
+        }
+    }
+
+    auto rdbStore = GetRdbStore();
+    if (rdbStore == nullptr) {
+        HILOG_ERROR("null FormInfoRdbStore");
+        return ERR_APPEXECFWK_FORM_COMMON_CODE;
+    }
+
+    int64_t startTime = FormUtil::GetCurrentSteadyClockMillseconds();
+    int32_t ret = ExecuteWriteBatch(rdbStore, batch);
+    if (ret == NativeRdb::E_OK) {
+        if (rdbStore->IsSlaveDiffFromMaster()) {
+            auto backupRet = rdbStore->Backup("");
+            HILOG_WARN("rdb slave corrupt, backup from master, ret=%{public}" PRId32, backupRet);
+        }
+    } else {
+        if (CheckAndRebuildRdbStore(ret) == ERR_OK) {
+            HILOG_WARN("Check rdb corrupt,rebuild form rdb successfully");
+            rdbStore = GetRdbStore();
+            if (rdbStore == nullptr) {
+                HILOG_ERROR("null FormInfoRdbStore");
+                return ERR_APPEXECFWK_FORM_COMMON_CODE;
+            }
+            ret = ExecuteWriteBatch(rdbStore, batch);
+        }
+    }
+
+    if (ret == NativeRdb::E_OK) {
+        UpdateWriteCount(batch.dataSize_);
+        UpdateBatchStatistics(batch.Size(), FormUtil::GetCurrentSteadyClockMillseconds() - startTime);
+        return ERR_OK;
+    }
+
+    HILOG_WARN("Batch operation failed, size=%{public}zu, ret=%{public}" PRId32, batch.Size(), ret);
+    return ERR_APPEXECFWK_FORM_COMMON_CODE;
+}
+
+int32_t FormRdbDataMgr::ExecuteWriteBatch(
+    const std::shared_ptr<NativeRdb::RdbStore> &rdbStore, const FormRdbWriteBatch &batch)
+{
+    int32_t ret = rdbStore->BeginTransaction();
+    if (ret != NativeRdb::E_OK) {
+        HILOG_ERROR("BeginTransaction failed, ret=%{public}" PRId32, ret);
+        return ret;
+    }
+
+    for (const auto &operation : batch.operations_) {
+        if (operation.isDelete) {
+            NativeRdb::AbsRdbPredicates absRdbPredicates(operation.tableName);
+            absRdbPredicates.EqualTo(FORM_KEY, operation.key);
+            int32_t rowId = -1;
+            ret = rdbStore->Delete(rowId, absRdbPredicates);
+        } else {
+            int64_t rowId = -1;
+            ret = rdbStore->InsertWithConflictResolution(rowId, operation.tableName, operation.valuesBucket,
+                NativeRdb::ConflictResolution::ON_CONFLICT_REPLACE);
+        }
+        if (ret != NativeRdb::E_OK) {
+            HILOG_ERROR("operation of table:%{public}s failed, ret=%{public}" PRId32,
+                operation.tableName.c_str(), ret);
+            rdbStore->RollBack();
+            return ret;
+        }
+    }
+
+    ret = rdbStore->Commit();
+    if (ret != NativeRdb::E_OK) {
+        HILOG_ERROR("Commit failed, ret=%{public}" PRId32, ret);
+        rdbStore->RollBack();
+    }
+    return ret;
+}
+
 bool FormRdbDataMgr::DeleteData(const NativeRdb::AbsRdbPredicates &absRdbPredicates)
 {
     auto rdbStore = GetRdbStore();
@@ -782,8 +943,7 @@ void FormRdbDataMgr::CreateFormRdbTables()
         std::shared_lock<std::shared_mutex> lock(formRdbTableCfgMapMutex_);
         for (auto iter = formRdbTableCfgMap_.begin(); iter != formRdbTableCfgMap_.end(); iter++) {
             std::string createTableSql = !iter->second.createTableSql.empty() ? iter->second.createTableSql
-                : "CREATE TABLE IF NOT EXISTS " + iter->second.tableName
-                + " (KEY TEXT NOT NULL PRIMARY KEY, VALUE TEXT NOT NULL);";
+                : BuildKeyValueTableSql(iter->second.tableName);
             createTableSqls[iter->second.tableName] = createTableSql;
         }
     }
@@ -832,15 +992,99 @@ void FormRdbDataMgr::UpdateWriteCount(size_t dataSize)
     writeSize_.fetch_add(dataSize, std::memory_order_relaxed);
 }
 
+void FormRdbDataMgr::UpdateBatchStatistics(size_t batchSize, int64_t commitCost)
+{
+    batchCount_.fetch_add(1, std::memory_order_relaxed);
+    batchOperationCount_.fetch_add(static_cast<int64_t>(batchSize), std::memory_order_relaxed);
+    batchCommitCost_.fetch_add(commitCost, std::memory_order_relaxed);
+    int64_t maxBatchSize = maxBatchSize_.load(std::memory_order_relaxed);
+    while (static_cast<int64_t>(batchSize) > maxBatchSize &&
+        !maxBatchSize_.compare_exchange_weak(maxBatchSize, static_cast<int64_t>(batchSize))) {
+    }
+    int64_t maxCommitCost = maxBatchCommitCost_.load(std::memory_order_relaxed);
+    while (commitCost > maxCommitCost && !maxBatchCommitCost_.compare_exchange_weak(maxCommitCost, commitCost)) {
+    }
+}
+
 void FormRdbDataMgr::PrintStatistics()
 {
     int64_t readCount = readCount_.exchange(0, std::memory_order_acq_rel);
     int64_t writeCount = writeCount_.exchange(0, std::memory_order_acq_rel);
     int64_t writeSize = writeSize_.exchange(0, std::memory_order_acq_rel);
+    int64_t batchCount = batchCount_.exchange(0, std::memory_order_acq_rel);
+    int64_t batchOperationCount = batchOperationCount_.exchange(0, std::memory_order_acq_rel);
+    int64_t maxBatchSize = maxBatchSize_.exchange(0, std::memory_order_acq_rel);
+    int64_t batchCommitCost = batchCommitCost_.exchange(0, std::memory_order_acq_rel);
+    int64_t maxBatchCommitCost = maxBatchCommitCost_.exchange(0, std::memory_order_acq_rel);
 
     HILOG_INFO("Database statistics in last 24 hours: read count=%{public}" PRId64
         ", write count=%{public}" PRId64 ", total write size=%{public}" PRId64 " bytes",
         readCount, writeCount, writeSize);
+    HILOG_INFO("Database batch statistics in last 24 hours: batch count=%{public}" PRId64
+        ", avg batch size=%{public}" PRId64 ", max batch size=%{public}" PRId64
+        ", avg commit cost=%{public}" PRId64 "ms, max commit cost=%{public}" PRId64 "ms",
+        batchCount, batchCount == 0 ? 0 : batchOperationCount / batchCount, maxBatchSize,
+        batchCount == 0 ? 0 : batchCommitCost / batchCount, maxBatchCommitCost);
+}
+
+void FormRdbWriteBatch::Put(const std::string &tableName, const std::string &key, const std::string &value)
+{
+    Operation operation;
+    operation.tableName = tableName;
+    operation.key = key;
+    operation.valuesBucket.PutString(FORM_KEY, key);
+    operation.valuesBucket.PutString(FORM_VALUE, value);
+    operations_.emplace_back(std::move(operation));
+    dataSize_ += key.size() + value.size();
+}
+
+void FormRdbWriteBatch::Put(const std::string &tableName, const std::string &key, const std::string &value,
+    const std::vector<uint8_t> &binaryValue)
+{
+    Operation operation;
+    operation.tableName = tableName;
+    operation.key = key;
+    operation.valuesBucket.PutString(FORM_KEY, key);
+    operation.valuesBucket.PutString(FORM_VALUE, value);
+    operation.valuesBucket.PutBlob(FORM_BINARY_VALUE, binaryValue);
+    operations_.emplace_back(std::move(operation));
+    dataSize_ += key.size() + value.size() + binaryValue.size();
+}
+
+void FormRdbWriteBatch::Put(const std::string &tableName, const NativeRdb::ValuesBucket &valuesBucket)
+{
+    Operation operation;
+    operation.tableName = tableName;
+    operation.valuesBucket = valuesBucket;
+    operations_.emplace_back(std::move(operation));
+    for (const auto &[column, valueObject] : valuesBucket.values_) {
+        if (const auto *str = std::get_if<std::string>(&valueObject.value)) {
+            dataSize_ += str->size();
+        } else if (const auto *blob = std::get_if<std::vector<uint8_t>>(&valueObject.value)) {
+            dataSize_ += blob->size();
+        } else {
+            dataSize_ += sizeof(int64_t);
+        }
+    }
+}
+
+void FormRdbWriteBatch::Delete(const std::string &tableName, const std::string &key)
+{
+    Operation operation;
+    operation.tableName = tableName;
+    operation.key = key;
+    operation.isDelete = true;
+    operations_.emplace_back(std::move(operation));
+}
+
+bool FormRdbWriteBatch::IsEmpty() const
+{
+    return operations_.empty();
+}
+
+size_t FormRdbWriteBatch::Size() const
+{
+    return operations_.size();
 }
 } // namespace AppExecFwk
 } // namespace OHOS
\ No newline at end of file
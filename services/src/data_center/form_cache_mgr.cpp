@@ -15,6 +15,8 @@
 
 #include "data_center/form_cache_mgr.h"
 
+#include <iomanip>
+#include <openssl/sha.h>
 #include <sstream>
 
 #include "fms_log_wrapper.h"
@@ -22,6 +24,7 @@
 #include "common/util/scope_guard.h"
 #include "common/util/form_util.h"
 #include "common/util/form_report.h"
+#include "form_mgr/form_mgr_queue.h"
 
 namespace OHOS {
 namespace AppExecFwk {
@@ -47,13 +50,51 @@ constexpr int32_t IMAGE_BIT_INDEX = 1;
 constexpr const char *IMAGE_SIZE = "IMAGE_SIZE";
 constexpr int32_t IMAGE_SIZE_INDEX = 2;
 
-constexpr int32_t INVALID_INDEX = -1;
+constexpr const char *IMG_STORE_TABLE = "img_store";
+constexpr const char *IMAGE_HASH = "IMAGE_HASH";
+
 constexpr const char *IS_DIRTY_DATA_CLEANED = "isDirtyDataCleaned";
 
+constexpr size_t LRU_CACHE_CAPACITY = 128;
+constexpr size_t MAX_DIRTY_CACHE_COUNT = 64;
+constexpr uint64_t FLUSH_WINDOW_MS = 1000;
+constexpr double PERCENTAGE = 100.0;
+constexpr size_t MAX_IMG_ASHMEM_COUNT = 64;
+
 inline bool HasContent(const std::string &str)
 {
     return !str.empty() && str != JSON_EMPTY_STRING && str != JSON_NULL_STRING;
 }
+
+NativeRdb::ValuesBucket BuildFormCacheValuesBucket(int64_t formId, const FormCache &formCache)
+{
+    NativeRdb::ValuesBucket valuesBucket;
+    valuesBucket.PutString(FORM_ID, std::to_string(formId));
+    valuesBucket.PutString(DATA_CACHE, formCache.dataCache);
+    valuesBucket.PutString(FORM_IMAGES, formCache.imgCache);
+    valuesBucket.PutInt(CACHE_STATE, static_cast<int>(formCache.cacheState));
+    return valuesBucket;
+}
+
+/**
+ * @brief Content address of an image, the sha256 of its bytes and declared size in hex.
+ */
+std::string CalcImageHash(const std::vector<uint8_t> &value, int32_t size)
+{
+    unsigned char digest[SHA256_DIGEST_LENGTH] = { 0 };
+    SHA256_CTX ctx;
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, value.data(), value.size());
+    SHA256_Update(&ctx, &size, sizeof(size));
+    SHA256_Final(digest, &ctx);
+
+    std::stringstream hash;
+    hash << std::hex << std::setfill('0');
+    for (unsigned char byte : digest) {
+        hash << std::setw(2) << static_cast<int32_t>(byte);
+    }
+    return hash.str();
+}
 }
 
 FormCacheMgr::FormCacheMgr()
@@ -88,6 +129,16 @@ void FormCacheMgr::CreateFormCacheTable()
     if (FormRdbDataMgr::GetInstance().InitFormRdbTable(formRdbImgTableConfig) != ERR_OK) {
         HILOG_ERROR("Form cache mgr init form rdb img table fail");
     }
+
+    FormRdbTableConfig formRdbImgStoreTableConfig;
+    formRdbImgStoreTableConfig.tableName = IMG_STORE_TABLE;
+    sql.str("");
+    sql << "CREATE TABLE IF NOT EXISTS " << IMG_STORE_TABLE;
+    sql << " (IMAGE_HASH TEXT NOT NULL PRIMARY KEY, IMAGE_BIT BLOB, IMAGE_SIZE INTEGER);";
+    formRdbImgStoreTableConfig.createTableSql = sql.str();
+    if (FormRdbDataMgr::GetInstance().InitFormRdbTable(formRdbImgStoreTableConfig) != ERR_OK) {
+        HILOG_ERROR("Form cache mgr init form rdb img store table fail");
+    }
 }
 
 void FormCacheMgr::Start()
@@ -101,11 +152,12 @@ bool FormCacheMgr::GetData(const int64_t formId, std::string &data,
 {
     HILOG_DEBUG("GetData start");
     FormCache formCache;
-    formCache.formId = formId;
-    bool ret = GetDataCacheFromDb(formId, formCache);
-    if (!ret) {
-        HILOG_ERROR("no data in db");
-        return false;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!GetFormCacheNolock(formId, formCache)) {
+            HILOG_ERROR("no data in db");
+            return false;
+        }
     }
 
     bool hasContent = false;
@@ -121,8 +173,7 @@ bool FormCacheMgr::GetData(const int64_t formId, std::string &data,
     }
 
     if (HasContent(formCache.imgCache)) {
-        ret = InnerGetImageData(formCache, imageDataMap);
-        if (!ret) {
+        if (!InnerGetImageData(formCache, imageDataMap)) {
             HILOG_ERROR("InnerGetImageData failed");
             return false;
         }
@@ -145,6 +196,14 @@ bool FormCacheMgr::InnerGetImageData(
     }
 
     for (auto && [key, value] : imgCacheObj.items()) {
+        if (value.is_string()) {
+            if (!GetImageDataByHash(key, value.get<std::string>(), imageDataMap)) {
+                return false;
+            }
+            continue;
+        }
+
+        // Entries written before the content-addressed store keep their img_cache row id.
         int64_t rowId;
         std::stringstream ss;
         ss << value.dump();
@@ -179,14 +238,55 @@ bool FormCacheMgr::InnerGetImageData(
     return true;
 }
 
+bool FormCacheMgr::GetImageDataByHash(const std::string &picName, const std::string &hash,
+    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> &imageDataMap) const
+{
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto iter = imgAshmemIndex_.find(hash);
+        if (iter != imgAshmemIndex_.end()) {
+            ashmemReuseCount_.fetch_add(1, std::memory_order_relaxed);
+            imgAshmems_.splice(imgAshmems_.begin(), imgAshmems_, iter->second);
+            imageDataMap[picName] = iter->second->second;
+            return true;
+        }
+    }
+
+    std::vector<uint8_t> blob;
+    int32_t size = 0;
+    if (!GetImgFromStore(hash, blob, size) || blob.empty()) {
+        HILOG_ERROR("GetImgFromStore failed, picName:%{public}s", picName.c_str());
+        return false;
+    }
+
+    sptr<FormAshmem> formAshmem = new (std::nothrow) FormAshmem();
+    if (formAshmem == nullptr) {
+        HILOG_ERROR("Alloc ashmem failed");
+        return false;
+    }
+
+    if (!formAshmem->WriteToAshmem(picName, reinterpret_cast<char *>(blob.data()),
+        static_cast<int32_t>(blob.size()))) {
+        HILOG_ERROR("Write to ashmem failed");
+        return false;
+    }
+
+    auto imageData = std::make_pair(formAshmem, size);
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        PutImgAshmemNolock(hash, imageData);
+    }
+    imageDataMap[picName] = imageData;
+    return true;
+}
+
 bool FormCacheMgr::AddData(int64_t formId, const FormProviderData &formProviderData)
 {
     HILOG_INFO("formId:%{public}" PRId64, formId);
     std::lock_guard<std::mutex> lock(cacheMutex_);
 
     FormCache formCache;
-    formCache.formId = formId;
-    GetDataCacheFromDb(formId, formCache);
+    GetFormCacheNolock(formId, formCache);
     if (!AddImgData(formProviderData, formCache)) {
         HILOG_ERROR("AddImgData failed");
         return false;
@@ -200,7 +300,7 @@ bool FormCacheMgr::AddData(int64_t formId, const FormProviderData &formProviderD
     // Save dataCache and imgCache
     formCache.cacheState = CacheState::DEFAULT;
     FormReport::GetInstance().SetDurationEndTime(formId, FormUtil::GetCurrentSteadyClockMillseconds());
-    return SaveDataCacheToDb(formId, formCache);
+    return AddDirtyCacheNolock(formId, formCache);
 }
 
 bool FormCacheMgr::AddImgData(
@@ -223,14 +323,8 @@ bool FormCacheMgr::AddImgData(
             HILOG_ERROR("parse data failed");
             return false;
         }
-        // delete old images
-        std::vector<std::string> rowIds;
-        for (auto && [key, value] : imgCacheObj.items()) {
-            rowIds.push_back(value.dump());
-        }
-        if (!DeleteImgCachesInDb(rowIds)) {
-            HILOG_ERROR("delete img caches failed");
-        }
+        // old images are released after the new entry is flushed
+        AddStaleImgNolock(imgCacheObj);
     }
 
     formCache.imgCache = newImgDbData.dump();
@@ -238,6 +332,17 @@ bool FormCacheMgr::AddImgData(
     return true;
 }
 
+void FormCacheMgr::AddStaleImgNolock(const nlohmann::json &imgCacheObj)
+{
+    for (auto && [key, value] : imgCacheObj.items()) {
+        if (value.is_string()) {
+            staleImgHashes_.push_back(value.get<std::string>());
+        } else {
+            staleImgRowIds_.push_back(value.dump());
+        }
+    }
+}
+
 bool FormCacheMgr::AddCacheData(
     const FormProviderData &formProviderData, FormCache &formCache)
 {
@@ -283,23 +388,26 @@ bool FormCacheMgr::AddImgDataToDb(
 {
     auto imgCache = formProviderData.GetImageDataMap();
     HILOG_DEBUG("AddImgDataToDb imgCache size:%{public}zu", imgCache.size());
+    std::vector<std::string> acquiredHashes;
     for (const auto &iter : imgCache) {
-        int64_t rowId = INVALID_INDEX;
         std::vector<uint8_t> value;
         bool ret = GetImageDataFromAshmem(
             iter.first, iter.second.first->GetAshmem(), iter.second.first->GetAshmemSize(), value);
         if (!ret) {
             HILOG_ERROR("fail get img data imgName:%{public}s", iter.first.c_str());
+            ReleaseImgsNolock(acquiredHashes);
             return false;
         }
 
-        ret = SaveImgCacheToDb(value, iter.second.second, rowId);
-        if (!ret || rowId == INVALID_INDEX) {
+        std::string hash = CalcImageHash(value, iter.second.second);
+        if (!AcquireImgNolock(hash, value, iter.second.second)) {
             HILOG_ERROR("fail save img data imgName:%{public}s", iter.first.c_str());
+            ReleaseImgsNolock(acquiredHashes);
             return false;
         }
 
-        imgDataJson[iter.first] = rowId;
+        acquiredHashes.push_back(hash);
+        imgDataJson[iter.first] = hash;
     }
 
     return true;
@@ -339,36 +447,40 @@ bool FormCacheMgr::GetImageDataFromAshmem(
 bool FormCacheMgr::DeleteData(const int64_t formId)
 {
     HILOG_INFO("formId:%{public}" PRId64, formId);
-    bool isNeedDeleteImgCache = true;
-    nlohmann::json imgCacheObj;
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    std::vector<std::string> rowIds;
     {
         std::lock_guard<std::mutex> lock(cacheMutex_);
         FormCache formCache;
-        bool ret = GetDataCacheFromDb(formId, formCache);
+        bool ret = GetFormCacheNolock(formId, formCache);
+        EraseCacheNolock(formId);
         if (!ret) {
             HILOG_INFO("No DataCache when delete");
             return true;
         }
 
+        nlohmann::json imgCacheObj;
         if (!HasContent(formCache.imgCache)) {
             HILOG_INFO("Has no imgCache when delete");
-            isNeedDeleteImgCache = false;
+        } else {
+            imgCacheObj = nlohmann::json::parse(formCache.imgCache, nullptr, false);
         }
-
-        imgCacheObj = nlohmann::json::parse(formCache.imgCache, nullptr, false);
-        if (imgCacheObj.is_discarded() || !imgCacheObj.is_object()) {
+        if (imgCacheObj.is_object()) {
+            std::vector<std::string> hashes;
+            for (auto && [key, value] : imgCacheObj.items()) {
+                if (value.is_string()) {
+                    hashes.push_back(value.get<std::string>());
+                } else {
+                    rowIds.push_back(value.dump());
+                }
+            }
+            ReleaseImgsNolock(hashes);
+        } else if (HasContent(formCache.imgCache)) {
             HILOG_ERROR("parse data failed");
-            isNeedDeleteImgCache = false;
         }
     }
-    if (isNeedDeleteImgCache) {
-        std::vector<std::string> rowIds;
-        for (auto && [key, value] : imgCacheObj.items()) {
-            rowIds.push_back(value.dump());
-        }
-        if (!DeleteImgCachesInDb(rowIds)) {
-            HILOG_ERROR("delete img caches failed");
-        }
+    if (!rowIds.empty() && !DeleteImgCachesInDb(rowIds)) {
+        HILOG_ERROR("delete img caches failed");
     }
     return DeleteDataCacheInDb(formId);
 }
@@ -377,7 +489,11 @@ bool FormCacheMgr::NeedAcquireProviderData(const int64_t formId) const
 {
     HILOG_DEBUG("NeedAcquireProviderData");
     FormCache formCache;
-    bool ret = GetDataCacheFromDb(formId, formCache);
+    bool ret = false;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        ret = GetFormCacheNolock(formId, formCache);
+    }
     if (!ret) {
         HILOG_ERROR("No DataCache");
         return true;
@@ -388,6 +504,315 @@ bool FormCacheMgr::NeedAcquireProviderData(const int64_t formId) const
     return !hasContent || isRebootState;
 }
 
+bool FormCacheMgr::GetFormCacheNolock(int64_t formId, FormCache &formCache) const
+{
+    auto iter = lruIndex_.find(formId);
+    if (iter != lruIndex_.end()) {
+        lruCaches_.splice(lruCaches_.begin(), lruCaches_, iter->second);
+        formCache = iter->second->second;
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // An entry evicted from the LRU tier may still be waiting for the flush.
+    auto dirtyIter = dirtyCaches_.find(formId);
+    if (dirtyIter != dirtyCaches_.end()) {
+        formCache = dirtyIter->second;
+        PutLruCacheNolock(formId, formCache);
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // An entry being flushed is not readable from db until its batch commits.
+    auto inFlightIter = inFlightCaches_.find(formId);
+    if (inFlightIter != inFlightCaches_.end()) {
+        formCache = inFlightIter->second;
+        PutLruCacheNolock(formId, formCache);
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    missCount_.fetch_add(1, std::memory_order_relaxed);
+    formCache.formId = std::to_string(formId);
+    if (!GetDataCacheFromDb(formId, formCache)) {
+        return false;
+    }
+    PutLruCacheNolock(formId, formCache);
+    return true;
+}
+
+void FormCacheMgr::PutLruCacheNolock(int64_t formId, const FormCache &formCache) const
+{
+    auto iter = lruIndex_.find(formId);
+    if (iter != lruIndex_.end()) {
+        iter->second->second = formCache;
+        lruCaches_.splice(lruCaches_.begin(), lruCaches_, iter->second);
+        return;
+    }
+
+    lruCaches_.emplace_front(formId, formCache);
+    lruIndex_[formId] = lruCaches_.begin();
+    if (lruCaches_.size() > LRU_CACHE_CAPACITY) {
+        lruIndex_.erase(lruCaches_.back().first);
+        lruCaches_.pop_back();
+    }
+}
+
+void FormCacheMgr::EraseCacheNolock(int64_t formId)
+{
+    auto iter = lruIndex_.find(formId);
+    if (iter != lruIndex_.end()) {
+        lruCaches_.erase(iter->second);
+        lruIndex_.erase(iter);
+    }
+    dirtyCaches_.erase(formId);
+}
+
+void FormCacheMgr::PutImgAshmemNolock(const std::string &hash,
+    const std::pair<sptr<FormAshmem>, int32_t> &imageData) const
+{
+    auto iter = imgAshmemIndex_.find(hash);
+    if (iter != imgAshmemIndex_.end()) {
+        iter->second->second = imageData;
+        imgAshmems_.splice(imgAshmems_.begin(), imgAshmems_, iter->second);
+        return;
+    }
+
+    imgAshmems_.emplace_front(hash, imageData);
+    imgAshmemIndex_[hash] = imgAshmems_.begin();
+    if (imgAshmems_.size() > MAX_IMG_ASHMEM_COUNT) {
+        imgAshmemIndex_.erase(imgAshmems_.back().first);
+        imgAshmems_.pop_back();
+    }
+}
+
+void FormCacheMgr::EraseImgAshmemNolock(const std::string &hash)
+{
+    auto iter = imgAshmemIndex_.find(hash);
+    if (iter != imgAshmemIndex_.end()) {
+        imgAshmems_.erase(iter->second);
+        imgAshmemIndex_.erase(iter);
+    }
+}
+
+bool FormCacheMgr::AddDirtyCacheNolock(int64_t formId, const FormCache &formCache)
+{
+    PutLruCacheNolock(formId, formCache);
+    if (!dirtyCaches_.insert_or_assign(formId, formCache).second) {
+        coalescedCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t delayMs = FLUSH_WINDOW_MS;
+    if (dirtyCaches_.size() == MAX_DIRTY_CACHE_COUNT) {
+        delayMs = 0;
+    } else if (isFlushScheduled_) {
+        return true;
+    }
+
+    bool ret = FormMgrQueue::GetInstance().ScheduleTask(delayMs, []() {
+        FormCacheMgr::GetInstance().FlushDirtyData();
+    });
+    if (!ret) {
+        HILOG_ERROR("schedule flush failed, write through formId:%{public}" PRId64, formId);
+        dirtyCaches_.erase(formId);
+        return SaveDataCacheToDb(formId, formCache);
+    }
+    isFlushScheduled_ = true;
+    return true;
+}
+
+void FormCacheMgr::FlushDirtyData(bool isReleaseMemory)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    std::vector<std::string> staleImgRowIds;
+    std::vector<std::string> staleImgHashes;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        inFlightCaches_.swap(dirtyCaches_);
+        staleImgRowIds.swap(staleImgRowIds_);
+        staleImgHashes.swap(staleImgHashes_);
+        isFlushScheduled_ = false;
+        if (isReleaseMemory) {
+            lruCaches_.clear();
+            lruIndex_.clear();
+            imgAshmems_.clear();
+            imgAshmemIndex_.clear();
+        }
+    }
+    if (inFlightCaches_.empty() && staleImgRowIds.empty() && staleImgHashes.empty()) {
+        return;
+    }
+
+    // inFlightCaches_ is only modified by a flush holding flushMutex_, so it is read here without cacheMutex_.
+    size_t flushSize = inFlightCaches_.size();
+    int64_t startTime = FormUtil::GetCurrentSteadyClockMillseconds();
+    FormRdbWriteBatch batch;
+    for (const auto &[formId, formCache] : inFlightCaches_) {
+        batch.Put(FORM_CACHE_TABLE, BuildFormCacheValuesBucket(formId, formCache));
+    }
+    if (FormRdbDataMgr::GetInstance().WriteBatch(batch) != ERR_OK) {
+        // Put the entries back without overriding newer ones, the next write or forced flush retries them.
+        HILOG_ERROR("flush form caches failed, size:%{public}zu", flushSize);
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        for (auto &[formId, formCache] : inFlightCaches_) {
+            dirtyCaches_.emplace(formId, std::move(formCache));
+        }
+        inFlightCaches_.clear();
+        staleImgRowIds_.insert(staleImgRowIds_.end(), staleImgRowIds.begin(), staleImgRowIds.end());
+        staleImgHashes_.insert(staleImgHashes_.end(), staleImgHashes.begin(), staleImgHashes.end());
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        inFlightCaches_.clear();
+    }
+    if (!staleImgRowIds.empty() && !DeleteImgCachesInDb(staleImgRowIds)) {
+        HILOG_ERROR("delete img caches failed");
+    }
+    if (!staleImgHashes.empty()) {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        ReleaseImgsNolock(staleImgHashes);
+    }
+
+    int64_t cost = FormUtil::GetCurrentSteadyClockMillseconds() - startTime;
+    flushCount_.fetch_add(1, std::memory_order_relaxed);
+    lastFlushCost_.store(cost, std::memory_order_relaxed);
+    totalFlushCost_.fetch_add(cost, std::memory_order_relaxed);
+    if (cost > maxFlushCost_.load(std::memory_order_relaxed)) {
+        maxFlushCost_.store(cost, std::memory_order_relaxed);
+    }
+    HILOG_INFO("flush form caches size:%{public}zu, stale images:%{public}zu, cost:%{public}" PRId64 "ms",
+        flushSize, staleImgRowIds.size() + staleImgHashes.size(), cost);
+}
+
+void FormCacheMgr::LoadImgRefCountsNolock()
+{
+    if (isImgRefCountLoaded_) {
+        return;
+    }
+    isImgRefCountLoaded_ = true;
+
+    std::stringstream sql;
+    sql << "SELECT " << FORM_IMAGES << " FROM " << FORM_CACHE_TABLE;
+    auto absSharedResultSet = FormRdbDataMgr::GetInstance().QuerySql(sql.str());
+    if (absSharedResultSet == nullptr) {
+        HILOG_ERROR("load img reference counts failed, keep img_store rows");
+        return;
+    }
+    ScopeGuard stateGuard([absSharedResultSet] {
+        if (absSharedResultSet) {
+            absSharedResultSet->Close();
+        }
+    });
+    while (absSharedResultSet->GoToNextRow() == NativeRdb::E_OK) {
+        std::string imgCache;
+        if (absSharedResultSet->GetString(0, imgCache) != NativeRdb::E_OK || !HasContent(imgCache)) {
+            continue;
+        }
+        nlohmann::json imgCacheObj = nlohmann::json::parse(imgCache, nullptr, false);
+        if (imgCacheObj.is_discarded() || !imgCacheObj.is_object()) {
+            continue;
+        }
+        for (auto && [key, value] : imgCacheObj.items()) {
+            if (value.is_string()) {
+                imgRefCounts_[value.get<std::string>()]++;
+            }
+        }
+    }
+    isImgRefCountReliable_ = true;
+
+    // Drop images left unreferenced by a crash between an image insert and its flush.
+    sql.str("");
+    sql << "DELETE FROM " << IMG_STORE_TABLE;
+    if (!imgRefCounts_.empty()) {
+        sql << " WHERE " << IMAGE_HASH << " NOT IN (";
+        for (const auto &iter : imgRefCounts_) {
+            sql << "\'" << iter.first << "\',";
+        }
+        sql.seekp(-1, std::ios::end);
+        sql << ")";
+    }
+    sql << ";";
+    FormRdbDataMgr::GetInstance().ExecuteSql(sql.str());
+    HILOG_INFO("load img reference counts, images:%{public}zu", imgRefCounts_.size());
+}
+
+bool FormCacheMgr::AcquireImgNolock(const std::string &hash, const std::vector<uint8_t> &value, int32_t size)
+{
+    LoadImgRefCountsNolock();
+    auto iter = imgRefCounts_.find(hash);
+    if (iter != imgRefCounts_.end()) {
+        iter->second++;
+        imgReuseCount_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (!SaveImgToStore(hash, value, size)) {
+        return false;
+    }
+    imgRefCounts_[hash] = 1;
+    return true;
+}
+
+void FormCacheMgr::ReleaseImgsNolock(const std::vector<std::string> &hashes)
+{
+    if (hashes.empty()) {
+        return;
+    }
+    LoadImgRefCountsNolock();
+    std::vector<std::string> unusedHashes;
+    for (const auto &hash : hashes) {
+        auto iter = imgRefCounts_.find(hash);
+        if (iter == imgRefCounts_.end()) {
+            continue;
+        }
+        if (--iter->second > 0) {
+            continue;
+        }
+        imgRefCounts_.erase(iter);
+        EraseImgAshmemNolock(hash);
+        unusedHashes.push_back(hash);
+    }
+    if (isImgRefCountReliable_ && !unusedHashes.empty() && !DeleteImgsInStore(unusedHashes)) {
+        HILOG_ERROR("delete img store rows failed");
+    }
+}
+
+void FormCacheMgr::DumpStatistics(std::string &result) const
+{
+    size_t lruSize = 0;
+    size_t dirtySize = 0;
+    size_t imgCount = 0;
+    size_t ashmemSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        lruSize = lruCaches_.size();
+        dirtySize = dirtyCaches_.size();
+        imgCount = imgRefCounts_.size();
+        ashmemSize = imgAshmems_.size();
+    }
+    int64_t hitCount = hitCount_.load(std::memory_order_relaxed);
+    int64_t missCount = missCount_.load(std::memory_order_relaxed);
+    int64_t flushCount = flushCount_.load(std::memory_order_relaxed);
+    int64_t totalFlushCost = totalFlushCost_.load(std::memory_order_relaxed);
+    double hitRate = (hitCount + missCount) == 0 ? 0 :
+        PERCENTAGE * static_cast<double>(hitCount) / static_cast<double>(hitCount + missCount);
+
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(2);
+    stream << "FormCache:\n";
+    stream << "  lruEntries [ " << lruSize << "/" << LRU_CACHE_CAPACITY << " ]\n";
+    stream << "  hitCount [ " << hitCount << " ] missCount [ " << missCount << " ] hitRate [ " << hitRate
+        << "% ]\n";
+    stream << "  dirtyEntries [ " << dirtySize << " ] coalescedUpdates [ " << coalescedCount_.load() << " ]\n";
+    stream << "  storedImages [ " << imgCount << " ] imgReuse [ " << imgReuseCount_.load()
+        << " ] ashmemEntries [ " << ashmemSize << " ] ashmemReuse [ " << ashmemReuseCount_.load() << " ]\n";
+    stream << "  flushCount [ " << flushCount << " ] lastFlushCost [ " << lastFlushCost_.load()
+        << "ms ] maxFlushCost [ " << maxFlushCost_.load() << "ms ] avgFlushCost [ "
+        << (flushCount == 0 ? 0 : totalFlushCost / flushCount) << "ms ]\n";
+    result += stream.str();
+}
+
 bool FormCacheMgr::GetDataCacheFromDb(int64_t formId, FormCache &formCache) const
 {
     NativeRdb::AbsRdbPredicates absRdbPredicates(FORM_CACHE_TABLE);
@@ -431,11 +856,7 @@ bool FormCacheMgr::GetDataCacheFromDb(int64_t formId, FormCache &formCache) cons
 
 bool FormCacheMgr::SaveDataCacheToDb(int64_t formId, const FormCache &formCache)
 {
-    NativeRdb::ValuesBucket valuesBucket;
-    valuesBucket.PutString(FORM_ID, std::to_string(formId));
-    valuesBucket.PutString(DATA_CACHE, formCache.dataCache);
-    valuesBucket.PutString(FORM_IMAGES, formCache.imgCache);
-    valuesBucket.PutInt(CACHE_STATE, static_cast<int>(formCache.cacheState));
+    NativeRdb::ValuesBucket valuesBucket = BuildFormCacheValuesBucket(formId, formCache);
     int64_t rowId;
     bool ret = FormRdbDataMgr::GetInstance().InsertData(FORM_CACHE_TABLE, valuesBucket, rowId);
     if (!ret) {
@@ -528,8 +949,75 @@ bool FormCacheMgr::DeleteImgCachesInDb(const std::vector<std::string> &rowIds)
     return FormRdbDataMgr::GetInstance().ExecuteSql(sql.str()) == ERR_OK;
 }
 
+bool FormCacheMgr::GetImgFromStore(const std::string &hash, std::vector<uint8_t> &blob, int32_t &size) const
+{
+    NativeRdb::AbsRdbPredicates absRdbPredicates(IMG_STORE_TABLE);
+    absRdbPredicates.EqualTo(IMAGE_HASH, hash);
+    auto absSharedResultSet = FormRdbDataMgr::GetInstance().QueryDataByStep(absRdbPredicates);
+    if (absSharedResultSet == nullptr) {
+        HILOG_ERROR("GetImgFromStore failed");
+        return false;
+    }
+
+    ScopeGuard stateGuard([absSharedResultSet] {
+        if (absSharedResultSet) {
+            absSharedResultSet->Close();
+        }
+    });
+    int ret = absSharedResultSet->GoToFirstRow();
+    if (ret != NativeRdb::E_OK) {
+        HILOG_ERROR("GoToFirstRow failed,ret:%{public}d", ret);
+        return false;
+    }
+
+    ret = absSharedResultSet->GetBlob(IMAGE_BIT_INDEX, blob);
+    if (ret != NativeRdb::E_OK) {
+        HILOG_ERROR("GetBlob failed, ret:%{public}d", ret);
+        return false;
+    }
+
+    ret = absSharedResultSet->GetInt(IMAGE_SIZE_INDEX, size);
+    if (ret != NativeRdb::E_OK) {
+        HILOG_ERROR("GetInt size failed, ret:%{public}d", ret);
+        return false;
+    }
+    return true;
+}
+
+bool FormCacheMgr::SaveImgToStore(const std::string &hash, const std::vector<uint8_t> &value, int32_t size)
+{
+    NativeRdb::ValuesBucket valuesBucket;
+    valuesBucket.PutString(IMAGE_HASH, hash);
+    valuesBucket.PutBlob(IMAGE_BIT, value);
+    valuesBucket.PutInt(IMAGE_SIZE, size);
+    int64_t rowId;
+    if (!FormRdbDataMgr::GetInstance().InsertData(IMG_STORE_TABLE, valuesBucket, rowId)) {
+        HILOG_ERROR("SaveImgToStore failed");
+        return false;
+    }
+    return true;
+}
+
+bool FormCacheMgr::DeleteImgsInStore(const std::vector<std::string> &hashes)
+{
+    if (hashes.empty()) {
+        return false;
+    }
+    HILOG_DEBUG("size:%{public}zu", hashes.size());
+    std::stringstream sql;
+    sql << "DELETE FROM " << IMG_STORE_TABLE << " WHERE " << IMAGE_HASH << " IN (";
+    for (const auto &hash : hashes) {
+        sql << "\'" << hash << "\',";
+    }
+    sql.seekp(-1, std::ios::end);
+    sql << ");";
+    return FormRdbDataMgr::GetInstance().ExecuteSql(sql.str()) == ERR_OK;
+}
+
 void FormCacheMgr::ResetCacheStateAfterReboot()
 {
+    // Memory entries would still report DEFAULT after the update below.
+    FlushDirtyData(true);
     std::stringstream sql;
     sql << "UPDATE " << FORM_CACHE_TABLE << " SET " << CACHE_STATE << " = 1;";
     FormRdbDataMgr::GetInstance().ExecuteSql(sql.str());
@@ -581,6 +1069,7 @@ void FormCacheMgr::SetIsDirtyDataCleaned()
 
 bool FormCacheMgr::GetFormCacheIds(std::unordered_set<int64_t> &formIds)
 {
+    FlushDirtyData();
     std::stringstream sql;
     sql << "SELECT " << FORM_ID << " FROM " << FORM_CACHE_TABLE;
     auto absSharedResultSet = FormRdbDataMgr::GetInstance().QuerySql(sql.str());
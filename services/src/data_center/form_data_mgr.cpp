@@ -73,6 +73,12 @@ static void OnMemoryWatermarkChange(const char *key, const char *value, [[maybe_
     bool isLowMemory = (std::string(value) == "true");
     FormDataMgr::GetInstance().SetIsLowMemory(isLowMemory);
     if (isLowMemory) {
+        bool ret = FormMgrQueue::GetInstance().ScheduleTask(0, []() {
+            FormCacheMgr::GetInstance().FlushDirtyData(true);
+        });
+        if (!ret) {
+            HILOG_ERROR("Failed to schedule low memory flush task");
+        }
         return;
     }
     RerenderAllFormsImmediate();
@@ -203,17 +209,17 @@ FormRecord FormDataMgr::AllotFormRecord(const FormItemInfo &formInfo, const int
         if (formRecords_.empty()) { // formRecords_ is empty, create a new one
             HILOG_DEBUG("form info not exist");
             record = CreateFormRecord(formInfo, callingUid, userId);
-            formRecords_.emplace(formInfo.GetFormId(), record);
+            EmplaceFormRecordNolock(formInfo.GetFormId(), record);
             isNewRecord = true;
         } else {
             auto info = formRecords_.find(formInfo.GetFormId());
             if (info == formRecords_.end()) {
                 HILOG_DEBUG("form info not find");
                 record = CreateFormRecord(formInfo, callingUid, userId);
-                formRecords_.emplace(formInfo.GetFormId(), record);
+                EmplaceFormRecordNolock(formInfo.GetFormId(), record);
                 isNewRecord = true;
             } else {
-                record = info->second;
+                record = *info->second;
             }
         }
     }
@@ -247,9 +253,9 @@ bool FormDataMgr::DeleteFormRecord(const int64_t formId)
             HILOG_ERROR("form record not exist");
             return false;
         }
-        formRecord = iter->second;
+        formRecord = *iter->second;
         isNetConditionForm = IsNetworkConditionForm(formRecord);
-        formRecords_.erase(iter);
+        EraseFormRecordNolock(iter);
     }
     if (isNetConditionForm && !HasNetworkConditionForm()) {
         NetConnCallbackManager::GetInstance().UnregisterNetConnCallback();
@@ -463,7 +469,7 @@ void FormDataMgr::RecycleAllRecyclableForms() const
     {
         std::lock_guard<std::mutex> lock(formRecordMutex_);
         for (auto itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-            if (itFormRecord->second.lowMemoryRecycleStatus == LowMemoryRecycleStatus::RECYCLABLE) {
+            if (itFormRecord->second->lowMemoryRecycleStatus == LowMemoryRecycleStatus::RECYCLABLE) {
                 formIds.emplace_back(itFormRecord->first);
             }
         }
@@ -655,7 +661,7 @@ bool FormDataMgr::ModifyFormTempFlag(const int64_t formId, const bool formTempFl
         HILOG_ERROR("formInfo not exist");
         return false;
     }
-    formRecords_[formId].formTempFlag = formTempFlag;
+    MutableFormRecordNolock(formRecords_[formId]).formTempFlag = formTempFlag;
     return true;
 }
 /**
@@ -672,9 +678,9 @@ bool FormDataMgr::AddFormUserUid(const int64_t formId, const int formUserUid)
         HILOG_ERROR("formInfo not exist");
         return false;
     }
-    if (std::find(formRecords_[formId].formUserUids.begin(), formRecords_[formId].formUserUids.end(),
-        formUserUid) == formRecords_[formId].formUserUids.end()) {
-        formRecords_[formId].formUserUids.emplace_back(formUserUid);
+    const std::vector<int> &formUserUids = formRecords_[formId]->formUserUids;
+    if (std::find(formUserUids.begin(), formUserUids.end(), formUserUid) == formUserUids.end()) {
+        MutableFormRecordNolock(formRecords_[formId]).formUserUids.emplace_back(formUserUid);
     }
     return true;
 }
@@ -689,10 +695,10 @@ bool FormDataMgr::DeleteFormUserUid(const int64_t formId, const int uid)
     HILOG_INFO("formId:%{public}" PRId64 ", uid:%{public}d", formId, uid);
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     if (formRecords_.count(formId) > 0) {
-        auto iter = std::find(formRecords_.at(formId).formUserUids.begin(),
-            formRecords_.at(formId).formUserUids.end(), uid);
-        if (iter != formRecords_.at(formId).formUserUids.end()) {
-            formRecords_.at(formId).formUserUids.erase(iter);
+        std::shared_ptr<FormRecord> &record = formRecords_.at(formId);
+        if (std::find(record->formUserUids.begin(), record->formUserUids.end(), uid) != record->formUserUids.end()) {
+            std::vector<int> &formUserUids = MutableFormRecordNolock(record).formUserUids;
+            formUserUids.erase(std::find(formUserUids.begin(), formUserUids.end(), uid));
         }
         return true;
     } else {
@@ -712,7 +718,9 @@ bool FormDataMgr::UpdateFormRecord(const int64_t formId, const FormRecord &formR
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     auto info = formRecords_.find(formId);
     if (info != formRecords_.end()) {
-        formRecords_[formId] = formRecord;
+        RemoveFormRecordIndexNolock(formId, *info->second);
+        info->second = std::make_shared<FormRecord>(formRecord);
+        AddFormRecordIndexNolock(formId, *info->second);
         return true;
     }
     return false;
@@ -736,7 +744,9 @@ bool FormDataMgr::UpdateFormRecord(const int64_t formId, std::function<void(Form
     if (iter == formRecords_.end()) {
         return false;
     }
-    updateFunc(iter->second);
+    RemoveFormRecordIndexNolock(formId, *iter->second);
+    updateFunc(MutableFormRecordNolock(iter->second));
+    AddFormRecordIndexNolock(formId, *iter->second);
     return true;
 }
 
@@ -755,11 +765,22 @@ bool FormDataMgr::GetFormRecord(const int64_t formId, FormRecord &formRecord) co
         HILOG_ERROR("Not find");
         return false;
     }
-    formRecord = info->second;
+    formRecord = *info->second;
 
     HILOG_DEBUG("get form record successfully");
     return true;
 }
+
+std::shared_ptr<const FormRecord> FormDataMgr::GetFormRecordSnapshot(const int64_t formId) const
+{
+    std::lock_guard<std::mutex> lock(formRecordMutex_);
+    auto info = formRecords_.find(formId);
+    if (info == formRecords_.end()) {
+        HILOG_ERROR("Not find formId:%{public}" PRId64, formId);
+        return nullptr;
+    }
+    return info->second;
+}
 /**
  * @brief Get form record.
  * @param bundleName Bundle name.
@@ -770,10 +791,11 @@ bool FormDataMgr::GetFormRecord(const std::string &bundleName, std::vector<FormR
 {
     HILOG_DEBUG("get form record by bundleName");
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-        if (bundleName == itFormRecord->second.bundleName &&
-            (userId == Constants::INVALID_USER_ID || userId == itFormRecord->second.userId)) {
-            formInfos.emplace_back(itFormRecord->second);
+    for (const int64_t formId : GetIndexedFormIdsNolock(bundleFormIds_, bundleName)) {
+        auto itFormRecord = formRecords_.find(formId);
+        if (itFormRecord != formRecords_.end() &&
+            (userId == Constants::INVALID_USER_ID || userId == itFormRecord->second->userId)) {
+            formInfos.emplace_back(*itFormRecord->second);
         }
     }
     if (formInfos.size() > 0) {
@@ -796,7 +818,7 @@ void FormDataMgr::SetDataProxyUpdate(const int64_t formId)
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     auto info = formRecords_.find(formId);
     if (info != formRecords_.end()) {
-        info->second.isDataProxyUpdate = true;
+        MutableFormRecordNolock(info->second).isDataProxyUpdate = true;
     }
 }
 
@@ -810,7 +832,7 @@ bool FormDataMgr::IsDataProxyIgnoreFormVisibility(const int64_t formId) const
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     auto info = formRecords_.find(formId);
     if (info != formRecords_.end()) {
-        return info->second.isDataProxyUpdate && info->second.isDataProxyIgnoreFormVisible;
+        return info->second->isDataProxyUpdate && info->second->isDataProxyIgnoreFormVisible;
     }
     return false;
 }
@@ -824,7 +846,7 @@ void FormDataMgr::ResetDataProxyUpdate(const int64_t formId)
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     auto info = formRecords_.find(formId);
     if (info != formRecords_.end()) {
-        info->second.isDataProxyUpdate = false;
+        MutableFormRecordNolock(info->second).isDataProxyUpdate = false;
     }
 }
 
@@ -841,14 +863,14 @@ ErrCode FormDataMgr::GetPublishedFormInfoById(const std::string &bundleName, Run
 {
     HILOG_DEBUG("get form record by bundleName & formId");
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-        if (bundleName == itFormRecord->second.bundleName && formId == itFormRecord->second.formId &&
-            (userId == Constants::INVALID_USER_ID || userId == itFormRecord->second.userId)) {
-            formInfo.formId = itFormRecord->second.formId;
-            FillBasicRunningFormInfoByFormRecord(itFormRecord->second, formInfo);
-            HILOG_DEBUG("GetPublishedFormInfoById success, formId:%{public}" PRId64, formId);
-            return ERR_OK;
-        }
+    auto itFormRecord = formRecords_.find(formId);
+    if (itFormRecord != formRecords_.end() && bundleName == itFormRecord->second->bundleName &&
+        formId == itFormRecord->second->formId &&
+        (userId == Constants::INVALID_USER_ID || userId == itFormRecord->second->userId)) {
+        formInfo.formId = itFormRecord->second->formId;
+        FillBasicRunningFormInfoByFormRecord(*itFormRecord->second, formInfo);
+        HILOG_DEBUG("GetPublishedFormInfoById success, formId:%{public}" PRId64, formId);
+        return ERR_OK;
     }
     HILOG_WARN("formInfo not find, formId:%{public}" PRId64, formId);
     return ERR_APPEXECFWK_FORM_GET_INFO_FAILED;
@@ -866,12 +888,13 @@ ErrCode FormDataMgr::GetPublishedFormInfos(const std::string &bundleName, std::v
 {
     HILOG_DEBUG("get form record by bundleName");
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-        if (bundleName == itFormRecord->second.bundleName &&
-            (userId == Constants::INVALID_USER_ID || userId == itFormRecord->second.userId)) {
+    for (const int64_t formId : GetIndexedFormIdsNolock(bundleFormIds_, bundleName)) {
+        auto itFormRecord = formRecords_.find(formId);
+        if (itFormRecord != formRecords_.end() &&
+            (userId == Constants::INVALID_USER_ID || userId == itFormRecord->second->userId)) {
             RunningFormInfo formInfo;
-            formInfo.formId = itFormRecord->second.formId;
-            FillBasicRunningFormInfoByFormRecord(itFormRecord->second, formInfo);
+            formInfo.formId = itFormRecord->second->formId;
+            FillBasicRunningFormInfoByFormRecord(*itFormRecord->second, formInfo);
             formInfos.emplace_back(formInfo);
         }
     }
@@ -895,10 +918,10 @@ bool FormDataMgr::GetFormRecordByCondition(int32_t conditionType, std::vector<Fo
     HILOG_DEBUG("get form record by conditionType");
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     for (auto itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-        std::vector<int32_t> conditionUpdate = itFormRecord->second.conditionUpdate;
+        const std::vector<int32_t> &conditionUpdate = itFormRecord->second->conditionUpdate;
         for (int32_t item : conditionUpdate) {
             if (item == conditionType) {
-                formInfos.emplace_back(itFormRecord->second);
+                formInfos.emplace_back(*itFormRecord->second);
                 break;
             }
         }
@@ -925,7 +948,7 @@ bool FormDataMgr::HasNetworkConditionForm() const
 {
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     for (const auto &pair : formRecords_) {
-        if (IsNetworkConditionForm(pair.second)) {
+        if (IsNetworkConditionForm(*pair.second)) {
             return true;
         }
     }
@@ -941,10 +964,10 @@ bool FormDataMgr::GetTempFormRecord(std::vector<FormRecord> &formTempRecords)
 {
     HILOG_INFO("Get temporary form record");
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    std::map<int64_t, FormRecord>::iterator itFormRecord;
+    std::map<int64_t, std::shared_ptr<FormRecord>>::iterator itFormRecord;
     for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-        if (itFormRecord->second.formTempFlag) {
-            formTempRecords.emplace_back(itFormRecord->second);
+        if (itFormRecord->second->formTempFlag) {
+            formTempRecords.emplace_back(*itFormRecord->second);
         }
     }
     if (!formTempRecords.empty()) {
@@ -1300,7 +1323,10 @@ void FormDataMgr::SetNeedRefresh(const int64_t formId, const bool needRefresh)
         HILOG_ERROR("form info not find");
         return;
     }
-    itFormRecord->second.needRefresh = needRefresh;
+    if (itFormRecord->second->needRefresh == needRefresh) {
+        return;
+    }
+    MutableFormRecordNolock(itFormRecord->second).needRefresh = needRefresh;
 }
 
 /**
@@ -1316,7 +1342,7 @@ void FormDataMgr::SetRefreshType(const int64_t formId, const int refreshType)
         HILOG_ERROR("form info not find");
         return;
     }
-    itFormRecord->second.refreshType = refreshType;
+    MutableFormRecordNolock(itFormRecord->second).refreshType = refreshType;
 }
 
 /**
@@ -1332,7 +1358,7 @@ void FormDataMgr::GetRefreshType(const int64_t formId, int &refreshType)
         HILOG_ERROR("form info not find");
         return;
     }
-    refreshType = itFormRecord->second.refreshType;
+    refreshType = itFormRecord->second->refreshType;
 }
 
 /**
@@ -1348,7 +1374,7 @@ void FormDataMgr::SetNeedAddForm(const int64_t formId, const bool needAddForm)
         HILOG_ERROR("form info not find");
         return;
     }
-    itFormRecord->second.needAddForm = needAddForm;
+    MutableFormRecordNolock(itFormRecord->second).needAddForm = needAddForm;
 }
 
 /**
@@ -1364,7 +1390,10 @@ void FormDataMgr::SetCountTimerRefresh(const int64_t formId, const bool countTim
         HILOG_ERROR("form info not find");
         return;
     }
-    itFormRecord->second.isCountTimerRefresh = countTimerRefresh;
+    if (itFormRecord->second->isCountTimerRefresh == countTimerRefresh) {
+        return;
+    }
+    MutableFormRecordNolock(itFormRecord->second).isCountTimerRefresh = countTimerRefresh;
 }
 
 /**
@@ -1380,7 +1409,10 @@ void FormDataMgr::SetTimerRefresh(const int64_t formId, const bool timerRefresh)
         HILOG_ERROR("form info not find");
         return;
     }
-    itFormRecord->second.isTimerRefresh = timerRefresh;
+    if (itFormRecord->second->isTimerRefresh == timerRefresh) {
+        return;
+    }
+    MutableFormRecordNolock(itFormRecord->second).isTimerRefresh = timerRefresh;
 }
 
 /**
@@ -1396,7 +1428,7 @@ void FormDataMgr::SetHostRefresh(const int64_t formId, const bool hostRefresh)
         HILOG_ERROR("form info not find, form:%{public}" PRId64, formId);
         return;
     }
-    itFormRecord->second.isHostRefresh = hostRefresh;
+    MutableFormRecordNolock(itFormRecord->second).isHostRefresh = hostRefresh;
 }
 
 /**
@@ -1411,7 +1443,7 @@ void FormDataMgr::ClearWantCache(const int64_t formId)
         HILOG_ERROR("form info not find, form:%{public}" PRId64, formId);
         return;
     }
-    itFormRecord->second.refreshWantMap.clear();
+    MutableFormRecordNolock(itFormRecord->second).refreshWantMap.clear();
 }
 
 /**
@@ -1426,10 +1458,11 @@ void FormDataMgr::ClearHostRefreshFlag(const int64_t formId)
         HILOG_ERROR("form info not find, form:%{public}" PRId64, formId);
         return;
     }
-    if (itFormRecord->second.isHostRefresh) {
+    if (itFormRecord->second->isHostRefresh) {
         HILOG_INFO("clean host refresh flag, form:%{public}" PRId64, formId);
-        itFormRecord->second.isHostRefresh = false;
-        itFormRecord->second.refreshWantMap.clear();
+        FormRecord &record = MutableFormRecordNolock(itFormRecord->second);
+        record.isHostRefresh = false;
+        record.refreshWantMap.clear();
     }
 }
 
@@ -1470,7 +1503,7 @@ void FormDataMgr::SetEnableUpdate(const int64_t formId, const bool enableUpdate)
         HILOG_ERROR("form info not find");
         return;
     }
-    itFormRecord->second.isEnableUpdate = enableUpdate;
+    MutableFormRecordNolock(itFormRecord->second).isEnableUpdate = enableUpdate;
 }
 /**
  * @brief Set update info for FormRecord.
@@ -1495,11 +1528,12 @@ void FormDataMgr::SetUpdateInfo(
         return;
     }
 
-    itFormRecord->second.isEnableUpdate = enableUpdate;
-    itFormRecord->second.updateDuration = updateDuration;
-    itFormRecord->second.updateAtHour = updateAtHour;
-    itFormRecord->second.updateAtMin = updateAtMin;
-    itFormRecord->second.updateAtTimes = updateAtTimes;
+    FormRecord &record = MutableFormRecordNolock(itFormRecord->second);
+    record.isEnableUpdate = enableUpdate;
+    record.updateDuration = updateDuration;
+    record.updateAtHour = updateAtHour;
+    record.updateAtMin = updateAtMin;
+    record.updateAtTimes = updateAtTimes;
 }
 /**
  * @brief Check if two forms is same or not.
@@ -1529,18 +1563,16 @@ void FormDataMgr::CleanRemovedFormRecords(const std::string &bundleName, std::se
     bool hadNetCondition = false;
     {
         std::lock_guard<std::mutex> lock(formRecordMutex_);
-        std::map<int64_t, FormRecord>::iterator itFormRecord;
-        for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end();) {
-            int64_t formId = itFormRecord->first;
-            if (removedForms.find(formId) != removedForms.end()) {
-                if (IsNetworkConditionForm(itFormRecord->second)) {
-                    hadNetCondition = true;
-                }
-                deleteForms.emplace_back(formId, itFormRecord->second);
-                itFormRecord = formRecords_.erase(itFormRecord);
-            } else {
-                itFormRecord++;
+        for (const int64_t formId : removedForms) {
+            auto itFormRecord = formRecords_.find(formId);
+            if (itFormRecord == formRecords_.end()) {
+                continue;
             }
+            if (IsNetworkConditionForm(*itFormRecord->second)) {
+                hadNetCondition = true;
+            }
+            deleteForms.emplace_back(formId, *itFormRecord->second);
+            EraseFormRecordNolock(itFormRecord);
         }
     }
 
@@ -1567,20 +1599,21 @@ void FormDataMgr::CleanRemovedTempFormRecords(const std::string &bundleName, con
     bool hadNetCondition = false;
     {
         std::lock_guard<std::mutex> lock(formRecordMutex_);
-        std::map<int64_t, FormRecord>::iterator itFormRecord;
-        for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end();) {
-            int64_t formId = itFormRecord->first;
-            if ((itFormRecord->second.formTempFlag) && (bundleName == itFormRecord->second.bundleName) &&
-                (userId == itFormRecord->second.providerUserId)) {
+        // Copy the ids, the index entry is modified while erasing.
+        std::set<int64_t> bundleFormIds = GetIndexedFormIdsNolock(bundleFormIds_, bundleName);
+        for (const int64_t formId : bundleFormIds) {
+            auto itFormRecord = formRecords_.find(formId);
+            if (itFormRecord == formRecords_.end()) {
+                continue;
+            }
+            if ((itFormRecord->second->formTempFlag) && (userId == itFormRecord->second->providerUserId)) {
                 removedTempForms.emplace(formId);
-                FormRenderMgr::GetInstance().StopRenderingForm(formId, itFormRecord->second);
-                if (IsNetworkConditionForm(itFormRecord->second)) {
+                FormRenderMgr::GetInstance().StopRenderingForm(formId, *itFormRecord->second);
+                if (IsNetworkConditionForm(*itFormRecord->second)) {
                     hadNetCondition = true;
                 }
-                itFormRecord = formRecords_.erase(itFormRecord);
+                EraseFormRecordNolock(itFormRecord);
                 FormBasicInfoMgr::GetInstance().DeleteFormBasicInfo(formId);
-            } else {
-                itFormRecord++;
             }
         }
     }
@@ -1608,10 +1641,10 @@ void FormDataMgr::CleanRemovedTempFormRecords(const std::string &bundleName, con
 void FormDataMgr::GetReCreateFormRecordsByBundleName(const std::string &bundleName, std::set<int64_t> &reCreateForms)
 {
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    std::map<int64_t, FormRecord>::iterator itFormRecord;
-    for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-        if (bundleName == itFormRecord->second.bundleName) {
-            reCreateForms.emplace(itFormRecord->second.formId);
+    for (const int64_t formId : GetIndexedFormIdsNolock(bundleFormIds_, bundleName)) {
+        auto itFormRecord = formRecords_.find(formId);
+        if (itFormRecord != formRecords_.end()) {
+            reCreateForms.emplace(itFormRecord->second->formId);
         }
     }
 }
@@ -1628,8 +1661,9 @@ void FormDataMgr::SetFormCacheInited(const int64_t formId, bool isInited)
         HILOG_ERROR("form info not find");
         return;
     }
-    itFormRecord->second.isInited = isInited;
-    itFormRecord->second.needRefresh = !isInited;
+    FormRecord &record = MutableFormRecordNolock(itFormRecord->second);
+    record.isInited = isInited;
+    record.needRefresh = !isInited;
 }
 /**
  * @brief Set versionUpgrade.
@@ -1644,7 +1678,7 @@ void FormDataMgr::SetVersionUpgrade(const int64_t formId, const bool versionUpgr
         HILOG_ERROR("form info not find");
         return;
     }
-    itFormRecord->second.versionUpgrade = versionUpgrade;
+    MutableFormRecordNolock(itFormRecord->second).versionUpgrade = versionUpgrade;
 }
 /**
  * @brief Update form for host clients.
@@ -1785,7 +1819,7 @@ int64_t FormDataMgr::FindMatchedFormId(const int64_t formId)
         return formId;
     }
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    std::map<int64_t, FormRecord>::iterator itFormRecord;
+    std::map<int64_t, std::shared_ptr<FormRecord>>::iterator itFormRecord;
     for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
         uint64_t unsignedFormId = static_cast<uint64_t>(formId);
         uint64_t unsignedItFormRecordFirst = static_cast<uint64_t>(itFormRecord->first);
@@ -1825,33 +1859,34 @@ void FormDataMgr::GetNoHostTempForms(
     std::map<int64_t, bool> &foundFormsMap)
 {
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    std::map<int64_t, FormRecord>::iterator itFormRecord;
+    std::map<int64_t, std::shared_ptr<FormRecord>>::iterator itFormRecord;
     for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-        if (!itFormRecord->second.formTempFlag) {
+        if (!itFormRecord->second->formTempFlag) {
             continue; // Not temp form, skip
         }
 
-        auto itUid = std::find(itFormRecord->second.formUserUids.begin(),
-            itFormRecord->second.formUserUids.end(), uid);
-        if (itUid == itFormRecord->second.formUserUids.end()) {
-            foundFormsMap.emplace(itFormRecord->second.formId, false);
+        auto itUid = std::find(itFormRecord->second->formUserUids.begin(),
+            itFormRecord->second->formUserUids.end(), uid);
+        if (itUid == itFormRecord->second->formUserUids.end()) {
+            foundFormsMap.emplace(itFormRecord->second->formId, false);
             continue;
         }
 
-        itFormRecord->second.formUserUids.erase(itUid);
-        if (!itFormRecord->second.formUserUids.empty()) {
+        std::vector<int> &formUserUids = MutableFormRecordNolock(itFormRecord->second).formUserUids;
+        formUserUids.erase(std::find(formUserUids.begin(), formUserUids.end(), uid));
+        if (!formUserUids.empty()) {
             continue;
         }
 
-        FormIdKey formIdKey(itFormRecord->second.bundleName, itFormRecord->second.abilityName,
-            itFormRecord->second.moduleName);
+        FormIdKey formIdKey(itFormRecord->second->bundleName, itFormRecord->second->abilityName,
+            itFormRecord->second->moduleName);
         auto itIdsSet = noHostTempFormsMap.find(formIdKey);
         if (itIdsSet == noHostTempFormsMap.end()) {
             std::set<int64_t> formIdsSet;
-            formIdsSet.emplace(itFormRecord->second.formId);
+            formIdsSet.emplace(itFormRecord->second->formId);
             noHostTempFormsMap.emplace(formIdKey, formIdsSet);
         } else {
-            itIdsSet->second.emplace(itFormRecord->second.formId);
+            itIdsSet->second.emplace(itFormRecord->second->formId);
         }
     }
 }
@@ -2124,7 +2159,7 @@ ErrCode FormDataMgr::SetRecordVisible(int64_t matchedFormId, bool isVisible)
         HILOG_ERROR("form info not find");
         return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
     }
-    info->second.isVisible = isVisible;
+    MutableFormRecordNolock(info->second).isVisible = isVisible;
     HILOG_DEBUG("set isVisible to %{public}d, formId:%{public}" PRId64 " ", isVisible, matchedFormId);
     return ERR_OK;
 }
@@ -2143,22 +2178,22 @@ void FormDataMgr::DeleteFormsByUserId(const int32_t userId, std::vector<int64_t>
     bool hadNetCondition = false;
     {
         std::lock_guard<std::mutex> lock(formRecordMutex_);
-        auto itFormRecord = formRecords_.begin();
-        while (itFormRecord != formRecords_.end()) {
-            int64_t formId = itFormRecord->first;
-            if (userId == itFormRecord->second.providerUserId) {
-                if (itFormRecord->second.formTempFlag) {
-                    removedTempForms.emplace_back(formId);
-                }
-                if (IsNetworkConditionForm(itFormRecord->second)) {
-                    hadNetCondition = true;
-                }
-                removedFormIds.emplace_back(formId);
-                itFormRecord = formRecords_.erase(itFormRecord);
-                FormBasicInfoMgr::GetInstance().DeleteFormBasicInfo(formId);
-            } else {
-                ++itFormRecord;
+        // Copy the ids, the index entry is modified while erasing.
+        std::set<int64_t> userFormIds = GetIndexedFormIdsNolock(providerUserFormIds_, userId);
+        for (const int64_t formId : userFormIds) {
+            auto itFormRecord = formRecords_.find(formId);
+            if (itFormRecord == formRecords_.end()) {
+                continue;
+            }
+            if (itFormRecord->second->formTempFlag) {
+                removedTempForms.emplace_back(formId);
+            }
+            if (IsNetworkConditionForm(*itFormRecord->second)) {
+                hadNetCondition = true;
             }
+            removedFormIds.emplace_back(formId);
+            EraseFormRecordNolock(itFormRecord);
+            FormBasicInfoMgr::GetInstance().DeleteFormBasicInfo(formId);
         }
     }
 
@@ -2185,7 +2220,7 @@ void FormDataMgr::ClearFormRecords()
 {
     {
         std::lock_guard<std::mutex> lock(formRecordMutex_);
-        formRecords_.clear();
+        ClearFormRecordsNolock();
     }
     {
         std::lock_guard<std::mutex> lock(formTempMutex_);
@@ -2207,17 +2242,20 @@ void FormDataMgr::GetNoHostInvalidTempForms(int32_t userId, int32_t callingUid,
                                             std::map<int64_t, bool> &foundFormsMap)
 {
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto &formRecordInfo : formRecords_) {
-        int64_t formId = formRecordInfo.first;
-        FormRecord &formRecord = formRecordInfo.second;
+    for (const int64_t formId : GetIndexedFormIdsNolock(providerUserFormIds_, userId)) {
+        auto formRecordInfo = formRecords_.find(formId);
+        if (formRecordInfo == formRecords_.end()) {
+            continue;
+        }
+        const FormRecord &checkedRecord = *formRecordInfo->second;
 
         // Checks the user id and the temp flag.
-        if (!formRecord.formTempFlag || (userId != formRecord.providerUserId)) {
+        if (!checkedRecord.formTempFlag || (userId != checkedRecord.providerUserId)) {
             continue;
         }
         // check UID
-        auto iter = std::find(formRecord.formUserUids.begin(), formRecord.formUserUids.end(), callingUid);
-        if (iter == formRecord.formUserUids.end()) {
+        if (std::find(checkedRecord.formUserUids.begin(), checkedRecord.formUserUids.end(), callingUid) ==
+            checkedRecord.formUserUids.end()) {
             continue;
         }
         // check valid form set
@@ -2226,7 +2264,9 @@ void FormDataMgr::GetNoHostInvalidTempForms(int32_t userId, int32_t callingUid,
         }
 
         HILOG_DEBUG("found invalid form:%{public}" PRId64 "", formId);
-        formRecord.formUserUids.erase(iter);
+        FormRecord &formRecord = MutableFormRecordNolock(formRecordInfo->second);
+        formRecord.formUserUids.erase(
+            std::find(formRecord.formUserUids.begin(), formRecord.formUserUids.end(), callingUid));
         if (formRecord.formUserUids.empty()) {
             FormIdKey formIdKey(formRecord.bundleName, formRecord.abilityName, formRecord.moduleName);
             auto itIdsSet = noHostTempFormsMap.find(formIdKey);
@@ -2499,7 +2539,7 @@ bool FormDataMgr::SetRecordNeedFreeInstall(int64_t formId, bool isNeedFreeInstal
         HILOG_ERROR("invalid formRecord");
         return false;
     }
-    item->second.needFreeInstall = isNeedFreeInstall;
+    MutableFormRecordNolock(item->second).needFreeInstall = isNeedFreeInstall;
     HILOG_INFO("successfully");
     return true;
 }
@@ -2619,7 +2659,7 @@ int32_t FormDataMgr::GetCastFormsCount(int32_t &formCount)
 {
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     for (const auto &recordPair : formRecords_) {
-        FormRecord record = recordPair.second;
+        const FormRecord &record = *recordPair.second;
         if (!record.formTempFlag) {
             formCount++;
         }
@@ -2698,40 +2738,40 @@ ErrCode FormDataMgr::GetFormInstancesByFilter(const FormInstancesFilter &formIns
 {
     HILOG_DEBUG("get form instances by filter");
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    std::map<int64_t, FormRecord>::iterator itFormRecord;
     if (formInstancesFilter.bundleName.empty()) {
         HILOG_ERROR("null formInstancesFilter.bundleName");
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
     }
 
-    for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-        if (formInstancesFilter.bundleName == itFormRecord->second.bundleName) {
+    for (const int64_t formId : GetIndexedFormIdsNolock(bundleFormIds_, formInstancesFilter.bundleName)) {
+        auto itFormRecord = formRecords_.find(formId);
+        if (itFormRecord != formRecords_.end()) {
             bool Needgetformhostrecordflag = true;
             if (!formInstancesFilter.moduleName.empty() &&
-                formInstancesFilter.moduleName != itFormRecord->second.moduleName) {
+                formInstancesFilter.moduleName != itFormRecord->second->moduleName) {
                 Needgetformhostrecordflag = false;
             } else if (!formInstancesFilter.abilityName.empty() &&
-                formInstancesFilter.abilityName != itFormRecord->second.abilityName) {
+                formInstancesFilter.abilityName != itFormRecord->second->abilityName) {
                 Needgetformhostrecordflag = false;
             } else if (!formInstancesFilter.formName.empty() &&
-                formInstancesFilter.formName != itFormRecord->second.formName) {
+                formInstancesFilter.formName != itFormRecord->second->formName) {
                 Needgetformhostrecordflag = false;
             }
             std::vector<FormHostRecord> formHostRecords;
-            GetFormHostRecord(itFormRecord->second.formId, formHostRecords);
+            GetFormHostRecord(itFormRecord->second->formId, formHostRecords);
             if (Needgetformhostrecordflag) {
                 FormInstance instance;
                 for (auto formHostRecord : formHostRecords) {
                     instance.formHostName = formHostRecord.GetHostBundleName();
-                    instance.formId = itFormRecord->second.formId;
-                    instance.specification = itFormRecord->second.specification;
+                    instance.formId = itFormRecord->second->formId;
+                    instance.specification = itFormRecord->second->specification;
                     instance.formVisiblity =
-                        static_cast<FormVisibilityType>(itFormRecord->second.formVisibleNotifyState);
-                    instance.bundleName = itFormRecord->second.bundleName;
-                    instance.moduleName = itFormRecord->second.moduleName;
-                    instance.abilityName = itFormRecord->second.abilityName;
-                    instance.formName = itFormRecord->second.formName;
-                    instance.description = itFormRecord->second.description;
+                        static_cast<FormVisibilityType>(itFormRecord->second->formVisibleNotifyState);
+                    instance.bundleName = itFormRecord->second->bundleName;
+                    instance.moduleName = itFormRecord->second->moduleName;
+                    instance.abilityName = itFormRecord->second->abilityName;
+                    instance.formName = itFormRecord->second->formName;
+                    instance.description = itFormRecord->second->description;
                     formInstances.emplace_back(instance);
                 }
             }
@@ -2879,16 +2919,22 @@ ErrCode FormDataMgr::GetRunningFormInfos(bool isUnusedIncluded, std::vector<Runn
 {
     HILOG_DEBUG("start");
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto record : formRecords_) {
-        if ((!record.second.formTempFlag) &&
-            ((userId == record.second.providerUserId) ||
-                (record.second.providerUserId == Constants::DEFAULT_USER_ID))) {
+    std::set<int64_t> formIds = GetIndexedFormIdsNolock(providerUserFormIds_, userId);
+    const std::set<int64_t> &defaultUserFormIds =
+        GetIndexedFormIdsNolock(providerUserFormIds_, static_cast<int32_t>(Constants::DEFAULT_USER_ID));
+    formIds.insert(defaultUserFormIds.begin(), defaultUserFormIds.end());
+    for (const int64_t formId : formIds) {
+        auto record = formRecords_.find(formId);
+        if (record == formRecords_.end()) {
+            continue;
+        }
+        if (!record->second->formTempFlag) {
             RunningFormInfo info;
-            info.formId = record.first;
-            FillBasicRunningFormInfoByFormRecord(record.second, info);
+            info.formId = record->first;
+            FillBasicRunningFormInfoByFormRecord(*record->second, info);
             info.formUsageState = FormUsageState::USED;
             std::vector<FormHostRecord> formHostRecords;
-            GetFormHostRecord(record.first, formHostRecords);
+            GetFormHostRecord(record->first, formHostRecords);
             if (formHostRecords.empty()) {
                 HILOG_ERROR("Get form host failed");
                 continue;
@@ -2950,7 +2996,7 @@ ErrCode FormDataMgr::GetRunningFormInfosByBundleName(const std::string &bundleNa
     }
 
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto record : formRecords_) {
+    for (const auto &record : formRecords_) {
         std::vector<FormHostRecord> formHostRecords;
         GetFormHostRecord(record.first, formHostRecords);
         if (formHostRecords.empty()) {
@@ -2958,14 +3004,14 @@ ErrCode FormDataMgr::GetRunningFormInfosByBundleName(const std::string &bundleNa
             continue;
         }
         auto hostBundleName = formHostRecords.begin()->GetHostBundleName();
-        bool flag = (!record.second.formTempFlag) &&
-            ((userId == record.second.providerUserId) ||
-            (record.second.providerUserId == Constants::DEFAULT_USER_ID));
+        bool flag = (!record.second->formTempFlag) &&
+            ((userId == record.second->providerUserId) ||
+            (record.second->providerUserId == Constants::DEFAULT_USER_ID));
         if (hostBundleName == bundleName && flag) {
             RunningFormInfo info;
             info.formId = record.first;
             info.hostBundleName = bundleName;
-            FillBasicRunningFormInfoByFormRecord(record.second, info);
+            FillBasicRunningFormInfoByFormRecord(*record.second, info);
             info.formUsageState = FormUsageState::USED;
             runningFormInfos.emplace_back(info);
         }
@@ -3041,8 +3087,8 @@ ErrCode FormDataMgr::UpdateFormLocation(const int64_t &formId, const int32_t &fo
                 formId, formLocation);
             return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
         }
-        info->second.formLocation = (Constants::FormLocation)formLocation;
-        record = info->second;
+        MutableFormRecordNolock(info->second).formLocation = (Constants::FormLocation)formLocation;
+        record = *info->second;
         HILOG_INFO("success, formId:%{public}" PRId64 " formLocation:%{public}d",
             formId, formLocation);
     }
@@ -3055,33 +3101,33 @@ ErrCode FormDataMgr::GetRecordsByFormType(const int32_t formRefreshType,
 {
     HILOG_INFO("formRefreshType:%{public}d", formRefreshType);
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto formRecord : formRecords_) {
-        if (!FormTrustMgr::GetInstance().IsTrust(formRecord.second.bundleName)) {
-            HILOG_ERROR("ignore,%{public}s is unTrust.", formRecord.second.bundleName.c_str());
+    for (const auto &formRecord : formRecords_) {
+        if (!FormTrustMgr::GetInstance().IsTrust(formRecord.second->bundleName)) {
+            HILOG_ERROR("ignore,%{public}s is unTrust.", formRecord.second->bundleName.c_str());
             continue;
         }
-        if (FormBundleForbidMgr::GetInstance().IsBundleForbidden(formRecord.second.bundleName)) {
-            HILOG_ERROR("ignore,%{public}s is forbidden.", formRecord.second.bundleName.c_str());
+        if (FormBundleForbidMgr::GetInstance().IsBundleForbidden(formRecord.second->bundleName)) {
+            HILOG_ERROR("ignore,%{public}s is forbidden.", formRecord.second->bundleName.c_str());
             continue;
         }
         if (formRefreshType == Constants::REFRESH_APP_FORM) {
-            if (formRecord.second.formBundleType != BundleType::APP) {
+            if (formRecord.second->formBundleType != BundleType::APP) {
                 continue;
             }
         } else if (formRefreshType == Constants::REFRESH_ATOMIC_FORM) {
-            if (formRecord.second.formBundleType != BundleType::ATOMIC_SERVICE) {
+            if (formRecord.second->formBundleType != BundleType::ATOMIC_SERVICE) {
                 continue;
             }
         } else if (formRefreshType == Constants::REFRESH_SYSTEMAPP_FORM) {
-            if (!formRecord.second.isSystemApp) {
+            if (!formRecord.second->isSystemApp) {
                 continue;
             }
         }
-        if (formRecord.second.formVisibleNotifyState == static_cast<int32_t>(FormVisibilityType::VISIBLE)) {
-            visibleFormRecords.emplace_back(formRecord.second);
+        if (formRecord.second->formVisibleNotifyState == static_cast<int32_t>(FormVisibilityType::VISIBLE)) {
+            visibleFormRecords.emplace_back(*formRecord.second);
             continue;
         }
-        invisibleFormRecords.emplace_back(formRecord.second);
+        invisibleFormRecords.emplace_back(*formRecord.second);
     }
     return ERR_OK;
 }
@@ -3094,7 +3140,7 @@ ErrCode FormDataMgr::SetFormLock(const int64_t formId, const bool lock)
         HILOG_ERROR("form info not find");
         return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
     }
-    itFormRecord->second.lockForm = lock;
+    MutableFormRecordNolock(itFormRecord->second).lockForm = lock;
     HILOG_INFO("formId:%{public}" PRId64 " lock:%{public}d", formId, lock);
     return ERR_OK;
 }
@@ -3107,7 +3153,7 @@ ErrCode FormDataMgr::GetFormLock(const int64_t formId, bool &lock)
         HILOG_ERROR("form info not find");
         return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
     }
-    lock = itFormRecord->second.lockForm;
+    lock = itFormRecord->second->lockForm;
     HILOG_INFO("formId:%{public}" PRId64 " lock:%{public}d", formId, lock);
     return ERR_OK;
 }
@@ -3120,7 +3166,7 @@ ErrCode FormDataMgr::SetFormProtect(const int64_t formId, const bool protect)
         HILOG_ERROR("form info not find");
         return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
     }
-    itFormRecord->second.protectForm = protect;
+    MutableFormRecordNolock(itFormRecord->second).protectForm = protect;
     HILOG_INFO("formId:%{public}" PRId64 " protect:%{public}d", formId, protect);
     return ERR_OK;
 }
@@ -3133,7 +3179,7 @@ ErrCode FormDataMgr::GetFormProtect(const int64_t formId, bool &protect)
         HILOG_ERROR("form info not find");
         return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
     }
-    protect = itFormRecord->second.protectForm;
+    protect = itFormRecord->second->protectForm;
     HILOG_INFO("formId:%{public}" PRId64 " protect:%{public}d", formId, protect);
     return ERR_OK;
 }
@@ -3146,7 +3192,7 @@ ErrCode FormDataMgr::SetFormEnable(const int64_t formId, const bool enable)
         HILOG_ERROR("form info not find");
         return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
     }
-    itFormRecord->second.enableForm = enable;
+    MutableFormRecordNolock(itFormRecord->second).enableForm = enable;
     HILOG_INFO("formId:%{public}" PRId64 " enable:%{public}d", formId, enable);
     return ERR_OK;
 }
@@ -3159,7 +3205,7 @@ ErrCode FormDataMgr::SetRefreshDuringDisableForm(const int64_t formId, const boo
         HILOG_ERROR("form info not find");
         return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
     }
-    itFormRecord->second.isRefreshDuringDisableForm = enable;
+    MutableFormRecordNolock(itFormRecord->second).isRefreshDuringDisableForm = enable;
     HILOG_INFO("formId:%{public}" PRId64 " enable:%{public}d", formId, enable);
     return ERR_OK;
 }
@@ -3172,7 +3218,7 @@ ErrCode FormDataMgr::SetUpdateDuringDisableForm(const int64_t formId, const bool
         HILOG_ERROR("form info not find");
         return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
     }
-    itFormRecord->second.isUpdateDuringDisableForm = enable;
+    MutableFormRecordNolock(itFormRecord->second).isUpdateDuringDisableForm = enable;
     HILOG_INFO("formId:%{public}" PRId64 " enable:%{public}d", formId, enable);
     return ERR_OK;
 }
@@ -3231,9 +3277,10 @@ void FormDataMgr::CheckForms(const std::vector<int64_t> &formIds)
 void FormDataMgr::GetFormIdsByUserId(int32_t userId, std::vector<int64_t> &formIds)
 {
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto formRecord : formRecords_) {
-        if (formRecord.second.userId == userId) {
-            formIds.emplace_back(formRecord.second.formId);
+    for (const int64_t formId : GetIndexedFormIdsNolock(userFormIds_, userId)) {
+        auto formRecord = formRecords_.find(formId);
+        if (formRecord != formRecords_.end()) {
+            formIds.emplace_back(formRecord->second->formId);
         }
     }
     HILOG_INFO("userId:%{public}d, size:%{public}zu", userId, formIds.size());
@@ -3286,9 +3333,10 @@ void FormDataMgr::UpdateRefreshWant(const int64_t formId, const Want &want, Form
 void FormDataMgr::GetFormRecordsByUserId(const int32_t userId, std::vector<FormRecord> &formRecords)
 {
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto formRecord : formRecords_) {
-        if (formRecord.second.userId == userId) {
-            formRecords.emplace_back(formRecord.second);
+    for (const int64_t formId : GetIndexedFormIdsNolock(userFormIds_, userId)) {
+        auto formRecord = formRecords_.find(formId);
+        if (formRecord != formRecords_.end()) {
+            formRecords.emplace_back(*formRecord->second);
         }
     }
     HILOG_INFO("userId:%{public}d, size:%{public}zu", userId, formRecords.size());
@@ -3312,7 +3360,7 @@ int32_t FormDataMgr::GetTempFormCountByUserId(const int32_t userId) const
     int32_t count = 0;
     for (const int64_t formId : tempForms_) {
         auto it = formRecords_.find(formId);
-        if (it != formRecords_.end() && it->second.userId == userId) {
+        if (it != formRecords_.end() && it->second->userId == userId) {
             count++;
         }
     }
@@ -3332,7 +3380,7 @@ bool FormDataMgr::GetFormRecordById(const int64_t formId, FormRecord &formRecord
     auto info = formRecords_.find(formId);
     notFindFormRecord = info == formRecords_.end();
     if (!notFindFormRecord) {
-        formRecord = info->second;
+        formRecord = *info->second;
     }
     return notFindFormRecord;
 }
@@ -3373,7 +3421,7 @@ bool FormDataMgr::UpdateFormRecordSetIsExistRecycleTask(const int64_t formId, bo
         HILOG_WARN("form %{public}" PRId64 " not exist", formId);
         return false;
     }
-    info->second.isExistRecycleTask = isExistRecycleTask;
+    MutableFormRecordNolock(info->second).isExistRecycleTask = isExistRecycleTask;
     HILOG_DEBUG("update form %{public}" PRId64 " isExistRecycleTask:%{public}d", formId, isExistRecycleTask);
     return true;
 }
@@ -3408,7 +3456,7 @@ ErrCode FormDataMgr::SetSpecification(const int64_t formId, const int32_t specif
         HILOG_ERROR("form info not find");
         return ERR_APPEXECFWK_FORM_INVALID_FORM_ID;
     }
-    itFormRecord->second.specification = specification;
+    MutableFormRecordNolock(itFormRecord->second).specification = specification;
     HILOG_INFO("formId:%{public}" PRId64 " specification:%{public}d", formId, specification);
     return ERR_OK;
 }
@@ -3437,7 +3485,7 @@ void FormDataMgr::SetExpectRecycledStatus(int64_t formId, bool isExpectRecycled)
     auto info = formRecords_.find(formId);
     if (info != formRecords_.end()) {
         HILOG_INFO("formId:%{public}" PRId64 " isExpectRecycled:%{public}d", formId, isExpectRecycled);
-        info->second.expectRecycled = isExpectRecycled;
+        MutableFormRecordNolock(info->second).expectRecycled = isExpectRecycled;
     }
 }
 
@@ -3448,7 +3496,7 @@ bool FormDataMgr::IsExpectRecycled(int64_t formId)
     if (info == formRecords_.end()) {
         return false;
     }
-    return info->second.expectRecycled;
+    return info->second->expectRecycled;
 }
 
 void FormDataMgr::DeleteRecordTempForms(const std::vector<int64_t> &recordTempForms)
@@ -3456,22 +3504,20 @@ void FormDataMgr::DeleteRecordTempForms(const std::vector<int64_t> &recordTempFo
     bool hadNetCondition = false;
     {
         std::lock_guard<std::mutex> lock(formRecordMutex_);
-        std::map<int64_t, FormRecord>::iterator itFormRecord;
-        for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end();) {
-            int64_t formId = itFormRecord->first;
+        for (const int64_t formId : recordTempForms) {
             // if temp form, remove it
-            if (std::find(recordTempForms.begin(), recordTempForms.end(), formId) != recordTempForms.end()) {
-                FormRecord formRecord = itFormRecord->second;
-                if (IsNetworkConditionForm(formRecord)) {
-                    hadNetCondition = true;
-                }
-                itFormRecord = formRecords_.erase(itFormRecord);
-                FormBasicInfoMgr::GetInstance().DeleteFormBasicInfo(formId);
-                FormProviderMgr::GetInstance().NotifyProviderFormDelete(formId, formRecord);
-                FormDataProxyMgr::GetInstance().UnsubscribeFormData(formId);
-            } else {
-                itFormRecord++;
+            auto itFormRecord = formRecords_.find(formId);
+            if (itFormRecord == formRecords_.end()) {
+                continue;
+            }
+            FormRecord formRecord = *itFormRecord->second;
+            if (IsNetworkConditionForm(formRecord)) {
+                hadNetCondition = true;
             }
+            EraseFormRecordNolock(itFormRecord);
+            FormBasicInfoMgr::GetInstance().DeleteFormBasicInfo(formId);
+            FormProviderMgr::GetInstance().NotifyProviderFormDelete(formId, formRecord);
+            FormDataProxyMgr::GetInstance().UnsubscribeFormData(formId);
         }
     }
     if (hadNetCondition && !HasNetworkConditionForm()) {
@@ -3483,9 +3529,10 @@ bool FormDataMgr::GetFormRecord(const std::string &bundleName, const std::string
     std::vector<FormRecord> &formRecords) const
 {
     std::lock_guard<std::mutex> lock(formRecordMutex_);
-    for (auto itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end(); itFormRecord++) {
-        if (bundleName == itFormRecord->second.bundleName && moduleName == itFormRecord->second.moduleName) {
-            formRecords.emplace_back(itFormRecord->second);
+    for (const int64_t formId : GetIndexedFormIdsNolock(moduleFormIds_, std::make_pair(bundleName, moduleName))) {
+        auto itFormRecord = formRecords_.find(formId);
+        if (itFormRecord != formRecords_.end()) {
+            formRecords.emplace_back(*itFormRecord->second);
         }
     }
     return formRecords.size() > 0;
@@ -3537,7 +3584,7 @@ bool FormDataMgr::UpdateFormUpgradeInfo(const int64_t formId, const FormUpgradeI
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     auto info = formRecords_.find(formId);
     if (info != formRecords_.end()) {
-        info->second.formUpgradeInfo = formUpgradeInfo;
+        MutableFormRecordNolock(info->second).formUpgradeInfo = formUpgradeInfo;
         return true;
     }
     HILOG_DEBUG("FormId:%{public}" PRId64 " form record not found.", formId);
@@ -3557,7 +3604,7 @@ bool FormDataMgr::GetFormUpgradeInfo(const int64_t formId, FormUpgradeInfo &form
         HILOG_ERROR("formInfo not find");
         return false;
     }
-    formUpgradeInfo = info->second.formUpgradeInfo;
+    formUpgradeInfo = info->second->formUpgradeInfo;
     HILOG_DEBUG("get form upgrade info successfully");
     return true;
 }
@@ -3601,11 +3648,11 @@ bool FormDataMgr::GetAddfinishAndSetUpdateFlag(const int64_t formId)
         HILOG_ERROR("formId:%{public}" PRId64 " not found", formId);
         return false;
     }
-    if (info->second.addFormFinish) {
+    if (info->second->addFormFinish) {
         HILOG_INFO("formId:%{public}" PRId64 " addition has been completed", formId);
         return true;
     }
-    info->second.isNeedUpdateFormOnAddFormFinish = true;
+    MutableFormRecordNolock(info->second).isNeedUpdateFormOnAddFormFinish = true;
     return false;
 }
 
@@ -3618,10 +3665,11 @@ bool FormDataMgr::GetIsNeedUpdateOnAddFinish(const int64_t formId, FormRecord &f
         HILOG_ERROR("formId:%{public}" PRId64 " not found", formId);
         return false;
     }
-    bool isNeedUpdate = !info->second.addFormFinish && info->second.isNeedUpdateFormOnAddFormFinish;
-    info->second.addFormFinish = true;
-    info->second.isNeedUpdateFormOnAddFormFinish = false;
-    formRecord = info->second;
+    bool isNeedUpdate = !info->second->addFormFinish && info->second->isNeedUpdateFormOnAddFormFinish;
+    FormRecord &record = MutableFormRecordNolock(info->second);
+    record.addFormFinish = true;
+    record.isNeedUpdateFormOnAddFormFinish = false;
+    formRecord = record;
     return isNeedUpdate;
 }
 
@@ -3635,9 +3683,9 @@ void FormDataMgr::UpdateHostWant(const int64_t formId, const Want &want, bool sh
     }
 
     if (shouldMerge) {
-        formRecord->second.hostWant.MergeFrom(want);
+        MutableFormRecordNolock(formRecord->second).hostWant.MergeFrom(want);
     } else {
-        formRecord->second.hostWant = FormWant(want);
+        MutableFormRecordNolock(formRecord->second).hostWant = FormWant(want);
     }
 
     HILOG_INFO("UpdateHostWant end, formId:%{public}" PRId64 ", shouldMerge:%{public}d", formId, shouldMerge);
@@ -3652,10 +3700,11 @@ void FormDataMgr::UpdateHostWantSize(
         HILOG_ERROR("form record is not exist.");
         return;
     }
-    formRecord->second.hostWant.SetParam(Constants::PARAM_FORM_WIDTH_KEY, static_cast<double>(width));
-    formRecord->second.hostWant.SetParam(Constants::PARAM_FORM_HEIGHT_KEY, static_cast<double>(height));
-    formRecord->second.hostWant.SetParam(Constants::PARAM_FORM_BORDER_WIDTH_KEY, borderWidth);
-    formRecord->second.hostWant.SetParam(Constants::PARAM_FORM_VIEW_SCALE, formViewScale);
+    FormWant &hostWant = MutableFormRecordNolock(formRecord->second).hostWant;
+    hostWant.SetParam(Constants::PARAM_FORM_WIDTH_KEY, static_cast<double>(width));
+    hostWant.SetParam(Constants::PARAM_FORM_HEIGHT_KEY, static_cast<double>(height));
+    hostWant.SetParam(Constants::PARAM_FORM_BORDER_WIDTH_KEY, borderWidth);
+    hostWant.SetParam(Constants::PARAM_FORM_VIEW_SCALE, formViewScale);
     HILOG_INFO("UpdateHostWantSize end, formId:%{public}" PRId64, formId);
 }
 
@@ -3750,5 +3799,76 @@ bool FormDataMgr::HasFormRecord(const int64_t formId) const
     std::lock_guard<std::mutex> lock(formRecordMutex_);
     return formRecords_.find(formId) != formRecords_.end();
 }
+
+bool FormDataMgr::EmplaceFormRecordNolock(const int64_t formId, const FormRecord &record)
+{
+    if (formRecords_.find(formId) != formRecords_.end()) {
+        return false;
+    }
+    formRecords_.emplace(formId, std::make_shared<FormRecord>(record));
+    AddFormRecordIndexNolock(formId, record);
+    return true;
+}
+
+bool FormDataMgr::EraseFormRecordNolock(const int64_t formId)
+{
+    auto iter = formRecords_.find(formId);
+    if (iter == formRecords_.end()) {
+        return false;
+    }
+    EraseFormRecordNolock(iter);
+    return true;
+}
+
+std::map<int64_t, std::shared_ptr<FormRecord>>::iterator FormDataMgr::EraseFormRecordNolock(
+    std::map<int64_t, std::shared_ptr<FormRecord>>::iterator iter)
+{
+    RemoveFormRecordIndexNolock(iter->first, *iter->second);
+    return formRecords_.erase(iter);
+}
+
+FormRecord &FormDataMgr::MutableFormRecordNolock(std::shared_ptr<FormRecord> &record)
+{
+    // snapshots are only handed out under formRecordMutex_, so a unique record can not be shared meanwhile
+    if (record.use_count() > 1) {
+        record = std::make_shared<FormRecord>(*record);
+    }
+    return *record;
+}
+
+void FormDataMgr::ClearFormRecordsNolock()
+{
+    formRecords_.clear();
+    bundleFormIds_.clear();
+    moduleFormIds_.clear();
+    userFormIds_.clear();
+    providerUserFormIds_.clear();
+}
+
+void FormDataMgr::AddFormRecordIndexNolock(const int64_t formId, const FormRecord &record)
+{
+    bundleFormIds_[record.bundleName].emplace(formId);
+    moduleFormIds_[std::make_pair(record.bundleName, record.moduleName)].emplace(formId);
+    userFormIds_[record.userId].emplace(formId);
+    providerUserFormIds_[record.providerUserId].emplace(formId);
+}
+
+void FormDataMgr::RemoveFormRecordIndexNolock(const int64_t formId, const FormRecord &record)
+{
+    auto removeFromIndex = [formId](auto &index, const auto &key) {
+        auto iter = index.find(key);
+        if (iter == index.end()) {
+            return;
+        }
+        iter->second.erase(formId);
+        if (iter->second.empty()) {
+            index.erase(iter);
+        }
+    };
+    removeFromIndex(bundleFormIds_, record.bundleName);
+    removeFromIndex(moduleFormIds_, std::make_pair(record.bundleName, record.moduleName));
+    removeFromIndex(userFormIds_, record.userId);
+    removeFromIndex(providerUserFormIds_, record.providerUserId);
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
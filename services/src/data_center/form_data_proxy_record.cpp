@@ -212,10 +212,7 @@ FormDataProxyRecord::FormDataProxyRecord(int64_t formId, const std::string &bund
     tokenId_(tokenId), uid_(uid)
 {
     HILOG_INFO("create formId:%{public}" PRId64 ", bundleName:%{public}s", formId, bundleName.c_str());
-    std::string uri = "datashareproxy://" + bundleName;
-    DataShare::CreateOptions options;
-    options.isProxy_ = true;
-    dataShareHelper_ = DataShare::DataShareHelper::Creator(uri, options);
+    dataShareHelper_ = FormDataProxySubscriptionRegistry::GetInstance().AcquireClient(bundleName);
 }
 
 FormDataProxyRecord::~FormDataProxyRecord()
@@ -223,7 +220,7 @@ FormDataProxyRecord::~FormDataProxyRecord()
     HILOG_INFO("destroy formId:%{public}" PRId64 ", bundleName:%{public}s", formId_, bundleName_.c_str());
     UnRegisterPermissionListener();
     if (dataShareHelper_ != nullptr) {
-        dataShareHelper_->Release();
+        FormDataProxySubscriptionRegistry::GetInstance().DetachForm(formId_, this);
     }
 }
 
@@ -268,20 +265,10 @@ ErrCode FormDataProxyRecord::SubscribeRdbFormData(const SubscribeMap &rdbSubscri
     std::vector<FormDataProxyRequest> formDataProxyRequests;
     ConvertSubscribeMapToRequests(rdbSubscribeMap, formDataProxyRequests);
 
-    std::weak_ptr<FormDataProxyRecord> weak(shared_from_this());
-    auto rdbTask = [weak](const DataShare::RdbChangeNode &changeNode) {
-        auto formDataRecord = weak.lock();
-        if (formDataRecord == nullptr) {
-            HILOG_ERROR("null formDataRecord");
-            return;
-        }
-        formDataRecord->OnRdbDataChange(changeNode);
-    };
+    auto self = shared_from_this();
     for (const auto &search : formDataProxyRequests) {
-        DataShare::TemplateId templateId;
-        templateId.subscriberId_ = search.subscribeId;
-        templateId.bundleName_ = bundleName_;
-        auto ret = dataShareHelper_->SubscribeRdbData(search.uris, templateId, rdbTask);
+        auto ret = FormDataProxySubscriptionRegistry::GetInstance().Subscribe(true, formId_, self, dataShareHelper_,
+            search.uris, search.subscribeId);
         uint32_t failNum = 0;
         for (const auto &iter : ret) {
             SubscribeResultRecord record{iter.key_, search.subscribeId, iter.errCode_, false, 0};
@@ -315,17 +302,10 @@ ErrCode FormDataProxyRecord::SubscribePublishFormData(const SubscribeMap &publis
     std::vector<FormDataProxyRequest> formDataProxyRequests;
     ConvertSubscribeMapToRequests(publishSubscribeMap, formDataProxyRequests);
 
-    std::weak_ptr<FormDataProxyRecord> weak(shared_from_this());
-    auto publishedTask = [weak](const DataShare::PublishedDataChangeNode &changeNode) {
-        auto formDataRecord = weak.lock();
-        if (formDataRecord == nullptr) {
-            HILOG_ERROR("null formDataRecord");
-            return;
-        }
-        formDataRecord->OnPublishedDataChange(changeNode);
-    };
+    auto self = shared_from_this();
     for (const auto &search : formDataProxyRequests) {
-        auto ret = dataShareHelper_->SubscribePublishedData(search.uris, search.subscribeId, publishedTask);
+        auto ret = FormDataProxySubscriptionRegistry::GetInstance().Subscribe(false, formId_, self, dataShareHelper_,
+            search.uris, search.subscribeId);
         uint32_t failNum = 0;
         for (const auto &iter : ret) {
             SubscribeResultRecord record{iter.key_, search.subscribeId, iter.errCode_, false, 0};
@@ -357,11 +337,9 @@ ErrCode FormDataProxyRecord::UnsubscribeFormData(SubscribeMap &rdbSubscribeMap,
 
     std::vector<FormDataProxyRequest> rdbRequests;
     ConvertSubscribeMapToRequests(rdbSubscribeMap, rdbRequests);
+    FormDataProxySubscriptionRegistry &registry = FormDataProxySubscriptionRegistry::GetInstance();
     for (const auto &search : rdbRequests) {
-        DataShare::TemplateId templateId;
-        templateId.subscriberId_ = search.subscribeId;
-        templateId.bundleName_ = bundleName_;
-        dataShareHelper_->UnsubscribeRdbData(search.uris, templateId);
+        registry.Unsubscribe(true, formId_, this, search.uris, search.subscribeId);
         for (const auto &uri : search.uris) {
             RemoveSubscribeResultRecord(uri, search.subscribeId, true);
         }
@@ -373,7 +351,7 @@ ErrCode FormDataProxyRecord::UnsubscribeFormData(SubscribeMap &rdbSubscribeMap,
     std::vector<FormDataProxyRequest> publishRequests;
     ConvertSubscribeMapToRequests(publishSubscribeMap, publishRequests);
     for (const auto &search : publishRequests) {
-        dataShareHelper_->UnsubscribePublishedData(search.uris, search.subscribeId);
+        registry.Unsubscribe(false, formId_, this, search.uris, search.subscribeId);
         for (const auto &uri : search.uris) {
             RemoveSubscribeResultRecord(uri, search.subscribeId, false);
         }
@@ -463,33 +441,27 @@ void FormDataProxyRecord::ConvertSubscribeMapToRequests(
 }
 
 void FormDataProxyRecord::UpdatePublishedDataForm(const std::vector<DataShare::PublishedDataItem> &data)
+{
+    FormDataProxyChange change;
+    FormDataProxySubscriptionRegistry::DecodePublishedData(data, change);
+    ApplyPublishedDataChange(change);
+}
+
+void FormDataProxyRecord::ApplyPublishedDataChange(const FormDataProxyChange &change)
 {
     std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageDataMap;
-    nlohmann::json object;
-    std::string formDataKeysStr = "";
-    for (const auto& iter : data) {
-        if (iter.key_.empty()) {
-            HILOG_ERROR("empty key");
-            continue;
-        }
-        if (iter.IsAshmem()) {
-            PrepareImageData(iter, object, imageDataMap);
-        } else {
-            auto value = std::get<std::string>(iter.value_);
-            nlohmann::json dataObject = nlohmann::json::parse(value, nullptr, false);
-            if (dataObject.is_discarded()) {
-                HILOG_ERROR("fail parse data:%{public}s", value.c_str());
-                continue;
-            }
-            object[iter.key_] = dataObject;
-            std::string newKeyStr = formDataKeysStr.empty() ? iter.key_ : (", " + iter.key_);
-            formDataKeysStr += newKeyStr;
+    std::string formDataStr = change.formDataStr;
+    if (!change.imageItems.empty()) {
+        // image names are generated per form
+        nlohmann::json object = change.object;
+        for (const auto *item : change.imageItems) {
+            PrepareImageData(*item, object, imageDataMap);
         }
+        formDataStr = object.empty() ? "" : object.dump();
     }
-    std::string formDataStr = object.empty() ? "" : object.dump();
     HILOG_INFO("formId:%{public}" PRId64 " update published data. formDataStr[len:%{public}zu], "
         "formDataKeysStr:%{public}s, imageDataMap size:%{public}zu", formId_, formDataStr.length(),
-        formDataKeysStr.c_str(), imageDataMap.size());
+        change.formDataKeys.c_str(), imageDataMap.size());
 
     FormProviderData formProviderData;
     formProviderData.SetDataString(formDataStr);
@@ -515,18 +487,11 @@ void FormDataProxyRecord::UpdatePublishedDataForm(const std::vector<DataShare::P
 
 void FormDataProxyRecord::UpdateRdbDataForm(const std::vector<std::string> &data)
 {
-    nlohmann::json object;
-    for (const auto& iter : data) {
-        HILOG_DEBUG("iter: %{private}s.", iter.c_str());
-        nlohmann::json dataObject = nlohmann::json::parse(iter, nullptr, false);
-        if (dataObject.is_discarded()) {
-            HILOG_ERROR("fail parse data:%{public}s", iter.c_str());
-            continue;
-        }
-        object.merge_patch(dataObject);
-    }
+    ApplyRdbDataChange(FormDataProxySubscriptionRegistry::DecodeRdbData(data));
+}
 
-    std::string formDataStr = object.empty() ? "" : object.dump();
+void FormDataProxyRecord::ApplyRdbDataChange(const std::string &formDataStr)
+{
     HILOG_INFO("formId:%{public}" PRId64 " update rdb data. formDataStr[len:%{public}zu].",
         formId_, formDataStr.length());
 
@@ -655,15 +620,8 @@ ErrCode FormDataProxyRecord::SetRdbSubsState(const SubscribeMap &rdbSubscribeMap
     ConvertSubscribeMapToRequests(rdbSubscribeMap, formDataProxyRequests);
 
     for (const auto &search : formDataProxyRequests) {
-        DataShare::TemplateId templateId;
-        templateId.subscriberId_ = search.subscribeId;
-        templateId.bundleName_ = bundleName_;
-        std::vector<DataShare::OperationResult> ret;
-        if (subsState) {
-            ret = dataShareHelper_->EnableRdbSubs(search.uris, templateId);
-        } else {
-            ret = dataShareHelper_->DisableRdbSubs(search.uris, templateId);
-        }
+        auto ret = FormDataProxySubscriptionRegistry::GetInstance().SetSubsState(true, formId_, this, search.uris,
+            search.subscribeId, subsState);
         uint32_t failNum = 0;
         for (const auto &iter : ret) {
             if (iter.errCode_ != 0) {
@@ -695,12 +653,8 @@ ErrCode FormDataProxyRecord::SetPublishSubsState(const SubscribeMap &publishSubs
     ConvertSubscribeMapToRequests(publishSubscribeMap, formDataProxyRequests);
 
     for (const auto &search : formDataProxyRequests) {
-        std::vector<DataShare::OperationResult> ret;
-        if (subsState) {
-            ret = dataShareHelper_->EnablePubSubs(search.uris, search.subscribeId);
-        } else {
-            ret = dataShareHelper_->DisablePubSubs(search.uris, search.subscribeId);
-        }
+        auto ret = FormDataProxySubscriptionRegistry::GetInstance().SetSubsState(false, formId_, this, search.uris,
+            search.subscribeId, subsState);
         uint32_t failNum = 0;
         for (const auto &iter : ret) {
             if (iter.errCode_ != 0) {
@@ -818,22 +772,10 @@ void FormDataProxyRecord::RetryFailureRdbSubscribes(SubscribeResultRecord &recor
         return;
     }
 
-    std::weak_ptr<FormDataProxyRecord> weak(shared_from_this());
-    auto rdbTask = [weak](const DataShare::RdbChangeNode &changeNode) {
-        auto formDataRecord = weak.lock();
-        if (formDataRecord == nullptr) {
-            HILOG_ERROR("null formDataRecord");
-            return;
-        }
-        formDataRecord->OnRdbDataChange(changeNode);
-    };
-
     record.retry = true;
     std::vector<std::string> uris{record.uri};
-    DataShare::TemplateId templateId;
-    templateId.subscriberId_ = record.subscribeId;
-    templateId.bundleName_ = bundleName_;
-    auto ret = dataShareHelper_->SubscribeRdbData(uris, templateId, rdbTask);
+    auto ret = FormDataProxySubscriptionRegistry::GetInstance().Subscribe(true, formId_, shared_from_this(),
+        dataShareHelper_, uris, record.subscribeId);
     for (const auto &iter : ret) {
         if (iter.errCode_ != 0) {
             HILOG_ERROR("retry subscribe rdb data failed, uri:%{public}s, subscriberId:%{public}" PRId64 ", "
@@ -853,19 +795,10 @@ void FormDataProxyRecord::RetryFailurePublishedSubscribes(SubscribeResultRecord
         return;
     }
 
-    std::weak_ptr<FormDataProxyRecord> weak(shared_from_this());
-    auto publishedTask = [weak](const DataShare::PublishedDataChangeNode &changeNode) {
-        auto formDataRecord = weak.lock();
-        if (formDataRecord == nullptr) {
-            HILOG_ERROR("null formDataRecord");
-            return;
-        }
-        formDataRecord->OnPublishedDataChange(changeNode);
-    };
-
     record.retry = true;
     std::vector<std::string> uris{record.uri};
-    auto ret = dataShareHelper_->SubscribePublishedData(uris, record.subscribeId, publishedTask);
+    auto ret = FormDataProxySubscriptionRegistry::GetInstance().Subscribe(false, formId_, shared_from_this(),
+        dataShareHelper_, uris, record.subscribeId);
     for (const auto &iter : ret) {
         if (iter.errCode_ != 0) {
             HILOG_ERROR("retry subscribe published data failed, uri:%{public}s, subscriberId:%{public}" PRId64 ", "
@@ -0,0 +1,599 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_center/form_data_proxy_subscription_registry.h"
+
+#include "data_center/form_data_proxy_record.h"
+#include "fms_log_wrapper.h"
+#include "form_mgr/form_mgr_queue.h"
+#include "form_mgr_errors.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+constexpr const char *KEY_DELIMITER = "?"; // the delimiter between key and uid
+
+std::string GetDataKey(const std::string &uri)
+{
+    auto index = uri.find(KEY_DELIMITER);
+    return index == std::string::npos ? uri : uri.substr(0, index);
+}
+} // namespace
+
+FormDataShareClient::FormDataShareClient(const std::string &bundleName,
+    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper)
+    : bundleName_(bundleName), dataShareHelper_(dataShareHelper)
+{
+}
+
+FormDataShareClient::~FormDataShareClient()
+{
+    HILOG_INFO("release bundleName:%{public}s", bundleName_.c_str());
+    if (dataShareHelper_ != nullptr) {
+        dataShareHelper_->Release();
+    }
+}
+
+std::shared_ptr<FormDataShareClient> FormDataShareClient::Create(const std::string &bundleName)
+{
+    std::string uri = "datashareproxy://" + bundleName;
+    DataShare::CreateOptions options;
+    options.isProxy_ = true;
+    auto dataShareHelper = DataShare::DataShareHelper::Creator(uri, options);
+    if (dataShareHelper == nullptr) {
+        HILOG_ERROR("create dataShareHelper failed, bundleName:%{public}s", bundleName.c_str());
+        return nullptr;
+    }
+    return std::make_shared<FormDataShareClient>(bundleName, dataShareHelper);
+}
+
+std::vector<DataShare::OperationResult> FormDataShareClient::SubscribeRdbData(const std::vector<std::string> &uris,
+    int64_t subscriberId, const RdbCallback &callback)
+{
+    DataShare::TemplateId templateId;
+    templateId.subscriberId_ = subscriberId;
+    templateId.bundleName_ = bundleName_;
+    return dataShareHelper_->SubscribeRdbData(uris, templateId, callback);
+}
+
+std::vector<DataShare::OperationResult> FormDataShareClient::SubscribePublishedData(
+    const std::vector<std::string> &uris, int64_t subscriberId, const PublishedCallback &callback)
+{
+    return dataShareHelper_->SubscribePublishedData(uris, subscriberId, callback);
+}
+
+std::vector<DataShare::OperationResult> FormDataShareClient::Unsubscribe(bool isRdbType,
+    const std::vector<std::string> &uris, int64_t subscriberId)
+{
+    if (!isRdbType) {
+        return dataShareHelper_->UnsubscribePublishedData(uris, subscriberId);
+    }
+    DataShare::TemplateId templateId;
+    templateId.subscriberId_ = subscriberId;
+    templateId.bundleName_ = bundleName_;
+    return dataShareHelper_->UnsubscribeRdbData(uris, templateId);
+}
+
+std::vector<DataShare::OperationResult> FormDataShareClient::SetSubsState(bool isRdbType,
+    const std::vector<std::string> &uris, int64_t subscriberId, bool subsState)
+{
+    if (!isRdbType) {
+        return subsState ? dataShareHelper_->EnablePubSubs(uris, subscriberId) :
+            dataShareHelper_->DisablePubSubs(uris, subscriberId);
+    }
+    DataShare::TemplateId templateId;
+    templateId.subscriberId_ = subscriberId;
+    templateId.bundleName_ = bundleName_;
+    return subsState ? dataShareHelper_->EnableRdbSubs(uris, templateId) :
+        dataShareHelper_->DisableRdbSubs(uris, templateId);
+}
+
+FormDataProxySubscriptionRegistry::FormDataProxySubscriptionRegistry()
+    : clientCreator_(FormDataShareClient::Create)
+{
+    HILOG_INFO("create");
+}
+
+FormDataProxySubscriptionRegistry::~FormDataProxySubscriptionRegistry()
+{
+    HILOG_INFO("destroy");
+}
+
+std::shared_ptr<FormDataShareClient> FormDataProxySubscriptionRegistry::AcquireClient(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(clientMutex_);
+    auto iter = clients_.find(bundleName);
+    if (iter != clients_.end()) {
+        auto client = iter->second.lock();
+        if (client != nullptr) {
+            return client;
+        }
+        clients_.erase(iter);
+    }
+    auto client = clientCreator_ == nullptr ? nullptr : clientCreator_(bundleName);
+    if (client == nullptr) {
+        HILOG_ERROR("null client, bundleName:%{public}s", bundleName.c_str());
+        return nullptr;
+    }
+    clients_[bundleName] = client;
+    return client;
+}
+
+std::vector<DataShare::OperationResult> FormDataProxySubscriptionRegistry::Subscribe(bool isRdbType, int64_t formId,
+    const std::shared_ptr<FormDataProxyRecord> &record, const std::shared_ptr<FormDataShareClient> &client,
+    const std::vector<std::string> &uris, int64_t subscriberId)
+{
+    std::vector<DataShare::OperationResult> results;
+    if (record == nullptr || client == nullptr) {
+        HILOG_ERROR("null record or client");
+        return results;
+    }
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    FormSubscriber subscriber{record, record.get(), true};
+    std::vector<std::string> newUris;
+    std::vector<std::string> enableUris;
+    // DataShare only sends the current data to the form that subscribes a uri first
+    nlohmann::json initialData = nlohmann::json::object();
+    {
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        for (const auto &uri : uris) {
+            auto iter = subscriptions_.find({isRdbType, uri, subscriberId});
+            if (iter == subscriptions_.end() || iter->second.ret != ERR_OK) {
+                // DataShare sends the current data within the subscribe call, the subscriber has to be there
+                Subscription &subscription = subscriptions_[{isRdbType, uri, subscriberId}];
+                subscription.client = client;
+                subscription.ret = ERR_OK;
+                subscription.subscribers[formId] = subscriber;
+                newUris.emplace_back(uri);
+                continue;
+            }
+            if (!IsSubscriptionEnabled(iter->second)) {
+                enableUris.emplace_back(uri);
+            }
+            iter->second.subscribers[formId] = subscriber;
+            for (const auto &item : iter->second.lastData.items()) {
+                initialData[item.key()] = item.value();
+            }
+            results.emplace_back(uri, ERR_OK);
+        }
+    }
+    if (!enableUris.empty()) {
+        client->SetSubsState(isRdbType, enableUris, subscriberId, true);
+    }
+    SendInitialData(isRdbType, record, initialData);
+    HILOG_INFO("formId:%{public}" PRId64 ", rdb:%{public}d, subscriberId:%{public}" PRId64 ", shared:%{public}zu, "
+        "new:%{public}zu", formId, isRdbType, subscriberId, results.size(), newUris.size());
+    if (newUris.empty()) {
+        return results;
+    }
+
+    std::vector<DataShare::OperationResult> subscribeResults;
+    if (isRdbType) {
+        subscribeResults = client->SubscribeRdbData(newUris, subscriberId,
+            [newUris, subscriberId](const DataShare::RdbChangeNode &changeNode) {
+                FormDataProxySubscriptionRegistry::GetInstance().OnRdbDataChange(newUris, subscriberId, changeNode);
+            });
+    } else {
+        subscribeResults = client->SubscribePublishedData(newUris, subscriberId,
+            [newUris, subscriberId](const DataShare::PublishedDataChangeNode &changeNode) {
+                FormDataProxySubscriptionRegistry::GetInstance().OnPublishedDataChange(
+                    newUris, subscriberId, changeNode);
+            });
+    }
+    std::lock_guard<std::mutex> lock(subscriptionMutex_);
+    std::set<std::string> resultUris;
+    for (const auto &result : subscribeResults) {
+        resultUris.emplace(result.key_);
+        auto iter = subscriptions_.find({isRdbType, result.key_, subscriberId});
+        if (iter != subscriptions_.end()) {
+            // a failed subscription is subscribed again by the next form
+            iter->second.ret = result.errCode_;
+        }
+        results.emplace_back(result);
+    }
+    for (const auto &uri : newUris) {
+        if (resultUris.find(uri) != resultUris.end()) {
+            continue;
+        }
+        HILOG_ERROR("no subscribe result, uri:%{public}s", uri.c_str());
+        auto iter = subscriptions_.find({isRdbType, uri, subscriberId});
+        if (iter == subscriptions_.end()) {
+            continue;
+        }
+        iter->second.subscribers.erase(formId);
+        if (iter->second.subscribers.empty()) {
+            subscriptions_.erase(iter);
+        }
+    }
+    return results;
+}
+
+void FormDataProxySubscriptionRegistry::Unsubscribe(bool isRdbType, int64_t formId,
+    const FormDataProxyRecord *record, const std::vector<std::string> &uris, int64_t subscriberId)
+{
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    std::map<ReleaseKey, SubscriptionRelease> releases;
+    {
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        for (const auto &uri : uris) {
+            auto iter = subscriptions_.find({isRdbType, uri, subscriberId});
+            if (iter != subscriptions_.end()) {
+                DetachSubscriberNolock(iter, formId, record, releases);
+            }
+        }
+    }
+    ApplyReleases(releases);
+}
+
+std::vector<DataShare::OperationResult> FormDataProxySubscriptionRegistry::SetSubsState(bool isRdbType,
+    int64_t formId, const FormDataProxyRecord *record, const std::vector<std::string> &uris, int64_t subscriberId,
+    bool subsState)
+{
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    std::vector<DataShare::OperationResult> results;
+    std::vector<std::string> changedUris;
+    std::shared_ptr<FormDataShareClient> client;
+    {
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        for (const auto &uri : uris) {
+            auto iter = subscriptions_.find({isRdbType, uri, subscriberId});
+            if (iter == subscriptions_.end()) {
+                results.emplace_back(uri, ERR_APPEXECFWK_FORM_COMMON_CODE);
+                continue;
+            }
+            auto subscriber = iter->second.subscribers.find(formId);
+            if (subscriber == iter->second.subscribers.end() || subscriber->second.recordPtr != record) {
+                results.emplace_back(uri, ERR_APPEXECFWK_FORM_COMMON_CODE);
+                continue;
+            }
+            bool wasEnabled = IsSubscriptionEnabled(iter->second);
+            subscriber->second.isEnabled = subsState;
+            if (wasEnabled == IsSubscriptionEnabled(iter->second)) {
+                results.emplace_back(uri, ERR_OK);
+                continue;
+            }
+            changedUris.emplace_back(uri);
+            client = iter->second.client;
+        }
+    }
+    if (client != nullptr && !changedUris.empty()) {
+        auto ret = client->SetSubsState(isRdbType, changedUris, subscriberId, subsState);
+        results.insert(results.end(), ret.begin(), ret.end());
+    }
+    return results;
+}
+
+void FormDataProxySubscriptionRegistry::DetachForm(int64_t formId, const FormDataProxyRecord *record)
+{
+    std::lock_guard<std::mutex> subscribeLock(subscribeMutex_);
+    std::map<ReleaseKey, SubscriptionRelease> releases;
+    {
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        for (auto iter = subscriptions_.begin(); iter != subscriptions_.end();) {
+            // the iterator is erased when its last form is detached
+            auto current = iter++;
+            DetachSubscriberNolock(current, formId, record, releases);
+        }
+    }
+    ApplyReleases(releases);
+}
+
+size_t FormDataProxySubscriptionRegistry::GetSubscriptionCount()
+{
+    std::lock_guard<std::mutex> lock(subscriptionMutex_);
+    return subscriptions_.size();
+}
+
+int64_t FormDataProxySubscriptionRegistry::GetDecodeCount() const
+{
+    return decodeCount_.load(std::memory_order_relaxed);
+}
+
+std::string FormDataProxySubscriptionRegistry::DecodeRdbData(const std::vector<std::string> &data)
+{
+    nlohmann::json object = ParseRdbData(data);
+    return object.empty() ? "" : object.dump();
+}
+
+nlohmann::json FormDataProxySubscriptionRegistry::ParseRdbData(const std::vector<std::string> &data)
+{
+    nlohmann::json object;
+    for (const auto& iter : data) {
+        HILOG_DEBUG("iter: %{private}s.", iter.c_str());
+        nlohmann::json dataObject = nlohmann::json::parse(iter, nullptr, false);
+        if (dataObject.is_discarded()) {
+            HILOG_ERROR("fail parse data:%{public}s", iter.c_str());
+            continue;
+        }
+        object.merge_patch(dataObject);
+    }
+    return object;
+}
+
+void FormDataProxySubscriptionRegistry::DecodePublishedData(const std::vector<DataShare::PublishedDataItem> &data,
+    FormDataProxyChange &change)
+{
+    std::vector<size_t> indexes(data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        indexes[i] = i;
+    }
+    BuildPublishedDataChange(data, ParsePublishedData(data), indexes, change);
+}
+
+void FormDataProxySubscriptionRegistry::OnRdbDataChange(const std::vector<std::string> &uris, int64_t subscriberId,
+    const DataShare::RdbChangeNode &changeNode)
+{
+    HILOG_INFO("rdb change. data size is %{public}zu", changeNode.data_.size());
+    if (changeNode.data_.empty()) {
+        return;
+    }
+    std::map<const FormDataProxyRecord *, std::shared_ptr<FormDataProxyRecord>> records;
+    std::vector<SubscriptionKey> keys;
+    {
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        auto iter = subscriptions_.find({true, changeNode.uri_, subscriberId});
+        if (iter != subscriptions_.end()) {
+            CollectRecordsNolock(iter->second, records);
+            keys.emplace_back(iter->first);
+        } else {
+            for (const auto &uri : uris) {
+                iter = subscriptions_.find({true, uri, subscriberId});
+                if (iter != subscriptions_.end()) {
+                    CollectRecordsNolock(iter->second, records);
+                    keys.emplace_back(iter->first);
+                }
+            }
+        }
+    }
+    if (records.empty()) {
+        return;
+    }
+
+    decodeCount_.fetch_add(1, std::memory_order_relaxed);
+    nlohmann::json object = ParseRdbData(changeNode.data_);
+    std::string formDataStr = object.empty() ? "" : object.dump();
+    {
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        for (const auto &key : keys) {
+            auto iter = subscriptions_.find(key);
+            if (iter != subscriptions_.end()) {
+                iter->second.lastData = object;
+            }
+        }
+    }
+    std::vector<std::weak_ptr<FormDataProxyRecord>> weakRecords;
+    for (const auto &record : records) {
+        weakRecords.emplace_back(record.second);
+    }
+    std::function<void()> taskFunc = [weakRecords, formDataStr]() {
+        for (const auto &weak : weakRecords) {
+            auto formDataRecord = weak.lock();
+            if (formDataRecord != nullptr) {
+                formDataRecord->ApplyRdbDataChange(formDataStr);
+            }
+        }
+    };
+    if (!FormMgrQueue::GetInstance().ScheduleTask(0, taskFunc)) {
+        HILOG_ERROR("fail UpdateRdbDataForm.");
+    }
+}
+
+void FormDataProxySubscriptionRegistry::OnPublishedDataChange(const std::vector<std::string> &uris,
+    int64_t subscriberId, const DataShare::PublishedDataChangeNode &changeNode)
+{
+    HILOG_DEBUG("on published data change. data size is %{public}zu", changeNode.datas_.size());
+    const auto &data = changeNode.datas_;
+    // record: the indexes of the items it observes
+    std::map<const FormDataProxyRecord *, std::pair<std::shared_ptr<FormDataProxyRecord>, std::vector<size_t>>> targets;
+    // the subscriptions each item belongs to
+    std::vector<std::vector<SubscriptionKey>> itemKeys(data.size());
+    {
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        for (size_t i = 0; i < data.size(); i++) {
+            std::vector<std::map<SubscriptionKey, Subscription>::const_iterator> matched;
+            for (const auto &uri : uris) {
+                auto iter = subscriptions_.find({false, uri, subscriberId});
+                if (iter != subscriptions_.end() && (uri == data[i].key_ || GetDataKey(uri) == data[i].key_)) {
+                    matched.emplace_back(iter);
+                }
+            }
+            if (matched.empty()) {
+                for (const auto &uri : uris) {
+                    auto iter = subscriptions_.find({false, uri, subscriberId});
+                    if (iter != subscriptions_.end()) {
+                        matched.emplace_back(iter);
+                    }
+                }
+            }
+            std::map<const FormDataProxyRecord *, std::shared_ptr<FormDataProxyRecord>> records;
+            for (const auto &subscription : matched) {
+                CollectRecordsNolock(subscription->second, records);
+                itemKeys[i].emplace_back(subscription->first);
+            }
+            for (const auto &record : records) {
+                auto &target = targets[record.first];
+                target.first = record.second;
+                target.second.emplace_back(i);
+            }
+        }
+    }
+    if (targets.empty()) {
+        return;
+    }
+
+    decodeCount_.fetch_add(1, std::memory_order_relaxed);
+    std::vector<nlohmann::json> parsedData = ParsePublishedData(data);
+    {
+        // image items are only valid while the change is dispatched, they are not kept
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        for (size_t i = 0; i < data.size(); i++) {
+            if (data[i].key_.empty() || data[i].IsAshmem() || parsedData[i].is_discarded()) {
+                continue;
+            }
+            for (const auto &key : itemKeys[i]) {
+                auto iter = subscriptions_.find(key);
+                if (iter != subscriptions_.end()) {
+                    iter->second.lastData[data[i].key_] = parsedData[i];
+                }
+            }
+        }
+    }
+    // forms observing the same items share one decoded change
+    std::map<std::vector<size_t>, std::vector<std::shared_ptr<FormDataProxyRecord>>> groups;
+    for (auto &target : targets) {
+        groups[target.second.second].emplace_back(std::move(target.second.first));
+    }
+    for (const auto &group : groups) {
+        FormDataProxyChange change;
+        BuildPublishedDataChange(data, parsedData, group.first, change);
+        for (const auto &record : group.second) {
+            record->ApplyPublishedDataChange(change);
+        }
+    }
+}
+
+void FormDataProxySubscriptionRegistry::SendInitialData(bool isRdbType,
+    const std::shared_ptr<FormDataProxyRecord> &record, const nlohmann::json &data)
+{
+    if (data.empty()) {
+        return;
+    }
+    std::weak_ptr<FormDataProxyRecord> weakRecord = record;
+    std::function<void()> taskFunc = [weakRecord, isRdbType, data]() {
+        auto formDataRecord = weakRecord.lock();
+        if (formDataRecord == nullptr) {
+            return;
+        }
+        if (isRdbType) {
+            formDataRecord->ApplyRdbDataChange(data.dump());
+            return;
+        }
+        FormDataProxyChange change;
+        change.object = data;
+        change.formDataStr = data.dump();
+        for (const auto &item : data.items()) {
+            change.formDataKeys += change.formDataKeys.empty() ? item.key() : (", " + item.key());
+        }
+        formDataRecord->ApplyPublishedDataChange(change);
+    };
+    if (!FormMgrQueue::GetInstance().ScheduleTask(0, taskFunc)) {
+        HILOG_ERROR("fail send initial data");
+    }
+}
+
+void FormDataProxySubscriptionRegistry::CollectRecordsNolock(const Subscription &subscription,
+    std::map<const FormDataProxyRecord *, std::shared_ptr<FormDataProxyRecord>> &records) const
+{
+    for (const auto &subscriber : subscription.subscribers) {
+        auto record = subscriber.second.record.lock();
+        if (record != nullptr) {
+            records.emplace(record.get(), record);
+        }
+    }
+}
+
+void FormDataProxySubscriptionRegistry::DetachSubscriberNolock(std::map<SubscriptionKey, Subscription>::iterator iter,
+    int64_t formId, const FormDataProxyRecord *record, std::map<ReleaseKey, SubscriptionRelease> &releases)
+{
+    Subscription &subscription = iter->second;
+    auto subscriber = subscription.subscribers.find(formId);
+    if (subscriber == subscription.subscribers.end() || subscriber->second.recordPtr != record) {
+        return;
+    }
+    bool wasEnabled = IsSubscriptionEnabled(subscription);
+    subscription.subscribers.erase(subscriber);
+    const auto &[isRdbType, uri, subscriberId] = iter->first;
+    SubscriptionRelease &release = releases[{subscription.client.get(), isRdbType, subscriberId}];
+    release.client = subscription.client;
+    if (subscription.subscribers.empty()) {
+        release.unsubscribeUris.emplace_back(uri);
+        subscriptions_.erase(iter);
+    } else if (wasEnabled && !IsSubscriptionEnabled(subscription)) {
+        release.disableUris.emplace_back(uri);
+    }
+}
+
+void FormDataProxySubscriptionRegistry::ApplyReleases(const std::map<ReleaseKey, SubscriptionRelease> &releases)
+{
+    for (const auto &item : releases) {
+        const auto &[client, isRdbType, subscriberId] = item.first;
+        const SubscriptionRelease &release = item.second;
+        if (client == nullptr) {
+            continue;
+        }
+        if (!release.unsubscribeUris.empty()) {
+            release.client->Unsubscribe(isRdbType, release.unsubscribeUris, subscriberId);
+            HILOG_INFO("unsubscribe rdb:%{public}d, subscriberId:%{public}" PRId64 ", totalNum:%{public}zu",
+                isRdbType, subscriberId, release.unsubscribeUris.size());
+        }
+        if (!release.disableUris.empty()) {
+            release.client->SetSubsState(isRdbType, release.disableUris, subscriberId, false);
+        }
+    }
+}
+
+bool FormDataProxySubscriptionRegistry::IsSubscriptionEnabled(const Subscription &subscription)
+{
+    for (const auto &subscriber : subscription.subscribers) {
+        if (subscriber.second.isEnabled) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<nlohmann::json> FormDataProxySubscriptionRegistry::ParsePublishedData(
+    const std::vector<DataShare::PublishedDataItem> &data)
+{
+    std::vector<nlohmann::json> parsedData(data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        if (data[i].key_.empty() || data[i].IsAshmem()) {
+            continue;
+        }
+        const auto &value = std::get<std::string>(data[i].value_);
+        parsedData[i] = nlohmann::json::parse(value, nullptr, false);
+        if (parsedData[i].is_discarded()) {
+            HILOG_ERROR("fail parse data:%{public}s", value.c_str());
+        }
+    }
+    return parsedData;
+}
+
+void FormDataProxySubscriptionRegistry::BuildPublishedDataChange(
+    const std::vector<DataShare::PublishedDataItem> &data, const std::vector<nlohmann::json> &parsedData,
+    const std::vector<size_t> &indexes, FormDataProxyChange &change)
+{
+    for (size_t index : indexes) {
+        const auto &item = data[index];
+        if (item.key_.empty()) {
+            HILOG_ERROR("empty key");
+            continue;
+        }
+        if (item.IsAshmem()) {
+            change.imageItems.emplace_back(&item);
+            continue;
+        }
+        if (parsedData[index].is_discarded()) {
+            continue;
+        }
+        change.object[item.key_] = parsedData[index];
+        change.formDataKeys += change.formDataKeys.empty() ? item.key_ : (", " + item.key_);
+    }
+    if (change.imageItems.empty()) {
+        change.formDataStr = change.object.empty() ? "" : change.object.dump();
+    }
+}
+} // namespace AppExecFwk
+} // namespace OHOS
@@ -17,8 +17,10 @@
 
 #include "bms_mgr/form_bms_helper.h"
 #include "common/util/form_util.h"
+#include "data_center/database/form_binary_codec.h"
 #include "data_center/database/form_db_cache.h"
 #include "data_center/form_info/form_info_helper.h"
+#include "data_center/form_info/form_info_rdb_storage_mgr.h"
 #include "feature/bundle_distributed/form_distributed_mgr.h"
 #include "fms_log_wrapper.h"
 #include "form_mgr_errors.h"
@@ -37,13 +39,21 @@ BundleFormInfo::BundleFormInfo(const std::string &bundleName) : bundleName_(bund
 
 ErrCode BundleFormInfo::InitFromJson(const std::string &formInfoStoragesJson)
 {
-    nlohmann::json jsonObject = nlohmann::json::parse(formInfoStoragesJson, nullptr, false);
-    if (jsonObject.is_discarded() || !jsonObject.is_array()) {
-        HILOG_ERROR("bad profile");
-        return ERR_APPEXECFWK_PARSE_BAD_PROFILE;
+    std::vector<AAFwk::FormInfoStorage> formInfoStorages;
+    if (FormBinaryReader::IsBinary(formInfoStoragesJson)) {
+        if (!AAFwk::FormInfoStoragesFromBinary(formInfoStoragesJson, formInfoStorages)) {
+            HILOG_ERROR("bad binary form infos");
+            return ERR_APPEXECFWK_PARSE_BAD_PROFILE;
+        }
+    } else {
+        nlohmann::json jsonObject = nlohmann::json::parse(formInfoStoragesJson, nullptr, false);
+        if (jsonObject.is_discarded() || !jsonObject.is_array()) {
+            HILOG_ERROR("bad profile");
+            return ERR_APPEXECFWK_PARSE_BAD_PROFILE;
+        }
+        formInfoStorages = jsonObject.get<std::vector<AAFwk::FormInfoStorage>>();
     }
     std::unique_lock<std::shared_timed_mutex> guard(formInfosMutex_);
-    auto formInfoStorages = jsonObject.get<std::vector<AAFwk::FormInfoStorage>>();
     for (auto &parentItem : formInfoStorages) {
         for (auto &childItem : parentItem.formInfos) {
             bool isBundleDistributed =
@@ -63,6 +73,21 @@ ErrCode BundleFormInfo::UpdateStaticFormInfos(std::vector<FormInfo> &formInfos,
 {
     HILOG_INFO("userId is %{public}d", userId);
     std::unique_lock<std::shared_timed_mutex> guard(formInfosMutex_);
+    UpdateStaticFormInfosLocked(formInfos, userId);
+    return UpdateFormInfoStorageLocked();
+}
+
+ErrCode BundleFormInfo::UpdateStaticFormInfos(std::vector<FormInfo> &formInfos, int32_t userId,
+    FormRdbWriteBatch &batch)
+{
+    HILOG_INFO("userId is %{public}d", userId);
+    std::unique_lock<std::shared_timed_mutex> guard(formInfosMutex_);
+    UpdateStaticFormInfosLocked(formInfos, userId);
+    return UpdateFormInfoStorageLocked(batch);
+}
+
+void BundleFormInfo::UpdateStaticFormInfosLocked(std::vector<FormInfo> &formInfos, int32_t userId)
+{
     if (!formInfos.empty()) {
         std::vector<FormDBInfo> formDBInfos;
         std::vector<FormInfo> finalFormInfos;
@@ -79,7 +104,7 @@ ErrCode BundleFormInfo::UpdateStaticFormInfos(std::vector<FormInfo> &formInfos,
             HILOG_DEBUG("Add new userId, user:%{public}d", userId);
             formInfoStorages_.emplace_back(userId, finalFormInfos);
         }
-        return UpdateFormInfoStorageLocked();
+        return;
     }
 
     bool IsBundleDistributed = FormDistributedMgr::GetInstance().IsBundleDistributed(bundleName_, userId);
@@ -91,7 +116,6 @@ ErrCode BundleFormInfo::UpdateStaticFormInfos(std::vector<FormInfo> &formInfos,
         HILOG_INFO("clear normal app formInfos, bundleName: %{public}s", bundleName_.c_str());
         formInfoStorages_.clear();
     }
-    return UpdateFormInfoStorageLocked();
 }
 
 ErrCode BundleFormInfo::Remove(int32_t userId)
@@ -272,19 +296,41 @@ ErrCode BundleFormInfo::GetFormsInfoByFilter(
 
 ErrCode BundleFormInfo::UpdateFormInfoStorageLocked()
 {
-    ErrCode errCode;
     if (formInfoStorages_.empty()) {
-        errCode = FormInfoRdbStorageMgr::GetInstance().RemoveBundleFormInfos(bundleName_);
-    } else {
-        nlohmann::json jsonObject = formInfoStorages_;
-        if (jsonObject.is_discarded()) {
-            HILOG_ERROR("bad form infos");
-            return ERR_APPEXECFWK_PARSE_BAD_PROFILE;
-        }
-        std::string formInfoStoragesStr = jsonObject.dump(Constants::DUMP_INDENT);
-        errCode = FormInfoRdbStorageMgr::GetInstance().UpdateBundleFormInfos(bundleName_, formInfoStoragesStr);
+        return FormInfoRdbStorageMgr::GetInstance().RemoveBundleFormInfos(bundleName_);
+    }
+    std::string formInfoStoragesStr;
+    ErrCode errCode = SerializeFormInfoStorageLocked(formInfoStoragesStr);
+    if (errCode != ERR_OK) {
+        return errCode;
     }
-    return errCode;
+    return FormInfoRdbStorageMgr::GetInstance().UpdateBundleFormInfos(bundleName_, formInfoStoragesStr,
+        AAFwk::FormInfoStoragesToBinary(formInfoStorages_));
+}
+
+ErrCode BundleFormInfo::UpdateFormInfoStorageLocked(FormRdbWriteBatch &batch)
+{
+    if (formInfoStorages_.empty()) {
+        return FormInfoRdbStorageMgr::GetInstance().RemoveBundleFormInfos(bundleName_, batch);
+    }
+    std::string formInfoStoragesStr;
+    ErrCode errCode = SerializeFormInfoStorageLocked(formInfoStoragesStr);
+    if (errCode != ERR_OK) {
+        return errCode;
+    }
+    return FormInfoRdbStorageMgr::GetInstance().UpdateBundleFormInfos(bundleName_, formInfoStoragesStr,
+        AAFwk::FormInfoStoragesToBinary(formInfoStorages_), batch);
+}
+
+ErrCode BundleFormInfo::SerializeFormInfoStorageLocked(std::string &formInfoStoragesStr) const
+{
+    nlohmann::json jsonObject = formInfoStorages_;
+    if (jsonObject.is_discarded()) {
+        HILOG_ERROR("bad form infos");
+        return ERR_APPEXECFWK_PARSE_BAD_PROFILE;
+    }
+    formInfoStoragesStr = jsonObject.dump(Constants::DUMP_INDENT);
+    return ERR_OK;
 }
 
 void BundleFormInfo::HandleFormInfosMaxLimit(std::vector<FormInfo> &inFormInfos,
@@ -22,6 +22,7 @@
 #include "data_center/database/form_db_cache.h"
 #include "data_center/form_info/form_info_helper.h"
 #include "data_center/form_info/form_info_storage.h"
+#include "data_center/database/form_binary_codec.h"
 #include "data_center/form_info/form_info_rdb_storage_mgr.h"
 #include "feature/bundle_distributed/form_distributed_mgr.h"
 #include "form_mgr_errors.h"
@@ -62,6 +63,7 @@ ErrCode FormInfoMgr::LoadFormInfosFromDb()
     }
 
     std::unique_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
+    FormRdbWriteBatch migrateBatch;
     for (const auto &item: formInfoStorages) {
         const std::string &bundleName = item.first;
         const std::string &formInfoStoragesJson = item.second;
@@ -70,13 +72,33 @@ ErrCode FormInfoMgr::LoadFormInfosFromDb()
         if (errCode != ERR_OK) {
             continue;
         }
+        if (!FormBinaryReader::IsBinary(formInfoStoragesJson)) {
+            MigrateFormInfoStorages(bundleName, formInfoStoragesJson, migrateBatch);
+        }
         HILOG_INFO("load bundle %{public}s form infos success.", bundleName.c_str());
         bundleFormInfoMap_[bundleName] = bundleFormInfoPtr;
     }
+    if (!migrateBatch.IsEmpty()) {
+        HILOG_INFO("add binary format to %{public}zu bundle form infos", migrateBatch.Size());
+        FormInfoRdbStorageMgr::GetInstance().WriteBatch(migrateBatch);
+    }
+    queryIndex_.InvalidateAll();
     HILOG_INFO("load bundle form infos from db done");
     return ERR_OK;
 }
 
+void FormInfoMgr::MigrateFormInfoStorages(const std::string &bundleName, const std::string &formInfoStoragesJson,
+    FormRdbWriteBatch &batch)
+{
+    nlohmann::json jsonObject = nlohmann::json::parse(formInfoStoragesJson, nullptr, false);
+    if (jsonObject.is_discarded() || !jsonObject.is_array()) {
+        return;
+    }
+    auto formInfoStorages = jsonObject.get<std::vector<AAFwk::FormInfoStorage>>();
+    FormInfoRdbStorageMgr::GetInstance().UpdateBundleFormInfos(bundleName, formInfoStoragesJson,
+        AAFwk::FormInfoStoragesToBinary(formInfoStorages), batch);
+}
+
 ErrCode FormInfoMgr::Start()
 {
     // std::call_once guarantees Start() loads DB exactly once.
@@ -115,6 +137,7 @@ ErrCode FormInfoMgr::UpdateStaticFormInfos(const std::string &bundleName, int32_
         break;
     }
     errCode = bundleFormInfoPtr->UpdateStaticFormInfos(formInfos, userId);
+    queryIndex_.Invalidate(bundleName);
     if (errCode != ERR_OK) {
         HILOG_ERROR("UpdateStaticFormInfos failed!");
         return errCode;
@@ -148,6 +171,7 @@ ErrCode FormInfoMgr::Remove(const std::string &bundleName, int32_t userId)
     if (bundleFormInfoIter->second != nullptr) {
         errCode = bundleFormInfoIter->second->Remove(userId);
     }
+    queryIndex_.Invalidate(bundleName);
 
     if (bundleFormInfoIter->second && bundleFormInfoIter->second->Empty()) {
         bundleFormInfoMap_.erase(bundleFormInfoIter);
@@ -157,17 +181,21 @@ ErrCode FormInfoMgr::Remove(const std::string &bundleName, int32_t userId)
 }
 
 ErrCode FormInfoMgr::GetAllFormsInfo(std::vector<FormInfo> &formInfos, int32_t userId)
+{
+    FormInfosSnapshot snapshot;
+    ErrCode errCode = GetAllFormsInfo(snapshot, userId);
+    AppendFormInfos(snapshot, formInfos);
+    return errCode;
+}
+
+ErrCode FormInfoMgr::GetAllFormsInfo(FormInfosSnapshot &formInfos, int32_t userId)
 {
     if (!CheckBundlePermission()) {
         HILOG_ERROR("CheckBundlePermission is failed");
         return ERR_APPEXECFWK_FORM_PERMISSION_DENY_BUNDLE;
     }
     std::shared_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
-    for (const auto &bundleFormInfo : bundleFormInfoMap_) {
-        if (bundleFormInfo.second != nullptr) {
-            bundleFormInfo.second->GetAllFormsInfo(formInfos, userId);
-        }
-    }
+    formInfos = queryIndex_.GetAllFormsInfo(bundleFormInfoMap_, GetQueryUserId(userId), false);
     return ERR_OK;
 }
 
@@ -178,16 +206,21 @@ ErrCode FormInfoMgr::GetAllTemplateFormsInfo(std::vector<FormInfo> &formInfos, i
         return ERR_APPEXECFWK_FORM_PERMISSION_DENY_BUNDLE;
     }
     std::shared_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
-    for (const auto &bundleFormInfo : bundleFormInfoMap_) {
-        if (bundleFormInfo.second != nullptr) {
-            bundleFormInfo.second->GetAllTemplateFormsInfo(formInfos, userId);
-        }
-    }
+    AppendFormInfos(queryIndex_.GetAllFormsInfo(bundleFormInfoMap_, GetQueryUserId(userId), true), formInfos);
     return ERR_OK;
 }
 
 ErrCode FormInfoMgr::GetFormsInfoByFilter(
     const FormInfoFilter &filter, std::vector<FormInfo> &formInfos, int32_t userId)
+{
+    FormInfosSnapshot snapshot;
+    ErrCode errCode = GetFormsInfoByFilter(filter, snapshot, userId);
+    AppendFormInfos(snapshot, formInfos);
+    return errCode;
+}
+
+ErrCode FormInfoMgr::GetFormsInfoByFilter(
+    const FormInfoFilter &filter, FormInfosSnapshot &formInfos, int32_t userId)
 {
     if (!CheckBundlePermission()) {
         if (filter.bundleName.empty() || !IsCaller(filter.bundleName)) {
@@ -196,27 +229,25 @@ ErrCode FormInfoMgr::GetFormsInfoByFilter(
         }
     }
     std::shared_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
-    if (filter.bundleName.empty()) {
-        for (const auto &bundleFormInfo : bundleFormInfoMap_) {
-            if (bundleFormInfo.second != nullptr) {
-                bundleFormInfo.second->GetFormsInfoByFilter(filter, formInfos, userId);
-            }
-        }
-    } else {
-        auto bundleFormInfoIter = bundleFormInfoMap_.find(filter.bundleName);
-        if (bundleFormInfoIter == bundleFormInfoMap_.end()) {
-            HILOG_WARN("no forms found for bundle name:%{public}s", filter.bundleName.c_str());
-            return ERR_OK;
-        }
-        if (bundleFormInfoIter->second != nullptr) {
-            bundleFormInfoIter->second->GetFormsInfoByFilter(filter, formInfos, userId);
-        }
+    if (!filter.bundleName.empty() && bundleFormInfoMap_.find(filter.bundleName) == bundleFormInfoMap_.end()) {
+        HILOG_WARN("no forms found for bundle name:%{public}s", filter.bundleName.c_str());
+        return ERR_OK;
     }
+    formInfos = queryIndex_.GetFormsInfoByFilter(bundleFormInfoMap_, filter, GetQueryUserId(userId));
     return ERR_OK;
 }
 
 ErrCode FormInfoMgr::GetFormsInfoByBundle(
     const std::string &bundleName, std::vector<FormInfo> &formInfos, int32_t userId)
+{
+    FormInfosSnapshot snapshot;
+    ErrCode errCode = GetFormsInfoByBundle(bundleName, snapshot, userId);
+    AppendFormInfos(snapshot, formInfos);
+    return errCode;
+}
+
+ErrCode FormInfoMgr::GetFormsInfoByBundle(
+    const std::string &bundleName, FormInfosSnapshot &formInfos, int32_t userId)
 {
     if (bundleName.empty()) {
         HILOG_ERROR("empty bundleName");
@@ -227,17 +258,11 @@ ErrCode FormInfoMgr::GetFormsInfoByBundle(
         return ERR_APPEXECFWK_FORM_PERMISSION_DENY_BUNDLE;
     }
 
-    std::shared_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
-    auto bundleFormInfoIter = bundleFormInfoMap_.find(bundleName);
-    if (bundleFormInfoIter == bundleFormInfoMap_.end()) {
+    ErrCode errCode = GetBundleFormsInfo(bundleName, "", false, formInfos, userId);
+    if (errCode != ERR_OK) {
         HILOG_DEBUG("no forms found");
-        return ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED;
     }
-
-    if (bundleFormInfoIter->second != nullptr) {
-        bundleFormInfoIter->second->GetAllFormsInfo(formInfos, userId);
-    }
-    return ERR_OK;
+    return errCode;
 }
 
 ErrCode FormInfoMgr::GetTemplateFormsInfoByBundle(
@@ -252,21 +277,27 @@ ErrCode FormInfoMgr::GetTemplateFormsInfoByBundle(
         return ERR_APPEXECFWK_FORM_PERMISSION_DENY_BUNDLE;
     }
 
-    std::shared_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
-    auto bundleFormInfoIter = bundleFormInfoMap_.find(bundleName);
-    if (bundleFormInfoIter == bundleFormInfoMap_.end()) {
+    FormInfosSnapshot snapshot;
+    ErrCode errCode = GetBundleFormsInfo(bundleName, "", true, snapshot, userId);
+    if (errCode != ERR_OK) {
         HILOG_ERROR("no forms found");
-        return ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED;
-    }
-
-    if (bundleFormInfoIter->second != nullptr) {
-        bundleFormInfoIter->second->GetAllTemplateFormsInfo(formInfos, userId);
+        return errCode;
     }
+    AppendFormInfos(snapshot, formInfos);
     return ERR_OK;
 }
 
 ErrCode FormInfoMgr::GetFormsInfoByModule(const std::string &bundleName, const std::string &moduleName,
     std::vector<FormInfo> &formInfos, int32_t userId)
+{
+    FormInfosSnapshot snapshot;
+    ErrCode errCode = GetFormsInfoByModule(bundleName, moduleName, snapshot, userId);
+    AppendFormInfos(snapshot, formInfos);
+    return errCode;
+}
+
+ErrCode FormInfoMgr::GetFormsInfoByModule(const std::string &bundleName, const std::string &moduleName,
+    FormInfosSnapshot &formInfos, int32_t userId)
 {
     if (bundleName.empty()) {
         HILOG_ERROR("empty bundleName");
@@ -278,7 +309,11 @@ ErrCode FormInfoMgr::GetFormsInfoByModule(const std::string &bundleName, const s
         return ERR_APPEXECFWK_FORM_PERMISSION_DENY_BUNDLE;
     }
 
-    return GetFormsInfoByModuleWithoutCheck(bundleName, moduleName, formInfos, userId);
+    ErrCode errCode = GetBundleFormsInfo(bundleName, moduleName, false, formInfos, userId);
+    if (errCode != ERR_OK) {
+        HILOG_ERROR("no forms found for %{public}s", bundleName.c_str());
+    }
+    return errCode;
 }
 
 ErrCode FormInfoMgr::GetTemplateFormsInfoByModule(const std::string &bundleName, const std::string &moduleName,
@@ -305,16 +340,13 @@ ErrCode FormInfoMgr::GetFormsInfoByModuleWithoutCheck(const std::string &bundleN
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
     }
 
-    std::shared_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
-    auto bundleFormInfoIter = bundleFormInfoMap_.find(bundleName);
-    if (bundleFormInfoIter == bundleFormInfoMap_.end()) {
+    FormInfosSnapshot snapshot;
+    ErrCode errCode = GetBundleFormsInfo(bundleName, moduleName, false, snapshot, userId);
+    if (errCode != ERR_OK) {
         HILOG_ERROR("no forms found for %{public}s", bundleName.c_str());
-        return ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED;
-    }
-
-    if (bundleFormInfoIter->second != nullptr) {
-        bundleFormInfoIter->second->GetFormsInfoByModule(moduleName, formInfos, userId);
+        return errCode;
     }
+    AppendFormInfos(snapshot, formInfos);
     return ERR_OK;
 }
 
@@ -326,38 +358,26 @@ ErrCode FormInfoMgr::GetTemplateFormsInfoByModuleWithoutCheck(const std::string
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
     }
 
-    std::shared_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
-    auto bundleFormInfoIter = bundleFormInfoMap_.find(bundleName);
-    if (bundleFormInfoIter == bundleFormInfoMap_.end()) {
+    FormInfosSnapshot snapshot;
+    ErrCode errCode = GetBundleFormsInfo(bundleName, moduleName, true, snapshot, userId);
+    if (errCode != ERR_OK) {
         HILOG_ERROR("no forms found for %{public}s", bundleName.c_str());
-        return ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED;
-    }
-
-    if (bundleFormInfoIter->second != nullptr) {
-        bundleFormInfoIter->second->GetTemplateFormsInfoByModule(moduleName, formInfos, userId);
+        return errCode;
     }
+    AppendFormInfos(snapshot, formInfos);
     return ERR_OK;
 }
 
 ErrCode FormInfoMgr::GetFormsInfoByRecord(const FormRecord &formRecord, FormInfo &formInfo)
 {
-    std::vector<FormInfo> formInfos;
-    {
-        std::shared_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
-        auto bundleFormInfoIter = bundleFormInfoMap_.find(formRecord.bundleName);
-        if (bundleFormInfoIter == bundleFormInfoMap_.end()) {
-            HILOG_ERROR("no forms found for %{public}s", formRecord.bundleName.c_str());
-            return ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED;
-        }
-
-        if (bundleFormInfoIter->second == nullptr) {
-            HILOG_ERROR("null BundleFormInfo");
-            return ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED;
-        }
-
-        bundleFormInfoIter->second->GetFormsInfoByModule(formRecord.moduleName, formInfos, formRecord.userId);
+    FormInfosSnapshot formInfos;
+    ErrCode errCode = GetBundleFormsInfo(formRecord.bundleName, formRecord.moduleName, false, formInfos,
+        formRecord.userId);
+    if (errCode != ERR_OK || formInfos == nullptr) {
+        HILOG_ERROR("no forms found for %{public}s", formRecord.bundleName.c_str());
+        return ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED;
     }
-    for (const FormInfo &info : formInfos) {
+    for (const FormInfo &info : *formInfos) {
         if (info.name == formRecord.formName) {
             formInfo = info;
             break;
@@ -366,6 +386,31 @@ ErrCode FormInfoMgr::GetFormsInfoByRecord(const FormRecord &formRecord, FormInfo
     return formInfo.name.empty() ? ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED : ERR_OK;
 }
 
+ErrCode FormInfoMgr::GetBundleFormsInfo(const std::string &bundleName, const std::string &moduleName,
+    bool isTemplate, FormInfosSnapshot &formInfos, int32_t userId)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
+    auto bundleFormInfoIter = bundleFormInfoMap_.find(bundleName);
+    if (bundleFormInfoIter == bundleFormInfoMap_.end()) {
+        return ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED;
+    }
+    formInfos = queryIndex_.GetFormsInfo(bundleFormInfoIter->second, bundleName, moduleName,
+        GetQueryUserId(userId), isTemplate);
+    return ERR_OK;
+}
+
+int32_t FormInfoMgr::GetQueryUserId(int32_t userId)
+{
+    return (userId == Constants::INVALID_USER_ID) ? FormUtil::GetCurrentAccountId() : userId;
+}
+
+void FormInfoMgr::AppendFormInfos(const FormInfosSnapshot &snapshot, std::vector<FormInfo> &formInfos)
+{
+    if (snapshot != nullptr) {
+        formInfos.insert(formInfos.end(), snapshot->begin(), snapshot->end());
+    }
+}
+
 ErrCode FormInfoMgr::CheckDynamicFormInfo(FormInfo &formInfo, const BundleInfo &bundleInfo)
 {
     for (auto &moduleInfo : bundleInfo.hapModuleInfos) {
@@ -418,7 +463,9 @@ ErrCode FormInfoMgr::AddDynamicFormInfo(FormInfo &formInfo, int32_t userId)
         bundleFormInfoPtr = std::make_shared<BundleFormInfo>(formInfo.bundleName);
     }
 
-    return bundleFormInfoPtr->AddDynamicFormInfo(formInfo, userId);
+    errCode = bundleFormInfoPtr->AddDynamicFormInfo(formInfo, userId);
+    queryIndex_.Invalidate(formInfo.bundleName);
+    return errCode;
 }
 
 ErrCode FormInfoMgr::RemoveDynamicFormInfo(const std::string &bundleName, const std::string &moduleName,
@@ -431,7 +478,9 @@ ErrCode FormInfoMgr::RemoveDynamicFormInfo(const std::string &bundleName, const
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
     }
 
-    return bundleFormInfoIter->second->RemoveDynamicFormInfo(moduleName, formName, userId);
+    ErrCode errCode = bundleFormInfoIter->second->RemoveDynamicFormInfo(moduleName, formName, userId);
+    queryIndex_.Invalidate(bundleName);
+    return errCode;
 }
 
 ErrCode FormInfoMgr::RemoveAllDynamicFormsInfo(const std::string &bundleName, int32_t userId)
@@ -443,7 +492,9 @@ ErrCode FormInfoMgr::RemoveAllDynamicFormsInfo(const std::string &bundleName, in
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
     }
 
-    return bundleFormInfoIter->second->RemoveAllDynamicFormsInfo(userId);
+    ErrCode errCode = bundleFormInfoIter->second->RemoveAllDynamicFormsInfo(userId);
+    queryIndex_.Invalidate(bundleName);
+    return errCode;
 }
 
 std::shared_ptr<BundleFormInfo> FormInfoMgr::GetOrCreateBundleFromInfo(const std::string &bundleName)
@@ -517,10 +568,17 @@ ErrCode FormInfoMgr::ReloadFormInfos(const int32_t userId)
     }
     {
         std::unique_lock<std::shared_timed_mutex> guard(bundleFormInfoMapMutex_);
-        UpdateBundleFormInfos(bundleVersionMap, userId);
-        AddBundleFormInfos(bundleVersionMap, userId);
+        FormRdbWriteBatch batch;
+        UpdateBundleFormInfos(bundleVersionMap, userId, batch);
+        AddBundleFormInfos(bundleVersionMap, userId, batch);
+        result = FormInfoRdbStorageMgr::GetInstance().WriteBatch(batch);
         HILOG_INFO("end, formInfoMapSize:%{public}zu", bundleFormInfoMap_.size());
     }
+    if (result != ERR_OK) {
+        // Not recorded as reloaded, so the next user switch or boot reloads this user again.
+        HILOG_ERROR("save form infos failed, userId:%{public}d", userId);
+        return result;
+    }
     {
         std::unique_lock<std::shared_mutex> lock(reloadUserIdsMutex_);
         reloadUserIds_.insert(userId);
@@ -590,6 +648,14 @@ ErrCode FormInfoMgr::GetBundleVersionMap(std::map<std::string, std::uint32_t> &b
 }
 
 void FormInfoMgr::UpdateBundleFormInfos(std::map<std::string, std::uint32_t> &bundleVersionMap, int32_t userId)
+{
+    FormRdbWriteBatch batch;
+    UpdateBundleFormInfos(bundleVersionMap, userId, batch);
+    FormInfoRdbStorageMgr::GetInstance().WriteBatch(batch);
+}
+
+void FormInfoMgr::UpdateBundleFormInfos(std::map<std::string, std::uint32_t> &bundleVersionMap, int32_t userId,
+    FormRdbWriteBatch &batch)
 {
     std::string versionCode;
     FormInfoRdbStorageMgr::GetInstance().GetFormVersionCode(versionCode);
@@ -610,14 +676,15 @@ void FormInfoMgr::UpdateBundleFormInfos(std::map<std::string, std::uint32_t> &bu
             std::vector<FormInfo> formInfos = formInfoPair.second;
             auto bundleFormInfoIter = bundleFormInfoMap_.find(bundleName);
             if (bundleFormInfoIter != bundleFormInfoMap_.end()) {
-                bundleFormInfoIter->second->UpdateStaticFormInfos(formInfos, userId);
+                bundleFormInfoIter->second->UpdateStaticFormInfos(formInfos, userId, batch);
                 HILOG_INFO("update forms info success, bundleName=%{public}s", bundleName.c_str());
             }
         }
     }
     if (isNeedUpdateAll) {
-        FormInfoRdbStorageMgr::GetInstance().UpdateFormVersionCode();
+        FormInfoRdbStorageMgr::GetInstance().UpdateFormVersionCode(batch);
     }
+    queryIndex_.InvalidateAll();
 }
 
 ErrCode FormInfoMgr::GetAppFormVisibleNotifyByBundleName(const std::string &bundleName,
@@ -682,6 +749,14 @@ bool FormInfoMgr::IsDeleteCacheInUpgradeScene(const FormInfo &formInfo)
 
 void FormInfoMgr::AddBundleFormInfos(
     const std::map<std::string, std::uint32_t>& bundleVersionMap, int32_t userId)
+{
+    FormRdbWriteBatch batch;
+    AddBundleFormInfos(bundleVersionMap, userId, batch);
+    FormInfoRdbStorageMgr::GetInstance().WriteBatch(batch);
+}
+
+void FormInfoMgr::AddBundleFormInfos(
+    const std::map<std::string, std::uint32_t>& bundleVersionMap, int32_t userId, FormRdbWriteBatch &batch)
 {
     if (bundleVersionMap.empty()) {
         return;
@@ -704,7 +779,7 @@ void FormInfoMgr::AddBundleFormInfos(
         std::vector<FormInfo> formInfos = formInfoPair.second;
  
         std::shared_ptr<BundleFormInfo> bundleFormInfoPtr = std::make_shared<BundleFormInfo>(bundleName);
-        errCode = bundleFormInfoPtr->UpdateStaticFormInfos(formInfos, userId);
+        errCode = bundleFormInfoPtr->UpdateStaticFormInfos(formInfos, userId, batch);
         if (errCode != ERR_OK || bundleFormInfoPtr->Empty()) {
             continue;
         }
@@ -712,6 +787,7 @@ void FormInfoMgr::AddBundleFormInfos(
         bundleFormInfoMap_[bundleName] = bundleFormInfoPtr;
         HILOG_INFO("add forms info success, bundleName=%{public}s", bundleName.c_str());
     }
+    queryIndex_.InvalidateAll();
 }
 
 void FormInfoMgr::ProcessBundleVersionMap(bool isNeedUpdateAll, int32_t userId,
@@ -760,6 +836,7 @@ void FormInfoMgr::UpdateFormShowConfigs(const std::vector<FormCustomConfig> &con
         }
         iter->second->UpdateFormShowConfigs(bundleConfigs);
     }
+    queryIndex_.InvalidateAll();
 }
 }  // namespace AppExecFwk
 }  // namespace OHOS
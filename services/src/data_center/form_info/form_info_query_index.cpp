@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_center/form_info/form_info_query_index.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+constexpr size_t MAX_FILTER_RESULT_COUNT = 128;
+constexpr char FILTER_KEY_DELIMITER = '|';
+
+const FormInfosSnapshot &GetEmptySnapshot()
+{
+    static const FormInfosSnapshot emptySnapshot = std::make_shared<const std::vector<FormInfo>>();
+    return emptySnapshot;
+}
+
+void GroupByModule(const std::vector<FormInfo> &formInfos,
+    std::unordered_map<std::string, FormInfosSnapshot> &moduleFormInfos)
+{
+    std::unordered_map<std::string, std::vector<FormInfo>> modules;
+    for (const auto &formInfo : formInfos) {
+        modules[formInfo.moduleName].push_back(formInfo);
+    }
+    for (auto &module : modules) {
+        moduleFormInfos.emplace(module.first, std::make_shared<const std::vector<FormInfo>>(std::move(module.second)));
+    }
+}
+}  // namespace
+
+FormInfosSnapshot FormInfoQueryIndex::GetFormsInfo(const std::shared_ptr<BundleFormInfo> &bundleFormInfo,
+    const std::string &bundleName, const std::string &moduleName, int32_t userId, bool isTemplate)
+{
+    if (bundleFormInfo == nullptr) {
+        return nullptr;
+    }
+    auto bundleIndex = GetBundleIndex(bundleFormInfo, bundleName, userId);
+    if (moduleName.empty()) {
+        return isTemplate ? bundleIndex->templateFormInfos : bundleIndex->formInfos;
+    }
+    const auto &moduleFormInfos = isTemplate ? bundleIndex->moduleTemplateFormInfos : bundleIndex->moduleFormInfos;
+    auto iter = moduleFormInfos.find(moduleName);
+    return iter == moduleFormInfos.end() ? GetEmptySnapshot() : iter->second;
+}
+
+FormInfosSnapshot FormInfoQueryIndex::GetAllFormsInfo(const BundleFormInfoMap &bundleFormInfoMap, int32_t userId,
+    bool isTemplate)
+{
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(indexMutex_);
+        auto &allFormInfos = isTemplate ? allTemplateFormInfos_ : allFormInfos_;
+        auto iter = allFormInfos.find(userId);
+        if (iter != allFormInfos.end()) {
+            return iter->second;
+        }
+        generation = generation_;
+    }
+
+    auto formInfos = std::make_shared<std::vector<FormInfo>>();
+    for (const auto &bundleFormInfo : bundleFormInfoMap) {
+        auto bundleFormInfos = GetFormsInfo(bundleFormInfo.second, bundleFormInfo.first, "", userId, isTemplate);
+        if (bundleFormInfos != nullptr) {
+            formInfos->insert(formInfos->end(), bundleFormInfos->begin(), bundleFormInfos->end());
+        }
+    }
+    FormInfosSnapshot snapshot = std::move(formInfos);
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    if (generation == generation_) {
+        (isTemplate ? allTemplateFormInfos_ : allFormInfos_)[userId] = snapshot;
+    }
+    return snapshot;
+}
+
+FormInfosSnapshot FormInfoQueryIndex::GetFormsInfoByFilter(const BundleFormInfoMap &bundleFormInfoMap,
+    const FormInfoFilter &filter, int32_t userId)
+{
+    std::string filterKey = GetFilterKey(filter, userId);
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(indexMutex_);
+        auto iter = filterFormInfos_.find(filterKey);
+        if (iter != filterFormInfos_.end()) {
+            return iter->second;
+        }
+        generation = generation_;
+    }
+
+    auto formInfos = std::make_shared<std::vector<FormInfo>>();
+    if (filter.bundleName.empty()) {
+        for (const auto &bundleFormInfo : bundleFormInfoMap) {
+            if (bundleFormInfo.second != nullptr) {
+                bundleFormInfo.second->GetFormsInfoByFilter(filter, *formInfos, userId);
+            }
+        }
+    } else {
+        auto iter = bundleFormInfoMap.find(filter.bundleName);
+        if (iter != bundleFormInfoMap.end() && iter->second != nullptr) {
+            iter->second->GetFormsInfoByFilter(filter, *formInfos, userId);
+        }
+    }
+    FormInfosSnapshot snapshot = std::move(formInfos);
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    if (generation == generation_) {
+        if (filterFormInfos_.size() >= MAX_FILTER_RESULT_COUNT) {
+            filterFormInfos_.clear();
+        }
+        filterFormInfos_[filterKey] = snapshot;
+    }
+    return snapshot;
+}
+
+void FormInfoQueryIndex::Invalidate(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    generation_++;
+    bundleIndex_.erase(bundleName);
+    // results across bundles may contain the bundle
+    allFormInfos_.clear();
+    allTemplateFormInfos_.clear();
+    filterFormInfos_.clear();
+}
+
+void FormInfoQueryIndex::InvalidateAll()
+{
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    generation_++;
+    bundleIndex_.clear();
+    allFormInfos_.clear();
+    allTemplateFormInfos_.clear();
+    filterFormInfos_.clear();
+}
+
+int64_t FormInfoQueryIndex::GetBuildCount() const
+{
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    return buildCount_;
+}
+
+std::shared_ptr<const FormInfoQueryIndex::BundleIndex> FormInfoQueryIndex::GetBundleIndex(
+    const std::shared_ptr<BundleFormInfo> &bundleFormInfo, const std::string &bundleName, int32_t userId)
+{
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(indexMutex_);
+        auto bundleIter = bundleIndex_.find(bundleName);
+        if (bundleIter != bundleIndex_.end()) {
+            auto userIter = bundleIter->second.find(userId);
+            if (userIter != bundleIter->second.end()) {
+                return userIter->second;
+            }
+        }
+        generation = generation_;
+    }
+
+    auto bundleIndex = BuildBundleIndex(*bundleFormInfo, userId);
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    buildCount_++;
+    if (generation == generation_) {
+        bundleIndex_[bundleName][userId] = bundleIndex;
+    }
+    return bundleIndex;
+}
+
+std::shared_ptr<const FormInfoQueryIndex::BundleIndex> FormInfoQueryIndex::BuildBundleIndex(
+    BundleFormInfo &bundleFormInfo, int32_t userId)
+{
+    std::vector<FormInfo> formInfos;
+    bundleFormInfo.GetAllFormsInfo(formInfos, userId);
+    std::vector<FormInfo> templateFormInfos;
+    bundleFormInfo.GetAllTemplateFormsInfo(templateFormInfos, userId);
+
+    auto bundleIndex = std::make_shared<BundleIndex>();
+    GroupByModule(formInfos, bundleIndex->moduleFormInfos);
+    GroupByModule(templateFormInfos, bundleIndex->moduleTemplateFormInfos);
+    bundleIndex->formInfos = std::make_shared<const std::vector<FormInfo>>(std::move(formInfos));
+    bundleIndex->templateFormInfos = std::make_shared<const std::vector<FormInfo>>(std::move(templateFormInfos));
+    return bundleIndex;
+}
+
+std::string FormInfoQueryIndex::GetFilterKey(const FormInfoFilter &filter, int32_t userId)
+{
+    std::string filterKey = std::to_string(userId) + FILTER_KEY_DELIMITER + filter.bundleName +
+        FILTER_KEY_DELIMITER + filter.moduleName + FILTER_KEY_DELIMITER;
+    for (int32_t dimension : filter.supportDimensions) {
+        filterKey += std::to_string(dimension) + ",";
+    }
+    filterKey += FILTER_KEY_DELIMITER;
+    for (int32_t shape : filter.supportShapes) {
+        filterKey += std::to_string(shape) + ",";
+    }
+    return filterKey;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
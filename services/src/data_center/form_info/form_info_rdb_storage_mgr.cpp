@@ -15,9 +15,14 @@
 
 #include "data_center/form_info/form_info_rdb_storage_mgr.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <thread>
 #include <unistd.h>
+#include <unordered_set>
+#include "common/util/form_util.h"
+#include "data_center/database/form_binary_codec.h"
+#include "ffrt.h"
 #include "fms_log_wrapper.h"
 #include "form_constants.h"
 #include "form_event_report.h"
@@ -32,6 +37,45 @@ constexpr const char *FORM_ID_PREFIX = "formId_";
 constexpr const char *STATUS_DATA_PREFIX = "statusData_";
 constexpr const char *FORM_VERSION_KEY = "versionCode_form";
 constexpr char MULTI_APP_FORM_VERSION_PREFIX[] = "versionCode_multiAppForm_";
+constexpr size_t PARSE_ENTRIES_PER_TASK = 256;
+constexpr size_t MAX_PARSE_TASK_NUM = 4;
+
+using FormEntry = std::pair<const std::string, std::string>;
+
+struct ParsedFormEntries {
+    std::vector<InnerFormInfo> innerFormInfos;
+    std::vector<std::string> errorKeys;
+    // <index of the parsed form, key the row was read under>
+    std::vector<std::pair<size_t, std::string>> legacyEntries;
+};
+
+bool ParseFormEntry(const std::string &value, InnerFormInfo &innerFormInfo, bool &isLegacy)
+{
+    isLegacy = !FormBinaryReader::IsBinary(value);
+    if (!isLegacy) {
+        return innerFormInfo.FromBinary(value);
+    }
+    nlohmann::json jsonObject = nlohmann::json::parse(value, nullptr, false);
+    return !jsonObject.is_discarded() && innerFormInfo.FromJson(jsonObject);
+}
+
+void ParseFormEntries(const std::vector<const FormEntry *> &entries, size_t begin, size_t end,
+    ParsedFormEntries &result)
+{
+    result.innerFormInfos.reserve(end - begin);
+    for (size_t i = begin; i < end; i++) {
+        InnerFormInfo innerFormInfo;
+        bool isLegacy = false;
+        if (!ParseFormEntry(entries[i]->second, innerFormInfo, isLegacy)) {
+            result.errorKeys.emplace_back(entries[i]->first);
+            continue;
+        }
+        if (isLegacy) {
+            result.legacyEntries.emplace_back(result.innerFormInfos.size(), entries[i]->first);
+        }
+        result.innerFormInfos.emplace_back(std::move(innerFormInfo));
+    }
+}
 } // namespace
 
 FormInfoRdbStorageMgr::FormInfoRdbStorageMgr()
@@ -105,28 +149,128 @@ ErrCode FormInfoRdbStorageMgr::UpdateBundleFormInfos(const std::string &bundleNa
     return ERR_OK;
 }
 
+ErrCode FormInfoRdbStorageMgr::UpdateBundleFormInfos(const std::string &bundleName,
+    const std::string &formInfoStorages, const std::vector<uint8_t> &binaryFormInfoStorages)
+{
+    if (bundleName.empty()) {
+        HILOG_ERROR("empty bundleName");
+        return ERR_APPEXECFWK_FORM_INVALID_PARAM;
+    }
+
+    HILOG_DEBUG("FormInfoRdbStorageMgr update form info, bundleName=%{public}s", bundleName.c_str());
+    std::string key = std::string().append(FORM_INFO_PREFIX).append(bundleName);
+    ErrCode result = FormRdbDataMgr::GetInstance().InsertData(Constants::FORM_RDB_TABLE_NAME, key, formInfoStorages,
+        binaryFormInfoStorages);
+    if (result != ERR_OK) {
+        HILOG_ERROR("update formInfoStorages to rdbStore error");
+        return ERR_APPEXECFWK_FORM_COMMON_CODE;
+    }
+    return ERR_OK;
+}
+
+ErrCode FormInfoRdbStorageMgr::RemoveBundleFormInfos(const std::string &bundleName, FormRdbWriteBatch &batch)
+{
+    if (bundleName.empty()) {
+        HILOG_ERROR("empty bundleName");
+        return ERR_APPEXECFWK_FORM_INVALID_PARAM;
+    }
+
+    std::string key = std::string().append(FORM_INFO_PREFIX).append(bundleName);
+    batch.Delete(Constants::FORM_RDB_TABLE_NAME, key);
+    return ERR_OK;
+}
+
+ErrCode FormInfoRdbStorageMgr::UpdateBundleFormInfos(const std::string &bundleName,
+    const std::string &formInfoStorages, FormRdbWriteBatch &batch)
+{
+    if (bundleName.empty()) {
+        HILOG_ERROR("empty bundleName");
+        return ERR_APPEXECFWK_FORM_INVALID_PARAM;
+    }
+
+    std::string key = std::string().append(FORM_INFO_PREFIX).append(bundleName);
+    batch.Put(Constants::FORM_RDB_TABLE_NAME, key, formInfoStorages);
+    return ERR_OK;
+}
+
+ErrCode FormInfoRdbStorageMgr::UpdateBundleFormInfos(const std::string &bundleName,
+    const std::string &formInfoStorages, const std::vector<uint8_t> &binaryFormInfoStorages, FormRdbWriteBatch &batch)
+{
+    if (bundleName.empty()) {
+        HILOG_ERROR("empty bundleName");
+        return ERR_APPEXECFWK_FORM_INVALID_PARAM;
+    }
+
+    std::string key = std::string().append(FORM_INFO_PREFIX).append(bundleName);
+    batch.Put(Constants::FORM_RDB_TABLE_NAME, key, formInfoStorages, binaryFormInfoStorages);
+    return ERR_OK;
+}
+
 void FormInfoRdbStorageMgr::SaveEntries(
     const std::unordered_map<std::string, std::string> &value, std::vector<InnerFormInfo> &innerFormInfos)
 {
+    std::vector<const FormEntry *> entries;
+    entries.reserve(value.size());
     for (const auto &item : value) {
-        InnerFormInfo innerFormInfo;
-        nlohmann::json jsonObject = nlohmann::json::parse(item.second, nullptr, false);
-        if (jsonObject.is_discarded() || innerFormInfo.FromJson(jsonObject) != true) {
-            HILOG_ERROR("error key: %{private}s", item.first.c_str());
-            FormRdbDataMgr::GetInstance().DeleteData(Constants::FORM_RDB_TABLE_NAME, item.first);
-            continue;
+        entries.emplace_back(&item);
+    }
+
+    // Decoding dominates startup loading, split it into contiguous chunks parsed by concurrent tasks.
+    size_t taskNum = std::min(MAX_PARSE_TASK_NUM, entries.size() / PARSE_ENTRIES_PER_TASK + 1);
+    size_t chunkSize = (entries.size() + taskNum - 1) / taskNum;
+    std::vector<ParsedFormEntries> results(taskNum);
+    if (taskNum == 1) {
+        ParseFormEntries(entries, 0, entries.size(), results[0]);
+    } else {
+        for (size_t i = 0; i < taskNum; i++) {
+            size_t begin = i * chunkSize;
+            size_t end = std::min(begin + chunkSize, entries.size());
+            ffrt::submit([&entries, &results, i, begin, end]() {
+                ParseFormEntries(entries, begin, end, results[i]);
+            });
         }
+        ffrt::wait();
+    }
 
-        if (std::find(innerFormInfos.begin(), innerFormInfos.end(), innerFormInfo) == innerFormInfos.end()) {
-            innerFormInfos.emplace_back(innerFormInfo);
+    std::unordered_set<int64_t> formIds;
+    formIds.reserve(innerFormInfos.size() + entries.size());
+    for (const auto &innerFormInfo : innerFormInfos) {
+        formIds.emplace(innerFormInfo.GetFormId());
+    }
+    innerFormInfos.reserve(innerFormInfos.size() + entries.size());
+    // Bad rows are dropped and json only rows get their binary encoding, in one transaction.
+    FormRdbWriteBatch fixBatch;
+    for (auto &result : results) {
+        for (const auto &[legacyIndex, legacyKey] : result.legacyEntries) {
+            const InnerFormInfo &innerFormInfo = result.innerFormInfos[legacyIndex];
+            std::string key = std::string().append(FORM_ID_PREFIX).append(std::to_string(innerFormInfo.GetFormId()));
+            if (key != legacyKey) {
+                // the form is looked up by its form id, move the row instead of leaving the old one behind
+                HILOG_WARN("migrate key: %{private}s", legacyKey.c_str());
+                fixBatch.Delete(Constants::FORM_RDB_TABLE_NAME, legacyKey);
+            }
+            fixBatch.Put(Constants::FORM_RDB_TABLE_NAME, key, innerFormInfo.ToString(), innerFormInfo.ToBinary());
+        }
+        for (auto &innerFormInfo : result.innerFormInfos) {
+            if (formIds.emplace(innerFormInfo.GetFormId()).second) {
+                innerFormInfos.emplace_back(std::move(innerFormInfo));
+            }
         }
+        for (const auto &key : result.errorKeys) {
+            HILOG_ERROR("error key: %{private}s", key.c_str());
+            fixBatch.Delete(Constants::FORM_RDB_TABLE_NAME, key);
+        }
+    }
+    if (!fixBatch.IsEmpty()) {
+        FormRdbDataMgr::GetInstance().WriteBatch(fixBatch);
     }
-    HILOG_DEBUG("SaveEntries end");
+    HILOG_DEBUG("SaveEntries end, taskNum:%{public}zu, fixed:%{public}zu", taskNum, fixBatch.Size());
 }
 
 ErrCode FormInfoRdbStorageMgr::LoadFormData(std::vector<InnerFormInfo> &innerFormInfos)
 {
     HILOG_DEBUG("call");
+    int64_t startTime = FormUtil::GetCurrentSteadyClockMillseconds();
     ErrCode result;
     std::unordered_map<std::string, std::string> value;
     result = FormRdbDataMgr::GetInstance().QueryData(Constants::FORM_RDB_TABLE_NAME, FORM_ID_PREFIX, value);
@@ -136,9 +280,13 @@ ErrCode FormInfoRdbStorageMgr::LoadFormData(std::vector<InnerFormInfo> &innerFor
             FORM_ID_PREFIX, static_cast<int32_t>(CallDbFailedErrorType::LOAD_DATABASE_FAILED), result);
         return ERR_APPEXECFWK_FORM_COMMON_CODE;
     }
+    int64_t queryEndTime = FormUtil::GetCurrentSteadyClockMillseconds();
     SaveEntries(value, innerFormInfos);
 
-    HILOG_DEBUG("end");
+    int64_t endTime = FormUtil::GetCurrentSteadyClockMillseconds();
+    HILOG_INFO("load %{public}zu forms from %{public}zu entries, query cost:%{public}" PRId64
+        "ms, parse cost:%{public}" PRId64 "ms", innerFormInfos.size(), value.size(),
+        queryEndTime - startTime, endTime - queryEndTime);
     return ERR_OK;
 }
 
@@ -147,8 +295,8 @@ ErrCode FormInfoRdbStorageMgr::SaveStorageFormData(const InnerFormInfo &innerFor
     HILOG_DEBUG("formId[%{public}" PRId64 "]", innerFormInfo.GetFormId());
     std::string formId = std::to_string(innerFormInfo.GetFormId());
     std::string key = std::string().append(FORM_ID_PREFIX).append(formId);
-    std::string value = innerFormInfo.ToString();
-    ErrCode result = FormRdbDataMgr::GetInstance().InsertData(Constants::FORM_RDB_TABLE_NAME, key, value);
+    ErrCode result = FormRdbDataMgr::GetInstance().InsertData(Constants::FORM_RDB_TABLE_NAME, key,
+        innerFormInfo.ToString(), innerFormInfo.ToBinary());
     if (result != ERR_OK) {
         HILOG_ERROR("put innerFormInfo of formId[%{public}s] into RdbStore failed", formId.c_str());
         FormEventReport::SendFormFailedEvent(FormEventName::CALLEN_DB_FAILED, 0, Constants::FORM_RDB_TABLE_NAME,
@@ -195,6 +343,24 @@ ErrCode FormInfoRdbStorageMgr::DeleteStorageFormData(const std::string &formId)
     return ERR_OK;
 }
 
+ErrCode FormInfoRdbStorageMgr::DeleteStorageFormDatas(const std::vector<std::string> &formIds)
+{
+    HILOG_DEBUG("size:%{public}zu", formIds.size());
+    FormRdbWriteBatch batch;
+    for (const auto &formId : formIds) {
+        batch.Delete(Constants::FORM_RDB_TABLE_NAME, std::string().append(FORM_ID_PREFIX).append(formId));
+        batch.Delete(Constants::FORM_RDB_TABLE_NAME, std::string().append(STATUS_DATA_PREFIX).append(formId));
+    }
+    ErrCode result = FormRdbDataMgr::GetInstance().WriteBatch(batch);
+    if (result != ERR_OK) {
+        HILOG_ERROR("delete %{public}zu forms failed", formIds.size());
+        FormEventReport::SendFormFailedEvent(FormEventName::CALLEN_DB_FAILED, 0, Constants::FORM_RDB_TABLE_NAME,
+            FORM_ID_PREFIX, static_cast<int32_t>(CallDbFailedErrorType::DATABASE_DELETE_FORMID_FAILED), result);
+        return ERR_APPEXECFWK_FORM_COMMON_CODE;
+    }
+    return ERR_OK;
+}
+
 ErrCode FormInfoRdbStorageMgr::LoadStatusData(const std::string &formId, std::string &statusData)
 {
     HILOG_DEBUG("formId is %{public}s", formId.c_str());
@@ -262,6 +428,24 @@ ErrCode FormInfoRdbStorageMgr::UpdateFormVersionCode()
     return ERR_OK;
 }
 
+void FormInfoRdbStorageMgr::UpdateFormVersionCode(FormRdbWriteBatch &batch)
+{
+    HILOG_INFO("call. versioncode:%{public}d", Constants::FORM_VERSION_CODE);
+    batch.Put(Constants::FORM_RDB_TABLE_NAME, FORM_VERSION_KEY, std::to_string(Constants::FORM_VERSION_CODE));
+}
+
+ErrCode FormInfoRdbStorageMgr::WriteBatch(const FormRdbWriteBatch &batch)
+{
+    ErrCode result = FormRdbDataMgr::GetInstance().WriteBatch(batch);
+    if (result != ERR_OK) {
+        HILOG_ERROR("write batch of %{public}zu operations failed", batch.Size());
+        FormEventReport::SendFormFailedEvent(FormEventName::CALLEN_DB_FAILED, 0, Constants::FORM_RDB_TABLE_NAME,
+            FORM_INFO_PREFIX, static_cast<int32_t>(CallDbFailedErrorType::DATABASE_SAVE_FORMID_FAILED), result);
+        return ERR_APPEXECFWK_FORM_COMMON_CODE;
+    }
+    return ERR_OK;
+}
+
 ErrCode FormInfoRdbStorageMgr::GetMultiAppFormVersionCode(const std::string &bundleName, std::string &versionCode)
 {
     HILOG_INFO("call");
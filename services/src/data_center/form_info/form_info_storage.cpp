@@ -17,6 +17,7 @@
 #include "form_info_filter.h"
 #include "data_center/form_info/form_info_storage.h"
 #include "data_center/form_cust_config_mgr.h"
+#include "data_center/database/form_binary_codec.h"
 
 #include "form_constants.h"
 #include "fms_log_wrapper.h"
@@ -29,6 +30,15 @@ namespace {
 constexpr const char *JSON_KEY_USER_ID = "userId";
 constexpr const char *JSON_KEY_FORM_INFO = "formInfos";
 const int32_t DEFAULT_RECT_SHAPE = 1;
+
+enum FormInfoStoragesTag : uint32_t {
+    TAG_STORAGE = 1,
+};
+
+enum FormInfoStorageTag : uint32_t {
+    TAG_USER_ID = 1,
+    TAG_FORM_INFO,
+};
 } // namespace
 
 FormInfoStorage::FormInfoStorage(int32_t userId, const std::vector<AppExecFwk::FormInfo> &formInfos)
@@ -258,5 +268,55 @@ void from_json(const nlohmann::json &jsonObject, FormInfoStorage &formInfoStorag
         formInfoStorage.formInfos = jsonObject.at(JSON_KEY_FORM_INFO).get<std::vector<AppExecFwk::FormInfo>>();
     }
 }
+
+std::vector<uint8_t> FormInfoStoragesToBinary(const std::vector<FormInfoStorage> &formInfoStorages)
+{
+    using namespace AppExecFwk;
+    FormBinaryWriter writer(FormBinaryRecordType::FORM_INFO_STORAGES);
+    for (const auto &formInfoStorage : formInfoStorages) {
+        FormBinaryWriter storageWriter;
+        storageWriter.WriteInt32(TAG_USER_ID, formInfoStorage.userId);
+        // FormInfo is owned by bundle framework, keep its json schema and only pack it compactly.
+        for (const auto &formInfo : formInfoStorage.formInfos) {
+            storageWriter.WriteBytes(TAG_FORM_INFO, nlohmann::json::to_msgpack(nlohmann::json(formInfo)));
+        }
+        writer.WriteBytes(TAG_STORAGE, storageWriter.GetData());
+    }
+    return writer.GetData();
+}
+
+bool FormInfoStoragesFromBinary(const std::string &data, std::vector<FormInfoStorage> &formInfoStorages)
+{
+    using namespace AppExecFwk;
+    FormBinaryReader reader;
+    if (!reader.Init(data, FormBinaryRecordType::FORM_INFO_STORAGES)) {
+        return false;
+    }
+    std::vector<FormBinaryField> storageFields;
+    reader.ReadRepeated(TAG_STORAGE, storageFields);
+    formInfoStorages.reserve(formInfoStorages.size() + storageFields.size());
+    for (const auto &storageField : storageFields) {
+        FormBinaryReader storageReader;
+        if (!storageReader.InitNested(storageField)) {
+            return false;
+        }
+        FormInfoStorage formInfoStorage;
+        storageReader.ReadInt32(TAG_USER_ID, formInfoStorage.userId);
+        std::vector<FormBinaryField> formInfoFields;
+        storageReader.ReadRepeated(TAG_FORM_INFO, formInfoFields);
+        formInfoStorage.formInfos.reserve(formInfoFields.size());
+        for (const auto &formInfoField : formInfoFields) {
+            nlohmann::json jsonObject = nlohmann::json::from_msgpack(formInfoField.data,
+                formInfoField.data + formInfoField.size, true, false);
+            if (jsonObject.is_discarded() || !jsonObject.is_object()) {
+                HILOG_ERROR("bad form info of user:%{public}d", formInfoStorage.userId);
+                return false;
+            }
+            formInfoStorage.formInfos.emplace_back(jsonObject.get<AppExecFwk::FormInfo>());
+        }
+        formInfoStorages.emplace_back(std::move(formInfoStorage));
+    }
+    return true;
+}
 } // namespace AAFwk
 } // namespace OHOS
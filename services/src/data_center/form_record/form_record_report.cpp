@@ -14,6 +14,10 @@
  */
 
 #include "data_center/form_record/form_record_report.h"
+
+#include <sstream>
+
+#include "common/util/form_util.h"
 #include "fms_log_wrapper.h"
 #include "form_event_report.h"
 #include "data_center/form_basic_info_mgr.h"
@@ -24,6 +28,8 @@ namespace AppExecFwk {
 namespace {
 constexpr size_t REPORT_INFO_QUEUE_MAX_LEN = 2;
 constexpr size_t REPORT_INFO_QUEUE_MIN_LEN = 1;
+constexpr int64_t MS_PER_HOUR = 60 * 60 * 1000;
+constexpr size_t SAVED_WAKEUP_HOURS = 24;
 }
 
 FormRecordReport::FormRecordReport()
@@ -55,6 +61,9 @@ void FormRecordReport::IncreaseUpdateTimes(int64_t formId, HiSysEventPointType t
 {
     HILOG_DEBUG("formId:%{public}" PRId64, formId);
     std::lock_guard<std::mutex> guard(formRecordReportMutex_);
+    if (type == TYPE_ALIGNED_TIMER_REFRESH) {
+        IncreaseSavedWakeupsNolock();
+    }
     if (formRecordReportMap_.find(formId) != formRecordReportMap_.end()) {
         auto &queue = formRecordReportMap_[formId];
         if (queue.empty()) {
@@ -95,6 +104,9 @@ void FormRecordReport::IncreaseUpdateTimes(int64_t formId, HiSysEventPointType t
             case TYPE_ACTUAL_PROXY_REFRESH:
                 info.actualProxyRefreshTimes++;
                 break;
+            case TYPE_ALIGNED_TIMER_REFRESH:
+                info.alignedTimerRefreshTimes++;
+                break;
             default:
                 break;
         }
@@ -135,18 +147,27 @@ void FormRecordReport::HandleFormRefreshCount()
         eventInfo.isDistributedForm = formRecord.isDistributedForm;
         eventInfo.formLocation = formRecord.formLocation;
         eventInfo.actualProxyRefreshTimes = record.actualProxyRefreshTimes;
+        eventInfo.alignedTimerRefreshTimes = record.alignedTimerRefreshTimes;
         FormEventReport::SendFormRefreshCountEvent(FormEventName::UPDATE_FORM_REFRESH_TIMES,
             HiSysEventType::STATISTIC, eventInfo);
         while (queue.size() > REPORT_INFO_QUEUE_MIN_LEN) {
             queue.pop();
         }
     }
+    if (!savedWakeupsPerHour_.empty()) {
+        std::ostringstream hourly;
+        for (const auto &bucket : savedWakeupsPerHour_) {
+            hourly << bucket.first << ":" << bucket.second << " ";
+        }
+        HILOG_INFO("aligned timer refresh saved wakeups per hour:%{public}s", hourly.str().c_str());
+    }
 }
 
 void FormRecordReport::ClearReportInfo()
 {
     std::lock_guard<std::mutex> guard(formRecordReportMutex_);
     formRecordReportMap_.clear();
+    savedWakeupsPerHour_.clear();
 }
 
 void FormRecordReport::AddNewDayReportInfo()
@@ -161,5 +182,22 @@ void FormRecordReport::AddNewDayReportInfo()
     }
 }
 
+std::vector<std::pair<int64_t, int32_t>> FormRecordReport::GetSavedWakeupsPerHour() const
+{
+    std::lock_guard<std::mutex> guard(formRecordReportMutex_);
+    return std::vector<std::pair<int64_t, int32_t>>(savedWakeupsPerHour_.begin(), savedWakeupsPerHour_.end());
+}
+
+void FormRecordReport::IncreaseSavedWakeupsNolock()
+{
+    int64_t hour = FormUtil::GetCurrentMillisecond() / MS_PER_HOUR;
+    if (savedWakeupsPerHour_.empty() || savedWakeupsPerHour_.back().first != hour) {
+        savedWakeupsPerHour_.emplace_back(hour, 0);
+        while (savedWakeupsPerHour_.size() > SAVED_WAKEUP_HOURS) {
+            savedWakeupsPerHour_.pop_front();
+        }
+    }
+    savedWakeupsPerHour_.back().second++;
+}
 }  // namespace AppExecFwk
-}  // namespace OHOS
\ No newline at end of file
+}  // namespace OHOS
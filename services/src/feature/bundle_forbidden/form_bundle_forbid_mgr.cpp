@@ -35,8 +35,11 @@ FormBundleForbidMgr::~FormBundleForbidMgr()
 
 bool FormBundleForbidMgr::Init()
 {
-    std::unique_lock<std::shared_mutex> lock(bundleForbiddenSetMutex_);
-    if (isInitialized_) {
+    if (isInitialized_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(bundleForbiddenSetMutex_);
+    if (isInitialized_.load(std::memory_order_relaxed)) {
         return true;
     }
     FormRdbTableConfig formRdbTableConfig;
@@ -48,8 +51,10 @@ bool FormBundleForbidMgr::Init()
         return false;
     }
 
-    FormRdbDataMgr::GetInstance().QueryAllKeys(FORBIDDEN_FORM_BUNDLE_TABLE, formBundleForbiddenSet_);
-    isInitialized_ = true;
+    std::set<std::string> forbiddenBundles;
+    FormRdbDataMgr::GetInstance().QueryAllKeys(FORBIDDEN_FORM_BUNDLE_TABLE, forbiddenBundles);
+    formBundleForbiddenSet_.Reset(std::move(forbiddenBundles));
+    isInitialized_.store(true, std::memory_order_release);
     HILOG_INFO("initialized");
     return true;
 }
@@ -66,9 +71,7 @@ bool FormBundleForbidMgr::IsBundleForbidden(const std::string &bundleName)
         return false;
     }
 
-    std::shared_lock<std::shared_mutex> lock(bundleForbiddenSetMutex_);
-    auto iter = formBundleForbiddenSet_.find(bundleName);
-    return iter != formBundleForbiddenSet_.end();
+    return formBundleForbiddenSet_.Contains(bundleName);
 }
 
 void FormBundleForbidMgr::SetBundleForbiddenStatus(const std::string &bundleName, bool isForbidden)
@@ -83,13 +86,10 @@ void FormBundleForbidMgr::SetBundleForbiddenStatus(const std::string &bundleName
         return;
     }
 
-    std::unique_lock<std::shared_mutex> lock(bundleForbiddenSetMutex_);
-    auto iter = formBundleForbiddenSet_.find(bundleName);
-    if (isForbidden && iter == formBundleForbiddenSet_.end()) {
-        formBundleForbiddenSet_.insert(bundleName);
+    std::lock_guard<std::mutex> lock(bundleForbiddenSetMutex_);
+    if (isForbidden && formBundleForbiddenSet_.Insert(bundleName)) {
         FormRdbDataMgr::GetInstance().InsertData(FORBIDDEN_FORM_BUNDLE_TABLE, bundleName);
-    } else if (!isForbidden && iter != formBundleForbiddenSet_.end()) {
-        formBundleForbiddenSet_.erase(bundleName);
+    } else if (!isForbidden && formBundleForbiddenSet_.Erase(bundleName)) {
         FormRdbDataMgr::GetInstance().DeleteData(FORBIDDEN_FORM_BUNDLE_TABLE, bundleName);
     }
 }
@@ -38,8 +38,11 @@ FormBundleLockMgr::~FormBundleLockMgr()
 
 bool FormBundleLockMgr::Init()
 {
-    std::unique_lock<std::shared_mutex> lock(bundleLockSetMutex_);
-    if (isInitialized_) {
+    if (isInitialized_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(bundleLockSetMutex_);
+    if (isInitialized_.load(std::memory_order_relaxed)) {
         return true;
     }
     FormRdbTableConfig formRdbTableConfig;
@@ -51,8 +54,10 @@ bool FormBundleLockMgr::Init()
         return false;
     }
 
-    FormRdbDataMgr::GetInstance().QueryAllKeys(LOCK_FORM_BUNDLE_TABLE, formBundleLockSet_);
-    isInitialized_ = true;
+    std::set<std::string> lockBundles;
+    FormRdbDataMgr::GetInstance().QueryAllKeys(LOCK_FORM_BUNDLE_TABLE, lockBundles);
+    formBundleLockSet_.Reset(std::move(lockBundles));
+    isInitialized_.store(true, std::memory_order_release);
     HILOG_INFO("initialized");
     return true;
 }
@@ -79,9 +84,7 @@ bool FormBundleLockMgr::IsBundleLock(const std::string &bundleName, const int32_
         return false;
     }
 
-    std::shared_lock<std::shared_mutex> lock(bundleLockSetMutex_);
-    auto iter = formBundleLockSet_.find(bundleName);
-    return iter != formBundleLockSet_.end();
+    return formBundleLockSet_.Contains(bundleName);
 }
 
 void FormBundleLockMgr::SetBundleLockStatus(const std::string &bundleName, bool isLock)
@@ -96,13 +99,10 @@ void FormBundleLockMgr::SetBundleLockStatus(const std::string &bundleName, bool
         return;
     }
 
-    std::unique_lock<std::shared_mutex> lock(bundleLockSetMutex_);
-    auto iter = formBundleLockSet_.find(bundleName);
-    if (isLock && iter == formBundleLockSet_.end()) {
-        formBundleLockSet_.insert(bundleName);
+    std::lock_guard<std::mutex> lock(bundleLockSetMutex_);
+    if (isLock && formBundleLockSet_.Insert(bundleName)) {
         FormRdbDataMgr::GetInstance().InsertData(LOCK_FORM_BUNDLE_TABLE, bundleName);
-    } else if (!isLock && iter != formBundleLockSet_.end()) {
-        formBundleLockSet_.erase(bundleName);
+    } else if (!isLock && formBundleLockSet_.Erase(bundleName)) {
         FormRdbDataMgr::GetInstance().DeleteData(LOCK_FORM_BUNDLE_TABLE, bundleName);
     }
 }
@@ -129,9 +129,7 @@ bool FormBundleLockMgr::IsBundleProtect(const std::string &bundleName, const int
         return IsBundleLock(bundleName, userId, formId);
     }
 
-    std::shared_lock<std::shared_mutex> lock(bundleProtectSetMutex_);
-    auto iter = formBundleProtectSet_.find(bundleName);
-    return iter != formBundleProtectSet_.end();
+    return formBundleProtectSet_.Contains(bundleName);
 }
 
 void FormBundleLockMgr::SetBundleProtectStatus(const std::string &bundleName, bool isProtect)
@@ -141,13 +139,9 @@ void FormBundleLockMgr::SetBundleProtectStatus(const std::string &bundleName, bo
         return;
     }
 
-    std::unique_lock<std::shared_mutex> lock(bundleProtectSetMutex_);
-    auto iter = formBundleProtectSet_.find(bundleName);
-    if (isProtect && iter == formBundleProtectSet_.end()) {
-        formBundleProtectSet_.insert(bundleName);
-    } else if (!isProtect && iter != formBundleProtectSet_.end()) {
-        formBundleProtectSet_.erase(bundleName);
-    } else {
+    std::lock_guard<std::mutex> lock(bundleProtectSetMutex_);
+    bool changed = isProtect ? formBundleProtectSet_.Insert(bundleName) : formBundleProtectSet_.Erase(bundleName);
+    if (!changed) {
         HILOG_ERROR("set bundle protect status failed");
     }
 }
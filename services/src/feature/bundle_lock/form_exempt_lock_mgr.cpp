@@ -37,8 +37,11 @@ FormExemptLockMgr::~FormExemptLockMgr()
 
 bool FormExemptLockMgr::Init()
 {
-    std::unique_lock<std::shared_mutex> lock(exemptLockSetMutex_);
-    if (isInitialized_) {
+    if (isInitialized_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(exemptLockSetMutex_);
+    if (isInitialized_.load(std::memory_order_relaxed)) {
         return true;
     }
     FormRdbTableConfig formRdbTableConfig;
@@ -50,8 +53,10 @@ bool FormExemptLockMgr::Init()
         return false;
     }
 
-    FormRdbDataMgr::GetInstance().QueryAllKeys(LOCK_FORM_EXEMPT_TABLE, formExemptLockSet_);
-    isInitialized_ = true;
+    std::set<std::string> exemptForms;
+    FormRdbDataMgr::GetInstance().QueryAllKeys(LOCK_FORM_EXEMPT_TABLE, exemptForms);
+    formExemptLockSet_.Reset(std::move(exemptForms));
+    isInitialized_.store(true, std::memory_order_release);
     HILOG_INFO("initialized");
     return true;
 }
@@ -64,9 +69,7 @@ bool FormExemptLockMgr::IsExemptLock(int64_t formId)
         return false;
     }
 
-    std::shared_lock<std::shared_mutex> lock(exemptLockSetMutex_);
-    auto iter = formExemptLockSet_.find(formId_s);
-    return iter != formExemptLockSet_.end();
+    return formExemptLockSet_.Contains(formId_s);
 }
 
 void FormExemptLockMgr::SetExemptLockStatus(int64_t formId, bool isExempt)
@@ -77,13 +80,10 @@ void FormExemptLockMgr::SetExemptLockStatus(int64_t formId, bool isExempt)
         return;
     }
 
-    std::unique_lock<std::shared_mutex> lock(exemptLockSetMutex_);
-    auto iter = formExemptLockSet_.find(formId_s);
-    if (isExempt && iter == formExemptLockSet_.end()) {
-        formExemptLockSet_.insert(formId_s);
+    std::lock_guard<std::mutex> lock(exemptLockSetMutex_);
+    if (isExempt && formExemptLockSet_.Insert(formId_s)) {
         FormRdbDataMgr::GetInstance().InsertData(LOCK_FORM_EXEMPT_TABLE, formId_s);
-    } else if (!isExempt && iter != formExemptLockSet_.end()) {
-        formExemptLockSet_.erase(formId_s);
+    } else if (!isExempt && formExemptLockSet_.Erase(formId_s)) {
         FormRdbDataMgr::GetInstance().DeleteData(LOCK_FORM_EXEMPT_TABLE, formId_s);
     }
 }
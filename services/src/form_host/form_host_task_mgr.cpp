@@ -15,9 +15,13 @@
 
 #include "form_host/form_host_task_mgr.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 #include "form_host_interface.h"
 #include "form_mgr_errors.h"
 #include "fms_log_wrapper.h"
+#include "ipc_types.h"
 #include "form_host/form_host_queue.h"
 #include "data_center/form_data_mgr.h"
 #include "form_provider/form_supply_callback.h"
@@ -59,11 +63,33 @@ void FormHostTaskMgr::PostUpdateTaskToHost(const int64_t formId, const FormRecor
     const sptr<IRemoteObject> &remoteObject)
 {
     HILOG_DEBUG("call");
+    if (remoteObject == nullptr) {
+        HILOG_ERROR("null remoteObject");
+        return;
+    }
 
-    auto updateTaskToHostFunc = [formId, record, remoteObject]() {
-        FormHostTaskMgr::GetInstance().UpdateTaskToHost(formId, record, remoteObject);
+    {
+        std::lock_guard<std::mutex> lock(updateBufferMutex_);
+        HostUpdateBuffer &buffer = updateBuffers_[remoteObject.GetRefPtr()];
+        bool flushPending = !buffer.updates.empty();
+        buffer.remoteObject = remoteObject;
+        auto iter = std::find_if(buffer.updates.begin(), buffer.updates.end(),
+            [formId](const std::pair<int64_t, FormRecord> &update) { return update.first == formId; });
+        if (iter != buffer.updates.end()) {
+            HILOG_DEBUG("supersede pending update, formId:%{public}" PRId64, formId);
+            iter->second = record;
+            return;
+        }
+        buffer.updates.emplace_back(formId, record);
+        if (flushPending) {
+            return;
+        }
+    }
+
+    auto flushUpdatesFunc = [remoteObject]() {
+        FormHostTaskMgr::GetInstance().FlushUpdatesToHost(remoteObject);
     };
-    FormHostQueue::GetInstance().ScheduleTask(FORM_TASK_DELAY_TIME, updateTaskToHostFunc);
+    FormHostQueue::GetInstance().ScheduleTask(FORM_TASK_DELAY_TIME, flushUpdatesFunc);
 }
 
 /**
@@ -244,6 +270,76 @@ void FormHostTaskMgr::UpdateTaskToHost(const int64_t formId, const FormRecord &r
     HILOG_DEBUG("end");
 }
 
+void FormHostTaskMgr::FlushUpdatesToHost(const sptr<IRemoteObject> &remoteObject)
+{
+    std::vector<std::pair<int64_t, FormRecord>> updates;
+    {
+        std::lock_guard<std::mutex> lock(updateBufferMutex_);
+        auto iter = updateBuffers_.find(remoteObject.GetRefPtr());
+        if (iter == updateBuffers_.end()) {
+            return;
+        }
+        updates.swap(iter->second.updates);
+        updateBuffers_.erase(iter);
+    }
+
+    if (updates.size() == 1) {
+        UpdateTaskToHost(updates.front().first, updates.front().second, remoteObject);
+        return;
+    }
+
+    sptr<IFormHost> remoteFormHost = iface_cast<IFormHost>(remoteObject);
+    if (remoteFormHost == nullptr) {
+        HILOG_ERROR("get formHostProxy failed");
+        return;
+    }
+
+    HILOG_DEBUG("flush %{public}zu updates", updates.size());
+    std::vector<FormJsInfo> formJsInfos;
+    formJsInfos.reserve(IFormHost::MAX_BATCH_UPDATE_COUNT);
+    for (const auto &update : updates) {
+        FormJsInfo formJsInfo;
+        FormDataMgr::GetInstance().CreateFormJsInfo(update.first, update.second, formJsInfo);
+        formJsInfos.emplace_back(std::move(formJsInfo));
+        if (formJsInfos.size() == static_cast<size_t>(IFormHost::MAX_BATCH_UPDATE_COUNT)) {
+            BatchUpdateToHost(remoteFormHost, remoteObject, formJsInfos);
+            formJsInfos.clear();
+        }
+    }
+    if (!formJsInfos.empty()) {
+        BatchUpdateToHost(remoteFormHost, remoteObject, formJsInfos);
+    }
+}
+
+void FormHostTaskMgr::BatchUpdateToHost(const sptr<IFormHost> &remoteFormHost,
+    const sptr<IRemoteObject> &remoteObject, const std::vector<FormJsInfo> &formJsInfos)
+{
+    bool isUnsupported = false;
+    {
+        std::lock_guard<std::mutex> lock(updateBufferMutex_);
+        isUnsupported = batchUpdateUnsupported_.count(remoteObject.GetRefPtr()) != 0;
+    }
+
+    if (!isUnsupported) {
+        int32_t result = remoteFormHost->OnBatchUpdate(formJsInfos);
+        if (result == ERR_OK) {
+            return;
+        }
+        if (result == IPC_STUB_UNKNOW_TRANS_ERR) {
+            // The host stub predates the batch call, other failures are retried with the next batch.
+            HILOG_WARN("host does not handle batch update, use single updates");
+            std::lock_guard<std::mutex> lock(updateBufferMutex_);
+            batchUpdateUnsupported_.insert(remoteObject.GetRefPtr());
+        } else {
+            HILOG_WARN("batch update failed:%{public}d, fall back to single updates", result);
+        }
+    }
+
+    for (const auto &formJsInfo : formJsInfos) {
+        remoteFormHost->OnUpdate(formJsInfo);
+    }
+}
+
 /**
  * @brief Handle uninstall message.
  * @param formIds The Id list of the forms.
@@ -376,6 +472,11 @@ void FormHostTaskMgr::HostDied(const sptr<IRemoteObject> &remoteHost)
         HILOG_ERROR("remote client died, invalid param");
         return;
     }
+    {
+        std::lock_guard<std::mutex> lock(updateBufferMutex_);
+        updateBuffers_.erase(remoteHost.GetRefPtr());
+        batchUpdateUnsupported_.erase(remoteHost.GetRefPtr());
+    }
     FormDataMgr::GetInstance().HandleHostDied(remoteHost);
     FormSupplyCallback::GetInstance()->HandleHostDied(remoteHost);
 }
@@ -112,7 +112,7 @@ int FormDataAdapter::UpdateForm(const int64_t formId, const int32_t callingUid,
     int ret = ERR_OK;
     RefreshData data;
     data.formId = matchedFormId;
-    data.record = formRecord;
+    data.record = std::make_shared<const FormRecord>(std::move(formRecord));
     data.callingUid = callingUid;
     data.providerData = formProviderData;
     ret = FormRefreshMgr::GetInstance().RequestRefresh(data, TYPE_DATA);
@@ -154,13 +154,14 @@ int FormDataAdapter::RequestForm(const int64_t formId,
     int64_t matchedFormId = FormDataMgr::GetInstance().FindMatchedFormId(formId);
     UpdateFormRenderParam(matchedFormId, callerToken, want);
     FormDataMgr::GetInstance().UpdateHostWant(formId, want, true);
-    FormRecord record;
-    bool result = FormDataMgr::GetInstance().GetFormRecord(matchedFormId, record);
+    FormRecord formRecord;
+    bool result = FormDataMgr::GetInstance().GetFormRecord(matchedFormId, formRecord);
     if (!result) {
         HILOG_ERROR("not exist such formId:%{public}" PRId64 ".", matchedFormId);
         return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
     }
 
+    auto record = std::make_shared<const FormRecord>(std::move(formRecord));
     RefreshData data;
     data.callingUid = IPCSkeleton::GetCallingUid();
     data.formId = matchedFormId;
@@ -169,9 +170,9 @@ int FormDataAdapter::RequestForm(const int64_t formId,
     data.want = updateFormWant;
     bool needAcquireProviderData = FormCacheMgr::GetInstance().NeedAcquireProviderData(formId);
     HILOG_INFO("formId:%{public}" PRId64 ", isNeedAddForm:%{public}d, needAcquireProviderData:%{public}d, "
-        "needRefresh:%{public}d.", formId, isNeedAddForm, needAcquireProviderData, record.needRefresh);
-    if (isNeedAddForm && (needAcquireProviderData || record.needRefresh)) {
-        ErrCode errCode = AcquireProviderFormInfoByFormRecord(record, addFormWant.GetParams());
+        "needRefresh:%{public}d.", formId, isNeedAddForm, needAcquireProviderData, record->needRefresh);
+    if (isNeedAddForm && (needAcquireProviderData || record->needRefresh)) {
+        ErrCode errCode = AcquireProviderFormInfoByFormRecord(*record, addFormWant.GetParams());
         auto delayRefreshForm = [data]() mutable {
             FormRefreshMgr::GetInstance().RequestRefresh(data, TYPE_HOST);
         };
@@ -270,17 +271,17 @@ ErrCode FormDataAdapter::BatchRefreshForms(const int32_t formRefreshType)
         formRecord.isCountTimerRefresh = false;
         formRecord.isTimerRefresh = false;
         RefreshData data;
-        data.record = formRecord;
         data.formId = formRecord.formId;
-        batch.push_back(data);
+        data.record = std::make_shared<const FormRecord>(std::move(formRecord));
+        batch.push_back(std::move(data));
     }
     for (auto &formRecord : invisibleFormRecords) {
         formRecord.isCountTimerRefresh = false;
         formRecord.isTimerRefresh = false;
         RefreshData data;
-        data.record = formRecord;
         data.formId = formRecord.formId;
-        batch.push_back(data);
+        data.record = std::make_shared<const FormRecord>(std::move(formRecord));
+        batch.push_back(std::move(data));
     }
     FormRefreshMgr::GetInstance().BatchRequestRefresh(TYPE_FORCE, StaggerStrategyType::DEFAULT, batch);
     return ERR_OK;
@@ -305,7 +306,7 @@ int FormDataAdapter::SetNextRefreshTime(const int64_t formId, const int64_t next
     RefreshData data;
     data.callingUid = IPCSkeleton::GetCallingUid();
     data.formId = matchedFormId;
-    data.record = formRecord;
+    data.record = std::make_shared<const FormRecord>(std::move(formRecord));
     data.nextTime = nextTime;
 
     return FormRefreshMgr::GetInstance().RequestRefresh(data, TYPE_NEXT_TIME);
@@ -563,10 +564,10 @@ ErrCode FormDataAdapter::ReloadForms(int32_t &reloadNum, const std::vector<FormR
     std::vector<RefreshData> batch;
     for (const FormRecord &formRecord : refreshForms) {
         RefreshData data;
-        data.record = formRecord;
+        data.record = std::make_shared<const FormRecord>(formRecord);
         data.formId = formRecord.formId;
         data.callingUid = callingUid;
-        batch.push_back(data);
+        batch.push_back(std::move(data));
     }
     FormRefreshMgr::GetInstance().BatchRequestRefresh(TYPE_PROVIDER, StaggerStrategyType::DEFAULT, batch);
     for (const auto &data : batch) {
@@ -672,8 +673,8 @@ ErrCode FormDataAdapter::UpdateFormByCondition(int32_t type)
     for (const FormRecord& formRecord : formInfos) {
         RefreshData data;
         data.formId = formRecord.formId;
-        data.record = formRecord;
-        batch.push_back(data);
+        data.record = std::make_shared<const FormRecord>(formRecord);
+        batch.push_back(std::move(data));
         reportStr.append(formRecord.bundleName).append("_").append(formRecord.formName);
     }
     FormRefreshMgr::GetInstance().BatchRequestRefresh(TYPE_NETWORK, StaggerStrategyType::VISIBLE_DELAY, batch);
@@ -696,7 +697,7 @@ void FormDataAdapter::DelayRefreshFormsOnAppUpgrade(const std::vector<FormRecord
             FormDataAdapter::GetInstance().UpdateFormRenderParamsAfterReload(updatedForm.formId);
             RefreshData data;
             data.formId = updatedForm.formId;
-            data.record = updatedForm;
+            data.record = std::make_shared<const FormRecord>(updatedForm);
             data.want = want;
             ErrCode errCode = FormRefreshMgr::GetInstance().RequestRefresh(data, TYPE_APP_UPGRADE);
             if (errCode == ERR_APPEXECFWK_FORM_GET_AMSCONNECT_FAILED) {
@@ -716,7 +717,7 @@ void FormDataAdapter::PostEnterpriseAppInstallFailedRetryTask(const FormRecord &
     auto refreshForm = [record, want]() {
         RefreshData data;
         data.formId = record.formId;
-        data.record = record;
+        data.record = std::make_shared<const FormRecord>(record);
         data.want = want;
         FormRefreshMgr::GetInstance().RequestRefresh(data, TYPE_APP_UPGRADE);
     };
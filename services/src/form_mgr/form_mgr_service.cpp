@@ -42,6 +42,7 @@
 #include "form_mgr/form_mgr_adapter_facade.h"
 #include "form_instance.h"
 #include "common/util/form_serial_queue.h"
+#include "common/util/form_dump_mgr.h"
 #include "feature/form_share/form_share_mgr.h"
 #include "common/timer_mgr/form_timer_mgr.h"
 #include "common/util/form_trust_mgr.h"
@@ -123,7 +124,10 @@ const std::string FORM_DUMP_HELP = "options list:\n"
     "  -n  <bundle-name>                    query form info by a bundle name\n"
     "  -i  <form-id>                        query form info by a form ID\n"
     "  -r  --running                        query running form info\n"
-    "  -a  --apps-blocked                   query blocked app name list\n";
+    "  -a  --apps-blocked                   query blocked app name list\n"
+    "  -c  --cache                          query form cache and bms query cache hit rate, dirty entries and flush "
+    "latency\n"
+    "  -q  --queue                          query serial queue depth, wait and execute time histograms\n";
 
 const std::map<std::string, FormMgrService::DumpKey> FormMgrService::dumpKeyMap_ = {
     {"-h", FormMgrService::DumpKey::KEY_DUMP_HELP},
@@ -142,6 +146,10 @@ const std::map<std::string, FormMgrService::DumpKey> FormMgrService::dumpKeyMap_
     {"--running", FormMgrService::DumpKey::KEY_DUMP_RUNNING},
     {"-a", FormMgrService::DumpKey::KEY_DUMP_BLOCKED_APPS},
     {"--apps-blocked", FormMgrService::DumpKey::KEY_DUMP_BLOCKED_APPS},
+    {"-c", FormMgrService::DumpKey::KEY_DUMP_CACHE},
+    {"--cache", FormMgrService::DumpKey::KEY_DUMP_CACHE},
+    {"-q", FormMgrService::DumpKey::KEY_DUMP_QUEUE},
+    {"--queue", FormMgrService::DumpKey::KEY_DUMP_QUEUE},
 };
 
 FormMgrService::FormMgrService()
@@ -832,6 +840,7 @@ void FormMgrService::OnStop()
     }
     FormAmsHelper::GetInstance().UnRegisterConfigurationObserver();
     ParamCommonEvent::GetInstance().UnSubscriberEvent();
+    FormCacheMgr::GetInstance().FlushDirtyData();
 }
 
 ErrCode FormMgrService::ReadFormConfigXML()
@@ -862,6 +871,7 @@ void FormMgrService::SubscribeSysEventReceiver()
         matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_SCREEN_ON);
         matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_USER_STOPPED);
         matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_USER_STARTED);
+        matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_SHUTDOWN);
         // init TimerReceiver
         EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
         subscribeInfo.SetThreadMode(EventFwk::CommonEventSubscribeInfo::COMMON);
@@ -1490,6 +1500,10 @@ void FormMgrService::Dump(const std::vector<std::u16string> &args, std::string &
             return HiDumpFormRunningFormInfos(value, result);
         case DumpKey::KEY_DUMP_BLOCKED_APPS:
             return HiDumpFormBlockedApps(value, result);
+        case DumpKey::KEY_DUMP_CACHE:
+            return HiDumpFormCacheInfos(value, result);
+        case DumpKey::KEY_DUMP_QUEUE:
+            return HiDumpFormQueueInfos(value, result);
         default:
             result = "error: unknow function.";
             return;
@@ -1660,6 +1674,23 @@ void FormMgrService::HiDumpFormBlockedApps([[maybe_unused]] const std::string &a
     FormTrustMgr::GetInstance().GetUntrustAppNameList(result);
 }
 
+void FormMgrService::HiDumpFormCacheInfos([[maybe_unused]] const std::string &args, std::string &result)
+{
+    if (!CheckCallerIsSystemApp()) {
+        return;
+    }
+    FormCacheMgr::GetInstance().DumpStatistics(result);
+    FormBmsHelper::GetInstance().DumpCacheStatistics(result);
+}
+
+void FormMgrService::HiDumpFormQueueInfos([[maybe_unused]] const std::string &args, std::string &result)
+{
+    if (!CheckCallerIsSystemApp()) {
+        return;
+    }
+    FormDumpMgr::GetInstance().DumpQueueInfos(result);
+}
+
 void FormMgrService::HiDumpFormInfoByFormId(const std::string &args, std::string &result)
 {
     if (args.empty()) {
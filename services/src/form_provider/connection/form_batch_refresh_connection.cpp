@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_provider/connection/form_batch_refresh_connection.h"
+
+#include <cinttypes>
+
+#include "data_center/form_data_mgr.h"
+#include "fms_log_wrapper.h"
+#include "form_constants.h"
+#include "form_provider/form_provider_task_mgr.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+
+FormBatchRefreshConnection::FormBatchRefreshConnection(const std::vector<FormBatchRefreshItem> &items,
+    const std::string &bundleName, const std::string &abilityName, const int32_t userId) : items_(items)
+{
+    SetProviderKey(bundleName, abilityName, userId);
+    if (!items_.empty()) {
+        SetFormId(items_.back().formId);
+        SetModuleName(items_.back().record.moduleName);
+    }
+}
+
+void FormBatchRefreshConnection::OnExecuteConnectTask(const Want &want, const sptr<IRemoteObject> &remoteObject)
+{
+    SetProviderToken(remoteObject);
+    std::vector<std::pair<int64_t, Want>> updates;
+    updates.reserve(items_.size());
+    for (const auto &item : items_) {
+        updates.emplace_back(item.formId, item.want);
+        FormDataMgr::GetInstance().ClearHostRefreshFlag(item.formId);
+    }
+    if (!updates.empty()) {
+        updates.back().second.SetParam(Constants::FORM_CONNECT_ID, GetConnectId());
+    }
+    FormProviderTaskMgr::GetInstance().PostBatchRefreshTask(updates, remoteObject);
+}
+
+void FormBatchRefreshConnection::OnConnectError(int resultCode, const AppExecFwk::ElementName &element)
+{
+    HILOG_ERROR("connect failed, resultCode:%{public}d, size:%{public}zu", resultCode, items_.size());
+    MarkFormsNeedRefresh();
+}
+
+void FormBatchRefreshConnection::OnAbilityDisconnectDone(const AppExecFwk::ElementName &element, int resultCode)
+{
+    if (resultCode == DISCONNECT_ERROR && GetConnectState() == ConnectState::CONNECTED) {
+        HILOG_ERROR("provider died, lastFormId:%{public}" PRId64 ", size:%{public}zu", GetFormId(), items_.size());
+        MarkFormsNeedRefresh();
+    }
+    FormAbilityConnection::OnAbilityDisconnectDone(element, resultCode);
+}
+
+void FormBatchRefreshConnection::MarkFormsNeedRefresh()
+{
+    for (const auto &item : items_) {
+        FormDataMgr::GetInstance().SetNeedRefresh(item.formId, true);
+    }
+}
+
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "form_provider/connection/form_pooled_connection.h"
+
+#include "fms_log_wrapper.h"
+#include "form_provider/form_connection_pool.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+
+FormPooledConnection::FormPooledConnection(const Want &connectWant, const int32_t userId)
+{
+    const AppExecFwk::ElementName &element = connectWant.GetElement();
+    SetProviderKey(element.GetBundleName(), element.GetAbilityName(), userId);
+    SetModuleName(element.GetModuleName());
+    SetConnectState(ConnectState::CONNECTING);
+}
+
+void FormPooledConnection::OnAbilityConnectDone(
+    const AppExecFwk::ElementName &element, const sptr<IRemoteObject> &remoteObject, int resultCode)
+{
+    element_ = element;
+    FormAbilityConnection::OnAbilityConnectDone(element, remoteObject, resultCode);
+}
+
+void FormPooledConnection::OnExecuteConnectTask(const Want &want, const sptr<IRemoteObject> &remoteObject)
+{
+    SetProviderToken(remoteObject);
+    FormConnectionPool::GetInstance().OnPooledConnected(this, element_, remoteObject);
+}
+
+void FormPooledConnection::OnConnectError(int resultCode, const AppExecFwk::ElementName &element)
+{
+    SetConnectState(ConnectState::DISCONNECTED);
+    FormConnectionPool::GetInstance().OnPooledConnectFailed(this, element, resultCode);
+}
+
+void FormPooledConnection::OnAbilityDisconnectDone(const AppExecFwk::ElementName &element, int resultCode)
+{
+    HILOG_INFO("provider:%{public}s, resultCode:%{public}d", GetProviderKey().c_str(), resultCode);
+    FormConnectionPool::GetInstance().OnPooledDisconnected(this, element, resultCode);
+    ReportFormAppUnbindEvent();
+    SetConnectState(ConnectState::DISCONNECTED);
+}
+
+}  // namespace AppExecFwk
+}  // namespace OHOS
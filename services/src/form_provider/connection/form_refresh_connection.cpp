@@ -27,12 +27,18 @@ namespace OHOS {
 namespace AppExecFwk {
 
 FormRefreshConnection::FormRefreshConnection(const int64_t formId, const Want &want, const FormRecord &record)
+    : FormRefreshConnection(formId, want, std::make_shared<const FormRecord>(record))
+{
+}
+
+FormRefreshConnection::FormRefreshConnection(const int64_t formId, const Want &want,
+    const std::shared_ptr<const FormRecord> &record)
     : want_(want), record_(record)
 {
     SetFormId(formId);
-    SetFreeInstall(record.needFreeInstall);
-    SetProviderKey(record.bundleName, record.abilityName, record.providerUserId);
-    SetModuleName(record.moduleName);
+    SetFreeInstall(record->needFreeInstall);
+    SetProviderKey(record->bundleName, record->abilityName, record->providerUserId);
+    SetModuleName(record->moduleName);
 }
 
 sptr<FormAbilityConnection> FormRefreshConnection::CreateRetryConnection() const
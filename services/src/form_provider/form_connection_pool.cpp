@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_provider/form_connection_pool.h"
+
+#include <algorithm>
+
+#include "ams_mgr/form_ams_helper.h"
+#include "common/util/form_util.h"
+#include "fms_log_wrapper.h"
+#include "form_mgr_errors.h"
+#include "form_provider/form_provider_queue.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+// The provider connection is kept this long after its last attached connection is released.
+constexpr int64_t POOL_IDLE_TIMEOUT_MS = 5000;
+// A provider connect not answered within this time is abandoned by later requests.
+constexpr int64_t POOL_CONNECT_TIMEOUT_MS = 10000;
+}
+
+FormConnectionPool::FormConnectionPool() {}
+FormConnectionPool::~FormConnectionPool() {}
+
+ErrCode FormConnectionPool::Connect(const sptr<FormAbilityConnection> &connection, int32_t userId)
+{
+    if (connection == nullptr) {
+        HILOG_ERROR("null connection");
+        return ERR_APPEXECFWK_FORM_COMMON_CODE;
+    }
+    Want connectWant = connection->CreateConnectWant();
+    std::string providerKey = connection->GetProviderKey();
+    if (providerKey.empty()) {
+        return FormAmsHelper::GetInstance().ConnectServiceAbilityWithUserId(connectWant, connection, userId);
+    }
+
+    connection->SetPooled(true);
+    sptr<FormPooledConnection> pooled = nullptr;
+    sptr<IRemoteObject> providerToken = nullptr;
+    AppExecFwk::ElementName element;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        int64_t now = FormUtil::GetCurrentSteadyClockMillseconds();
+        ProviderConnection &provider = providers_[providerKey];
+        provider.lastActiveTime = now;
+        if (provider.connected) {
+            provider.attached.emplace(connection.GetRefPtr(), connection);
+            providerToken = provider.providerToken;
+            element = provider.pooled->GetElement();
+        } else if (provider.pooled != nullptr && now - provider.connectTime < POOL_CONNECT_TIMEOUT_MS) {
+            provider.pending.emplace_back(connection);
+            return ERR_OK;
+        } else {
+            // A connect that never answered is abandoned, the connections waiting on it move to the new one.
+            pooled = new (std::nothrow) FormPooledConnection(connectWant, userId);
+            if (pooled == nullptr) {
+                HILOG_ERROR("create FormPooledConnection failed");
+                return ERR_APPEXECFWK_FORM_COMMON_CODE;
+            }
+            provider.pooled = pooled;
+            provider.connectTime = now;
+            provider.pending.emplace_back(connection);
+        }
+    }
+
+    if (pooled == nullptr) {
+        HILOG_DEBUG("reuse provider connection:%{public}s", providerKey.c_str());
+        connection->OnAbilityConnectDone(element, providerToken, ERR_OK);
+        return ERR_OK;
+    }
+
+    HILOG_INFO("connect provider:%{public}s", providerKey.c_str());
+    ErrCode errorCode = FormAmsHelper::GetInstance().ConnectServiceAbilityWithUserId(connectWant, pooled, userId);
+    if (errorCode == ERR_OK) {
+        return ERR_OK;
+    }
+
+    HILOG_ERROR("connect provider failed, errorCode:%{public}d", errorCode);
+    std::vector<sptr<FormAbilityConnection>> pending;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        auto iter = providers_.find(providerKey);
+        if (iter != providers_.end() && iter->second.pooled == pooled) {
+            pending.swap(iter->second.pending);
+            providers_.erase(iter);
+        }
+    }
+    connection->SetPooled(false);
+    pending.erase(std::remove(pending.begin(), pending.end(), connection), pending.end());
+    ConnectStandalone(pending, userId);
+    return errorCode;
+}
+
+void FormConnectionPool::Release(const sptr<FormAbilityConnection> &connection)
+{
+    if (connection == nullptr) {
+        return;
+    }
+    std::string providerKey = connection->GetProviderKey();
+    AppExecFwk::ElementName element;
+    sptr<FormPooledConnection> idlePooled = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        auto iter = providers_.find(providerKey);
+        if (iter == providers_.end() || iter->second.attached.erase(connection.GetRefPtr()) == 0) {
+            return;
+        }
+        ProviderConnection &provider = iter->second;
+        element = provider.pooled->GetElement();
+        provider.lastActiveTime = FormUtil::GetCurrentSteadyClockMillseconds();
+        if (provider.attached.empty() && provider.pending.empty()) {
+            idlePooled = provider.pooled;
+        }
+    }
+
+    // Deliver the disconnect the connection would have got from ams had it connected on its own.
+    connection->OnAbilityDisconnectDone(element, ERR_OK);
+    if (idlePooled != nullptr) {
+        auto releaseFunc = [providerKey, idlePooled]() {
+            FormConnectionPool::GetInstance().ReleaseIdle(providerKey, idlePooled);
+        };
+        FormProviderQueue::GetInstance().ScheduleTask(POOL_IDLE_TIMEOUT_MS, releaseFunc);
+    }
+}
+
+void FormConnectionPool::ReleaseIdle(const std::string &providerKey, const sptr<FormPooledConnection> &pooled)
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        auto iter = providers_.find(providerKey);
+        if (iter == providers_.end() || iter->second.pooled != pooled || !iter->second.attached.empty() ||
+            !iter->second.pending.empty()) {
+            return;
+        }
+        int64_t idleTime = FormUtil::GetCurrentSteadyClockMillseconds() - iter->second.lastActiveTime;
+        if (idleTime < POOL_IDLE_TIMEOUT_MS) {
+            auto releaseFunc = [providerKey, pooled]() {
+                FormConnectionPool::GetInstance().ReleaseIdle(providerKey, pooled);
+            };
+            FormProviderQueue::GetInstance().ScheduleTask(POOL_IDLE_TIMEOUT_MS - idleTime, releaseFunc);
+            return;
+        }
+        providers_.erase(iter);
+    }
+    HILOG_INFO("release idle provider connection:%{public}s", providerKey.c_str());
+    FormAmsHelper::GetInstance().DisconnectServiceAbility(pooled);
+}
+
+void FormConnectionPool::OnPooledConnected(const sptr<FormPooledConnection> &pooled,
+    const AppExecFwk::ElementName &element, const sptr<IRemoteObject> &remoteObject)
+{
+    std::vector<sptr<FormAbilityConnection>> pending;
+    bool abandoned = true;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        auto iter = providers_.find(pooled->GetProviderKey());
+        if (iter != providers_.end() && iter->second.pooled == pooled) {
+            ProviderConnection &provider = iter->second;
+            provider.connected = true;
+            provider.providerToken = remoteObject;
+            provider.lastActiveTime = FormUtil::GetCurrentSteadyClockMillseconds();
+            pending.swap(provider.pending);
+            for (const auto &connection : pending) {
+                provider.attached.emplace(connection.GetRefPtr(), connection);
+            }
+            abandoned = false;
+        }
+    }
+    if (abandoned) {
+        HILOG_WARN("abandoned provider connection:%{public}s", pooled->GetProviderKey().c_str());
+        FormAmsHelper::GetInstance().DisconnectServiceAbility(pooled);
+        return;
+    }
+
+    HILOG_INFO("provider:%{public}s connected, pending:%{public}zu", pooled->GetProviderKey().c_str(),
+        pending.size());
+    for (const auto &connection : pending) {
+        connection->OnAbilityConnectDone(element, remoteObject, ERR_OK);
+    }
+}
+
+void FormConnectionPool::OnPooledConnectFailed(const sptr<FormPooledConnection> &pooled,
+    const AppExecFwk::ElementName &element, int resultCode)
+{
+    std::vector<sptr<FormAbilityConnection>> pending;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        auto iter = providers_.find(pooled->GetProviderKey());
+        if (iter == providers_.end() || iter->second.pooled != pooled) {
+            return;
+        }
+        pending.swap(iter->second.pending);
+        providers_.erase(iter);
+    }
+    for (const auto &connection : pending) {
+        connection->SetPooled(false);
+        connection->OnAbilityConnectDone(element, nullptr, resultCode);
+    }
+}
+
+void FormConnectionPool::OnPooledDisconnected(const sptr<FormPooledConnection> &pooled,
+    const AppExecFwk::ElementName &element, int resultCode)
+{
+    std::vector<sptr<FormAbilityConnection>> attached;
+    std::vector<sptr<FormAbilityConnection>> pending;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        auto iter = providers_.find(pooled->GetProviderKey());
+        if (iter == providers_.end() || iter->second.pooled != pooled) {
+            return;
+        }
+        for (const auto &item : iter->second.attached) {
+            attached.emplace_back(item.second);
+        }
+        pending.swap(iter->second.pending);
+        providers_.erase(iter);
+    }
+
+    // Attached connections see the disconnect as their own, which keeps their retry policies working.
+    for (const auto &connection : attached) {
+        connection->OnAbilityDisconnectDone(element, resultCode);
+    }
+    ConnectStandalone(pending, pooled->GetUserId());
+}
+
+void FormConnectionPool::ConnectStandalone(const std::vector<sptr<FormAbilityConnection>> &connections,
+    int32_t userId)
+{
+    for (const auto &connection : connections) {
+        connection->SetPooled(false);
+        ErrCode errorCode = FormAmsHelper::GetInstance().ConnectServiceAbilityWithUserId(
+            connection->CreateConnectWant(), connection, userId);
+        if (errorCode != ERR_OK) {
+            HILOG_ERROR("connect failed, formId:%{public}" PRId64 ", errorCode:%{public}d",
+                connection->GetFormId(), errorCode);
+        }
+    }
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -20,6 +20,7 @@
 #include "fms_log_wrapper.h"
 #include "ams_mgr/form_ams_helper.h"
 #include "form_provider/connection/form_batch_delete_connection.h"
+#include "form_provider/connection/form_batch_refresh_connection.h"
 #include "data_center/form_cache_mgr.h"
 #include "form_constants.h"
 #include "data_center/form_data_mgr.h"
@@ -29,6 +30,7 @@
 #include "data_center/form_record/form_record.h"
 #include "form_provider/connection/form_refresh_connection.h"
 #include "form_provider/connection/form_location_connection.h"
+#include "form_provider/form_connection_pool.h"
 #include "form_provider/connection/form_configuration_update_connection.h"
 #include "form_provider/connection/form_update_size_connection.h"
 #include "common/timer_mgr/form_timer_mgr.h"
@@ -314,8 +316,7 @@ ErrCode FormProviderMgr::ConnectAmsForRefresh(const int64_t formId, const FormRe
         }
     }
 
-    ErrCode errorCode = FormAmsHelper::GetInstance().ConnectServiceAbilityWithUserId(connectWant, formRefreshConnection,
-        record.providerUserId);
+    ErrCode errorCode = FormConnectionPool::GetInstance().Connect(formRefreshConnection, record.providerUserId);
     if (errorCode != ERR_OK) {
         HILOG_ERROR("ConnectServiceAbility failed, errorCode:%{public}d", errorCode);
         FormEventReport::SendFormFailedEvent(FormEventName::CONNECT_FORM_ABILITY_FAILED, formId,
@@ -336,6 +337,78 @@ ErrCode FormProviderMgr::ConnectAmsForRefresh(const int64_t formId, const FormRe
     return ERR_OK;
 }
 
+/**
+ * @brief Connect ams once for refreshing several forms of one provider.
+ *
+ * @param items The forms to refresh, all of them must share bundle, ability and provider user.
+ * @return Returns ERR_OK on success, others on failure.
+ */
+ErrCode FormProviderMgr::ConnectAmsForBatchRefresh(const std::vector<FormBatchRefreshItem> &items)
+{
+    std::vector<FormBatchRefreshItem> batchItems;
+    auto errorHandler = FormProviderErrorHandlerFactory::GetRefreshHandler();
+    for (const auto &item : items) {
+        // Free install rebinds per form, keep it on the single form path.
+        if (item.record.needFreeInstall) {
+            ConnectAmsForRefresh(item.formId, item.record, item.want);
+            continue;
+        }
+        if (item.record.isCountTimerRefresh && !FormTimerMgr::GetInstance().IsLimiterEnableRefresh(item.formId)) {
+            HILOG_ERROR("timer refresh,already limit, formId:%{public}" PRId64, item.formId);
+            continue;
+        }
+        if (errorHandler != nullptr) {
+            errorHandler->RemoveRetryPolicy(item.formId);
+        }
+        batchItems.emplace_back(item);
+    }
+    if (batchItems.empty()) {
+        return ERR_OK;
+    }
+    if (batchItems.size() == 1) {
+        return ConnectAmsForRefresh(batchItems.front().formId, batchItems.front().record, batchItems.front().want);
+    }
+
+    const FormRecord &provider = batchItems.front().record;
+    HILOG_INFO("bundleName:%{public}s, abilityName:%{public}s, userId:%{public}d, size:%{public}zu",
+        provider.bundleName.c_str(), provider.abilityName.c_str(), provider.providerUserId, batchItems.size());
+    sptr<FormAbilityConnection> connection = new (std::nothrow) FormBatchRefreshConnection(batchItems,
+        provider.bundleName, provider.abilityName, provider.providerUserId);
+    if (connection == nullptr) {
+        HILOG_ERROR("create FormBatchRefreshConnection failed");
+        return ERR_APPEXECFWK_FORM_COMMON_CODE;
+    }
+
+    ErrCode errorCode = FormConnectionPool::GetInstance().Connect(connection, provider.providerUserId);
+    if (errorCode != ERR_OK) {
+        HILOG_ERROR("ConnectServiceAbility failed, errorCode:%{public}d", errorCode);
+        for (const auto &item : batchItems) {
+            FormDataMgr::GetInstance().SetNeedRefresh(item.formId, true);
+            FormEventReport::SendFormFailedEvent(FormEventName::CONNECT_FORM_ABILITY_FAILED, item.formId,
+                item.record.bundleName, "", static_cast<int32_t>(ConnectFormAbilityErrorType::UPDATE_FORM_FAILED),
+                errorCode);
+        }
+        return (errorCode == ERR_ECOLOGICAL_CONTROL_STATUS) ?
+            ERR_APPEXECFWK_FORM_GET_AMSCONNECT_FAILED : ERR_APPEXECFWK_FORM_BIND_PROVIDER_FAILED;
+    }
+
+    for (size_t i = 0; i < batchItems.size(); i++) {
+        const FormBatchRefreshItem &item = batchItems[i];
+        if (item.record.isCountTimerRefresh) {
+            IncreaseTimerRefreshCount(item.formId);
+        }
+        if (item.record.isTimerRefresh) {
+            FormDataMgr::GetInstance().SetTimerRefresh(item.formId, false);
+        }
+        // Every form but the one that woke the provider rode on a shared connection.
+        if (i > 0) {
+            FormRecordReport::GetInstance().IncreaseUpdateTimes(item.formId,
+                HiSysEventPointType::TYPE_ALIGNED_TIMER_REFRESH);
+        }
+    }
+    return ERR_OK;
+}
+
 /**
  * @brief Connect ability manager service for refresh app permission
  *
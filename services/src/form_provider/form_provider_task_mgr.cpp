@@ -118,6 +118,24 @@ void FormProviderTaskMgr::PostProviderBatchDeleteTask(std::set<int64_t> &formIds
     FormProviderQueue::GetInstance().ScheduleTask(FORM_TASK_DELAY_TIME, batchDeleteFunc);
 }
 
+/**
+ * @brief Refresh several forms of one provider in a single task.
+ * @param updates The form ids and the wants of the forms.
+ * @param remoteObject Form provider proxy object.
+ */
+void FormProviderTaskMgr::PostBatchRefreshTask(const std::vector<std::pair<int64_t, Want>> &updates,
+    const sptr<IRemoteObject> &remoteObject)
+{
+    HILOG_INFO("call, size:%{public}zu", updates.size());
+
+    auto batchRefreshFunc = [updates, remoteObject]() {
+        for (const auto &update : updates) {
+            FormProviderTaskMgr::GetInstance().NotifyFormUpdate(update.first, update.second, remoteObject);
+        }
+    };
+    FormProviderQueue::GetInstance().ScheduleTask(FORM_TASK_DELAY_TIME, batchRefreshFunc);
+}
+
 /**
  * @brief Cast temp form data from form provider(task).
  *
@@ -285,15 +303,19 @@ void FormProviderTaskMgr::NotifyFormUpdate(const int64_t formId, const Want &wan
         return;
     }
     int error = formProviderProxy->NotifyFormUpdate(formId, want, FormSupplyCallback::GetInstance());
+    // Updates sent ahead of the last one of a batch carry no connect id, the connection outlives them.
+    bool ownsConnection = want.HasParameter(Constants::FORM_CONNECT_ID);
     if (error == ERR_OK) {
         FormProviderErrorHandlerFactory::GetRefreshHandler()->RemoveRetryPolicy(formId);
-        DelayedFormExitDetect(connectId);
+        if (ownsConnection) {
+            DelayedFormExitDetect(connectId);
+        }
         return;
     }
     HILOG_ERROR("fail notify form update, error:%{public}d", error);
     bool handled = FormProviderErrorHandlerFactory::GetRefreshHandler()
         ->HandleSendRequestFailed(formId, error, want);
-    if (!handled) {
+    if (!handled && ownsConnection) {
         RemoveConnection(connectId);
     }
 }
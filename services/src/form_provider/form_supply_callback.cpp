@@ -24,6 +24,7 @@
 #include "data_center/form_data_proxy_mgr.h"
 #include "form_mgr_errors.h"
 #include "common/util/form_task_common.h"
+#include "form_provider/form_connection_pool.h"
 #include "form_provider/form_provider_mgr.h"
 #include "form_provider/form_provider_task_mgr.h"
 #include "form_provider/form_provider_queue.h"
@@ -215,7 +216,10 @@ void FormSupplyCallback::RemoveConnection(int32_t connectId)
     }
 
     if (connection != nullptr) {
-        if (CanDisconnect(connection)) {
+        if (connection->IsPooled()) {
+            FormConnectionPool::GetInstance().Release(connection);
+            HILOG_DEBUG("release pooled connection, connectId:%{public}d", connectId);
+        } else if (CanDisconnect(connection)) {
             FormAmsHelper::GetInstance().DisconnectServiceAbility(connection);
             HILOG_INFO("disconnect service ability, connectId:%{public}d", connectId);
         } else {
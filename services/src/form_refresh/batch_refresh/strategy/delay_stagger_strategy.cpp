@@ -44,7 +44,7 @@ int32_t DelayStaggerStrategy::ExecuteRefresh(std::vector<RefreshData> &batch, in
     std::vector<RefreshData> currentBatch;
 
     for (const auto &data : batch) {
-        int32_t uid = data.record.uid;
+        int32_t uid = data.record != nullptr ? data.record->uid : 0;
 
         // Check if adding this data would exceed the batch size by unique uid count
         if (currentBatchUids.count(uid) == 0 && currentBatchUids.size() >= static_cast<size_t>(batchSize_)) {
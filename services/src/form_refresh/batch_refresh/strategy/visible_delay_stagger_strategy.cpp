@@ -34,7 +34,7 @@ void VisibleDelayStaggerStrategy::Filter(std::vector<RefreshData> &batch, int32_
     int32_t conditionType = (mapIt != CONDITION_TYPE_MAP.end()) ? mapIt->second : Constants::REFRESHTYPE_DEFAULT;
     auto it = std::remove_if(batch.begin(), batch.end(),
         [&refreshControlMgr, &refreshCacheMgr, conditionType](const RefreshData &data) {
-        if (refreshControlMgr.IsFormInvisible(data.record)) {
+        if (data.record != nullptr && refreshControlMgr.IsFormInvisible(*data.record)) {
             refreshCacheMgr.AddFlagByInvisible(data.formId, conditionType);
             return true;
         }
@@ -26,8 +26,7 @@ AddFinishChecker::~AddFinishChecker() {}
 
 int AddFinishChecker::CheckValid(const CheckValidFactor &factor)
 {
-    FormRecord formRecord = factor.record;
-    if (!formRecord.addFormFinish) {
+    if (!factor.record->addFormFinish) {
         HILOG_WARN("form is adding:%{public}" PRId64, factor.formId);
         return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
     }
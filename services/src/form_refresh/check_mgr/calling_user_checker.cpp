@@ -23,9 +23,9 @@ CallingUserChecker::~CallingUserChecker() {}
 
 int CallingUserChecker::CheckValid(const CheckValidFactor &factor)
 {
-    if (factor.record.uid != factor.callingUid) {
+    if (factor.record->uid != factor.callingUid) {
         HILOG_ERROR("form uid:%{public}d does not match callingUid:%{public}d, formId:%{public}" PRId64,
-            factor.record.uid, factor.callingUid, factor.formId);
+            factor.record->uid, factor.callingUid, factor.formId);
         return ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF;
     }
     return ERR_OK;
@@ -25,7 +25,7 @@ MultiActiveUsersChecker::~MultiActiveUsersChecker() {}
 
 int MultiActiveUsersChecker::CheckValid(const CheckValidFactor &factor)
 {
-    int32_t providerUserId = factor.record.providerUserId;
+    int32_t providerUserId = factor.record->providerUserId;
     if (!FormUtil::IsActiveUser(providerUserId)) {
         HILOG_ERROR("not active users, providerUserId:%{public}d, formId:%{public}" PRId64, providerUserId,
             factor.formId);
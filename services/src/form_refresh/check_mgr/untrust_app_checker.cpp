@@ -25,18 +25,18 @@ UntrustAppChecker::~UntrustAppChecker() {}
 
 int UntrustAppChecker::CheckValid(const CheckValidFactor &factor)
 {
-    if (!FormTrustMgr::GetInstance().IsTrust(factor.record.bundleName)) {
-        HILOG_ERROR("is untrust app, formId:%{public}" PRId64, factor.record.formId);
+    if (!FormTrustMgr::GetInstance().IsTrust(factor.record->bundleName)) {
+        HILOG_ERROR("is untrust app, formId:%{public}" PRId64, factor.record->formId);
         return ERR_APPEXECFWK_FORM_NOT_TRUST;
     }
 
-    if (ParamControl::GetInstance().IsFormDisable(factor.record)) {
-        HILOG_ERROR("form is disable refresh by due, %{public}" PRId64, factor.record.formId);
+    if (ParamControl::GetInstance().IsFormDisable(*factor.record)) {
+        HILOG_ERROR("form is disable refresh by due, %{public}" PRId64, factor.record->formId);
         return ERR_APPEXECFWK_FORM_DUE_DISABLE;
     }
 
-    if (ParamControl::GetInstance().IsFormRemove(factor.record)) {
-        HILOG_ERROR("form is remove state by due, %{public}" PRId64, factor.record.formId);
+    if (ParamControl::GetInstance().IsFormRemove(*factor.record)) {
+        HILOG_ERROR("form is remove state by due, %{public}" PRId64, factor.record->formId);
         return ERR_APPEXECFWK_FORM_DUE_REMOVE;
     }
     return ERR_OK;
@@ -69,8 +69,8 @@ int FormRefreshMgr::RequestRefresh(RefreshData &data, const int32_t refreshType)
         if (ERROR_CODE_WHITE_LIST.find(ret) == ERROR_CODE_WHITE_LIST.end()) {
             FormEventReport::SendFormFailedEvent(FormEventName::UPDATE_FORM_FAILED,
                 data.formId,
-                data.record.bundleName,
-                data.record.formName,
+                data.record != nullptr ? data.record->bundleName : "",
+                data.record != nullptr ? data.record->formName : "",
                 refreshType,
                 ret);
         }
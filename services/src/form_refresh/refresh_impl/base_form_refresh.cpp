@@ -30,6 +30,11 @@ BaseFormRefresh::BaseFormRefresh(RefreshConfig&& config) : config_(std::move(con
 
 int BaseFormRefresh::RefreshFormRequest(RefreshData &data)
 {
+    if (data.record == nullptr) {
+        HILOG_ERROR("null record, formId:%{public}" PRId64, data.formId);
+        return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
+    }
+
     int ret = ERR_OK;
     // 1. Build check factor
     CheckValidFactor factor = BuildCheckFactor(data);
@@ -93,7 +98,7 @@ int BaseFormRefresh::DoControlCheck(RefreshData &data)
 
     // 2. Healthy control check
     if (flags & CONTROL_CHECK_HEALTHY_CONTROL) {
-        if (RefreshControlMgr::GetInstance().IsHealthyControl(data.record)) {
+        if (RefreshControlMgr::GetInstance().IsHealthyControl(*data.record)) {
             RefreshCacheMgr::GetInstance().AddFlagByHealthyControl(data.formId, true);
             return ERR_OK;
         }
@@ -101,7 +106,7 @@ int BaseFormRefresh::DoControlCheck(RefreshData &data)
 
     // 3. Invisible check
     if (flags & CONTROL_CHECK_INVISIBLE) {
-        if (RefreshControlMgr::GetInstance().IsFormInvisible(data.record)) {
+        if (RefreshControlMgr::GetInstance().IsFormInvisible(*data.record)) {
             RefreshCacheMgr::GetInstance().AddFlagByInvisible(data.formId, config_.refreshType);
             return ERR_OK;
         }
@@ -109,15 +114,15 @@ int BaseFormRefresh::DoControlCheck(RefreshData &data)
 
     // 4. Screen off check
     if (flags & CONTROL_CHECK_SCREEN_OFF) {
-        if (RefreshControlMgr::GetInstance().IsScreenOff(data.record)) {
-            RefreshCacheMgr::GetInstance().AddFlagByScreenOff(data.formId, data.want, data.record);
+        if (RefreshControlMgr::GetInstance().IsScreenOff(*data.record)) {
+            RefreshCacheMgr::GetInstance().AddFlagByScreenOff(data.formId, data.want, *data.record);
             return ERR_OK;
         }
     }
 
     // 5. Need to fresh check
     if (flags & CONTROL_CHECK_NEED_TO_FRESH) {
-        if (!RefreshControlMgr::GetInstance().IsNeedToFresh(data.record, config_.isVisibleToFresh)) {
+        if (!RefreshControlMgr::GetInstance().IsNeedToFresh(*data.record, config_.isVisibleToFresh)) {
             FormDataMgr::GetInstance().SetNeedRefresh(data.formId, true);
             return ERR_OK;
         }
@@ -128,7 +133,7 @@ int BaseFormRefresh::DoControlCheck(RefreshData &data)
 
 int BaseFormRefresh::DoRefresh(RefreshData &data)
 {
-    FormRecord refreshRecord = FormDataMgr::GetInstance().GetFormAbilityInfo(data.record);
+    FormRecord refreshRecord = FormDataMgr::GetInstance().GetFormAbilityInfo(*data.record);
     ErrCode ret = RefreshExecMgr::AskForProviderData(data.formId, refreshRecord, data.want);
     if (ret != ERR_OK) {
         HILOG_ERROR("ask for provider data failed, ret:%{public}d, formId:%{public}" PRId64, ret, data.formId);
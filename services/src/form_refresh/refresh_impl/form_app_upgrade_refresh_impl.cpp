@@ -38,10 +38,10 @@ FormAppUpgradeRefreshImpl::~FormAppUpgradeRefreshImpl() {}
 
 int FormAppUpgradeRefreshImpl::DoRefresh(RefreshData &data)
 {
-    if (!FormMgrAdapterFacade::GetInstance().IsDeleteCacheInUpgradeScene(data.record)) {
+    if (!FormMgrAdapterFacade::GetInstance().IsDeleteCacheInUpgradeScene(*data.record)) {
         FormProviderData formProviderData;
         formProviderData.EnableDbCache(true);
-        FormMgrAdapterFacade::GetInstance().UpdateForm(data.formId, data.record.uid, formProviderData);
+        FormMgrAdapterFacade::GetInstance().UpdateForm(data.formId, data.record->uid, formProviderData);
         HILOG_INFO("Upgrade APP data agent card update, formId: %{public}" PRId64, data.formId);
     }
     return BaseFormRefresh::DoRefresh(data);
@@ -38,9 +38,11 @@ FormDataRefreshImpl::~FormDataRefreshImpl() {}
 int FormDataRefreshImpl::DoRefresh(RefreshData &data)
 {
     int ret = ERR_OK;
-    FormType formType = data.record.uiSyntax;
+    FormType formType = data.record->uiSyntax;
     if (formType == FormType::JS) {
-        ret = FormProviderMgr::GetInstance().UpdateForm(data.formId, data.record, data.providerData);
+        // UpdateForm merges the provider data into the record, so it works on a private copy.
+        FormRecord formRecord(*data.record);
+        ret = FormProviderMgr::GetInstance().UpdateForm(data.formId, formRecord, data.providerData);
         HILOG_INFO("update js form, ret:%{public}d, formId:%{public}" PRId64, ret, data.formId);
         return ret;
     }
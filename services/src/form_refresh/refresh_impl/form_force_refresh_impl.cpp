@@ -24,6 +24,10 @@ FormForceRefreshImpl::~FormForceRefreshImpl() {}
 
 int FormForceRefreshImpl::RefreshFormRequest(RefreshData &data)
 {
+    if (data.record == nullptr) {
+        HILOG_ERROR("null record, formId:%{public}" PRId64, data.formId);
+        return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
+    }
     return DoRefresh(data);
 }
 } // namespace AppExecFwk
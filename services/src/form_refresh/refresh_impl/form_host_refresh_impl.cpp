@@ -38,8 +38,11 @@ FormHostRefreshImpl::~FormHostRefreshImpl() {}
 
 int FormHostRefreshImpl::DoControlCheck(RefreshData &data)
 {
-    FormDataMgr::GetInstance().UpdateRefreshWant(data.formId, data.want, data.record);
-    FormDataMgr::GetInstance().UpdateFormRecord(data.formId, data.record);
+    // The snapshot is shared, so publish the updated refresh want as a new version.
+    FormRecord record(*data.record);
+    FormDataMgr::GetInstance().UpdateRefreshWant(data.formId, data.want, record);
+    FormDataMgr::GetInstance().UpdateFormRecord(data.formId, record);
+    data.record = std::make_shared<const FormRecord>(std::move(record));
     FormDataMgr::GetInstance().SetHostRefresh(data.formId, true);
     // Execute base class control checks
     int ret = BaseFormRefresh::DoControlCheck(data);
@@ -48,7 +51,7 @@ int FormHostRefreshImpl::DoControlCheck(RefreshData &data)
     }
 
     // System app set refresh type
-    if (data.record.isSystemApp) {
+    if (data.record->isSystemApp) {
         data.want.SetParam(Constants::PARAM_FORM_REFRESH_TYPE, Constants::REFRESHTYPE_HOST);
     }
 
@@ -38,7 +38,7 @@ FormNetConnRefreshImpl::~FormNetConnRefreshImpl() {}
 int FormNetConnRefreshImpl::DoRefresh(RefreshData &data)
 {
     // System app set refresh type
-    if (data.record.isSystemApp) {
+    if (data.record->isSystemApp) {
         data.want.SetParam(Constants::PARAM_FORM_REFRESH_TYPE, Constants::REFRESHTYPE_NETWORKCHANGED);
     }
     return BaseFormRefresh::DoRefresh(data);
@@ -49,7 +49,7 @@ int FormNextTimeRefreshImpl::DoRefresh(RefreshData &data)
         return ERR_APPEXECFWK_FORM_COMMON_CODE;
     }
 
-    if (data.record.isDataProxy) {
+    if (data.record->isDataProxy) {
         HILOG_INFO("data proxy form set next refresh time formId:%{public}" PRId64, data.formId);
     }
 
@@ -40,7 +40,7 @@ int FormRefreshAfterUncontrolImpl::RefreshFormRequest(RefreshData &data)
         return ret;
     }
 
-    if (RefreshControlMgr::GetInstance().IsHealthyControl(data.record)) {
+    if (RefreshControlMgr::GetInstance().IsHealthyControl(*data.record)) {
         RefreshCacheMgr::GetInstance().AddFlagByHealthyControl(data.formId, true);
         return ERR_OK;
     }
@@ -54,12 +54,12 @@ int FormRefreshAfterUncontrolImpl::RefreshFormRequest(RefreshData &data)
         return ERR_OK;
     }
 
-    if (!RefreshControlMgr::GetInstance().IsNeedToFresh(data.record, true)) {
+    if (!RefreshControlMgr::GetInstance().IsNeedToFresh(*data.record, true)) {
         FormDataMgr::GetInstance().SetNeedRefresh(data.formId, true);
         return ERR_OK;
     }
 
-    FormRecord refreshRecord = FormDataMgr::GetInstance().GetFormAbilityInfo(data.record);
+    FormRecord refreshRecord = FormDataMgr::GetInstance().GetFormAbilityInfo(*data.record);
     refreshRecord.isCountTimerRefresh = isCountTimerRefresh;
     refreshRecord.isTimerRefresh = isTimerRefresh;
     ret = RefreshExecMgr::AskForProviderData(data.formId, refreshRecord, data.want);
@@ -79,7 +79,7 @@ bool FormRefreshAfterUncontrolImpl::DetectControlPoint(
         FormDataMgr::GetInstance().SetTimerRefresh(data.formId, true);
     }
 
-    if (isTimerRefresh && RefreshControlMgr::GetInstance().IsFormInvisible(data.record)) {
+    if (isTimerRefresh && RefreshControlMgr::GetInstance().IsFormInvisible(*data.record)) {
         RefreshCacheMgr::GetInstance().AddFlagByInvisible(data.formId, refreshType);
         return false;
     }
@@ -92,7 +92,7 @@ bool FormRefreshAfterUncontrolImpl::DetectControlPoint(
         }
     }
 
-    if (data.record.isSystemApp &&
+    if (data.record->isSystemApp &&
         refreshType != Constants::REFRESHTYPE_DEFAULT && refreshType != Constants::REFRESHTYPE_VISIABLE) {
         data.want.SetParam(Constants::PARAM_FORM_REFRESH_TYPE, refreshType);
     } else {
@@ -103,8 +103,8 @@ bool FormRefreshAfterUncontrolImpl::DetectControlPoint(
         FormDataMgr::GetInstance().SetCountTimerRefresh(data.formId, true);
     }
 
-    if (RefreshControlMgr::GetInstance().IsScreenOff(data.record)) {
-        RefreshCacheMgr::GetInstance().AddFlagByScreenOff(data.formId, data.want, data.record);
+    if (RefreshControlMgr::GetInstance().IsScreenOff(*data.record)) {
+        RefreshCacheMgr::GetInstance().AddFlagByScreenOff(data.formId, data.want, *data.record);
         return false;
     }
 
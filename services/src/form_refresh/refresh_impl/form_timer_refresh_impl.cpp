@@ -39,9 +39,8 @@ FormTimerRefreshImpl::~FormTimerRefreshImpl() {}
 
 int FormTimerRefreshImpl::RefreshFormRequest(RefreshData &data)
 {
-    FormRecord record;
-    bool flag = FormDataMgr::GetInstance().GetFormRecord(data.formId, record);
-    if (!flag) {
+    std::shared_ptr<const FormRecord> record = FormDataMgr::GetInstance().GetFormRecordSnapshot(data.formId);
+    if (record == nullptr) {
         HILOG_ERROR("not exist such form:%{public}" PRId64 "", data.formId);
         return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
     }
@@ -58,7 +57,73 @@ int FormTimerRefreshImpl::RefreshFormRequest(RefreshData &data)
     return ERR_OK;
 }
 
+int FormTimerRefreshImpl::RefreshFormBatchRequest(std::vector<RefreshData> &batch)
+{
+    std::vector<RefreshData> newBatch;
+    newBatch.reserve(batch.size());
+    for (auto &data : batch) {
+        std::shared_ptr<const FormRecord> record = FormDataMgr::GetInstance().GetFormRecordSnapshot(data.formId);
+        if (record == nullptr) {
+            HILOG_ERROR("not exist such form:%{public}" PRId64 "", data.formId);
+            data.errorCode = ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
+            continue;
+        }
+        RefreshData newData(data);
+        BuildTimerWant(data.formTimer, newData.want);
+        newData.record = record;
+        newBatch.emplace_back(std::move(newData));
+    }
+    if (newBatch.empty()) {
+        return ERR_OK;
+    }
+
+    auto task = [newBatch]() {
+        FormTimerRefreshImpl::GetInstance().DealBatchRefresh(newBatch);
+    };
+    ffrt::submit(task);
+    return ERR_OK;
+}
+
 int FormTimerRefreshImpl::DealRefresh(const RefreshData &data)
+{
+    FormBatchRefreshItem item;
+    bool needConnect = false;
+    int ret = PrepareRefresh(data, item, needConnect);
+    if (ret != ERR_OK || !needConnect) {
+        return ret;
+    }
+
+    ret = RefreshExecMgr::AskForProviderData(item.formId, item.record, item.want);
+    if (ret != ERR_OK) {
+        HILOG_ERROR("ask for provider data failed, ret:%{public}d, formId:%{public}" PRId64, ret, item.formId);
+        return ret;
+    }
+
+    return ERR_OK;
+}
+
+void FormTimerRefreshImpl::DealBatchRefresh(const std::vector<RefreshData> &batch)
+{
+    std::vector<FormBatchRefreshItem> items;
+    items.reserve(batch.size());
+    for (const auto &data : batch) {
+        FormBatchRefreshItem item;
+        bool needConnect = false;
+        if (PrepareRefresh(data, item, needConnect) == ERR_OK && needConnect) {
+            items.emplace_back(std::move(item));
+        }
+    }
+    if (items.empty()) {
+        return;
+    }
+
+    int ret = RefreshExecMgr::AskForProviderDataBatch(items);
+    if (ret != ERR_OK) {
+        HILOG_ERROR("ask for provider data failed, ret:%{public}d, size:%{public}zu", ret, items.size());
+    }
+}
+
+int FormTimerRefreshImpl::PrepareRefresh(const RefreshData &data, FormBatchRefreshItem &item, bool &needConnect)
 {
     const std::vector<int32_t> checkTypes = { TYPE_UNTRUST_APP, TYPE_MULTI_ACTIVE_USERS, TYPE_ADD_FINISH };
     CheckValidFactor factor;
@@ -76,7 +141,7 @@ int FormTimerRefreshImpl::DealRefresh(const RefreshData &data)
     }
 
     RefreshData newData(data);
-    if (RefreshControlMgr::GetInstance().IsHealthyControl(newData.record)) {
+    if (RefreshControlMgr::GetInstance().IsHealthyControl(*newData.record)) {
         RefreshCacheMgr::GetInstance().AddFlagByHealthyControl(newData.formId, true);
         return ERR_OK;
     }
@@ -89,20 +154,17 @@ int FormTimerRefreshImpl::DealRefresh(const RefreshData &data)
         return ERR_OK;
     }
 
-    if (!RefreshControlMgr::GetInstance().IsNeedToFresh(newData.record, false)) {
+    if (!RefreshControlMgr::GetInstance().IsNeedToFresh(*newData.record, false)) {
         FormDataMgr::GetInstance().SetNeedRefresh(newData.formId, true);
         return ERR_OK;
     }
 
-    FormRecord refreshRecord = FormDataMgr::GetInstance().GetFormAbilityInfo(newData.record);
-    refreshRecord.isCountTimerRefresh = isCountTimerRefresh;
-    refreshRecord.isTimerRefresh = isTimerRefresh;
-    ret = RefreshExecMgr::AskForProviderData(newData.formId, refreshRecord, newData.want);
-    if (ret != ERR_OK) {
-        HILOG_ERROR("ask for provider data failed, ret:%{public}d, formId:%{public}" PRId64, ret, newData.formId);
-        return ret;
-    }
-
+    item.formId = newData.formId;
+    item.record = FormDataMgr::GetInstance().GetFormAbilityInfo(*newData.record);
+    item.record.isCountTimerRefresh = isCountTimerRefresh;
+    item.record.isTimerRefresh = isTimerRefresh;
+    item.want = newData.want;
+    needConnect = true;
     return ERR_OK;
 }
 
@@ -114,12 +176,12 @@ bool FormTimerRefreshImpl::DetectControlPoint(
         FormDataMgr::GetInstance().SetTimerRefresh(newData.formId, true);
     }
 
-    if (RefreshControlMgr::GetInstance().IsFormInvisible(newData.record)) {
+    if (RefreshControlMgr::GetInstance().IsFormInvisible(*newData.record)) {
         RefreshCacheMgr::GetInstance().AddFlagByInvisible(newData.formId, refreshType);
         return false;
     }
 
-    if (!newData.record.isSystemApp) {
+    if (!newData.record->isSystemApp) {
         newData.want.RemoveParam(Constants::PARAM_FORM_REFRESH_TYPE);
     }
 
@@ -127,8 +189,8 @@ bool FormTimerRefreshImpl::DetectControlPoint(
         FormDataMgr::GetInstance().SetCountTimerRefresh(newData.formId, true);
     }
 
-    if (RefreshControlMgr::GetInstance().IsScreenOff(newData.record)) {
-        RefreshCacheMgr::GetInstance().AddFlagByScreenOff(newData.formId, newData.want, newData.record);
+    if (RefreshControlMgr::GetInstance().IsScreenOff(*newData.record)) {
+        RefreshCacheMgr::GetInstance().AddFlagByScreenOff(newData.formId, newData.want, *newData.record);
         return false;
     }
 
@@ -78,7 +78,7 @@ void RefreshCacheMgr::ConsumeHealthyControlFlag(std::vector<FormRecord>::iterato
         Want want = CreateWant(record, userId);
         RefreshData data;
         data.formId = record->formId;
-        data.record = *record;
+        data.record = std::make_shared<const FormRecord>(*record);
         data.want = want;
         FormRefreshMgr::GetInstance().RequestRefresh(data, TYPE_UNCONTROL);
     }
@@ -132,9 +132,9 @@ void RefreshCacheMgr::ConsumeInvisibleFlag(const std::vector<FormRecord> &visibl
         }
         RefreshData data;
         data.formId = formId;
-        data.record = record;
+        data.record = std::make_shared<const FormRecord>(record);
         data.want = want;
-        batch.emplace_back(data);
+        batch.emplace_back(std::move(data));
     }
 
     if (!batch.empty()) {
@@ -142,11 +142,12 @@ void RefreshCacheMgr::ConsumeInvisibleFlag(const std::vector<FormRecord> &visibl
     }
 }
 
-void RefreshCacheMgr::AddFlagByScreenOff(const int64_t formId, const Want &want, FormRecord &record)
+void RefreshCacheMgr::AddFlagByScreenOff(const int64_t formId, const Want &want, const FormRecord &record)
 {
     HILOG_WARN("add screen off formId:%{public}" PRId64, formId);
-    FormDataMgr::GetInstance().UpdateRefreshWant(formId, want, record);
-    FormDataMgr::GetInstance().UpdateFormRecord(formId, record);
+    FormRecord newRecord(record);
+    FormDataMgr::GetInstance().UpdateRefreshWant(formId, want, newRecord);
+    FormDataMgr::GetInstance().UpdateFormRecord(formId, newRecord);
     FormDataMgr::GetInstance().SetHostRefresh(formId, true);
     FormDataMgr::GetInstance().SetNeedRefresh(formId, true);
 }
@@ -217,7 +218,7 @@ void RefreshCacheMgr::CosumeRefreshByDueControl(const std::vector<FormRecord> &d
     for (const auto &formRecord : disableFormRecords) {
         RefreshData data;
         data.formId = formRecord.formId;
-        data.record = formRecord;
+        data.record = std::make_shared<const FormRecord>(formRecord);
         FormRefreshMgr::GetInstance().RequestRefresh(data, TYPE_PROVIDER);
     }
 }
@@ -257,7 +258,7 @@ void RefreshCacheMgr::ConsumeAddUnfinishFlag(const int64_t formId, const int32_t
     }
     RefreshData data;
     data.formId = formId;
-    data.record = record;
+    data.record = std::make_shared<const FormRecord>(std::move(record));
     data.want = want;
     FormRefreshMgr::GetInstance().RequestRefresh(data, TYPE_UNCONTROL);
 }
@@ -51,6 +51,10 @@ int RefreshCheckMgr::IsBaseValidPass(const std::vector<int32_t> &types, const Ch
         HILOG_INFO("the refresh task need't check valid, formId:%{public}" PRId64, factor.formId);
         return ERR_OK;
     }
+    if (factor.record == nullptr) {
+        HILOG_ERROR("null record, formId:%{public}" PRId64, factor.formId);
+        return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
+    }
 
     int ret = ERR_OK;
     for (const auto type : types) {
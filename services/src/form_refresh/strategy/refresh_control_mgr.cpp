@@ -90,7 +90,7 @@ bool RefreshControlMgr::IsHealthyControl(const FormRecord &record)
     return false;
 }
 
-bool RefreshControlMgr::IsNeedToFresh(FormRecord &record, bool isVisibleToFresh)
+bool RefreshControlMgr::IsNeedToFresh(const FormRecord &record, bool isVisibleToFresh)
 {
     bool isEnableRefresh = FormDataMgr::GetInstance().IsEnableRefresh(record.formId);
     HILOG_INFO("isEnableRefresh is %{public}d", isEnableRefresh);
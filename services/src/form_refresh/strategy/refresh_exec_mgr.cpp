@@ -26,6 +26,11 @@ ErrCode RefreshExecMgr::AskForProviderData(const int64_t formId, const FormRecor
     return FormProviderMgr::GetInstance().ConnectAmsForRefresh(formId, record, want);
 }
 
+ErrCode RefreshExecMgr::AskForProviderDataBatch(const std::vector<FormBatchRefreshItem> &items)
+{
+    return FormProviderMgr::GetInstance().ConnectAmsForBatchRefresh(items);
+}
+
 ErrCode RefreshExecMgr::UpdateByProviderData(
     const int64_t formId, const FormProviderData &formProviderData, bool mergeData)
 {
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_render/form_render_delta_mgr.h"
+
+#include <cinttypes>
+
+#include "fms_log_wrapper.h"
+#include "form_constants.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+// Smaller documents are always sent in full, tracking them costs more than it saves.
+constexpr size_t MIN_PATCH_DATA_SIZE = 1024;
+// A patch is only sent when it is at most half of the full document.
+constexpr size_t PATCH_SIZE_RATIO = 2;
+
+bool ContainsNull(const nlohmann::json &value)
+{
+    if (value.is_null()) {
+        return true;
+    }
+    if (value.is_structured()) {
+        for (const auto &item : value) {
+            if (ContainsNull(item)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+}
+
+FormRenderDeltaMgr::FormRenderDeltaMgr() {}
+FormRenderDeltaMgr::~FormRenderDeltaMgr() {}
+
+bool FormRenderDeltaMgr::CreateMergePatch(const nlohmann::json &source, const nlohmann::json &target,
+    nlohmann::json &patch)
+{
+    if (!source.is_object() || !target.is_object()) {
+        patch = target;
+        return !ContainsNull(target);
+    }
+    patch = nlohmann::json::object();
+    for (auto iter = source.begin(); iter != source.end(); ++iter) {
+        if (!target.contains(iter.key())) {
+            patch[iter.key()] = nullptr;
+        }
+    }
+    for (auto iter = target.begin(); iter != target.end(); ++iter) {
+        auto sourceIter = source.find(iter.key());
+        if (sourceIter != source.end() && *sourceIter == iter.value()) {
+            continue;
+        }
+        nlohmann::json member;
+        if (!CreateMergePatch(sourceIter != source.end() ? *sourceIter : nlohmann::json(), iter.value(), member)) {
+            return false;
+        }
+        patch[iter.key()] = std::move(member);
+    }
+    return true;
+}
+
+void FormRenderDeltaMgr::PrepareRenderData(FormJsInfo &formJsInfo, Want &want)
+{
+    int64_t formId = formJsInfo.formId;
+    nlohmann::json data = formJsInfo.formProviderData.GetData();
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    if (formJsInfo.formData.size() < MIN_PATCH_DATA_SIZE || !data.is_object()) {
+        states_.erase(formId);
+        return;
+    }
+
+    RenderDataState &state = states_[formId];
+    int32_t revision = state.revision + 1;
+    auto renderType = want.GetIntParam(Constants::FORM_RENDER_TYPE_KEY, Constants::RENDER_FORM);
+    auto images = formJsInfo.formProviderData.GetImageDataMap();
+    nlohmann::json patch;
+    if (renderType == Constants::UPDATE_RENDERING_FORM && state.revision > 0 &&
+        state.ackedRevision == state.revision && CreateMergePatch(state.data, data, patch)) {
+        std::string patchData = patch.dump();
+        if (patchData.size() * PATCH_SIZE_RATIO <= formJsInfo.formData.size()) {
+            HILOG_DEBUG("formId:%{public}" PRId64 " patch %{public}zu of %{public}zu bytes", formId,
+                patchData.size(), formJsInfo.formData.size());
+            std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> changedImages;
+            for (const auto &image : images) {
+                auto iter = state.images.find(image.first);
+                if (iter == state.images.end() || iter->second.first != image.second.first) {
+                    changedImages.emplace(image);
+                }
+            }
+            // the render service only applies formData, so the full json is not sent along with the patch
+            nlohmann::json emptyData = nlohmann::json::object();
+            FormProviderData patchProviderData(emptyData);
+            patchProviderData.SetImageDataMap(changedImages);
+            formJsInfo.formProviderData = patchProviderData;
+            formJsInfo.formData = std::move(patchData);
+            want.SetParam(Constants::FORM_DATA_PATCH_BASE_REVISION, state.revision);
+        }
+    }
+
+    for (auto &image : images) {
+        state.images[image.first] = std::move(image.second);
+    }
+    state.revision = revision;
+    state.data = std::move(data);
+    want.SetParam(Constants::FORM_DATA_REVISION, revision);
+}
+
+bool FormRenderDeltaMgr::OnRenderTaskDone(int64_t formId, const Want &want, FormProviderData &formProviderData)
+{
+    int32_t revision = want.GetIntParam(Constants::FORM_DATA_REVISION, 0);
+    if (revision == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    auto iter = states_.find(formId);
+    if (iter == states_.end()) {
+        return false;
+    }
+    if (!want.GetBoolParam(Constants::FORM_DATA_PATCH_MISMATCH, false)) {
+        if (revision == iter->second.revision) {
+            iter->second.ackedRevision = revision;
+        }
+        return false;
+    }
+
+    HILOG_WARN("formId:%{public}" PRId64 " patch on revision %{public}d not applied, resend full data",
+        formId, revision);
+    formProviderData = FormProviderData(iter->second.data);
+    formProviderData.SetImageDataMap(iter->second.images);
+    if (!iter->second.images.empty()) {
+        formProviderData.SetImageDataState(FormProviderData::IMAGE_DATA_STATE_ADDED);
+    }
+    states_.erase(iter);
+    return true;
+}
+
+void FormRenderDeltaMgr::Invalidate(int64_t formId)
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    states_.erase(formId);
+}
+
+void FormRenderDeltaMgr::InvalidateAll()
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    states_.clear();
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -28,6 +28,7 @@
 #include "form_event_report.h"
 #include "form_host_interface.h"
 #include "form_mgr_errors.h"
+#include "form_render/form_render_delta_mgr.h"
 #include "form_render/form_sandbox_render_mgr_inner.h"
 #include "form_provider/form_supply_callback.h"
 #include "common/util/form_trust_mgr.h"
@@ -468,6 +469,11 @@ ErrCode FormRenderMgr::StopRenderingForm(
 ErrCode FormRenderMgr::RenderFormCallback(int64_t formId, const Want &want)
 {
     HILOG_DEBUG("call");
+    FormProviderData formProviderData;
+    if (FormRenderDeltaMgr::GetInstance().OnRenderTaskDone(formId, want, formProviderData)) {
+        WantParams wantParams;
+        return UpdateRenderingForm(formId, formProviderData, wantParams, false);
+    }
     return ERR_OK;
 }
 
@@ -27,6 +27,7 @@
 #include "form_event_report.h"
 #include "form_host_interface.h"
 #include "form_mgr_errors.h"
+#include "form_render/form_render_delta_mgr.h"
 #include "form_render/form_render_task_mgr.h"
 #include "form_provider/form_supply_callback.h"
 #include "status_mgr_center/form_status_task_mgr.h"
@@ -241,6 +242,9 @@ ErrCode FormRenderMgrInner::ReloadForm(
         HILOG_ERROR("null remoteObjectGotten");
         return ret;
     }
+    for (const auto &formRecord : formRecords) {
+        FormRenderDeltaMgr::GetInstance().Invalidate(formRecord.formId);
+    }
     Want want;
     FillBundleInfo(want, bundleName, userId);
     want.SetParam(Constants::FORM_SUPPLY_UID, std::to_string(userId) + bundleName);
@@ -472,6 +476,7 @@ ErrCode FormRenderMgrInner::checkConnectionsFormIds(std::vector<int64_t> formIds
 void FormRenderMgrInner::RerenderAllForms()
 {
     HILOG_WARN("FRS is died,notify host");
+    FormRenderDeltaMgr::GetInstance().InvalidateAll();
     std::unique_lock<std::shared_mutex> guard(renderRemoteObjMutex_);
     renderRemoteObj_ = nullptr;
     guard.unlock();
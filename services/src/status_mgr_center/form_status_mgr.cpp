@@ -87,8 +87,8 @@ bool FormStatusMgr::ExecStatusMachineTask(const int64_t formId, const FormFsmEve
     }
     FormFsmStatus status = FormStatus::GetInstance().GetFormStatus(formId);
 
-    FormStatusMachineInfo info;
-    if (!FormStatusTable::GetInstance().GetFormStatusInfo(status, event, info)) {
+    const FormStatusMachineInfo *info = FormStatusTable::GetInstance().GetFormStatusInfo(status, event);
+    if (info == nullptr) {
         HILOG_ERROR("get form status info failed, formId:%{public}" PRId64, formId);
         (void)FormStatusMgr::GetInstance().ReportStatusInfoError(formId, status, event);
         return false;
@@ -99,17 +99,17 @@ bool FormStatusMgr::ExecStatusMachineTask(const int64_t formId, const FormFsmEve
         formId,
         FormStatusPrint::FormStatusToString(status).c_str(),
         FormStatusPrint::FormEventToString(event).c_str(),
-        FormStatusPrint::FormStatusToString(info.nextStatus).c_str(),
-        static_cast<int32_t>(info.processType));
+        FormStatusPrint::FormStatusToString(info->nextStatus).c_str(),
+        static_cast<int32_t>(info->processType));
 
     // state machine switches to the next state.
-    FormStatus::GetInstance().SetFormStatus(formId, info.nextStatus);
+    FormStatus::GetInstance().SetFormStatus(formId, info->nextStatus);
 
     // state machine timeout process
-    FormStatusMgr::GetInstance().ExecFormTaskTimeout(formId, info.timeoutMs, event, status);
+    FormStatusMgr::GetInstance().ExecFormTaskTimeout(formId, info->timeoutMs, event, status);
 
     // state machine excute
-    FormStatusMgr::GetInstance().ExecFormTask(info.processType, formId, event, func);
+    FormStatusMgr::GetInstance().ExecFormTask(info->processType, formId, event, func);
     return true;
 }
 
@@ -281,64 +281,74 @@ void FormStatusMgr::ProcessTaskFromRetry(const int64_t formId)
 
 bool FormStatusMgr::HasFormEventQueue(const int64_t formId)
 {
-    std::shared_lock<std::shared_mutex> lock(formEventQueueMutex_);
-    return !(formEventQueueMap_.find(formId) == formEventQueueMap_.end());
+    std::shared_lock<std::shared_mutex> lock(formEventStateMutex_);
+    auto iter = formEventStateMap_.find(formId);
+    return iter != formEventStateMap_.end() && iter->second.eventQueue != nullptr;
 }
 
 const std::shared_ptr<FormEventQueue> FormStatusMgr::GetFormEventQueue(const int64_t formId)
 {
-    std::unique_lock<std::shared_mutex> lock(formEventQueueMutex_);
-    if (formEventQueueMap_.find(formId) == formEventQueueMap_.end()) {
-        std::shared_ptr<FormEventQueue> formEventQueue = std::make_shared<FormEventQueue>(formId);
-        formEventQueueMap_.emplace(formId, formEventQueue);
-        HILOG_INFO("formEventQueueMap_ insert, formId:%{public}" PRId64 ". ", formId);
+    std::unique_lock<std::shared_mutex> lock(formEventStateMutex_);
+    FormEventState &state = formEventStateMap_[formId];
+    if (state.eventQueue == nullptr) {
+        state.eventQueue = std::make_shared<FormEventQueue>(formId);
+        HILOG_INFO("formEventQueue insert, formId:%{public}" PRId64 ". ", formId);
     }
-
-    return formEventQueueMap_[formId];
+    return state.eventQueue;
 }
 
 void FormStatusMgr::DeleteFormEventQueue(const int64_t formId)
 {
-    std::unique_lock<std::shared_mutex> lock(formEventQueueMutex_);
-    auto iter = formEventQueueMap_.find(formId);
-    if (iter != formEventQueueMap_.end()) {
+    std::unique_lock<std::shared_mutex> lock(formEventStateMutex_);
+    auto iter = formEventStateMap_.find(formId);
+    if (iter != formEventStateMap_.end() && iter->second.eventQueue != nullptr) {
         HILOG_INFO("formId:%{public}" PRId64 ". ", formId);
-        formEventQueueMap_.erase(iter);
+        iter->second.eventQueue = nullptr;
+        EraseFormEventStateIfEmptyNolock(iter);
     }
 }
 
 std::string FormStatusMgr::GetFormEventId(const int64_t formId)
 {
-    std::shared_lock<std::shared_mutex> lock(formEventIdMapMutex_);
-    if (formEventIdMap_.find(formId) == formEventIdMap_.end()) {
+    int64_t eventId = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(formEventStateMutex_);
+        auto iter = formEventStateMap_.find(formId);
+        if (iter != formEventStateMap_.end()) {
+            eventId = iter->second.eventId;
+        }
+    }
+    if (eventId == 0) {
         HILOG_ERROR("eventId is not existed, formId:%{public}" PRId64 ".", formId);
         return "";
     }
-
-    HILOG_INFO("formId:%{public}" PRId64 ", eventId:%{public}s.", formId, (formEventIdMap_[formId]).c_str());
-    return formEventIdMap_[formId];
+    // the id travels to the render service as a string param, a counter value fits the small string buffer
+    return std::to_string(eventId);
 }
 
 void FormStatusMgr::SetFormEventId(const int64_t formId)
 {
-    int64_t eventId = FormUtil::GetCurrentNanosecond();
-    std::string tidString = std::to_string(eventId);
-    HILOG_INFO("formId:%{public}" PRId64 ", eventId:%{public}s.", formId, tidString.c_str());
-    std::unique_lock<std::shared_mutex> lock(formEventIdMapMutex_);
-    if (formEventIdMap_.find(formId) == formEventIdMap_.end()) {
-        formEventIdMap_.emplace(formId, std::to_string(eventId));
-        return;
-    }
-    formEventIdMap_[formId] = tidString;
+    int64_t eventId = nextEventId_.fetch_add(1, std::memory_order_relaxed);
+    HILOG_INFO("formId:%{public}" PRId64 ", eventId:%{public}" PRId64 ".", formId, eventId);
+    std::unique_lock<std::shared_mutex> lock(formEventStateMutex_);
+    formEventStateMap_[formId].eventId = eventId;
 }
 
 void FormStatusMgr::DeleteFormEventId(const int64_t formId)
 {
-    std::unique_lock<std::shared_mutex> lock(formEventIdMapMutex_);
-    auto iter = formEventIdMap_.find(formId);
-    if (iter != formEventIdMap_.end()) {
+    std::unique_lock<std::shared_mutex> lock(formEventStateMutex_);
+    auto iter = formEventStateMap_.find(formId);
+    if (iter != formEventStateMap_.end() && iter->second.eventId != 0) {
         HILOG_INFO("formId:%{public}" PRId64 ". ", formId);
-        formEventIdMap_.erase(iter);
+        iter->second.eventId = 0;
+        EraseFormEventStateIfEmptyNolock(iter);
+    }
+}
+
+void FormStatusMgr::EraseFormEventStateIfEmptyNolock(std::unordered_map<int64_t, FormEventState>::iterator iter)
+{
+    if (iter->second.eventQueue == nullptr && iter->second.eventId == 0) {
+        formEventStateMap_.erase(iter);
     }
 }
 
@@ -14,14 +14,15 @@
  */
 
 #include "status_mgr_center/form_status_table.h"
-#include <unordered_map>
+#include <array>
+#include <iterator>
 #include "fms_log_wrapper.h"
 #include "util/form_status_print.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 namespace {
-const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_INIT = {
+constexpr FormStatusMachineInfo FORM_STATUS_TRANSITIONS[] = {
     // INIT
     {
         FormFsmStatus::INIT,
@@ -51,9 +52,6 @@ const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_INIT = {
         FormFsmProcessType::PROCESS_TASK_DIRECT,
         FormEventTimeout::TIMEOUT_30_S,
     },
-};
-
-const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RENDERING = {
     // RENDERING
     {
         FormFsmStatus::RENDERING,
@@ -111,9 +109,7 @@ const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RENDERING = {
         FormFsmProcessType::PROCESS_TASK_RETRY,
         FormEventTimeout::TIMEOUT_NO_NEED,
     },
-};
-
-const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RENDERED = {
+    // RENDERED
     {
         FormFsmStatus::RENDERED,
         FormFsmEvent::RENDER_FORM,
@@ -142,9 +138,7 @@ const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RENDERED = {
         FormFsmProcessType::PROCESS_TASK_DIRECT,
         FormEventTimeout::TIMEOUT_30_S,
     },
-};
-
-const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RECYCLED = {
+    // RECYCLED
     {
         FormFsmStatus::RECYCLED,
         FormFsmEvent::RENDER_FORM,
@@ -173,9 +167,7 @@ const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RECYCLED = {
         FormFsmProcessType::PROCESS_TASK_DIRECT,
         FormEventTimeout::TIMEOUT_30_S,
     },
-};
-
-const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RECYCLING_DATA = {
+    // RECYCLING_DATA
     {
         FormFsmStatus::RECYCLING_DATA,
         FormFsmEvent::RENDER_FORM,
@@ -232,9 +224,7 @@ const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RECYCLING_DATA = {
         FormFsmProcessType::PROCESS_TASK_DIRECT,
         FormEventTimeout::TIMEOUT_NO_NEED,
     },
-};
-
-const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RECYCLING = {
+    // RECYCLING
     {
         FormFsmStatus::RECYCLING,
         FormFsmEvent::RENDER_FORM,
@@ -284,9 +274,7 @@ const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RECYCLING = {
         FormFsmProcessType::PROCESS_TASK_RETRY,
         FormEventTimeout::TIMEOUT_NO_NEED,
     },
-};
-
-const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RECOVERING = {
+    // RECOVERING
     {
         FormFsmStatus::RECOVERING,
         FormFsmEvent::RENDER_FORM,
@@ -336,9 +324,7 @@ const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_RECOVERING = {
         FormFsmProcessType::PROCESS_TASK_RETRY,
         FormEventTimeout::TIMEOUT_NO_NEED,
     },
-};
-
-const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_DELETING = {
+    // DELETING
     {
         FormFsmStatus::DELETING,
         FormFsmEvent::RENDER_FORM,
@@ -381,9 +367,7 @@ const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_DELETING = {
         FormFsmProcessType::PROCESS_TASK_RETRY,
         FormEventTimeout::TIMEOUT_NO_NEED,
     },
-};
-
-const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_UNPROCESSABLE = {
+    // UNPROCESSABLE
     {
         FormFsmStatus::UNPROCESSABLE,
         FormFsmEvent::RENDER_FORM,
@@ -421,17 +405,40 @@ const std::vector<FormStatusMachineInfo> FORM_STATUS_TABLE_UNPROCESSABLE = {
     },
 };
 
-const std::unordered_map<FormFsmStatus, std::vector<FormStatusMachineInfo>> FORM_STATUS_TABLE = {
-    {FormFsmStatus::INIT, FORM_STATUS_TABLE_INIT},
-    {FormFsmStatus::RENDERING, FORM_STATUS_TABLE_RENDERING},
-    {FormFsmStatus::RENDERED, FORM_STATUS_TABLE_RENDERED},
-    {FormFsmStatus::RECYCLED, FORM_STATUS_TABLE_RECYCLED},
-    {FormFsmStatus::RECYCLING_DATA, FORM_STATUS_TABLE_RECYCLING_DATA},
-    {FormFsmStatus::RECYCLING, FORM_STATUS_TABLE_RECYCLING},
-    {FormFsmStatus::RECOVERING, FORM_STATUS_TABLE_RECOVERING},
-    {FormFsmStatus::DELETING, FORM_STATUS_TABLE_DELETING},
-    {FormFsmStatus::UNPROCESSABLE, FORM_STATUS_TABLE_UNPROCESSABLE},
+constexpr size_t FORM_FSM_STATUS_COUNT = static_cast<size_t>(FormFsmStatus::UNPROCESSABLE) + 1;
+constexpr size_t FORM_FSM_EVENT_COUNT = static_cast<size_t>(FormFsmEvent::RELOAD_FORM) + 1;
+
+struct FormStatusTableEntry {
+    bool isValid;
+    FormStatusMachineInfo info;
 };
+
+using FormStatusMatrix = std::array<std::array<FormStatusTableEntry, FORM_FSM_EVENT_COUNT>, FORM_FSM_STATUS_COUNT>;
+
+constexpr FormStatusMatrix BuildFormStatusMatrix()
+{
+    FormStatusMatrix matrix {};
+    for (const auto &info : FORM_STATUS_TRANSITIONS) {
+        matrix[static_cast<size_t>(info.curStatus)][static_cast<size_t>(info.event)] = { true, info };
+    }
+    return matrix;
+}
+
+constexpr size_t CountValidEntries(const FormStatusMatrix &matrix)
+{
+    size_t count = 0;
+    for (const auto &row : matrix) {
+        for (const auto &entry : row) {
+            count += entry.isValid ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+// Dense (status, event) table built at compile time, a lookup is two array indexes.
+constexpr FormStatusMatrix FORM_STATUS_MATRIX = BuildFormStatusMatrix();
+static_assert(CountValidEntries(FORM_STATUS_MATRIX) == std::size(FORM_STATUS_TRANSITIONS),
+    "duplicate (status, event) pair in FORM_STATUS_TRANSITIONS");
 }  // namespace
 
 FormStatusTable::FormStatusTable()
@@ -444,28 +451,28 @@ FormStatusTable::~FormStatusTable()
     HILOG_DEBUG("destroy FormStatusTable");
 }
 
-bool FormStatusTable::GetFormStatusInfo(FormFsmStatus curStatus, FormFsmEvent event, FormStatusMachineInfo &info)
+const FormStatusMachineInfo *FormStatusTable::GetFormStatusInfo(FormFsmStatus curStatus, FormFsmEvent event) const
 {
-    auto iter = FORM_STATUS_TABLE.find(curStatus);
-    if (iter == FORM_STATUS_TABLE.end()) {
+    auto statusIndex = static_cast<size_t>(curStatus);
+    auto eventIndex = static_cast<size_t>(event);
+    if (statusIndex >= FORM_FSM_STATUS_COUNT || eventIndex >= FORM_FSM_EVENT_COUNT ||
+        !FORM_STATUS_MATRIX[statusIndex][eventIndex].isValid) {
         HILOG_ERROR("form status error, curStatus is %{public}s, event is %{public}s.",
             FormStatusPrint::FormStatusToString(curStatus).c_str(),
             FormStatusPrint::FormEventToString(event).c_str());
-        return false;
+        return nullptr;
     }
+    return &FORM_STATUS_MATRIX[statusIndex][eventIndex].info;
+}
 
-    auto tableInfo = iter->second;
-    for (size_t i = 0; i < tableInfo.size(); i++) {
-        if (tableInfo[i].event == event) {
-            info = tableInfo[i];
-            return true;
-        }
+bool FormStatusTable::GetFormStatusInfo(FormFsmStatus curStatus, FormFsmEvent event, FormStatusMachineInfo &info)
+{
+    const FormStatusMachineInfo *statusInfo = GetFormStatusInfo(curStatus, event);
+    if (statusInfo == nullptr) {
+        return false;
     }
-
-    HILOG_ERROR("form status error, curStatus is %{public}s, event is %{public}s.",
-        FormStatusPrint::FormStatusToString(curStatus).c_str(),
-        FormStatusPrint::FormEventToString(event).c_str());
-    return false;
+    info = *statusInfo;
+    return true;
 }
 }  // namespace AppExecFwk
 }  // namespace OHOS
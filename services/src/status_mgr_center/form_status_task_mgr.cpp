@@ -27,6 +27,7 @@
 #include "form_event_report.h"
 #include "form_mgr/form_mgr_queue.h"
 #include "form_provider/form_supply_callback.h"
+#include "form_render/form_render_delta_mgr.h"
 #include "status_mgr_center/form_event_retry_mgr.h"
 #include "status_mgr_center/form_status_queue.h"
 #include "status_mgr_center/form_status_mgr.h"
@@ -335,6 +336,7 @@ void FormStatusTaskMgr::RecycleForm(const int64_t &formId, const sptr<IRemoteObj
         HILOG_ERROR("form %{public}" PRId64 " not exist", formId);
         return;
     }
+    FormRenderDeltaMgr::GetInstance().Invalidate(formId);
 
     Want want;
     want.SetParam(Constants::FORM_SUPPLY_UID, std::to_string(formRecord.providerUserId) + formRecord.bundleName);
@@ -452,6 +454,7 @@ void FormStatusTaskMgr::StopRenderingForm(
         return;
     }
 
+    FormRenderDeltaMgr::GetInstance().Invalidate(formRecord.formId);
     FormJsInfo formInfo;
     FormDataMgr::GetInstance().CreateFormJsInfo(formRecord.formId, formRecord, formInfo);
     Want newWant(want);
@@ -488,6 +491,7 @@ void FormStatusTaskMgr::RenderForm(
     Want newWant(want);
     std::string eventId = FormStatusMgr::GetInstance().GetFormEventId(formRecord.formId);
     newWant.SetParam(Constants::FORM_STATUS_EVENT_ID, eventId);
+    FormRenderDeltaMgr::GetInstance().PrepareRenderData(formJsInfo, newWant);
 
     int32_t error = remoteFormRender->RenderForm(formJsInfo, newWant, FormSupplyCallback::GetInstance());
     FormRecordReport::GetInstance().IncreaseUpdateTimes(formRecord.formId, HiSysEventPointType::TYPE_DAILY_REFRESH);
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+
+#define private public
+#include "feature/bundle_forbidden/form_bundle_forbid_mgr.h"
+#undef private
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace {
+constexpr int32_t BUNDLE_COUNT = 64;
+constexpr int32_t READER_THREADS = 16;
+constexpr int64_t WRITE_INTERVAL = 1000;
+const std::string BUNDLE_PREFIX = "com.form.benchmark";
+
+/**
+ * @brief Query path before snapshots: every query took the exclusive lock to check the init flag,
+ *        then the shared lock to read.
+ */
+class LegacyForbidSet {
+public:
+    bool IsBundleForbidden(const std::string &bundleName)
+    {
+        if (!Init()) {
+            return false;
+        }
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return bundles_.find(bundleName) != bundles_.end();
+    }
+
+    void SetBundleForbiddenStatus(const std::string &bundleName, bool isForbidden)
+    {
+        Init();
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (isForbidden) {
+            bundles_.insert(bundleName);
+        } else {
+            bundles_.erase(bundleName);
+        }
+    }
+
+private:
+    bool Init()
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (isInitialized_) {
+            return true;
+        }
+        for (int32_t i = 0; i < BUNDLE_COUNT; i += 2) {
+            bundles_.insert(BUNDLE_PREFIX + std::to_string(i));
+        }
+        isInitialized_ = true;
+        return true;
+    }
+
+    bool isInitialized_ = false;
+    std::set<std::string> bundles_;
+    std::shared_mutex mutex_;
+};
+
+LegacyForbidSet g_legacyForbidSet;
+
+void InitForbidMgr()
+{
+    std::set<std::string> bundles;
+    for (int32_t i = 0; i < BUNDLE_COUNT; i += 2) {
+        bundles.insert(BUNDLE_PREFIX + std::to_string(i));
+    }
+    FormBundleForbidMgr &forbidMgr = FormBundleForbidMgr::GetInstance();
+    forbidMgr.formBundleForbiddenSet_.Reset(std::move(bundles));
+    forbidMgr.isInitialized_ = true;
+}
+
+std::string GetBundleName(int64_t index)
+{
+    return BUNDLE_PREFIX + std::to_string(index % BUNDLE_COUNT);
+}
+}
+
+static void LegacyForbidQueryTestCase(benchmark::State &state)
+{
+    std::string bundleName = GetBundleName(state.thread_index());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g_legacyForbidSet.IsBundleForbidden(bundleName));
+    }
+}
+
+static void SnapshotForbidQueryTestCase(benchmark::State &state)
+{
+    if (state.thread_index() == 0) {
+        InitForbidMgr();
+    }
+    std::string bundleName = GetBundleName(state.thread_index());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(FormBundleForbidMgr::GetInstance().IsBundleForbidden(bundleName));
+    }
+}
+
+static void LegacyForbidQueryWithWriterTestCase(benchmark::State &state)
+{
+    std::string bundleName = GetBundleName(state.thread_index());
+    int64_t count = 0;
+    for (auto _ : state) {
+        if (state.thread_index() == 0 && ++count % WRITE_INTERVAL == 0) {
+            g_legacyForbidSet.SetBundleForbiddenStatus(bundleName, (count / WRITE_INTERVAL) % 2 == 0);
+        }
+        benchmark::DoNotOptimize(g_legacyForbidSet.IsBundleForbidden(bundleName));
+    }
+}
+
+static void SnapshotForbidQueryWithWriterTestCase(benchmark::State &state)
+{
+    if (state.thread_index() == 0) {
+        InitForbidMgr();
+    }
+    FormBundleForbidMgr &forbidMgr = FormBundleForbidMgr::GetInstance();
+    std::string bundleName = GetBundleName(state.thread_index());
+    int64_t count = 0;
+    for (auto _ : state) {
+        if (state.thread_index() == 0 && ++count % WRITE_INTERVAL == 0) {
+            // publish through the snapshot set directly, the benchmark has no rdb table to write
+            std::lock_guard<std::mutex> lock(forbidMgr.bundleForbiddenSetMutex_);
+            if ((count / WRITE_INTERVAL) % 2 == 0) {
+                forbidMgr.formBundleForbiddenSet_.Insert(bundleName);
+            } else {
+                forbidMgr.formBundleForbiddenSet_.Erase(bundleName);
+            }
+        }
+        benchmark::DoNotOptimize(forbidMgr.IsBundleForbidden(bundleName));
+    }
+}
+
+BENCHMARK(LegacyForbidQueryTestCase)->Threads(1)->Threads(READER_THREADS)->UseRealTime();
+BENCHMARK(SnapshotForbidQueryTestCase)->Threads(1)->Threads(READER_THREADS)->UseRealTime();
+BENCHMARK(LegacyForbidQueryWithWriterTestCase)->Threads(READER_THREADS)->UseRealTime();
+BENCHMARK(SnapshotForbidQueryWithWriterTestCase)->Threads(READER_THREADS)->UseRealTime();
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <set>
+#include <vector>
+
+#include "form_host_client.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace {
+constexpr int64_t FORM_ID_BASE = 100000;
+constexpr int32_t HOST_FORM_COUNT = 200;
+// stands for the work of an ArkTS callback
+constexpr int32_t CALLBACK_WORK_LOOPS = 500;
+
+void DoCallbackWork()
+{
+    for (int32_t i = 0; i < CALLBACK_WORK_LOOPS; i++) {
+        benchmark::DoNotOptimize(i);
+    }
+}
+
+class BenchmarkFormCallback : public FormCallbackInterface {
+public:
+    BenchmarkFormCallback() = default;
+    ~BenchmarkFormCallback() override = default;
+
+    void ProcessFormUpdate(const FormJsInfo &formJsInfo) override
+    {
+        DoCallbackWork();
+    }
+
+    void ProcessFormUninstall(const int64_t formId) override {}
+
+    void OnDeathReceived() override {}
+
+    void OnError(const int32_t errorCode, const std::string &errorMsg) override {}
+
+    void ProcessLockForm(bool lock) override
+    {
+        DoCallbackWork();
+    }
+};
+
+/**
+ * @brief Registry layout before sharding: one map behind one mutex, callbacks run under the mutex
+ *        and a batch takes the mutex once per form.
+ */
+class LegacyFormCallbackRegistry {
+public:
+    void AddForm(const std::shared_ptr<FormCallbackInterface> &formCallback, int64_t formId)
+    {
+        std::lock_guard<std::mutex> lock(callbackMutex_);
+        formCallbackMap_[formId].emplace(formCallback);
+    }
+
+    void UpdateForm(const FormJsInfo &formJsInfo)
+    {
+        std::lock_guard<std::mutex> lock(callbackMutex_);
+        auto iter = formCallbackMap_.find(formJsInfo.formId);
+        if (iter == formCallbackMap_.end()) {
+            return;
+        }
+        for (const auto &callback : iter->second) {
+            callback->ProcessFormUpdate(formJsInfo);
+        }
+    }
+
+    void OnLockForm(const std::vector<int64_t> &formIds, bool lock)
+    {
+        for (int64_t formId : formIds) {
+            std::lock_guard<std::mutex> lockMutex(callbackMutex_);
+            auto iter = formCallbackMap_.find(formId);
+            if (iter == formCallbackMap_.end()) {
+                continue;
+            }
+            for (const auto &callback : iter->second) {
+                callback->ProcessLockForm(lock);
+            }
+        }
+    }
+
+private:
+    std::mutex callbackMutex_;
+    std::map<int64_t, std::set<std::shared_ptr<FormCallbackInterface>>> formCallbackMap_;
+};
+
+struct HostForms {
+    sptr<FormHostClient> formHostClient;
+    LegacyFormCallbackRegistry legacyRegistry;
+    std::vector<FormJsInfo> formJsInfos;
+    std::vector<int64_t> formIds;
+};
+
+/**
+ * @brief Forms shared by every benchmark thread, each form has its own callback as in a host with many cards.
+ */
+HostForms &GetHostForms()
+{
+    static HostForms hostForms = []() {
+        HostForms forms;
+        forms.formHostClient = new (std::nothrow) FormHostClient();
+        for (int32_t i = 0; i < HOST_FORM_COUNT; i++) {
+            FormJsInfo formJsInfo;
+            formJsInfo.formId = FORM_ID_BASE + i;
+            formJsInfo.uiSyntax = FormType::ETS;
+            auto callback = std::make_shared<BenchmarkFormCallback>();
+            forms.formHostClient->AddForm(callback, formJsInfo);
+            forms.legacyRegistry.AddForm(callback, formJsInfo.formId);
+            forms.formJsInfos.emplace_back(formJsInfo);
+            forms.formIds.emplace_back(formJsInfo.formId);
+        }
+        return forms;
+    }();
+    return hostForms;
+}
+}
+
+static void LegacyUpdateTestCase(benchmark::State &state)
+{
+    HostForms &hostForms = GetHostForms();
+    while (state.KeepRunning()) {
+        for (const auto &formJsInfo : hostForms.formJsInfos) {
+            hostForms.legacyRegistry.UpdateForm(formJsInfo);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * HOST_FORM_COUNT);
+}
+
+static void ShardedUpdateTestCase(benchmark::State &state)
+{
+    HostForms &hostForms = GetHostForms();
+    while (state.KeepRunning()) {
+        for (const auto &formJsInfo : hostForms.formJsInfos) {
+            hostForms.formHostClient->UpdateForm(formJsInfo);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * HOST_FORM_COUNT);
+}
+
+static void LegacyBatchLockTestCase(benchmark::State &state)
+{
+    HostForms &hostForms = GetHostForms();
+    while (state.KeepRunning()) {
+        hostForms.legacyRegistry.OnLockForm(hostForms.formIds, true);
+    }
+    state.SetItemsProcessed(state.iterations() * HOST_FORM_COUNT);
+}
+
+static void ShardedBatchLockTestCase(benchmark::State &state)
+{
+    HostForms &hostForms = GetHostForms();
+    while (state.KeepRunning()) {
+        hostForms.formHostClient->OnLockForm(hostForms.formIds, true);
+    }
+    state.SetItemsProcessed(state.iterations() * HOST_FORM_COUNT);
+}
+
+BENCHMARK(LegacyUpdateTestCase)->Threads(1)->Threads(4)->Threads(8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(ShardedUpdateTestCase)->Threads(1)->Threads(4)->Threads(8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(LegacyBatchLockTestCase)->Threads(1)->Threads(4)->Threads(8)->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(ShardedBatchLockTestCase)->Threads(1)->Threads(4)->Threads(8)->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
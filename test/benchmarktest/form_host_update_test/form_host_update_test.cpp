@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data_center/form_record/form_record.h"
+#include "form_host_stub.h"
+#include "form_provider_data.h"
+#define private public
+#include "form_host/form_host_task_mgr.h"
+#undef private
+#include "message_parcel.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace {
+constexpr int64_t FORM_ID_BASE = 100000;
+constexpr int32_t HOST_FORM_COUNT = 50;
+constexpr int32_t UPDATES_PER_FORM = 2;
+constexpr int32_t FORM_DATA_SIZE = 512;
+
+/**
+ * @brief Host stub counting the calls it receives. A local stub is reached without binder, so every call
+ *        writes and reads its form infos through a MessageParcel the way the proxy and the stub would.
+ */
+class CountingFormHost : public FormHostStub {
+public:
+    void OnAcquired(const FormJsInfo &formInfo, const sptr<IRemoteObject> &token) override {}
+    void OnUpdate(const FormJsInfo &formInfo) override
+    {
+        callCount_++;
+        updateCount_ += RoundTrip({ formInfo });
+    }
+    int32_t OnBatchUpdate(const std::vector<FormJsInfo> &formInfos) override
+    {
+        callCount_++;
+        updateCount_ += RoundTrip(formInfos);
+        return ERR_OK;
+    }
+    void OnUninstall(const std::vector<int64_t> &formIds) override {}
+    void OnAcquireState(FormState state, const AAFwk::Want &want) override {}
+    void OnShareFormResponse(int64_t requestCode, int32_t result) override {}
+    void OnError(int32_t errorCode, const std::string &errorMsg) override {}
+    void OnError(int32_t errorCode, const std::string &errorMsg, std::vector<int64_t> &formIds) override {}
+    void OnAcquireDataResponse(const AAFwk::WantParams &wantParams, int64_t requestCode) override {}
+
+    uint64_t callCount_ = 0;
+    uint64_t updateCount_ = 0;
+
+private:
+    static uint64_t RoundTrip(const std::vector<FormJsInfo> &formInfos)
+    {
+        MessageParcel data;
+        for (const auto &formInfo : formInfos) {
+            data.WriteParcelable(&formInfo);
+        }
+        uint64_t readCount = 0;
+        for (size_t i = 0; i < formInfos.size(); i++) {
+            std::unique_ptr<FormJsInfo> formInfo(data.ReadParcelable<FormJsInfo>());
+            if (formInfo != nullptr) {
+                readCount++;
+            }
+        }
+        return readCount;
+    }
+};
+
+/**
+ * @brief The updates of one round: every form of the host is updated UPDATES_PER_FORM times within
+ *        one flush window, as a provider refreshing its data and then its images does.
+ */
+std::vector<std::pair<int64_t, FormRecord>> BuildUpdateStream()
+{
+    FormProviderData formProviderData(std::string("{\"data\":\"") + std::string(FORM_DATA_SIZE, 'a') + "\"}");
+    std::vector<std::pair<int64_t, FormRecord>> updates;
+    for (int32_t round = 0; round < UPDATES_PER_FORM; round++) {
+        for (int32_t i = 0; i < HOST_FORM_COUNT; i++) {
+            FormRecord record;
+            record.formId = FORM_ID_BASE + i;
+            record.formName = "widget" + std::to_string(i);
+            record.bundleName = "com.form.benchmark";
+            record.abilityName = "FormAbility";
+            record.moduleName = "entry";
+            record.formProviderInfo.SetFormData(formProviderData);
+            updates.emplace_back(record.formId, record);
+        }
+    }
+    return updates;
+}
+
+void ReportCounters(benchmark::State &state, const sptr<CountingFormHost> &host)
+{
+    double rounds = static_cast<double>(state.iterations());
+    state.counters["ipc_per_round"] = benchmark::Counter(static_cast<double>(host->callCount_) / rounds);
+    state.counters["updates_per_round"] = benchmark::Counter(static_cast<double>(host->updateCount_) / rounds);
+}
+}
+
+/**
+ * @brief Every update of the stream delivered on its own, as before updates were buffered per host.
+ */
+static void HostUpdateSingleTestCase(benchmark::State &state)
+{
+    FormHostTaskMgr taskMgr;
+    sptr<CountingFormHost> host = new CountingFormHost();
+    sptr<IRemoteObject> remoteObject = host->AsObject();
+    std::vector<std::pair<int64_t, FormRecord>> updates = BuildUpdateStream();
+    for (auto _ : state) {
+        for (const auto &update : updates) {
+            taskMgr.UpdateTaskToHost(update.first, update.second, remoteObject);
+        }
+    }
+    ReportCounters(state, host);
+}
+
+/**
+ * @brief The same stream posted to FormHostTaskMgr and flushed the way the flush window task does.
+ */
+static void HostUpdateCoalescedTestCase(benchmark::State &state)
+{
+    FormHostTaskMgr taskMgr;
+    sptr<CountingFormHost> host = new CountingFormHost();
+    sptr<IRemoteObject> remoteObject = host->AsObject();
+    std::vector<std::pair<int64_t, FormRecord>> updates = BuildUpdateStream();
+    for (auto _ : state) {
+        for (const auto &update : updates) {
+            taskMgr.PostUpdateTaskToHost(update.first, update.second, remoteObject);
+        }
+        taskMgr.FlushUpdatesToHost(remoteObject);
+    }
+    ReportCounters(state, host);
+}
+
+BENCHMARK(HostUpdateSingleTestCase)->Unit(benchmark::kMicrosecond);
+BENCHMARK(HostUpdateCoalescedTestCase)->Unit(benchmark::kMicrosecond);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
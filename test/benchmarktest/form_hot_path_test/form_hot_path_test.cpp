@@ -0,0 +1,510 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bms_mgr/form_bms_helper.h"
+#include "common/util/form_util.h"
+#include "data_center/database/form_db_cache.h"
+#include "data_center/form_data_mgr.h"
+#include "data_center/form_info/form_item_info.h"
+#include "form_constants.h"
+#include "form_js_info.h"
+#include "form_provider_data.h"
+#include "form_refresh/refresh_impl/base_form_refresh.h"
+#include "form_refresh/strategy/refresh_check_mgr.h"
+#include "message_parcel.h"
+#include "status_mgr_center/form_status.h"
+#define private public
+#include "common/timer_mgr/form_timer_mgr.h"
+#include "data_center/database/form_rdb_data_mgr.h"
+#include "status_mgr_center/form_status_mgr.h"
+#undef private
+#include "mock_bundle_mgr.h"
+#include "mock_rdb_store.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace {
+constexpr int64_t FORM_ID_BASE = 100000;
+constexpr int32_t CALLING_UID = 20000001;
+constexpr int32_t BUNDLE_COUNT = 50;
+constexpr int32_t LOOKUP_COUNT = 1000;
+constexpr int32_t REFRESH_FORM_COUNT = 1000;
+constexpr int32_t REGISTERED_TIMER_COUNT = 10000;
+constexpr int32_t DB_FORM_COUNT = 1000;
+constexpr int32_t STATUS_FORM_COUNT = 1000;
+constexpr size_t SMALL_DATA_SIZE = 1024;
+// above FormJsInfo::BIG_DATA and the provider data threshold, so the payload goes through ashmem
+constexpr size_t BIG_DATA_SIZE = FormJsInfo::BIG_DATA * 4;
+const std::string BUNDLE_NAME_PREFIX = "com.form.benchmark";
+const std::string JSON_OUT_ARG = "--benchmark_out=";
+const std::string JSON_OUT_FORMAT_ARG = "--benchmark_out_format=json";
+const std::string DEFAULT_JSON_OUT = "/data/local/tmp/form_hot_path_benchmark.json";
+const std::vector<FormFsmEvent> RECYCLE_CYCLE_EVENTS = {
+    FormFsmEvent::RECYCLE_DATA, FormFsmEvent::RECYCLE_DATA_DONE, FormFsmEvent::RECYCLE_FORM,
+    FormFsmEvent::RECYCLE_FORM_DONE, FormFsmEvent::RECOVER_FORM, FormFsmEvent::RECOVER_FORM_DONE,
+};
+
+std::string GetBundleName(int32_t index)
+{
+    return BUNDLE_NAME_PREFIX + std::to_string(index % BUNDLE_COUNT);
+}
+
+void AllotFormRecords(int32_t count)
+{
+    for (int32_t i = 0; i < count; i++) {
+        FormItemInfo itemInfo;
+        itemInfo.SetFormId(FORM_ID_BASE + i);
+        itemInfo.SetProviderBundleName(GetBundleName(i));
+        itemInfo.SetHostBundleName(GetBundleName(i));
+        itemInfo.SetModuleName("entry");
+        itemInfo.SetAbilityName("FormAbility");
+        itemInfo.SetFormName("widget" + std::to_string(i));
+        itemInfo.SetEnableUpdateFlag(true);
+        itemInfo.SetUpdateDuration(1);
+        FormDataMgr::GetInstance().AllotFormRecord(itemInfo, CALLING_UID);
+    }
+}
+
+void DeleteFormRecords(int32_t count)
+{
+    for (int32_t i = 0; i < count; i++) {
+        FormDataMgr::GetInstance().DeleteFormRecord(FORM_ID_BASE + i);
+    }
+}
+
+/**
+ * @brief Stand-ins of the bundle manager and the form rdb store, nothing leaves the process.
+ *        The rdb store is installed before the first FormDbCache use so the tables are created on it.
+ */
+void InstallStandIns()
+{
+    sptr<MockBundleMgrStub> bundleMgrStub = new (std::nothrow) MockBundleMgrStub();
+    sptr<MockBundleMgrProxy> bundleMgrProxy = new (std::nothrow) MockBundleMgrProxy(bundleMgrStub);
+    FormBmsHelper::GetInstance().SetBundleManager(bundleMgrProxy);
+
+    RdbStoreConfig config("", NativeRdb::StorageMode::MODE_DISK, false, std::vector<uint8_t>(),
+        Constants::FORM_JOURNAL_MODE, Constants::FORM_SYNC_MODE, "", NativeRdb::SecurityLevel::S1);
+    FormRdbDataMgr::GetInstance().rdbStore_ = std::make_shared<testing::NiceMock<MockRdbStore>>(config);
+}
+
+/**
+ * @brief Refresh with the provider connection replaced by a no-op, so only the checker chain is measured.
+ */
+class StandInFormRefresh : public BaseFormRefresh {
+public:
+    StandInFormRefresh() : BaseFormRefresh(MakeConfig()) {}
+    ~StandInFormRefresh() override = default;
+
+protected:
+    int DoRefresh(RefreshData &data) override
+    {
+        return ERR_OK;
+    }
+
+private:
+    static RefreshConfig MakeConfig()
+    {
+        RefreshConfig config;
+        config.checkTypes = { TYPE_UNTRUST_APP, TYPE_CALLING_USER, TYPE_ACTIVE_USER };
+        config.controlCheckFlags = CONTROL_CHECK_HEALTHY_CONTROL | CONTROL_CHECK_INVISIBLE |
+            CONTROL_CHECK_SCREEN_OFF | CONTROL_CHECK_NEED_TO_FRESH;
+        return config;
+    }
+};
+
+FormJsInfo MakeFormJsInfo(size_t dataSize)
+{
+    FormJsInfo formJsInfo;
+    formJsInfo.formId = FORM_ID_BASE;
+    formJsInfo.formName = "widget";
+    formJsInfo.bundleName = BUNDLE_NAME_PREFIX;
+    formJsInfo.formData = std::string(dataSize, 'a');
+    return formJsInfo;
+}
+
+FormProviderData MakeFormProviderData(size_t dataSize)
+{
+    return FormProviderData("{\"data\":\"" + std::string(dataSize, 'a') + "\"}");
+}
+}
+
+class FormDataMgrLookupTest : public benchmark::Fixture {
+public:
+    FormDataMgrLookupTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormDataMgrLookupTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        AllotFormRecords(state.range(0));
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        DeleteFormRecords(state.range(0));
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+};
+
+BENCHMARK_DEFINE_F(FormDataMgrLookupTest, GetFormRecordSnapshotTestCase)(benchmark::State &state)
+{
+    int64_t formCount = state.range(0);
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < LOOKUP_COUNT; i++) {
+            benchmark::DoNotOptimize(FormDataMgr::GetInstance().GetFormRecordSnapshot(FORM_ID_BASE + i % formCount));
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(FormDataMgrLookupTest, GetFormRecordCopyTestCase)(benchmark::State &state)
+{
+    int64_t formCount = state.range(0);
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < LOOKUP_COUNT; i++) {
+            FormRecord record;
+            benchmark::DoNotOptimize(FormDataMgr::GetInstance().GetFormRecord(FORM_ID_BASE + i % formCount, record));
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(FormDataMgrLookupTest, GetFormRecordByBundleTestCase)(benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        std::vector<FormRecord> records;
+        benchmark::DoNotOptimize(FormDataMgr::GetInstance().GetFormRecord(GetBundleName(0), records));
+    }
+}
+
+BENCHMARK_REGISTER_F(FormDataMgrLookupTest, GetFormRecordSnapshotTestCase)->Arg(1000)->Arg(5000)->Arg(10000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(FormDataMgrLookupTest, GetFormRecordCopyTestCase)->Arg(1000)->Arg(5000)->Arg(10000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(FormDataMgrLookupTest, GetFormRecordByBundleTestCase)->Arg(1000)->Arg(5000)->Arg(10000)
+    ->Unit(benchmark::kMicrosecond);
+
+class FormRefreshCheckTest : public benchmark::Fixture {
+public:
+    FormRefreshCheckTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormRefreshCheckTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        AllotFormRecords(REFRESH_FORM_COUNT);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        DeleteFormRecords(REFRESH_FORM_COUNT);
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+};
+
+BENCHMARK_F(FormRefreshCheckTest, CheckerChainTestCase)(benchmark::State &state)
+{
+    StandInFormRefresh formRefresh;
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < REFRESH_FORM_COUNT; i++) {
+            RefreshData data;
+            data.formId = FORM_ID_BASE + i;
+            data.callingUid = CALLING_UID;
+            data.record = FormDataMgr::GetInstance().GetFormRecordSnapshot(data.formId);
+            benchmark::DoNotOptimize(formRefresh.RefreshFormRequest(data));
+        }
+    }
+    state.counters["forms"] = benchmark::Counter(REFRESH_FORM_COUNT);
+}
+
+class FormParcelTest : public benchmark::Fixture {
+public:
+    FormParcelTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormParcelTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override {}
+
+    void TearDown(const ::benchmark::State &state) override {}
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+BENCHMARK_DEFINE_F(FormParcelTest, FormJsInfoRoundTripTestCase)(benchmark::State &state)
+{
+    FormJsInfo formJsInfo = MakeFormJsInfo(static_cast<size_t>(state.range(0)));
+    while (state.KeepRunning()) {
+        MessageParcel parcel;
+        formJsInfo.Marshalling(parcel);
+        std::unique_ptr<FormJsInfo> result(FormJsInfo::Unmarshalling(parcel));
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(FormParcelTest, FormProviderDataRoundTripTestCase)(benchmark::State &state)
+{
+    FormProviderData providerData = MakeFormProviderData(static_cast<size_t>(state.range(0)));
+    while (state.KeepRunning()) {
+        MessageParcel parcel;
+        providerData.Marshalling(parcel);
+        std::unique_ptr<FormProviderData> result(FormProviderData::Unmarshalling(parcel));
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(FormParcelTest, FormJsInfoRoundTripTestCase)->Arg(SMALL_DATA_SIZE)->Arg(BIG_DATA_SIZE)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(FormParcelTest, FormProviderDataRoundTripTestCase)->Arg(SMALL_DATA_SIZE)->Arg(BIG_DATA_SIZE)
+    ->Unit(benchmark::kMicrosecond);
+
+class FormTimerTickTest : public benchmark::Fixture {
+public:
+    FormTimerTickTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormTimerTickTest() override = default;
+
+    /**
+     * @brief None of the tasks is registered to the limiter. The interval timer is never created, so
+     *        a tick does not arm a system timer.
+     */
+    void SetUp(const ::benchmark::State &state) override
+    {
+        timerMgr_ = std::make_shared<FormTimerMgr>();
+        timerMgr_->intervalTimerId_ = 0L;
+        int64_t currentTime = FormUtil::GetCurrentMillisecond();
+        for (int32_t i = 0; i < REGISTERED_TIMER_COUNT; i++) {
+            FormTimer task(FORM_ID_BASE + i, Constants::MIN_PERIOD, 0);
+            task.refreshTime = currentTime;
+            timerMgr_->intervalTimerTasks_.emplace(task.formId, task);
+            timerMgr_->EnqueueIntervalTaskNolock(task);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        timerMgr_ = nullptr;
+    }
+
+    /**
+     * @brief Make the first dueCount tasks due again, a tick moves the tasks it refreshed to the next period.
+     */
+    void ResetDueTasks(int64_t dueCount)
+    {
+        std::lock_guard<std::mutex> lock(timerMgr_->intervalMutex_);
+        int64_t dueTime = FormUtil::GetCurrentMillisecond() - Constants::MIN_PERIOD;
+        for (int64_t i = 0; i < dueCount; i++) {
+            FormTimer &task = timerMgr_->intervalTimerTasks_[FORM_ID_BASE + i];
+            timerMgr_->DequeueIntervalTaskNolock(task);
+            task.refreshTime = dueTime;
+            timerMgr_->EnqueueIntervalTaskNolock(task);
+        }
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+    std::shared_ptr<FormTimerMgr> timerMgr_ = nullptr;
+};
+
+BENCHMARK_DEFINE_F(FormTimerTickTest, IntervalTickTestCase)(benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        ResetDueTasks(state.range(0));
+        state.ResumeTiming();
+        timerMgr_->OnIntervalTimeOut();
+    }
+    state.counters["registered_timers"] = benchmark::Counter(REGISTERED_TIMER_COUNT);
+}
+
+BENCHMARK_REGISTER_F(FormTimerTickTest, IntervalTickTestCase)->Arg(0)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+class FormDbCacheUpdateTest : public benchmark::Fixture {
+public:
+    FormDbCacheUpdateTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormDbCacheUpdateTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        AllotFormRecords(DB_FORM_COUNT);
+        records_.clear();
+        for (int32_t i = 0; i < DB_FORM_COUNT; i++) {
+            FormRecord record;
+            FormDataMgr::GetInstance().GetFormRecord(FORM_ID_BASE + i, record);
+            FormDbCache::GetInstance().UpdateDBRecord(record.formId, record);
+            records_.emplace_back(std::move(record));
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (const auto &record : records_) {
+            FormDbCache::GetInstance().DeleteFormInfo(record.formId);
+        }
+        records_.clear();
+        DeleteFormRecords(DB_FORM_COUNT);
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+    std::vector<FormRecord> records_;
+};
+
+BENCHMARK_F(FormDbCacheUpdateTest, UpdateUnchangedTestCase)(benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        for (const auto &record : records_) {
+            benchmark::DoNotOptimize(FormDbCache::GetInstance().UpdateDBRecord(record.formId, record));
+        }
+    }
+}
+
+BENCHMARK_F(FormDbCacheUpdateTest, UpdateChangedTestCase)(benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        // every round flips the flag, so each update reaches the rdb stand-in
+        for (auto &record : records_) {
+            record.enableForm = !record.enableForm;
+            benchmark::DoNotOptimize(FormDbCache::GetInstance().UpdateDBRecord(record.formId, record));
+        }
+    }
+}
+
+class FormStatusCycleTest : public benchmark::Fixture {
+public:
+    FormStatusCycleTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormStatusCycleTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        for (int32_t i = 0; i < STATUS_FORM_COUNT; i++) {
+            FormStatus::GetInstance().SetFormStatus(FORM_ID_BASE + i, FormFsmStatus::RENDERED);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (int32_t i = 0; i < STATUS_FORM_COUNT; i++) {
+            FormStatusMgr::GetInstance().ProcessTaskDelete(FORM_ID_BASE + i);
+        }
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+};
+
+/**
+ * @brief Each event runs the state machine task as the status queue would, with a no-op task. The
+ *        timeout it arms is cancelled right away, as the done event of the render service does.
+ */
+BENCHMARK_F(FormStatusCycleTest, RecycleRecoverCycleTestCase)(benchmark::State &state)
+{
+    FormStatusMgr &statusMgr = FormStatusMgr::GetInstance();
+    std::function<void()> task = []() {};
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < STATUS_FORM_COUNT; i++) {
+            int64_t formId = FORM_ID_BASE + i;
+            for (FormFsmEvent event : RECYCLE_CYCLE_EVENTS) {
+                benchmark::DoNotOptimize(statusMgr.ExecStatusMachineTask(formId, event, task));
+                statusMgr.CancelFormEventTimeout(formId, statusMgr.GetFormEventId(formId));
+            }
+        }
+    }
+    state.counters["transitions"] =
+        benchmark::Counter(static_cast<double>(STATUS_FORM_COUNT * RECYCLE_CYCLE_EVENTS.size()));
+}
+}
+
+/**
+ * @brief Results are written as json unless --benchmark_out is given, so runs of two builds can be
+ *        compared with the compare tool of benchmark.
+ */
+int main(int argc, char **argv)
+{
+    std::vector<char *> args(argv, argv + argc);
+    bool hasOut = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], JSON_OUT_ARG.c_str(), JSON_OUT_ARG.size()) == 0) {
+            hasOut = true;
+        }
+    }
+    std::string outArg = JSON_OUT_ARG + DEFAULT_JSON_OUT;
+    std::string formatArg = JSON_OUT_FORMAT_ARG;
+    if (!hasOut) {
+        args.push_back(outArg.data());
+        args.push_back(formatArg.data());
+    }
+    int benchmarkArgc = static_cast<int>(args.size());
+    args.push_back(nullptr);
+
+    OHOS::InstallStandIns();
+    benchmark::Initialize(&benchmarkArgc, args.data());
+    if (benchmark::ReportUnrecognizedArguments(benchmarkArgc, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define private public
+#include "data_center/form_info/bundle_form_info.h"
+#undef private
+#include "data_center/form_info/form_info_query_index.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace {
+constexpr int32_t BUNDLE_COUNT = 500;
+constexpr int32_t FORMS_PER_BUNDLE = 4;
+constexpr int32_t USER_ID = 100;
+constexpr int32_t QUERY_BUNDLE_STEP = 7;
+constexpr int64_t INVALIDATE_INTERVAL = 64;
+const std::string BUNDLE_PREFIX = "com.form.benchmark";
+const std::string MODULE_NAME = "entry";
+
+FormInfoQueryIndex::BundleFormInfoMap BuildBundleFormInfoMap()
+{
+    FormInfoQueryIndex::BundleFormInfoMap bundleFormInfoMap;
+    for (int32_t i = 0; i < BUNDLE_COUNT; i++) {
+        std::string bundleName = BUNDLE_PREFIX + std::to_string(i);
+        auto bundleFormInfo = std::make_shared<BundleFormInfo>(bundleName);
+        FormInfoStorage formInfoStorage;
+        formInfoStorage.userId = USER_ID;
+        for (int32_t j = 0; j < FORMS_PER_BUNDLE; j++) {
+            FormInfo formInfo;
+            formInfo.bundleName = bundleName;
+            formInfo.moduleName = MODULE_NAME;
+            formInfo.abilityName = bundleName + ".MainAbility";
+            formInfo.name = "widget" + std::to_string(j);
+            formInfo.description = "benchmark form " + std::to_string(j);
+            formInfo.jsComponentName = "widget";
+            formInfo.supportDimensions = {1, 2, 3};
+            formInfo.defaultDimension = 1;
+            formInfo.supportShapes = {1};
+            formInfoStorage.formInfos.push_back(formInfo);
+        }
+        bundleFormInfo->formInfoStorages_.push_back(formInfoStorage);
+        bundleFormInfoMap.emplace(bundleName, bundleFormInfo);
+    }
+    return bundleFormInfoMap;
+}
+
+FormInfoFilter BuildFilter()
+{
+    FormInfoFilter filter;
+    filter.supportDimensions = {2};
+    return filter;
+}
+
+const std::string &GetQueryBundleName(int64_t query)
+{
+    static std::vector<std::string> bundleNames;
+    if (bundleNames.empty()) {
+        for (int32_t i = 0; i < BUNDLE_COUNT; i++) {
+            bundleNames.push_back(BUNDLE_PREFIX + std::to_string(i));
+        }
+    }
+    return bundleNames[(query * QUERY_BUNDLE_STEP) % BUNDLE_COUNT];
+}
+}
+
+/**
+ * @brief Query path before the index: every query walked the bundles and copied each form info out.
+ */
+static void LegacyAllFormsTestCase(benchmark::State &state)
+{
+    auto bundleFormInfoMap = BuildBundleFormInfoMap();
+    for (auto _ : state) {
+        std::vector<FormInfo> formInfos;
+        for (const auto &bundleFormInfo : bundleFormInfoMap) {
+            bundleFormInfo.second->GetAllFormsInfo(formInfos, USER_ID);
+        }
+        benchmark::DoNotOptimize(formInfos.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void IndexAllFormsTestCase(benchmark::State &state)
+{
+    auto bundleFormInfoMap = BuildBundleFormInfoMap();
+    FormInfoQueryIndex queryIndex;
+    for (auto _ : state) {
+        FormInfosSnapshot formInfos = queryIndex.GetAllFormsInfo(bundleFormInfoMap, USER_ID, false);
+        benchmark::DoNotOptimize(formInfos.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void LegacyFilterTestCase(benchmark::State &state)
+{
+    auto bundleFormInfoMap = BuildBundleFormInfoMap();
+    FormInfoFilter filter = BuildFilter();
+    for (auto _ : state) {
+        std::vector<FormInfo> formInfos;
+        for (const auto &bundleFormInfo : bundleFormInfoMap) {
+            bundleFormInfo.second->GetFormsInfoByFilter(filter, formInfos, USER_ID);
+        }
+        benchmark::DoNotOptimize(formInfos.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void IndexFilterTestCase(benchmark::State &state)
+{
+    auto bundleFormInfoMap = BuildBundleFormInfoMap();
+    FormInfoQueryIndex queryIndex;
+    FormInfoFilter filter = BuildFilter();
+    for (auto _ : state) {
+        FormInfosSnapshot formInfos = queryIndex.GetFormsInfoByFilter(bundleFormInfoMap, filter, USER_ID);
+        benchmark::DoNotOptimize(formInfos.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void LegacyByModuleTestCase(benchmark::State &state)
+{
+    auto bundleFormInfoMap = BuildBundleFormInfoMap();
+    int64_t query = 0;
+    for (auto _ : state) {
+        std::vector<FormInfo> formInfos;
+        bundleFormInfoMap[GetQueryBundleName(query++)]->GetFormsInfoByModule(MODULE_NAME, formInfos, USER_ID);
+        benchmark::DoNotOptimize(formInfos.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void IndexByModuleTestCase(benchmark::State &state)
+{
+    auto bundleFormInfoMap = BuildBundleFormInfoMap();
+    FormInfoQueryIndex queryIndex;
+    int64_t query = 0;
+    for (auto _ : state) {
+        const std::string &bundleName = GetQueryBundleName(query++);
+        FormInfosSnapshot formInfos =
+            queryIndex.GetFormsInfo(bundleFormInfoMap[bundleName], bundleName, MODULE_NAME, USER_ID, false);
+        benchmark::DoNotOptimize(formInfos.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief A bundle is reloaded every INVALIDATE_INTERVAL queries, the cross bundle results are rebuilt.
+ */
+static void IndexAllFormsWithReloadTestCase(benchmark::State &state)
+{
+    auto bundleFormInfoMap = BuildBundleFormInfoMap();
+    FormInfoQueryIndex queryIndex;
+    int64_t query = 0;
+    for (auto _ : state) {
+        if (query % INVALIDATE_INTERVAL == 0) {
+            queryIndex.Invalidate(GetQueryBundleName(query));
+        }
+        query++;
+        FormInfosSnapshot formInfos = queryIndex.GetAllFormsInfo(bundleFormInfoMap, USER_ID, false);
+        benchmark::DoNotOptimize(formInfos.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(LegacyAllFormsTestCase)->Unit(benchmark::kMicrosecond);
+BENCHMARK(IndexAllFormsTestCase)->Unit(benchmark::kMicrosecond);
+BENCHMARK(LegacyFilterTestCase)->Unit(benchmark::kMicrosecond);
+BENCHMARK(IndexFilterTestCase)->Unit(benchmark::kMicrosecond);
+BENCHMARK(LegacyByModuleTestCase)->Unit(benchmark::kMicrosecond);
+BENCHMARK(IndexByModuleTestCase)->Unit(benchmark::kMicrosecond);
+BENCHMARK(IndexAllFormsWithReloadTestCase)->Unit(benchmark::kMicrosecond);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "data_center/database/form_db_info.h"
+#include "data_center/form_info/form_info_storage.h"
+#include "nlohmann/json.hpp"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace {
+constexpr int64_t FORM_ID_BASE = 100000;
+constexpr int32_t USER_ID = 100;
+constexpr int32_t CALLING_UID = 20000001;
+constexpr int32_t FORMS_PER_STORAGE = 8;
+constexpr int32_t DUMP_INDENT = 4;
+
+std::vector<InnerFormInfo> BuildInnerFormInfos(int64_t count)
+{
+    std::vector<InnerFormInfo> innerFormInfos;
+    innerFormInfos.reserve(count);
+    for (int64_t i = 0; i < count; i++) {
+        FormDBInfo formDBInfo;
+        formDBInfo.formId = FORM_ID_BASE + i;
+        formDBInfo.userId = USER_ID;
+        formDBInfo.providerUserId = USER_ID;
+        formDBInfo.formName = "widget" + std::to_string(i);
+        formDBInfo.bundleName = "com.form.benchmark" + std::to_string(i % 100);
+        formDBInfo.moduleName = "entry";
+        formDBInfo.abilityName = "FormAbility";
+        formDBInfo.formUserUids = { CALLING_UID };
+        formDBInfo.formLocation = Constants::FormLocation::DESKTOP;
+        innerFormInfos.emplace_back(formDBInfo);
+    }
+    return innerFormInfos;
+}
+
+std::vector<AAFwk::FormInfoStorage> BuildFormInfoStorages(int64_t count)
+{
+    std::vector<AAFwk::FormInfoStorage> formInfoStorages;
+    for (int64_t i = 0; i < count; i += FORMS_PER_STORAGE) {
+        std::vector<FormInfo> formInfos;
+        for (int64_t j = i; j < count && j < i + FORMS_PER_STORAGE; j++) {
+            FormInfo formInfo;
+            formInfo.bundleName = "com.form.benchmark";
+            formInfo.moduleName = "entry";
+            formInfo.abilityName = "FormAbility";
+            formInfo.name = "widget" + std::to_string(j);
+            formInfo.description = "benchmark widget";
+            formInfo.supportDimensions = { 1, 2, 3 };
+            formInfo.defaultDimension = 1;
+            formInfos.emplace_back(formInfo);
+        }
+        formInfoStorages.emplace_back(USER_ID, formInfos);
+    }
+    return formInfoStorages;
+}
+
+void ReportSize(benchmark::State &state, size_t totalSize)
+{
+    state.counters["total_bytes"] = benchmark::Counter(static_cast<double>(totalSize));
+    state.counters["bytes_per_record"] =
+        benchmark::Counter(static_cast<double>(totalSize) / static_cast<double>(state.range(0)));
+}
+}
+
+static void InnerFormInfoJsonSerializeTestCase(benchmark::State &state)
+{
+    std::vector<InnerFormInfo> innerFormInfos = BuildInnerFormInfos(state.range(0));
+    size_t totalSize = 0;
+    for (auto _ : state) {
+        totalSize = 0;
+        for (const auto &innerFormInfo : innerFormInfos) {
+            std::string value = innerFormInfo.ToString();
+            totalSize += value.size();
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    ReportSize(state, totalSize);
+}
+
+static void InnerFormInfoBinarySerializeTestCase(benchmark::State &state)
+{
+    std::vector<InnerFormInfo> innerFormInfos = BuildInnerFormInfos(state.range(0));
+    size_t totalSize = 0;
+    for (auto _ : state) {
+        totalSize = 0;
+        for (const auto &innerFormInfo : innerFormInfos) {
+            std::vector<uint8_t> value = innerFormInfo.ToBinary();
+            totalSize += value.size();
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    ReportSize(state, totalSize);
+}
+
+static void InnerFormInfoJsonParseTestCase(benchmark::State &state)
+{
+    std::vector<std::string> values;
+    for (const auto &innerFormInfo : BuildInnerFormInfos(state.range(0))) {
+        values.emplace_back(innerFormInfo.ToString());
+    }
+    for (auto _ : state) {
+        for (const auto &value : values) {
+            InnerFormInfo innerFormInfo;
+            nlohmann::json jsonObject = nlohmann::json::parse(value, nullptr, false);
+            benchmark::DoNotOptimize(innerFormInfo.FromJson(jsonObject));
+        }
+    }
+}
+
+static void InnerFormInfoBinaryParseTestCase(benchmark::State &state)
+{
+    std::vector<std::string> values;
+    for (const auto &innerFormInfo : BuildInnerFormInfos(state.range(0))) {
+        std::vector<uint8_t> binary = innerFormInfo.ToBinary();
+        values.emplace_back(binary.begin(), binary.end());
+    }
+    for (auto _ : state) {
+        for (const auto &value : values) {
+            InnerFormInfo innerFormInfo;
+            benchmark::DoNotOptimize(innerFormInfo.FromBinary(value));
+        }
+    }
+}
+
+static void FormInfoStorageJsonTestCase(benchmark::State &state)
+{
+    std::vector<AAFwk::FormInfoStorage> formInfoStorages = BuildFormInfoStorages(state.range(0));
+    size_t totalSize = 0;
+    for (auto _ : state) {
+        nlohmann::json jsonObject = formInfoStorages;
+        std::string value = jsonObject.dump(DUMP_INDENT);
+        totalSize = value.size();
+        nlohmann::json parsed = nlohmann::json::parse(value, nullptr, false);
+        auto decoded = parsed.get<std::vector<AAFwk::FormInfoStorage>>();
+        benchmark::DoNotOptimize(decoded);
+    }
+    ReportSize(state, totalSize);
+}
+
+static void FormInfoStorageBinaryTestCase(benchmark::State &state)
+{
+    std::vector<AAFwk::FormInfoStorage> formInfoStorages = BuildFormInfoStorages(state.range(0));
+    size_t totalSize = 0;
+    for (auto _ : state) {
+        std::vector<uint8_t> binary = AAFwk::FormInfoStoragesToBinary(formInfoStorages);
+        std::string value(binary.begin(), binary.end());
+        totalSize = value.size();
+        std::vector<AAFwk::FormInfoStorage> decoded;
+        benchmark::DoNotOptimize(AAFwk::FormInfoStoragesFromBinary(value, decoded));
+    }
+    ReportSize(state, totalSize);
+}
+
+BENCHMARK(InnerFormInfoJsonSerializeTestCase)->Arg(1000)->Arg(5000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(InnerFormInfoBinarySerializeTestCase)->Arg(1000)->Arg(5000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(InnerFormInfoJsonParseTestCase)->Arg(1000)->Arg(5000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(InnerFormInfoBinaryParseTestCase)->Arg(1000)->Arg(5000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(FormInfoStorageJsonTestCase)->Arg(1000)->Arg(5000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(FormInfoStorageBinaryTestCase)->Arg(1000)->Arg(5000)->Arg(10000)->Unit(benchmark::kMillisecond);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "common/timer_mgr/form_timer.h"
+#include "data_center/form_data_mgr.h"
+#include "data_center/form_info/form_item_info.h"
+#include "form_constants.h"
+#define private public
+#include "form_refresh/refresh_impl/form_timer_refresh_impl.h"
+#undef private
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+std::atomic<uint64_t> g_allocCount = 0;
+}
+
+void *operator new(std::size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace OHOS {
+namespace {
+constexpr int64_t FORM_ID_BASE = 100000;
+constexpr int32_t TIMER_STORM_FORM_COUNT = 1000;
+constexpr int32_t CALLING_UID = 20000001;
+constexpr int32_t USER_ID = 100;
+const std::string BUNDLE_NAME = "com.form.benchmark";
+
+/**
+ * @brief Runs the timer refresh of one form synchronously: the request stage, the checks and the
+ *        controls, up to the provider connection which needs a live provider.
+ */
+bool RunTimerRefresh(int64_t formId)
+{
+    RefreshData data;
+    data.formId = formId;
+    data.formTimer = FormTimer(formId, true, USER_ID);
+    data.record = FormDataMgr::GetInstance().GetFormRecordSnapshot(formId);
+    if (data.record == nullptr) {
+        return false;
+    }
+    FormTimerRefreshImpl::GetInstance().BuildTimerWant(data.formTimer, data.want);
+
+    FormBatchRefreshItem item;
+    bool needConnect = false;
+    FormTimerRefreshImpl::GetInstance().PrepareRefresh(data, item, needConnect);
+    benchmark::DoNotOptimize(item);
+    return needConnect;
+}
+
+/**
+ * @brief Clears the flags the provider response would clear, so every iteration refreshes again.
+ */
+void ResetTimerRefreshFlags()
+{
+    for (int32_t i = 0; i < TIMER_STORM_FORM_COUNT; i++) {
+        FormDataMgr::GetInstance().SetTimerRefresh(FORM_ID_BASE + i, false);
+        FormDataMgr::GetInstance().SetCountTimerRefresh(FORM_ID_BASE + i, false);
+    }
+}
+}
+
+class FormRefreshTest : public benchmark::Fixture {
+public:
+    FormRefreshTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormRefreshTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        for (int32_t i = 0; i < TIMER_STORM_FORM_COUNT; i++) {
+            FormItemInfo itemInfo;
+            itemInfo.SetFormId(FORM_ID_BASE + i);
+            itemInfo.SetProviderBundleName(BUNDLE_NAME);
+            itemInfo.SetHostBundleName(BUNDLE_NAME);
+            itemInfo.SetModuleName("entry");
+            itemInfo.SetAbilityName("FormAbility");
+            itemInfo.SetFormName("widget" + std::to_string(i));
+            itemInfo.SetEnableUpdateFlag(true);
+            itemInfo.SetUpdateDuration(1);
+            FormDataMgr::GetInstance().AllotFormRecord(itemInfo, CALLING_UID, USER_ID);
+            FormDataMgr::GetInstance().UpdateFormRecord(FORM_ID_BASE + i, [](FormRecord &record) {
+                record.addFormFinish = true;
+                record.formVisibleNotifyState = Constants::FORM_VISIBLE;
+            });
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (int32_t i = 0; i < TIMER_STORM_FORM_COUNT; i++) {
+            FormDataMgr::GetInstance().DeleteFormRecord(FORM_ID_BASE + i);
+        }
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+};
+
+BENCHMARK_F(FormRefreshTest, TimerStormRefreshTestCase)(benchmark::State &state)
+{
+    uint64_t allocs = 0;
+    int64_t connects = 0;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        ResetTimerRefreshFlags();
+        state.ResumeTiming();
+        uint64_t begin = g_allocCount.load(std::memory_order_relaxed);
+        for (int32_t i = 0; i < TIMER_STORM_FORM_COUNT; i++) {
+            if (RunTimerRefresh(FORM_ID_BASE + i)) {
+                connects++;
+            }
+        }
+        allocs += g_allocCount.load(std::memory_order_relaxed) - begin;
+    }
+    state.counters["allocs_per_refresh"] = benchmark::Counter(static_cast<double>(allocs) /
+        (static_cast<double>(state.iterations()) * TIMER_STORM_FORM_COUNT));
+    state.counters["connects_per_iteration"] = benchmark::Counter(static_cast<double>(connects) /
+        static_cast<double>(state.iterations()));
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "status_mgr_center/form_status_mgr.h"
+#include "status_mgr_center/form_status_table.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace {
+constexpr int64_t FORM_ID_BASE = 100000;
+constexpr int64_t STORM_FORM_COUNT = 5000;
+constexpr int32_t STATUS_COUNT = static_cast<int32_t>(FormFsmStatus::UNPROCESSABLE) + 1;
+constexpr int32_t EVENT_COUNT = static_cast<int32_t>(FormFsmEvent::RELOAD_FORM) + 1;
+
+/**
+ * @brief Lookup and event id bookkeeping before the dense table: the transition vector of the
+ *        status was copied and scanned, event ids were nanosecond strings kept in a map.
+ */
+class LegacyFormStatusMachine {
+public:
+    LegacyFormStatusMachine()
+    {
+        const FormStatusTable &statusTable = FormStatusTable::GetInstance();
+        for (int32_t status = 0; status < STATUS_COUNT; status++) {
+            for (int32_t event = 0; event < EVENT_COUNT; event++) {
+                const FormStatusMachineInfo *info =
+                    statusTable.GetFormStatusInfo(static_cast<FormFsmStatus>(status), static_cast<FormFsmEvent>(event));
+                if (info != nullptr) {
+                    table_[info->curStatus].push_back(*info);
+                }
+            }
+        }
+    }
+
+    bool GetFormStatusInfo(FormFsmStatus curStatus, FormFsmEvent event, FormStatusMachineInfo &info)
+    {
+        auto iter = table_.find(curStatus);
+        if (iter == table_.end()) {
+            return false;
+        }
+        auto tableInfo = iter->second;
+        for (size_t i = 0; i < tableInfo.size(); i++) {
+            if (tableInfo[i].event == event) {
+                info = tableInfo[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void SetFormEventId(int64_t formId)
+    {
+        int64_t eventId = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        std::unique_lock<std::shared_mutex> lock(eventIdMutex_);
+        eventIdMap_[formId] = std::to_string(eventId);
+    }
+
+    std::string GetFormEventId(int64_t formId)
+    {
+        std::shared_lock<std::shared_mutex> lock(eventIdMutex_);
+        auto iter = eventIdMap_.find(formId);
+        return iter == eventIdMap_.end() ? "" : iter->second;
+    }
+
+    void DeleteFormEventId(int64_t formId)
+    {
+        std::unique_lock<std::shared_mutex> lock(eventIdMutex_);
+        eventIdMap_.erase(formId);
+    }
+
+private:
+    std::unordered_map<FormFsmStatus, std::vector<FormStatusMachineInfo>> table_;
+    std::shared_mutex eventIdMutex_;
+    std::unordered_map<int64_t, std::string> eventIdMap_;
+};
+
+void ReportTransitions(benchmark::State &state)
+{
+    // a recover is two transitions: RECYCLED -> RECOVERING -> RENDERED
+    state.SetItemsProcessed(state.iterations() * STORM_FORM_COUNT * 2);
+}
+}
+
+static void LegacyRecoverStormTestCase(benchmark::State &state)
+{
+    LegacyFormStatusMachine statusMachine;
+    for (auto _ : state) {
+        for (int64_t formId = FORM_ID_BASE; formId < FORM_ID_BASE + STORM_FORM_COUNT; formId++) {
+            FormStatusMachineInfo info;
+            statusMachine.GetFormStatusInfo(FormFsmStatus::RECYCLED, FormFsmEvent::RECOVER_FORM, info);
+            statusMachine.SetFormEventId(formId);
+            benchmark::DoNotOptimize(statusMachine.GetFormEventId(formId));
+            statusMachine.GetFormStatusInfo(info.nextStatus, FormFsmEvent::RECOVER_FORM_DONE, info);
+            benchmark::DoNotOptimize(statusMachine.GetFormEventId(formId));
+            statusMachine.DeleteFormEventId(formId);
+        }
+    }
+    ReportTransitions(state);
+}
+
+static void DenseTableRecoverStormTestCase(benchmark::State &state)
+{
+    const FormStatusTable &statusTable = FormStatusTable::GetInstance();
+    FormStatusMgr &statusMgr = FormStatusMgr::GetInstance();
+    for (auto _ : state) {
+        for (int64_t formId = FORM_ID_BASE; formId < FORM_ID_BASE + STORM_FORM_COUNT; formId++) {
+            const FormStatusMachineInfo *info =
+                statusTable.GetFormStatusInfo(FormFsmStatus::RECYCLED, FormFsmEvent::RECOVER_FORM);
+            statusMgr.SetFormEventId(formId);
+            benchmark::DoNotOptimize(statusMgr.GetFormEventId(formId));
+            info = statusTable.GetFormStatusInfo(info->nextStatus, FormFsmEvent::RECOVER_FORM_DONE);
+            benchmark::DoNotOptimize(info);
+            benchmark::DoNotOptimize(statusMgr.GetFormEventId(formId));
+            statusMgr.DeleteFormEventId(formId);
+        }
+    }
+    ReportTransitions(state);
+}
+
+BENCHMARK(LegacyRecoverStormTestCase)->Unit(benchmark::kMillisecond);
+BENCHMARK(DenseTableRecoverStormTestCase)->Unit(benchmark::kMillisecond);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
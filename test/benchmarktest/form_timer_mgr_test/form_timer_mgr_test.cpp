@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "form_constants.h"
+#define private public
+#include "common/timer_mgr/form_timer_mgr.h"
+#undef private
+#include "common/util/form_util.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace {
+constexpr int64_t FORM_ID_BASE = 100000;
+constexpr int32_t REGISTERED_TIMER_COUNT = 10000;
+
+/**
+ * @brief Populate interval tasks, the first dueCount ones are due and the rest are spread over one period.
+ *        No task is registered to the limiter, so due tasks are skipped and the queue is stable between ticks.
+ */
+void PopulateIntervalTasks(FormTimerMgr &timerMgr, int64_t dueCount)
+{
+    int64_t currentTime = FormUtil::GetCurrentMillisecond();
+    for (int32_t i = 0; i < REGISTERED_TIMER_COUNT; i++) {
+        FormTimer task(FORM_ID_BASE + i, Constants::MIN_PERIOD, 0);
+        if (i < dueCount) {
+            task.refreshTime = currentTime - Constants::MIN_PERIOD;
+        } else {
+            task.refreshTime = currentTime - Constants::MIN_PERIOD / 2 + i % (Constants::MIN_PERIOD / 2);
+        }
+        timerMgr.intervalTimerTasks_.emplace(task.formId, task);
+        timerMgr.EnqueueIntervalTaskNolock(task);
+    }
+}
+
+/**
+ * @brief Tick layout before interval tasks were queued by deadline: every registered task is visited.
+ */
+size_t LegacyIntervalTick(FormTimerMgr &timerMgr)
+{
+    std::lock_guard<std::mutex> lock(timerMgr.intervalMutex_);
+    size_t dueCount = 0;
+    int64_t currentTime = FormUtil::GetCurrentMillisecond();
+    for (auto &intervalPair : timerMgr.intervalTimerTasks_) {
+        FormTimer &intervalTask = intervalPair.second;
+        if (!((currentTime - intervalTask.refreshTime) >= intervalTask.period ||
+            std::abs((currentTime - intervalTask.refreshTime) - intervalTask.period) < Constants::ABS_TIME)) {
+            continue;
+        }
+        if (!timerMgr.refreshLimiter_.IsEnableRefresh(intervalTask.formId)) {
+            continue;
+        }
+        dueCount++;
+    }
+    return dueCount;
+}
+}
+
+class FormTimerMgrTest : public benchmark::Fixture {
+public:
+    FormTimerMgrTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormTimerMgrTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        timerMgr_ = std::make_shared<FormTimerMgr>();
+        PopulateIntervalTasks(*timerMgr_, state.range(0));
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        timerMgr_ = nullptr;
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+    std::shared_ptr<FormTimerMgr> timerMgr_ = nullptr;
+};
+
+BENCHMARK_DEFINE_F(FormTimerMgrTest, IntervalTickLegacyScanTestCase)(benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(LegacyIntervalTick(*timerMgr_));
+    }
+    state.counters["registered_timers"] = benchmark::Counter(REGISTERED_TIMER_COUNT);
+}
+
+BENCHMARK_DEFINE_F(FormTimerMgrTest, IntervalTickQueueTestCase)(benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        timerMgr_->OnIntervalTimeOut();
+    }
+    state.counters["registered_timers"] = benchmark::Counter(REGISTERED_TIMER_COUNT);
+}
+
+BENCHMARK_REGISTER_F(FormTimerMgrTest, IntervalTickLegacyScanTestCase)->Arg(0)->Arg(100)->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(FormTimerMgrTest, IntervalTickQueueTestCase)->Arg(0)->Arg(100)->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
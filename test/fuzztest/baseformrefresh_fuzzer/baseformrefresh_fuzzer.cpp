@@ -46,13 +46,15 @@ RefreshData GenerateFuzzedRefreshData(FuzzedDataProvider *fdp)
     data.formId = fdp->ConsumeIntegralInRange<int64_t>(MIN_NUM, MAX_NUM);
     data.nextTime = fdp->ConsumeIntegral<int64_t>();
     data.callingUid = fdp->ConsumeIntegral<int32_t>();
-    data.record.formId = data.formId;
-    data.record.bundleName = fdp->ConsumeRandomLengthString(MAX_LENGTH);
-    data.record.moduleName = fdp->ConsumeRandomLengthString(MAX_LENGTH);
-    data.record.abilityName = fdp->ConsumeRandomLengthString(MAX_LENGTH);
-    data.record.formName = fdp->ConsumeRandomLengthString(MAX_LENGTH);
-    data.record.isEnableUpdate = fdp->ConsumeBool();
-    data.record.updateDuration = fdp->ConsumeIntegral<int64_t>();
+    FormRecord record;
+    record.formId = data.formId;
+    record.bundleName = fdp->ConsumeRandomLengthString(MAX_LENGTH);
+    record.moduleName = fdp->ConsumeRandomLengthString(MAX_LENGTH);
+    record.abilityName = fdp->ConsumeRandomLengthString(MAX_LENGTH);
+    record.formName = fdp->ConsumeRandomLengthString(MAX_LENGTH);
+    record.isEnableUpdate = fdp->ConsumeBool();
+    record.updateDuration = fdp->ConsumeIntegral<int64_t>();
+    data.record = std::make_shared<const FormRecord>(record);
     data.formTimer.formId = data.formId;
     data.formTimer.refreshTime = fdp->ConsumeIntegral<int64_t>();
     data.formTimer.userId = fdp->ConsumeIntegral<int32_t>();
@@ -117,7 +117,9 @@ bool DoSomethingInterestingWithMyAPI(FuzzedDataProvider *fdp)
     }
     OHOS::InnerFormInfoTest(fdp);
     FormDbCache formDbCache;
-    formDbCache.formDBInfos_ = OHOS::GetFormDBInfos(fdp);
+    for (const auto &formDBInfo : OHOS::GetFormDBInfos(fdp)) {
+        formDbCache.InsertFormDBInfoNolock(formDBInfo);
+    }
     formDbCache.Start();
     FormDBInfo formDBInfo;
     formDbCache.SaveFormInfo(formDBInfo);
@@ -47,7 +47,7 @@ void DoSomethingInterestingWithMyAPI(const char* data, size_t size)
     FormRecord record;
     record.formId = refreshData.formId;
     record.bundleName = std::string(data, size);
-    refreshData.record = record;
+    refreshData.record = std::make_shared<const FormRecord>(record);
 
     Want want;
     want.SetParam("test_param", std::string(data, size));
@@ -100,7 +100,7 @@ void RefreshControlMgrTest(FuzzedDataProvider *fdp)
     RefreshControlMgr::GetInstance().IsHealthyControl(record);
     RefreshControlMgr::GetInstance().IsNeedToFresh(record, isVisibleToFresh);
     RefreshData data;
-    data.record = record;
+    data.record = std::make_shared<const FormRecord>(record);
     FormAppUpgradeRefreshImpl::GetInstance().RefreshFormRequest(data);
 }
 
@@ -201,7 +201,7 @@ void FormRefreshTest(FuzzedDataProvider *fdp)
     record.isSystemApp = isTrue;
     record.formId = formId;
     record.isDataProxy = isTrue;
-    data.record = record;
+    data.record = std::make_shared<const FormRecord>(record);
     data.formTimer = formTimer;
     data.callerToken = callerToken;
     data.want = want;
@@ -238,7 +238,7 @@ bool DoSomethingInterestingWithMyAPI(FuzzedDataProvider *fdp)
     reqFactor.formId = formId;
     reqFactor.callingUid = callingUid;
     reqFactor.want = want;
-    reqFactor.record = record;
+    reqFactor.record = std::make_shared<const FormRecord>(record);
     ActiveUserChecker::GetInstance().CheckValid(reqFactor);
     AddFinishChecker::GetInstance().CheckValid(reqFactor);
     CallingBundleChecker::GetInstance().CheckValid(reqFactor);
@@ -62,7 +62,7 @@ bool DoSomethingInterestingWithMyAPI(FuzzedDataProvider *fdp)
     record.isTimerRefresh = fdp->ConsumeBool();
     record.userId = fdp->ConsumeIntegral<int32_t>();
     record.uid = fdp->ConsumeIntegral<int32_t>();
-    refreshData.record = record;
+    refreshData.record = std::make_shared<const FormRecord>(record);
 
     FormTimer formTimer;
     formTimer.formId = refreshData.formId;
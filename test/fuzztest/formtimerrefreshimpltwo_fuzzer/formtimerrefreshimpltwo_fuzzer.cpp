@@ -16,8 +16,8 @@
 #include "formtimerrefreshimpltwo_fuzzer.h"
 
 #include <cstddef>
-#include <cstdint>
-#include <chrono>
+#include <cstdint>
+#include <chrono>
 #include <thread>
 #include <fuzzer/FuzzedDataProvider.h>
 
@@ -56,7 +56,7 @@ void CreateRefreshData(FuzzedDataProvider *fdp, RefreshData &refreshData)
     record.isTimerRefresh = fdp->ConsumeBool();
     record.userId = fdp->ConsumeIntegral<int32_t>();
     record.uid = fdp->ConsumeIntegral<int32_t>();
-    refreshData.record = record;
+    refreshData.record = std::make_shared<const FormRecord>(record);
 
     FormTimer formTimer;
     formTimer.formId = refreshData.formId;
@@ -194,10 +194,13 @@ void TestSystemAppFlags(FuzzedDataProvider *fdp)
     RefreshData refreshData;
     CreateRefreshData(fdp, refreshData);
 
-    refreshData.record.isSystemApp = true;
+    FormRecord record(*refreshData.record);
+    record.isSystemApp = true;
+    refreshData.record = std::make_shared<const FormRecord>(record);
     FormTimerRefreshImpl::GetInstance().RefreshFormRequest(refreshData);
 
-    refreshData.record.isSystemApp = false;
+    record.isSystemApp = false;
+    refreshData.record = std::make_shared<const FormRecord>(record);
     FormTimerRefreshImpl::GetInstance().RefreshFormRequest(refreshData);
 }
 
@@ -206,10 +209,13 @@ void TestVisibilityFlags(FuzzedDataProvider *fdp)
     RefreshData refreshData;
     CreateRefreshData(fdp, refreshData);
 
-    refreshData.record.isVisible = true;
+    FormRecord record(*refreshData.record);
+    record.isVisible = true;
+    refreshData.record = std::make_shared<const FormRecord>(record);
     FormTimerRefreshImpl::GetInstance().RefreshFormRequest(refreshData);
 
-    refreshData.record.isVisible = false;
+    record.isVisible = false;
+    refreshData.record = std::make_shared<const FormRecord>(record);
     FormTimerRefreshImpl::GetInstance().RefreshFormRequest(refreshData);
 }
 
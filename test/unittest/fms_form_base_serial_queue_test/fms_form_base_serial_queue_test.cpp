@@ -17,12 +17,14 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <limits>
 #include <mutex>
 #include <string>
 #include <thread>
 
 #include "queue/form_base_serial_queue.h"
+#include "queue/form_queue_metrics.h"
 #include "fms_log_wrapper.h"
 
 using namespace testing;
@@ -64,6 +66,18 @@ private:
     std::condition_variable cv;
 };
 
+bool WaitUntil(const std::function<bool()> &condition, int32_t timeoutMs = WAIT_TIMEOUT_MS)
+{
+    constexpr int32_t pollIntervalMs = 10;
+    for (int32_t waited = 0; waited < timeoutMs; waited += pollIntervalMs) {
+        if (condition()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(pollIntervalMs));
+    }
+    return condition();
+}
+
 class FmsFormBaseSerialQueueTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -275,7 +289,7 @@ HWTEST_F(FmsFormBaseSerialQueueTest, FmsFormBaseSerialQueueTest_ScheduleDelayTas
  */
 HWTEST_F(FmsFormBaseSerialQueueTest, FmsFormBaseSerialQueueTest_ScheduleTask_Qos_001, TestSize.Level1)
 {
-    for (auto qos : { TaskQos::QOS_DEFAULT, TaskQos::QOS_DEADLINE_REQUEST }) {
+    for (auto qos : { TaskQos::QOS_DEFAULT, TaskQos::QOS_DEADLINE_REQUEST, TaskQos::QOS_BACKGROUND }) {
         FormBaseSerialQueue queue("test_queue_qos");
         TaskSyncHelper helper;
         EXPECT_TRUE(queue.ScheduleTask(0, helper.CreateTask(), qos));
@@ -299,4 +313,97 @@ HWTEST_F(FmsFormBaseSerialQueueTest, FmsFormBaseSerialQueueTest_ScheduleTask_Qos
     GTEST_LOG_(INFO) << "FmsFormBaseSerialQueueTest_ScheduleTask_QosOverflow_001 end";
 }
 
-}
\ No newline at end of file
+}
+
+/**
+ * @tc.name: FmsFormBaseSerialQueueTest_SelfPrune_001
+ * @tc.desc: Verify a delayed task removes its key once it runs, and a replaced key is kept for the new task
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormBaseSerialQueueTest, FmsFormBaseSerialQueueTest_SelfPrune_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormBaseSerialQueueTest_SelfPrune_001 start";
+    FormBaseSerialQueue queue("test_queue_self_prune");
+    auto metrics = queue.GetMetrics();
+    ASSERT_NE(metrics, nullptr);
+    TaskSyncHelper helper;
+    TaskKey key = static_cast<int64_t>(1001);
+    EXPECT_TRUE(queue.ScheduleDelayTask(key, 0, helper.CreateTask()));
+    EXPECT_TRUE(helper.WaitForResult());
+    EXPECT_TRUE(WaitUntil([&metrics]() { return metrics->GetDelayTaskCount() == 0; }))
+        << "Finished task should remove its key";
+    EXPECT_FALSE(queue.CancelDelayTask(key));
+
+    TaskSyncHelper replaceHelper;
+    auto reschedule = [&queue, &key, &replaceHelper]() {
+        queue.ScheduleDelayTask(key, TASK_DELAY_MS, replaceHelper.CreateTask());
+    };
+    EXPECT_TRUE(queue.ScheduleDelayTask(key, 0, reschedule));
+    EXPECT_TRUE(WaitUntil([&metrics]() { return metrics->GetFinishedCount() == 2; }));
+    EXPECT_EQ(metrics->GetDelayTaskCount(), 1) << "Task scheduled from the running task should be kept";
+    EXPECT_TRUE(queue.CancelDelayTask(key));
+    EXPECT_EQ(metrics->GetDelayTaskCount(), 0);
+    GTEST_LOG_(INFO) << "FmsFormBaseSerialQueueTest_SelfPrune_001 end";
+}
+
+/**
+ * @tc.name: FmsFormBaseSerialQueueTest_Metrics_001
+ * @tc.desc: Verify depth, wait and execute histograms are recorded and dumped
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormBaseSerialQueueTest, FmsFormBaseSerialQueueTest_Metrics_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormBaseSerialQueueTest_Metrics_001 start";
+    constexpr int64_t taskCount = 3;
+    FormBaseSerialQueue queue("test_queue_metrics");
+    auto metrics = queue.GetMetrics();
+    ASSERT_NE(metrics, nullptr);
+    std::mutex blockMutex;
+    std::unique_lock<std::mutex> blockLock(blockMutex);
+    // the first task holds the queue so the others pile up behind it
+    EXPECT_TRUE(queue.ScheduleTask(0, [&blockMutex]() {
+        std::lock_guard<std::mutex> lock(blockMutex);
+    }));
+    for (int64_t i = 1; i < taskCount; i++) {
+        EXPECT_TRUE(queue.ScheduleTask(0, []() {}));
+    }
+    EXPECT_GE(metrics->GetMaxDepth(), taskCount - 1);
+    blockLock.unlock();
+    EXPECT_TRUE(WaitUntil([&metrics, taskCount]() { return metrics->GetFinishedCount() == taskCount; }));
+    EXPECT_EQ(metrics->GetDepth(), 0);
+    EXPECT_EQ(metrics->GetWaitHistogram().GetCount(), taskCount);
+    EXPECT_EQ(metrics->GetExecuteHistogram().GetCount(), taskCount);
+
+    TaskKey key = static_cast<int64_t>(1002);
+    EXPECT_TRUE(queue.ScheduleDelayTask(key, TASK_DELAY_MS, []() {}));
+    EXPECT_EQ(metrics->GetDepth(), 1);
+    EXPECT_TRUE(queue.CancelDelayTask(key));
+    EXPECT_EQ(metrics->GetDepth(), 0);
+
+    std::string result;
+    FormQueueMetricsRegistry::GetInstance().Dump(result);
+    EXPECT_NE(result.find("test_queue_metrics"), std::string::npos);
+    EXPECT_NE(result.find("waitSinceDue"), std::string::npos);
+    GTEST_LOG_(INFO) << "FmsFormBaseSerialQueueTest_Metrics_001 end";
+}
+
+/**
+ * @tc.name: FmsFormBaseSerialQueueTest_Histogram_001
+ * @tc.desc: Verify latency histogram bucket boundaries
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormBaseSerialQueueTest, FmsFormBaseSerialQueueTest_Histogram_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormBaseSerialQueueTest_Histogram_001 start";
+    FormQueueLatencyHistogram histogram;
+    histogram.Record(-1);
+    histogram.Record(0);
+    histogram.Record(1);
+    histogram.Record(FormQueueLatencyHistogram::BUCKET_BOUNDS.back());
+    EXPECT_EQ(histogram.GetBucketCount(0), 2);
+    EXPECT_EQ(histogram.GetBucketCount(1), 1);
+    EXPECT_EQ(histogram.GetBucketCount(FormQueueLatencyHistogram::BUCKET_COUNT - 1), 1);
+    EXPECT_EQ(histogram.GetCount(), 4);
+    EXPECT_EQ(histogram.GetMax(), FormQueueLatencyHistogram::BUCKET_BOUNDS.back());
+    GTEST_LOG_(INFO) << "FmsFormBaseSerialQueueTest_Histogram_001 end";
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#define private public
+#define protected public
+#include "data_center/form_data_mgr.h"
+#include "form_provider/connection/form_batch_refresh_connection.h"
+#undef protected
+#undef private
+#include "fms_log_wrapper.h"
+#include "mock_form_provider_client.h"
+#include "gmock/gmock.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string BUNDLE_NAME = "aa";
+const std::string ABILITY_NAME = "bb";
+const std::string MODULE_NAME = "entry";
+constexpr int32_t USER_ID = 100;
+
+std::vector<FormBatchRefreshItem> BuildItems(const std::vector<int64_t> &formIds)
+{
+    std::vector<FormBatchRefreshItem> items;
+    for (int64_t formId : formIds) {
+        FormBatchRefreshItem item;
+        item.formId = formId;
+        item.record.formId = formId;
+        item.record.bundleName = BUNDLE_NAME;
+        item.record.abilityName = ABILITY_NAME;
+        item.record.moduleName = MODULE_NAME;
+        item.record.providerUserId = USER_ID;
+        items.emplace_back(item);
+    }
+    return items;
+}
+
+class FormBatchRefreshConnectionTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void FormBatchRefreshConnectionTest::SetUpTestCase()
+{}
+
+void FormBatchRefreshConnectionTest::TearDownTestCase()
+{}
+
+void FormBatchRefreshConnectionTest::SetUp()
+{}
+
+void FormBatchRefreshConnectionTest::TearDown()
+{}
+
+/**
+ * @tc.name: FormBatchRefreshConnectionTest_0001
+ * @tc.desc: test the connection targets the shared provider and reports the last form.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormBatchRefreshConnectionTest, FormBatchRefreshConnectionTest_0001, TestSize.Level0)
+{
+    HILOG_INFO("FormBatchRefreshConnectionTest_0001 start");
+    sptr<FormBatchRefreshConnection> connection =
+        new FormBatchRefreshConnection(BuildItems({ 1, 2, 3 }), BUNDLE_NAME, ABILITY_NAME, USER_ID);
+    EXPECT_EQ(connection->items_.size(), 3);
+    EXPECT_EQ(connection->GetFormId(), 3);
+    EXPECT_EQ(connection->GetBundleName(), BUNDLE_NAME);
+    Want connectWant = connection->CreateConnectWant();
+    EXPECT_EQ(connectWant.GetElement().GetAbilityName(), ABILITY_NAME);
+    EXPECT_EQ(connectWant.GetElement().GetModuleName(), MODULE_NAME);
+    GTEST_LOG_(INFO) << "FormBatchRefreshConnectionTest_0001 end";
+}
+
+/**
+ * @tc.name: FormBatchRefreshConnectionTest_0002
+ * @tc.desc: test OnAbilityConnectDone function and resultCode != ERR_OK
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormBatchRefreshConnectionTest, FormBatchRefreshConnectionTest_0002, TestSize.Level0)
+{
+    HILOG_INFO("FormBatchRefreshConnectionTest_0002 start");
+    sptr<FormBatchRefreshConnection> connection =
+        new FormBatchRefreshConnection(BuildItems({ 1, 2 }), BUNDLE_NAME, ABILITY_NAME, USER_ID);
+    AppExecFwk::ElementName element;
+    sptr<IRemoteObject> remoteObject = nullptr;
+    int resultCode = 11;
+    connection->OnAbilityConnectDone(element, remoteObject, resultCode);
+    EXPECT_EQ(connection->GetProviderToken(), nullptr);
+    GTEST_LOG_(INFO) << "FormBatchRefreshConnectionTest_0002 end";
+}
+
+/**
+ * @tc.name: FormBatchRefreshConnectionTest_0003
+ * @tc.desc: test OnAbilityConnectDone function and resultCode == ERR_OK
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormBatchRefreshConnectionTest, FormBatchRefreshConnectionTest_0003, TestSize.Level0)
+{
+    HILOG_INFO("FormBatchRefreshConnectionTest_0003 start");
+    sptr<FormBatchRefreshConnection> connection =
+        new FormBatchRefreshConnection(BuildItems({ 1, 2 }), BUNDLE_NAME, ABILITY_NAME, USER_ID);
+    AppExecFwk::ElementName element;
+    sptr<IRemoteObject> remoteObject = new (std::nothrow) MockFormProviderClient();
+    connection->OnAbilityConnectDone(element, remoteObject, ERR_OK);
+    EXPECT_EQ(connection->GetProviderToken(), remoteObject);
+    GTEST_LOG_(INFO) << "FormBatchRefreshConnectionTest_0003 end";
+}
+
+/**
+ * @tc.name: FormBatchRefreshConnectionTest_0004
+ * @tc.desc: test every form of the batch is marked to refresh again when the connect fails or the provider dies
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormBatchRefreshConnectionTest, FormBatchRefreshConnectionTest_0004, TestSize.Level0)
+{
+    HILOG_INFO("FormBatchRefreshConnectionTest_0004 start");
+    std::vector<int64_t> formIds = { 4, 5 };
+    auto items = BuildItems(formIds);
+    for (const auto &item : items) {
+        FormDataMgr::GetInstance().formRecords_[item.formId] = std::make_shared<FormRecord>(item.record);
+    }
+    sptr<FormBatchRefreshConnection> connection =
+        new FormBatchRefreshConnection(items, BUNDLE_NAME, ABILITY_NAME, USER_ID);
+    AppExecFwk::ElementName element;
+    int resultCode = 11;
+    connection->OnAbilityConnectDone(element, nullptr, resultCode);
+    FormRecord record;
+    for (int64_t formId : formIds) {
+        ASSERT_TRUE(FormDataMgr::GetInstance().GetFormRecord(formId, record));
+        EXPECT_TRUE(record.needRefresh);
+        FormDataMgr::GetInstance().SetNeedRefresh(formId, false);
+    }
+
+    connection->SetConnectState(ConnectState::CONNECTED);
+    connection->OnAbilityDisconnectDone(element, DISCONNECT_ERROR);
+    EXPECT_EQ(connection->GetConnectState(), ConnectState::DISCONNECTED);
+    for (int64_t formId : formIds) {
+        ASSERT_TRUE(FormDataMgr::GetInstance().GetFormRecord(formId, record));
+        EXPECT_TRUE(record.needRefresh);
+        FormDataMgr::GetInstance().formRecords_.erase(formId);
+    }
+    GTEST_LOG_(INFO) << "FormBatchRefreshConnectionTest_0004 end";
+}
+}
@@ -31,6 +31,7 @@
 #define private public
 #define protected public
 #include "bms_mgr/form_bms_helper.h"
+#include "common/util/form_util.h"
 #include "form_mgr_errors.h"
 #undef private
 #undef protected
@@ -2860,5 +2861,136 @@ HWTEST_F(FmsFormBmsHelperTest, FmsFormBmsHelperTest_2128, TestSize.Level1)
     EXPECT_FALSE(formBmsHelper.GetCompileMode(bundleName, moduleName, userId, compileMode));
     GTEST_LOG_(INFO) << "FmsFormHostRecordTest FmsFormBmsHelperTest_2128 end";
 }
+class CountingBundleMgrProxy : public MockBundleMgrProxy {
+public:
+    explicit CountingBundleMgrProxy(const sptr<IRemoteObject> &impl) : MockBundleMgrProxy(impl)
+    {}
+
+    int32_t GetNameForUid(const int uid, std::string &bundleName) override
+    {
+        ipcCount_++;
+        bundleName = uid == APP_600 ? "com.form.host.app600" : "com.form.provider.service";
+        return ERR_OK;
+    }
+
+    bool CheckIsSystemAppByUid(const int uid) override
+    {
+        ipcCount_++;
+        return uid == APP_600;
+    }
+
+    bool GetBundleInfo(const std::string &bundleName, int32_t flags, BundleInfo &bundleInfo, int32_t userId) override
+    {
+        ipcCount_++;
+        bundleInfo.name = bundleName;
+        return true;
+    }
+
+    int32_t ipcCount_ = 0;
+};
+
+/**
+ * @brief The bms queries of an AddForm followed by a refresh of the form: the host is resolved and
+ *        checked, then the provider bundle is queried by both.
+ */
+void RunAddFormAndRefreshQueries(FormBmsHelper &formBmsHelper)
+{
+    const std::string providerBundleName = "com.form.provider.service";
+    const int32_t providerUid = APP_600 + 1;
+    const int32_t userId = 100;
+    std::string bundleName;
+    BundleInfo bundleInfo;
+    // AddForm
+    formBmsHelper.GetBundleNameByUid(APP_600, bundleName);
+    formBmsHelper.CheckIsSystemAppByUid(APP_600);
+    formBmsHelper.GetBundleInfo(providerBundleName, userId, bundleInfo);
+    formBmsHelper.GetBundleInfoWithPermission(providerBundleName, userId, bundleInfo);
+    // refresh
+    formBmsHelper.GetBundleNameByUid(providerUid, bundleName);
+    formBmsHelper.GetBundleInfo(providerBundleName, userId, bundleInfo);
+    formBmsHelper.GetBundleNameByUid(APP_600, bundleName);
+    formBmsHelper.CheckIsSystemAppByUid(APP_600);
+}
+
+/**
+ * @tc.name: FmsFormBmsHelperTest_2129
+ * @tc.desc: Verify that repeated queries of an AddForm and refresh sequence are served from the cache.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormBmsHelperTest, FmsFormBmsHelperTest_2129, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormBmsHelperTest_2129 start";
+    FormBmsHelper formBmsHelper;
+    const sptr<IRemoteObject> impl;
+    sptr<CountingBundleMgrProxy> bundleManager = new (std::nothrow) CountingBundleMgrProxy(impl);
+    formBmsHelper.SetBundleManager(bundleManager);
+    RunAddFormAndRefreshQueries(formBmsHelper);
+    // two uids, one system app check and two flag sets of one bundle, instead of 8
+    constexpr int32_t firstRoundIpcCount = 5;
+    EXPECT_EQ(bundleManager->ipcCount_, firstRoundIpcCount);
+    RunAddFormAndRefreshQueries(formBmsHelper);
+    EXPECT_EQ(bundleManager->ipcCount_, firstRoundIpcCount);
+
+    std::string result;
+    formBmsHelper.DumpCacheStatistics(result);
+    EXPECT_NE(result.find("uidBundleName"), std::string::npos);
+    GTEST_LOG_(INFO) << "FmsFormBmsHelperTest_2129 end";
+}
+
+/**
+ * @tc.name: FmsFormBmsHelperTest_2130
+ * @tc.desc: Verify that package events and a new bundle manager drop the cached queries.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormBmsHelperTest, FmsFormBmsHelperTest_2130, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormBmsHelperTest_2130 start";
+    FormBmsHelper formBmsHelper;
+    const sptr<IRemoteObject> impl;
+    sptr<CountingBundleMgrProxy> bundleManager = new (std::nothrow) CountingBundleMgrProxy(impl);
+    formBmsHelper.SetBundleManager(bundleManager);
+    std::string bundleName;
+    EXPECT_EQ(formBmsHelper.GetBundleNameByUid(APP_600, bundleName), ERR_OK);
+    EXPECT_TRUE(formBmsHelper.CheckIsSystemAppByUid(APP_600));
+    EXPECT_EQ(bundleManager->ipcCount_, 2);
+
+    formBmsHelper.InvalidateBundleCache("com.form.host.app600");
+    EXPECT_EQ(formBmsHelper.GetBundleNameByUid(APP_600, bundleName), ERR_OK);
+    EXPECT_TRUE(formBmsHelper.CheckIsSystemAppByUid(APP_600));
+    EXPECT_EQ(bundleManager->ipcCount_, 4);
+
+    sptr<CountingBundleMgrProxy> restartedBundleManager = new (std::nothrow) CountingBundleMgrProxy(impl);
+    formBmsHelper.SetBundleManager(restartedBundleManager);
+    EXPECT_EQ(formBmsHelper.GetBundleNameByUid(APP_600, bundleName), ERR_OK);
+    EXPECT_EQ(restartedBundleManager->ipcCount_, 1);
+    GTEST_LOG_(INFO) << "FmsFormBmsHelperTest_2130 end";
+}
+
+/**
+ * @tc.name: FmsFormBmsHelperTest_2131
+ * @tc.desc: Verify that a negative system app answer is queried again once it is older than its ttl.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormBmsHelperTest, FmsFormBmsHelperTest_2131, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormBmsHelperTest_2131 start";
+    FormBmsHelper formBmsHelper;
+    const sptr<IRemoteObject> impl;
+    sptr<CountingBundleMgrProxy> bundleManager = new (std::nothrow) CountingBundleMgrProxy(impl);
+    formBmsHelper.SetBundleManager(bundleManager);
+    const int32_t normalUid = APP_600 + 1;
+    EXPECT_FALSE(formBmsHelper.CheckIsSystemAppByUid(normalUid));
+    EXPECT_FALSE(formBmsHelper.CheckIsSystemAppByUid(normalUid));
+    EXPECT_TRUE(formBmsHelper.CheckIsSystemAppByUid(APP_600));
+    EXPECT_EQ(bundleManager->ipcCount_, 2);
+
+    int64_t expired = FormUtil::GetCurrentSteadyClockMillseconds() - FormBmsHelper::NON_SYSTEM_APP_CACHE_TTL_MS;
+    formBmsHelper.systemAppCache_.Put(normalUid, std::make_pair(false, expired));
+    formBmsHelper.systemAppCache_.Put(APP_600, std::make_pair(true, expired));
+    EXPECT_FALSE(formBmsHelper.CheckIsSystemAppByUid(normalUid));
+    EXPECT_TRUE(formBmsHelper.CheckIsSystemAppByUid(APP_600));
+    EXPECT_EQ(bundleManager->ipcCount_, 3);
+    GTEST_LOG_(INFO) << "FmsFormBmsHelperTest_2131 end";
+}
 } // namespace AppExecFwk
 } // namespace OHOS
@@ -500,4 +500,210 @@ HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_024, TestSize.Level1)
     EXPECT_TRUE(formCacheMgr_.AddImgData(formProviderData, formCache));
     GTEST_LOG_(INFO) << "FmsFormCacheMgrTest_024 end";
 }
+
+/*
+ * @tc.name: FmsFormCacheMgrTest_025
+ * @tc.desc: Verify repeated AddData is coalesced in memory and committed by FlushDirtyData.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_025, TestSize.Level1)
+{
+    HILOG_INFO("FmsFormCacheMgrTest_025 start");
+    int64_t formId = PARAM_FORM_ID_FIRST - 1;
+    formCacheMgr_.DeleteData(formId);
+    FormProviderData formProviderData;
+    formProviderData.UpdateData(R"({"a":"1"})"_json);
+    EXPECT_TRUE(formCacheMgr_.AddData(formId, formProviderData));
+    formProviderData.UpdateData(R"({"b":"2"})"_json);
+    EXPECT_TRUE(formCacheMgr_.AddData(formId, formProviderData));
+    EXPECT_EQ(formCacheMgr_.dirtyCaches_.size(), 1);
+    EXPECT_EQ(formCacheMgr_.coalescedCount_.load(), 1);
+
+    int64_t hitCount = formCacheMgr_.hitCount_.load();
+    std::string queryResult;
+    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageDataMap;
+    EXPECT_TRUE(formCacheMgr_.GetData(formId, queryResult, imageDataMap));
+    EXPECT_EQ(queryResult, R"({"a":"1","b":"2"})");
+    EXPECT_EQ(formCacheMgr_.hitCount_.load(), hitCount + 1);
+
+    FormCache formCache;
+    EXPECT_FALSE(formCacheMgr_.GetDataCacheFromDb(formId, formCache));
+    formCacheMgr_.FlushDirtyData();
+    EXPECT_TRUE(formCacheMgr_.dirtyCaches_.empty());
+    EXPECT_TRUE(formCacheMgr_.GetDataCacheFromDb(formId, formCache));
+    EXPECT_EQ(formCache.dataCache, queryResult);
+    EXPECT_TRUE(formCacheMgr_.DeleteData(formId));
+    GTEST_LOG_(INFO) << "FmsFormCacheMgrTest_025 end";
+}
+
+/*
+ * @tc.name: FmsFormCacheMgrTest_026
+ * @tc.desc: Verify DeleteData drops the pending entry so a later flush does not resurrect it.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_026, TestSize.Level1)
+{
+    HILOG_INFO("FmsFormCacheMgrTest_026 start");
+    int64_t formId = PARAM_FORM_ID_FIRST - 2;
+    FormProviderData formProviderData;
+    formProviderData.UpdateData(R"({"a":"1"})"_json);
+    EXPECT_TRUE(formCacheMgr_.AddData(formId, formProviderData));
+    EXPECT_TRUE(formCacheMgr_.DeleteData(formId));
+    EXPECT_EQ(formCacheMgr_.dirtyCaches_.count(formId), 0);
+    EXPECT_EQ(formCacheMgr_.lruIndex_.count(formId), 0);
+    formCacheMgr_.FlushDirtyData();
+    FormCache formCache;
+    EXPECT_FALSE(formCacheMgr_.GetDataCacheFromDb(formId, formCache));
+    EXPECT_TRUE(formCacheMgr_.NeedAcquireProviderData(formId));
+    GTEST_LOG_(INFO) << "FmsFormCacheMgrTest_026 end";
+}
+
+/*
+ * @tc.name: FmsFormCacheMgrTest_027
+ * @tc.desc: Verify the LRU tier is bounded and evicts the least recently used entry.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_027, TestSize.Level1)
+{
+    HILOG_INFO("FmsFormCacheMgrTest_027 start");
+    FormCache formCache;
+    constexpr int64_t capacity = 128;
+    for (int64_t formId = 1; formId <= capacity; formId++) {
+        formCacheMgr_.PutLruCacheNolock(formId, formCache);
+    }
+    // touch the oldest entry, the second one becomes the eviction victim
+    formCacheMgr_.PutLruCacheNolock(1, formCache);
+    formCacheMgr_.PutLruCacheNolock(capacity + 1, formCache);
+    EXPECT_EQ(formCacheMgr_.lruCaches_.size(), capacity);
+    EXPECT_EQ(formCacheMgr_.lruIndex_.count(1), 1);
+    EXPECT_EQ(formCacheMgr_.lruIndex_.count(2), 0);
+
+    formCacheMgr_.FlushDirtyData(true);
+    EXPECT_TRUE(formCacheMgr_.lruCaches_.empty());
+    EXPECT_TRUE(formCacheMgr_.lruIndex_.empty());
+    GTEST_LOG_(INFO) << "FmsFormCacheMgrTest_027 end";
+}
+
+/*
+ * @tc.name: FmsFormCacheMgrTest_028
+ * @tc.desc: Verify DumpStatistics reports hit rate, dirty entries and flush latency.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_028, TestSize.Level1)
+{
+    HILOG_INFO("FmsFormCacheMgrTest_028 start");
+    std::string result;
+    formCacheMgr_.DumpStatistics(result);
+    EXPECT_NE(result.find("hitRate"), std::string::npos);
+    EXPECT_NE(result.find("dirtyEntries"), std::string::npos);
+    EXPECT_NE(result.find("lastFlushCost"), std::string::npos);
+    GTEST_LOG_(INFO) << "FmsFormCacheMgrTest_028 end";
+}
+
+/*
+ * @tc.name: FmsFormCacheMgrTest_029
+ * @tc.desc: Verify identical images of two forms are stored once and share one ashmem on read.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_029, TestSize.Level1)
+{
+    HILOG_INFO("FmsFormCacheMgrTest_029 start");
+    int64_t firstFormId = PARAM_FORM_ID_FIRST - 3;
+    int64_t secondFormId = PARAM_FORM_ID_FIRST - 4;
+    std::string testData = "same_icon_content";
+    sptr<FormAshmem> formAshmem = new (std::nothrow) FormAshmem();
+    ASSERT_NE(formAshmem, nullptr);
+    ASSERT_TRUE(formAshmem->WriteToAshmem("icon", testData.data(), static_cast<int32_t>(testData.size())));
+    FormProviderData formProviderData;
+    formProviderData.imageDataMap_["icon"] = std::make_pair(formAshmem, static_cast<int32_t>(testData.size()));
+
+    int64_t imgReuseCount = formCacheMgr_.imgReuseCount_.load();
+    EXPECT_TRUE(formCacheMgr_.AddData(firstFormId, formProviderData));
+    EXPECT_TRUE(formCacheMgr_.AddData(secondFormId, formProviderData));
+    EXPECT_EQ(formCacheMgr_.imgReuseCount_.load(), imgReuseCount + 1);
+    std::string imgCache = formCacheMgr_.dirtyCaches_[firstFormId].imgCache;
+    EXPECT_EQ(imgCache, formCacheMgr_.dirtyCaches_[secondFormId].imgCache);
+    std::string hash = nlohmann::json::parse(imgCache)["icon"].get<std::string>();
+    EXPECT_EQ(formCacheMgr_.imgRefCounts_[hash], 2);
+
+    std::string data;
+    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> firstImages;
+    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> secondImages;
+    EXPECT_TRUE(formCacheMgr_.GetData(firstFormId, data, firstImages));
+    EXPECT_TRUE(formCacheMgr_.GetData(secondFormId, data, secondImages));
+    ASSERT_EQ(firstImages.size(), 1);
+    EXPECT_EQ(firstImages["icon"].first, secondImages["icon"].first);
+
+    formCacheMgr_.FlushDirtyData();
+    EXPECT_TRUE(formCacheMgr_.DeleteData(firstFormId));
+    EXPECT_EQ(formCacheMgr_.imgRefCounts_[hash], 1);
+    EXPECT_TRUE(formCacheMgr_.DeleteData(secondFormId));
+    EXPECT_EQ(formCacheMgr_.imgRefCounts_.count(hash), 0);
+    EXPECT_EQ(formCacheMgr_.imgAshmemIndex_.count(hash), 0);
+    GTEST_LOG_(INFO) << "FmsFormCacheMgrTest_029 end";
+}
+
+/*
+ * @tc.name: FmsFormCacheMgrTest_030
+ * @tc.desc: Verify an entry taken by a running flush stays readable until its batch commits.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_030, TestSize.Level1)
+{
+    HILOG_INFO("FmsFormCacheMgrTest_030 start");
+    int64_t formId = PARAM_FORM_ID_FIRST - 3;
+    formCacheMgr_.DeleteData(formId);
+    FormCache formCache;
+    formCache.formId = std::to_string(formId);
+    formCache.dataCache = R"({"a":"1"})";
+    formCacheMgr_.inFlightCaches_.emplace(formId, formCache);
+
+    // the low memory flush dropped the LRU tier and the entry is not committed yet
+    FormCache queryCache;
+    EXPECT_TRUE(formCacheMgr_.GetFormCacheNolock(formId, queryCache));
+    EXPECT_EQ(queryCache.dataCache, formCache.dataCache);
+    EXPECT_FALSE(formCacheMgr_.NeedAcquireProviderData(formId));
+
+    formCacheMgr_.inFlightCaches_.clear();
+    EXPECT_TRUE(formCacheMgr_.DeleteData(formId));
+    EXPECT_TRUE(formCacheMgr_.NeedAcquireProviderData(formId));
+    GTEST_LOG_(INFO) << "FmsFormCacheMgrTest_030 end";
+}
+
+/*
+ * @tc.name: FmsFormCacheMgrTest_031
+ * @tc.desc: Verify the image ashmem cache evicts the least recently used image when it is full.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_031, TestSize.Level1)
+{
+    HILOG_INFO("FmsFormCacheMgrTest_031 start");
+    constexpr size_t maxImgAshmemCount = 64;
+    for (size_t i = 0; i < maxImgAshmemCount; i++) {
+        formCacheMgr_.PutImgAshmemNolock("hash" + std::to_string(i), std::make_pair(new FormAshmem(), 1));
+    }
+    EXPECT_EQ(formCacheMgr_.imgAshmems_.size(), maxImgAshmemCount);
+
+    // a hit moves the oldest image to the front, so the next oldest one is evicted
+    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageDataMap;
+    EXPECT_TRUE(formCacheMgr_.GetImageDataByHash("icon", "hash0", imageDataMap));
+    formCacheMgr_.PutImgAshmemNolock("hashNew", std::make_pair(new FormAshmem(), 1));
+    EXPECT_EQ(formCacheMgr_.imgAshmems_.size(), maxImgAshmemCount);
+    EXPECT_EQ(formCacheMgr_.imgAshmemIndex_.size(), maxImgAshmemCount);
+    EXPECT_EQ(formCacheMgr_.imgAshmemIndex_.count("hash0"), 1);
+    EXPECT_EQ(formCacheMgr_.imgAshmemIndex_.count("hash1"), 0);
+    EXPECT_EQ(formCacheMgr_.imgAshmems_.front().first, "hashNew");
+
+    formCacheMgr_.EraseImgAshmemNolock("hash0");
+    EXPECT_EQ(formCacheMgr_.imgAshmemIndex_.count("hash0"), 0);
+    EXPECT_EQ(formCacheMgr_.imgAshmems_.size(), maxImgAshmemCount - 1);
+    GTEST_LOG_(INFO) << "FmsFormCacheMgrTest_031 end";
+}
 }
@@ -81,7 +81,7 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_ActiveUserChecker_001, TestSiz
     formRecord.providerUserId = callingUid;
     Want reqWant;
     CheckValidFactor reqFactor;
-    reqFactor.record = formRecord;
+    reqFactor.record = std::make_shared<const FormRecord>(formRecord);
     reqFactor.want = reqWant;
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF, ActiveUserChecker::GetInstance().CheckValid(reqFactor));
 
@@ -95,11 +95,11 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_AddFinishChecker_002, TestSize
     CheckValidFactor reqFactor;
     FormRecord formRecord;
     formRecord.addFormFinish = false;
-    reqFactor.record = formRecord;
+    reqFactor.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_NOT_EXIST_ID, AddFinishChecker::GetInstance().CheckValid(reqFactor));
 
     formRecord.addFormFinish = true;
-    reqFactor.record = formRecord;
+    reqFactor.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, AddFinishChecker::GetInstance().CheckValid(reqFactor));
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_AddFinishChecker_002 end";
 }
@@ -109,6 +109,7 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_CallingBundleChecker_003, Test
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_CallingBundleChecker_003 start";
 
     CheckValidFactor reqFactor;
+    reqFactor.record = std::make_shared<const FormRecord>();
     EXPECT_EQ(ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED, CallingBundleChecker::GetInstance().CheckValid(reqFactor));
 
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_CallingBundleChecker_003 end";
@@ -120,12 +121,13 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_CallingUserChecker_004, TestSi
 
     int callingUid = 1;
     CheckValidFactor reqFactor;
+    reqFactor.record = std::make_shared<const FormRecord>();
     reqFactor.callingUid = callingUid;
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF, CallingUserChecker::GetInstance().CheckValid(reqFactor));
 
     FormRecord formRecord;
     formRecord.uid = callingUid;
-    reqFactor.record = formRecord;
+    reqFactor.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, CallingUserChecker::GetInstance().CheckValid(reqFactor));
 
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_CallingUserChecker_004 end";
@@ -154,11 +156,12 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_SystemAppChecker_006, TestSize
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_SystemAppChecker_006 start";
 
     CheckValidFactor reqFactor;
+    reqFactor.record = std::make_shared<const FormRecord>();
     EXPECT_EQ(ERR_APPEXECFWK_FORM_PERMISSION_DENY_SYS, SystemAppChecker::GetInstance().CheckValid(reqFactor));
 
     FormRecord formRecord;
     formRecord.isSystemApp = true;
-    reqFactor.record = formRecord;
+    reqFactor.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, SystemAppChecker::GetInstance().CheckValid(reqFactor));
 
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_SystemAppChecker_006 end";
@@ -169,15 +172,19 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormDataRefreshImpl_007, TestS
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_FormDataRefreshImpl_007 start";
 
     RefreshData data;
+    FormRecord formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsBaseValidPass(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF, FormDataRefreshImpl::GetInstance().RefreshFormRequest(data));
 
     MockIsBaseValidPass(ERR_OK);
-    data.record.uiSyntax = FormType::JS;
+    formRecord.uiSyntax = FormType::JS;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockFormProviderUpdateForm(ERR_OK);
     EXPECT_EQ(ERR_OK, FormDataRefreshImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.uiSyntax = FormType::ETS;
+    formRecord.uiSyntax = FormType::ETS;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockUpdateByProviderData(ERR_APPEXECFWK_FORM_DISABLE_REFRESH);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_DISABLE_REFRESH, FormDataRefreshImpl::GetInstance().RefreshFormRequest(data));
 
@@ -191,6 +198,8 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormForceRefreshImpl_008, Test
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_FormForceRefreshImpl_008 start";
 
     RefreshData data;
+    FormRecord formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
 
     MockIsBaseValidPass(ERR_OK);
     MockAskForProviderData(ERR_APPEXECFWK_FORM_COMMON_CODE);
@@ -207,15 +216,17 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormHostRefreshImpl_009, TestS
 
     RefreshData data;
     FormRecord formRecord;
-    data.record = formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsBaseValidPass(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF, FormHostRefreshImpl::GetInstance().RefreshFormRequest(data));
 
     MockIsBaseValidPass(ERR_OK);
-    data.record.enableForm = false;
+    formRecord.enableForm = false;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, FormHostRefreshImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.enableForm = true;
+    formRecord.enableForm = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsAddFormFinish(false);
     EXPECT_EQ(ERR_OK, FormHostRefreshImpl::GetInstance().RefreshFormRequest(data));
 
@@ -223,7 +234,8 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormHostRefreshImpl_009, TestS
     MockIsScreenOff(true);
     EXPECT_EQ(ERR_OK, FormHostRefreshImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.isVisible = true;
+    formRecord.isVisible = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsScreenOff(false);
     MockIsNeedToFresh(false);
     EXPECT_EQ(ERR_OK, FormHostRefreshImpl::GetInstance().RefreshFormRequest(data));
@@ -233,7 +245,8 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormHostRefreshImpl_009, TestS
     EXPECT_EQ(ERR_OK, FormHostRefreshImpl::GetInstance().RefreshFormRequest(data));
 
     MockAskForProviderData(ERR_OK);
-    data.record.isSystemApp = true;
+    formRecord.isSystemApp = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, FormHostRefreshImpl::GetInstance().RefreshFormRequest(data));
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_FormHostRefreshImpl_009 end";
 }
@@ -244,23 +257,27 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormNetConnRefreshImpl_010, Te
 
     RefreshData data;
     FormRecord formRecord;
-    data.record = formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsBaseValidPass(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF, FormNetConnRefreshImpl::GetInstance().RefreshFormRequest(data));
 
     MockIsBaseValidPass(ERR_OK);
-    data.record.enableForm = false;
+    formRecord.enableForm = false;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, FormNetConnRefreshImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.enableForm = true;
-    data.record.formVisibleNotifyState = Constants::FORM_INVISIBLE;
+    formRecord.enableForm = true;
+    formRecord.formVisibleNotifyState = Constants::FORM_INVISIBLE;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, FormNetConnRefreshImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.formVisibleNotifyState = Constants::FORM_VISIBLE;
+    formRecord.formVisibleNotifyState = Constants::FORM_VISIBLE;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsScreenOff(true);
     EXPECT_EQ(ERR_OK, FormNetConnRefreshImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.isVisible = true;
+    formRecord.isVisible = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsScreenOff(false);
     MockIsNeedToFresh(false);
     EXPECT_EQ(ERR_OK, FormNetConnRefreshImpl::GetInstance().RefreshFormRequest(data));
@@ -270,7 +287,8 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormNetConnRefreshImpl_010, Te
     EXPECT_EQ(ERR_APPEXECFWK_FORM_COMMON_CODE, FormNetConnRefreshImpl::GetInstance().RefreshFormRequest(data));
 
     MockAskForProviderData(ERR_OK);
-    data.record.isSystemApp = true;
+    formRecord.isSystemApp = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, FormNetConnRefreshImpl::GetInstance().RefreshFormRequest(data));
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_FormNetConnRefreshImpl_010 end";
 }
@@ -281,12 +299,13 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormNextTimeRefreshImpl_011, T
 
     RefreshData data;
     FormRecord formRecord;
-    data.record = formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsBaseValidPass(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF, FormNextTimeRefreshImpl::GetInstance().RefreshFormRequest(data));
 
     MockIsBaseValidPass(ERR_OK);
-    data.record.isDataProxy = true;
+    formRecord.isDataProxy = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_COMMON_CODE, FormNextTimeRefreshImpl::GetInstance().RefreshFormRequest(data));
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_FormNextTimeRefreshImpl_011 end";
 }
@@ -297,18 +316,20 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormRefreshAfterUncontrolImpl_
 
     RefreshData data;
     FormRecord formRecord;
-    data.record = formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsBaseValidPass(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF,
         FormRefreshAfterUncontrolImpl::GetInstance().RefreshFormRequest(data));
 
     MockIsBaseValidPass(ERR_OK);
-    data.record.enableForm = false;
+    formRecord.enableForm = false;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, FormRefreshAfterUncontrolImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.enableForm = true;
-    data.record.formVisibleNotifyState = Constants::FORM_INVISIBLE;
-    data.record.isSystemApp = true;
+    formRecord.enableForm = true;
+    formRecord.formVisibleNotifyState = Constants::FORM_INVISIBLE;
+    formRecord.isSystemApp = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     data.want.SetParam(Constants::KEY_IS_TIMER, true);
     data.want.SetParam(Constants::KEY_TIMER_REFRESH, true);
     data.want.SetParam(Constants::PARAM_FORM_REFRESH_TYPE, Constants::REFRESHTYPE_VISIABLE);
@@ -319,11 +340,13 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormRefreshAfterUncontrolImpl_
     itemInfo.SetFormId(formId);
     FormDataMgr::GetInstance().AllotFormRecord(itemInfo, 0, 0);
     FormDataMgr::GetInstance().SetRefreshType(formId, Constants::REFRESHTYPE_NETWORKCHANGED);
-    data.record.formVisibleNotifyState = Constants::FORM_VISIBLE;
+    formRecord.formVisibleNotifyState = Constants::FORM_VISIBLE;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsScreenOff(true);
     EXPECT_EQ(ERR_OK, FormRefreshAfterUncontrolImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.isVisible = true;
+    formRecord.isVisible = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsScreenOff(false);
     MockIsNeedToFresh(false);
     EXPECT_EQ(ERR_OK, FormRefreshAfterUncontrolImpl::GetInstance().RefreshFormRequest(data));
@@ -351,7 +374,7 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormTimerRefreshImpl_013, Test
 
     data.formId = formId;
     FormRecord formRecord;
-    data.record = formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
 
     FormTimer timerTask;
     timerTask.isCountTimer = true;
@@ -367,18 +390,21 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormTimerRefreshImpl_013, Test
     EXPECT_EQ(ERR_OK, FormTimerRefreshImpl::GetInstance().RefreshFormRequest(data));
 
     MockIsSystemOverload(false);
-    data.record.enableForm = false;
+    formRecord.enableForm = false;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, FormTimerRefreshImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.enableForm = true;
-    data.record.formVisibleNotifyState = Constants::FORM_INVISIBLE;
-    data.record.isSystemApp = true;
+    formRecord.enableForm = true;
+    formRecord.formVisibleNotifyState = Constants::FORM_INVISIBLE;
+    formRecord.isSystemApp = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     data.want.SetParam(Constants::KEY_IS_TIMER, true);
     data.want.SetParam(Constants::KEY_TIMER_REFRESH, true);
     data.want.SetParam(Constants::PARAM_FORM_REFRESH_TYPE, Constants::REFRESHTYPE_VISIABLE);
     EXPECT_EQ(ERR_OK, FormTimerRefreshImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.formVisibleNotifyState = Constants::FORM_VISIBLE;
+    formRecord.formVisibleNotifyState = Constants::FORM_VISIBLE;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsScreenOff(true);
     EXPECT_EQ(ERR_OK, FormTimerRefreshImpl::GetInstance().RefreshFormRequest(data));
 
@@ -395,6 +421,7 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_UntrustAppChecker_014, TestSiz
 {
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_UntrustAppChecker_014 start";
     CheckValidFactor reqFactor;
+    reqFactor.record = std::make_shared<const FormRecord>();
     EXPECT_EQ(ERR_OK, UntrustAppChecker::GetInstance().CheckValid(reqFactor));
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_UntrustAppChecker_014 end";
 }
@@ -405,17 +432,19 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormAppUpgradeRefreshImpl_015,
 
     RefreshData data;
     FormRecord formRecord;
-    data.record = formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsBaseValidPass(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF,
         FormAppUpgradeRefreshImpl::GetInstance().RefreshFormRequest(data));
 
     MockIsBaseValidPass(ERR_OK);
-    data.record.enableForm = false;
+    formRecord.enableForm = false;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, FormAppUpgradeRefreshImpl::GetInstance().RefreshFormRequest(data));
 
-    data.record.enableForm = true;
-    data.record.isVisible = true;
+    formRecord.enableForm = true;
+    formRecord.isVisible = true;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockAskForProviderData(ERR_APPEXECFWK_FORM_COMMON_CODE);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_COMMON_CODE, FormAppUpgradeRefreshImpl::GetInstance().RefreshFormRequest(data));
 
@@ -430,7 +459,7 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_FormProviderRefreshImpl_016, T
 
     RefreshData data;
     FormRecord formRecord;
-    data.record = formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     MockIsBaseValidPass(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF);
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF, FormProviderRefreshImpl::GetInstance().RefreshFormRequest(data));
 
@@ -464,7 +493,7 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_MultiActiveUsersChecker_001, T
     formRecord.providerUserId = callingUid;
     Want reqWant;
     CheckValidFactor reqFactor;
-    reqFactor.record = formRecord;
+    reqFactor.record = std::make_shared<const FormRecord>(formRecord);
     reqFactor.want = reqWant;
     EXPECT_EQ(ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF, MultiActiveUsersChecker::GetInstance().CheckValid(reqFactor));
 
@@ -476,6 +505,8 @@ HWTEST_F(FmsFormCheckMgrTest, FmsFormCheckMgrTest_BaseFormRefresh_001, TestSize.
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_BaseFormRefresh_001 start";
 
     RefreshData data;
+    FormRecord formRecord;
+    data.record = std::make_shared<const FormRecord>(formRecord);
     RefreshConfig config;
     config.controlCheckFlags = CONTROL_CHECK_SYSTEM_OVERLOAD | CONTROL_CHECK_HEALTHY_CONTROL |
         CONTROL_CHECK_INVISIBLE | CONTROL_CHECK_SCREEN_OFF | CONTROL_CHECK_NEED_TO_FRESH | CONTROL_CHECK_ADD_FINISH;
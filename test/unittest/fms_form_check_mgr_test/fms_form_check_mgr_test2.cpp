@@ -55,6 +55,11 @@ HWTEST_F(FmsFormCheckMgrTest2, FmsFormCheckMgrTest_RefreshCheckMgr_001, TestSize
     CheckValidFactor factor;
     EXPECT_EQ(ERR_OK, RefreshCheckMgr::GetInstance().IsBaseValidPass(checkTypes, factor));
 
+    checkTypes = { TYPE_SYSTEM_APP };
+    EXPECT_EQ(ERR_APPEXECFWK_FORM_NOT_EXIST_ID, RefreshCheckMgr::GetInstance().IsBaseValidPass(checkTypes, factor));
+
+    FormRecord formRecord;
+    factor.record = std::make_shared<const FormRecord>(formRecord);
     checkTypes = { -1 };
     EXPECT_EQ(ERR_APPEXECFWK_FORM_INVALID_PARAM, RefreshCheckMgr::GetInstance().IsBaseValidPass(checkTypes, factor));
 
@@ -62,7 +67,8 @@ HWTEST_F(FmsFormCheckMgrTest2, FmsFormCheckMgrTest_RefreshCheckMgr_001, TestSize
     EXPECT_EQ(ERR_APPEXECFWK_FORM_PERMISSION_DENY_SYS,
         RefreshCheckMgr::GetInstance().IsBaseValidPass(checkTypes, factor));
 
-    factor.record.isSystemApp = true;
+    formRecord.isSystemApp = true;
+    factor.record = std::make_shared<const FormRecord>(formRecord);
     EXPECT_EQ(ERR_OK, RefreshCheckMgr::GetInstance().IsBaseValidPass(checkTypes, factor));
     GTEST_LOG_(INFO) << "FmsFormCheckMgrTest_RefreshCheckMgr_001 end";
 }
@@ -85,7 +85,7 @@ bool RefreshControlMgr::IsHealthyControl(const FormRecord &record)
     return g_mockIsHealthyControl;
 }
 
-bool RefreshControlMgr::IsNeedToFresh(FormRecord &record, bool isVisibleToFresh)
+bool RefreshControlMgr::IsNeedToFresh(const FormRecord &record, bool isVisibleToFresh)
 {
     return g_mockIsNeedToFresh;
 }
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#define private public
+#define protected public
+#include "form_provider/form_connection_pool.h"
+#include "form_provider/connection/form_refresh_connection.h"
+#undef protected
+#undef private
+#include "fms_log_wrapper.h"
+#include "form_mgr_errors.h"
+#include "mock_form_provider_client.h"
+#include "gmock/gmock.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+extern void MockConnectServiceAbilityRet(ErrCode mockRet);
+extern int32_t GetMockConnectCount();
+extern int32_t GetMockDisconnectCount();
+extern void ResetMockConnectCount();
+
+namespace {
+const std::string BUNDLE_NAME = "com.form.provider";
+const std::string ABILITY_NAME = "FormAbility";
+const std::string MODULE_NAME = "entry";
+constexpr int32_t USER_ID = 100;
+constexpr int64_t FORM_ID_BASE = 100000;
+constexpr int32_t REFRESH_COUNT = 100;
+
+sptr<FormAbilityConnection> CreateRefreshConnection(int64_t formId)
+{
+    FormRecord record;
+    record.formId = formId;
+    record.bundleName = BUNDLE_NAME;
+    record.abilityName = ABILITY_NAME;
+    record.moduleName = MODULE_NAME;
+    record.providerUserId = USER_ID;
+    Want want;
+    return new FormRefreshConnection(formId, want, record);
+}
+
+std::string GetProviderKey()
+{
+    return CreateRefreshConnection(FORM_ID_BASE)->GetProviderKey();
+}
+
+sptr<FormPooledConnection> GetPooledConnection()
+{
+    auto &providers = FormConnectionPool::GetInstance().providers_;
+    auto iter = providers.find(GetProviderKey());
+    return iter == providers.end() ? nullptr : iter->second.pooled;
+}
+
+class FormConnectionPoolTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void FormConnectionPoolTest::SetUpTestCase()
+{}
+
+void FormConnectionPoolTest::TearDownTestCase()
+{}
+
+void FormConnectionPoolTest::SetUp()
+{
+    ResetMockConnectCount();
+    MockConnectServiceAbilityRet(ERR_OK);
+}
+
+void FormConnectionPoolTest::TearDown()
+{
+    FormConnectionPool::GetInstance().providers_.clear();
+}
+
+/**
+ * @tc.name: FormConnectionPoolTest_0001
+ * @tc.desc: test 100 refreshes of one provider share a single ability connect.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormConnectionPoolTest, FormConnectionPoolTest_0001, TestSize.Level0)
+{
+    HILOG_INFO("FormConnectionPoolTest_0001 start");
+    std::vector<sptr<FormAbilityConnection>> connections;
+    for (int32_t i = 0; i < REFRESH_COUNT; i++) {
+        connections.emplace_back(CreateRefreshConnection(FORM_ID_BASE + i));
+    }
+    FormConnectionPool &pool = FormConnectionPool::GetInstance();
+    EXPECT_EQ(pool.Connect(connections[0], USER_ID), ERR_OK);
+    sptr<FormPooledConnection> pooled = GetPooledConnection();
+    ASSERT_NE(pooled, nullptr);
+    AppExecFwk::ElementName element("", BUNDLE_NAME, ABILITY_NAME, MODULE_NAME);
+    sptr<IRemoteObject> providerToken = new (std::nothrow) MockFormProviderClient();
+    pooled->OnAbilityConnectDone(element, providerToken, ERR_OK);
+    EXPECT_EQ(connections[0]->GetProviderToken(), providerToken);
+
+    for (int32_t i = 1; i < REFRESH_COUNT; i++) {
+        EXPECT_EQ(pool.Connect(connections[i], USER_ID), ERR_OK);
+        EXPECT_EQ(connections[i]->GetProviderToken(), providerToken);
+        EXPECT_TRUE(connections[i]->IsPooled());
+    }
+    for (const auto &connection : connections) {
+        pool.Release(connection);
+    }
+    EXPECT_EQ(GetMockConnectCount(), 1);
+    EXPECT_EQ(GetMockDisconnectCount(), 0);
+    EXPECT_TRUE(pool.providers_[GetProviderKey()].attached.empty());
+
+    pool.providers_[GetProviderKey()].lastActiveTime = 0;
+    pool.ReleaseIdle(GetProviderKey(), pooled);
+    EXPECT_EQ(GetPooledConnection(), nullptr);
+    EXPECT_EQ(GetMockDisconnectCount(), 1);
+    GTEST_LOG_(INFO) << "FormConnectionPoolTest_0001 end";
+}
+
+/**
+ * @tc.name: FormConnectionPoolTest_0002
+ * @tc.desc: test refreshes queued while the provider connects run once it is connected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormConnectionPoolTest, FormConnectionPoolTest_0002, TestSize.Level0)
+{
+    HILOG_INFO("FormConnectionPoolTest_0002 start");
+    FormConnectionPool &pool = FormConnectionPool::GetInstance();
+    sptr<FormAbilityConnection> first = CreateRefreshConnection(FORM_ID_BASE);
+    sptr<FormAbilityConnection> second = CreateRefreshConnection(FORM_ID_BASE + 1);
+    EXPECT_EQ(pool.Connect(first, USER_ID), ERR_OK);
+    EXPECT_EQ(pool.Connect(second, USER_ID), ERR_OK);
+    EXPECT_EQ(GetMockConnectCount(), 1);
+    EXPECT_EQ(pool.providers_[GetProviderKey()].pending.size(), 2);
+
+    AppExecFwk::ElementName element("", BUNDLE_NAME, ABILITY_NAME, MODULE_NAME);
+    sptr<IRemoteObject> providerToken = new (std::nothrow) MockFormProviderClient();
+    GetPooledConnection()->OnAbilityConnectDone(element, providerToken, ERR_OK);
+    EXPECT_TRUE(pool.providers_[GetProviderKey()].pending.empty());
+    EXPECT_EQ(pool.providers_[GetProviderKey()].attached.size(), 2);
+    EXPECT_EQ(second->GetProviderToken(), providerToken);
+    GTEST_LOG_(INFO) << "FormConnectionPoolTest_0002 end";
+}
+
+/**
+ * @tc.name: FormConnectionPoolTest_0003
+ * @tc.desc: test a failed provider connect is reported to the caller and not pooled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormConnectionPoolTest, FormConnectionPoolTest_0003, TestSize.Level0)
+{
+    HILOG_INFO("FormConnectionPoolTest_0003 start");
+    MockConnectServiceAbilityRet(ERR_APPEXECFWK_FORM_BIND_PROVIDER_FAILED);
+    sptr<FormAbilityConnection> connection = CreateRefreshConnection(FORM_ID_BASE);
+    EXPECT_EQ(FormConnectionPool::GetInstance().Connect(connection, USER_ID),
+        ERR_APPEXECFWK_FORM_BIND_PROVIDER_FAILED);
+    EXPECT_FALSE(connection->IsPooled());
+    EXPECT_EQ(GetPooledConnection(), nullptr);
+    GTEST_LOG_(INFO) << "FormConnectionPoolTest_0003 end";
+}
+
+/**
+ * @tc.name: FormConnectionPoolTest_0004
+ * @tc.desc: test a provider disconnect reaches the attached connections and drops the pooled connection.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormConnectionPoolTest, FormConnectionPoolTest_0004, TestSize.Level0)
+{
+    HILOG_INFO("FormConnectionPoolTest_0004 start");
+    FormConnectionPool &pool = FormConnectionPool::GetInstance();
+    sptr<FormAbilityConnection> connection = CreateRefreshConnection(FORM_ID_BASE);
+    EXPECT_EQ(pool.Connect(connection, USER_ID), ERR_OK);
+    sptr<FormPooledConnection> pooled = GetPooledConnection();
+    ASSERT_NE(pooled, nullptr);
+    AppExecFwk::ElementName element("", BUNDLE_NAME, ABILITY_NAME, MODULE_NAME);
+    pooled->OnAbilityConnectDone(element, new (std::nothrow) MockFormProviderClient(), ERR_OK);
+    EXPECT_EQ(connection->GetConnectState(), ConnectState::CONNECTED);
+
+    pooled->OnAbilityDisconnectDone(element, ERR_OK);
+    EXPECT_EQ(GetPooledConnection(), nullptr);
+    EXPECT_EQ(connection->GetConnectState(), ConnectState::DISCONNECTED);
+    GTEST_LOG_(INFO) << "FormConnectionPoolTest_0004 end";
+}
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ams_mgr/form_ams_helper.h"
+
+#include "form_mgr_errors.h"
+
+namespace {
+    int32_t g_connectCount = 0;
+    int32_t g_disconnectCount = 0;
+    ErrCode g_mockConnectServiceAbilityRet = ERR_OK;
+}
+
+void MockConnectServiceAbilityRet(ErrCode mockRet)
+{
+    g_mockConnectServiceAbilityRet = mockRet;
+}
+
+int32_t GetMockConnectCount()
+{
+    return g_connectCount;
+}
+
+int32_t GetMockDisconnectCount()
+{
+    return g_disconnectCount;
+}
+
+void ResetMockConnectCount()
+{
+    g_connectCount = 0;
+    g_disconnectCount = 0;
+}
+
+namespace OHOS {
+namespace AppExecFwk {
+ErrCode FormAmsHelper::ConnectServiceAbilityWithUserId(
+    const Want &want, const sptr<AAFwk::IAbilityConnection> &connect, int32_t userId)
+{
+    g_connectCount++;
+    return g_mockConnectServiceAbilityRet;
+}
+
+ErrCode FormAmsHelper::DisconnectServiceAbility(const sptr<AAFwk::IAbilityConnection> &connect)
+{
+    g_disconnectCount++;
+    return ERR_OK;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
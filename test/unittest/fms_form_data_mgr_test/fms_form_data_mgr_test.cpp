@@ -53,6 +53,16 @@ const int64_t FORM_ID_ZERO = 0;
 const int64_t FORM_USER_UIDS_ZERO = 0;
 
 namespace {
+void ClearFormDbCache()
+{
+    FormDbCache &formDbCache = FormDbCache::GetInstance();
+    formDbCache.formDBInfos_.clear();
+    formDbCache.bundleUserIndex_.clear();
+    formDbCache.providerUserIndex_.clear();
+    formDbCache.userIdFormCounts_.clear();
+    formDbCache.hostUidFormCounts_.clear();
+}
+
 class FmsFormDataMgrTest : public testing::Test {
 public:
     FmsFormDataMgrTest()
@@ -80,7 +90,7 @@ void FmsFormDataMgrTest::SetUp(void)
 void FmsFormDataMgrTest::TearDown(void)
 {
     while (!formDataMgr_.formRecords_.empty()) {
-        formDataMgr_.formRecords_.erase(formDataMgr_.formRecords_.begin());
+        formDataMgr_.EraseFormRecordNolock(formDataMgr_.formRecords_.begin());
     }
     if (!formDataMgr_.clientRecords_.empty()) {
         formDataMgr_.clientRecords_.erase(formDataMgr_.clientRecords_.begin(), formDataMgr_.clientRecords_.end());
@@ -89,7 +99,7 @@ void FmsFormDataMgrTest::TearDown(void)
         formDataMgr_.tempForms_.erase(formDataMgr_.tempForms_.begin(), formDataMgr_.tempForms_.end());
     }
     if (!FormDbCache::GetInstance().formDBInfos_.empty()) {
-        FormDbCache::GetInstance().formDBInfos_.clear();
+        ClearFormDbCache();
     }
     formDataMgr_.udidHash_ = 0;
 }
@@ -161,7 +171,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_AllotFormRecord_002, TestSize.Le
 
     // create formRecords
     FormRecord record = formDataMgr_.CreateFormRecord(form_item_info, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     FormRecord recordResult = formDataMgr_.AllotFormRecord(form_item_info, callingUid);
     EXPECT_EQ(formId, recordResult.formId);
@@ -194,7 +204,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_AllotFormRecord_003, TestSize.Le
 
     // create formRecords
     FormRecord record = formDataMgr_.CreateFormRecord(otherFormItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(otherformId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherformId, record);
 
     FormRecord recordResult = formDataMgr_.AllotFormRecord(form_item_info, callingUid);
     EXPECT_EQ(formId, recordResult.formId);
@@ -706,10 +716,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_ModifyFormTempFlag_002, TestSize
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(true, formDataMgr_.ModifyFormTempFlag(formId, formTempFlag));
-    EXPECT_EQ(false, formDataMgr_.formRecords_[formId].formTempFlag);
+    EXPECT_EQ(false, formDataMgr_.formRecords_[formId]->formTempFlag);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_ModifyFormTempFlag_002 end";
 }
@@ -752,7 +762,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_AddFormUserUid_002, TestSize.Lev
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
     EXPECT_EQ(true, formDataMgr_.AddFormUserUid(formId, formUserUid));
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_AddFormUserUid_002 end";
 }
@@ -794,13 +804,13 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_DeleteFormUserUid_002, TestSize.
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, formUserUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(true, formDataMgr_.DeleteFormUserUid(formId, formUserUid));
 
     // check formUserUids
     bool find = false;
-    for (int uid : formDataMgr_.formRecords_[formId].formUserUids) {
+    for (int uid : formDataMgr_.formRecords_[formId]->formUserUids) {
         if (uid == formUserUid) {
             find = true;
         }
@@ -852,7 +862,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateFormRecord_002, TestSize.L
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     int callingUidModify = 1;
     FormRecord recordModify = formDataMgr_.CreateFormRecord(formItemInfo, callingUidModify);
@@ -860,9 +870,9 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateFormRecord_002, TestSize.L
     EXPECT_EQ(true, formDataMgr_.UpdateFormRecord(formId, recordModify));
 
     // check update form
-    auto iter = std::find(formDataMgr_.formRecords_[formId].formUserUids.begin(),
-        formDataMgr_.formRecords_[formId].formUserUids.end(), callingUidModify);
-    if (iter != formDataMgr_.formRecords_[formId].formUserUids.end()) {
+    auto iter = std::find(formDataMgr_.formRecords_[formId]->formUserUids.begin(),
+        formDataMgr_.formRecords_[formId]->formUserUids.end(), callingUidModify);
+    if (iter != formDataMgr_.formRecords_[formId]->formUserUids.end()) {
         GTEST_LOG_(INFO) << "FmsFormDataMgrTest_UpdateFormRecord_002 find callingUidModify after update!";
     }
 
@@ -883,10 +893,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateFormRecord_003, TestSize.L
     FormRecord record;
     record.bundleName = "XXX";
 
-    formDataMgr_.formRecords_.clear();
-    formDataMgr_.formRecords_[formId] = record;
+    formDataMgr_.ClearFormRecordsNolock();
+    formDataMgr_.formRecords_[formId] = std::make_shared<FormRecord>(record);
     formDataMgr_.UpdateFormRecord(formId, [](FormRecord &record) { record.bundleName = "bundleName"; });
-    EXPECT_EQ(formDataMgr_.formRecords_[formId].bundleName, "bundleName");
+    EXPECT_EQ(formDataMgr_.formRecords_[formId]->bundleName, "bundleName");
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_UpdateFormRecord_003 end";
 }
 
@@ -927,7 +937,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormRecord_002, TestSize.Leve
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     FormRecord recordOutput;
     EXPECT_EQ(true, formDataMgr_.GetFormRecord(formId, recordOutput));
@@ -976,7 +986,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormRecord_2_002, TestSize.Le
     InitFormItemInfo(formId, formItemInfo);
     formItemInfo.SetProviderBundleName(bundleName);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(true, formDataMgr_.GetFormRecord(bundleName, formInfos));
 
@@ -1019,7 +1029,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HasFormUserUids_002, TestSize.Le
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(true, formDataMgr_.HasFormUserUids(formId));
 
@@ -1150,7 +1160,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HandleHostDied_001, TestSize.Lev
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.HandleHostDied(token_);
 
@@ -1185,7 +1195,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HandleHostDied_002, TestSize.Lev
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.HandleHostDied(token_);
 
@@ -1218,7 +1228,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HandleHostDied_003, TestSize.Lev
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     record.expectRecycled = true;
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.HandleHostDied(token_);
 
@@ -1386,10 +1396,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetNeedRefresh_002, TestSize.Lev
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.SetNeedRefresh(formId, needRefresh);
-    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second.needRefresh);
+    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second->needRefresh);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetNeedRefresh_002 end";
 }
@@ -1433,10 +1443,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetCountTimerRefresh_002, TestSi
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.SetCountTimerRefresh(formId, countTimerRefresh);
-    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second.isCountTimerRefresh);
+    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second->isCountTimerRefresh);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetCountTimerRefresh_002 end";
 }
@@ -1580,10 +1590,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetEnableUpdate_002, TestSize.Le
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.SetEnableUpdate(formId, enableUpdate);
-    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second.isEnableUpdate);
+    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second->isEnableUpdate);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetEnableUpdate_002 end";
 }
@@ -1638,13 +1648,13 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetUpdateInfo_002, TestSize.Leve
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.SetUpdateInfo(formId, enableUpdate, updateDuration, updateAtHour, updateAtMin, updateAtTimes);
-    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second.isEnableUpdate);
-    EXPECT_EQ(100, formDataMgr_.formRecords_.find(formId)->second.updateDuration);
-    EXPECT_EQ(24, formDataMgr_.formRecords_.find(formId)->second.updateAtHour);
-    EXPECT_EQ(59, formDataMgr_.formRecords_.find(formId)->second.updateAtMin);
+    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second->isEnableUpdate);
+    EXPECT_EQ(100, formDataMgr_.formRecords_.find(formId)->second->updateDuration);
+    EXPECT_EQ(24, formDataMgr_.formRecords_.find(formId)->second->updateAtHour);
+    EXPECT_EQ(59, formDataMgr_.formRecords_.find(formId)->second->updateAtMin);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetUpdateInfo_002 end";
 }
@@ -1667,7 +1677,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_CleanRemovedFormRecords_001, Tes
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     std::string bundleName = FORM_HOST_BUNDLE_NAME;
 
@@ -1699,7 +1709,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_CleanRemovedFormRecords_002, Tes
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     std::string bundleName = FORM_HOST_BUNDLE_NAME;
 
@@ -1739,7 +1749,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_CleanRemovedTempFormRecords_001,
     formItemInfo.SetProviderBundleName(bundleName);
     int32_t userId = 100;
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid, userId);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     // create tempForms_
     formDataMgr_.tempForms_.emplace_back(formId);
@@ -1778,7 +1788,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_CleanRemovedTempFormRecords_002,
     InitFormItemInfo(formId, formItemInfo);
     formItemInfo.SetProviderBundleName(otherBundleName);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     // create tempForms_
     formDataMgr_.tempForms_.emplace_back(formId);
@@ -1813,7 +1823,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetReCreateFormRecordsByBundleNa
     InitFormItemInfo(formId, formItemInfo);
     formItemInfo.SetProviderBundleName(bundleName);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.GetReCreateFormRecordsByBundleName(bundleName, reCreateForms);
     EXPECT_EQ(true, reCreateForms.count(formId));
@@ -1858,11 +1868,11 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetFormCacheInited_002, TestSize
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.SetFormCacheInited(formId, true);
-    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second.isInited);
-    EXPECT_EQ(false, formDataMgr_.formRecords_.find(formId)->second.needRefresh);
+    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second->isInited);
+    EXPECT_EQ(false, formDataMgr_.formRecords_.find(formId)->second->needRefresh);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetFormCacheInited_002 end";
 }
@@ -1906,10 +1916,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetVersionUpgrade_002, TestSize.
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     formDataMgr_.SetVersionUpgrade(formId, versionUpgrade);
-    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second.versionUpgrade);
+    EXPECT_EQ(true, formDataMgr_.formRecords_.find(formId)->second->versionUpgrade);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetVersionUpgrade_002 end";
 }
@@ -2015,7 +2025,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_002, TestSize
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
     // versionUpgrade : false
     formDataMgr_.SetVersionUpgrade(formId, false);
 
@@ -2056,7 +2066,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_003, TestSize
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
     // versionUpgrade : true
     formDataMgr_.SetVersionUpgrade(formId, true);
 
@@ -2097,7 +2107,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_004, TestSize
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.UpdateHostFormFlag(formIds, token_, flag, false, refreshForms));
 
@@ -2135,7 +2145,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_005, TestSize
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.UpdateHostFormFlag(formIds, token_, flag, false, refreshForms));
 
@@ -2172,7 +2182,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_006, TestSize
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.UpdateHostFormFlag(formIds, token_, flag, false, refreshForms));
 
@@ -2211,7 +2221,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_007, TestSize
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     // needRefresh:true
     record.needRefresh = true;
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.UpdateHostFormFlag(formIds, token_, flag, false, refreshForms));
 
@@ -2249,7 +2259,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_008, TestSize
     FormItemInfo formItemInfo;
     InitFormItemInfo(otherFormId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.UpdateHostFormFlag(formIds, token_, flag, false, refreshForms));
 
@@ -2267,14 +2277,14 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetTempFormRecord_001, TestSize.
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetTempFormRecord_001 start";
     // Clean all formRecords
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     // create formRecord
     int64_t otherFormId = 800;
     int callingUid = 0;
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
 
     std::vector<FormRecord> formInfos;
     EXPECT_EQ(false, formDataMgr_.GetTempFormRecord(formInfos));
@@ -2293,14 +2303,14 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetTempFormRecord_002, TestSize.
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetTempFormRecord_002 start";
     // Clean all formRecords
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     // create formRecord
     int64_t otherFormId = 800;
     int callingUid = 0;
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(true);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
 
     std::vector<FormRecord> formInfos;
     EXPECT_EQ(true, formDataMgr_.GetTempFormRecord(formInfos));
@@ -2320,7 +2330,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfos_001, TestSiz
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetRunningFormInfos_001 start";
     // Clean all formRecords
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     // create formRecord
     int64_t otherFormId = 800;
     int callingUid = 20000;
@@ -2329,7 +2339,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfos_001, TestSiz
     std::string bundleName = "A";
     formItemInfo.SetHostBundleName(bundleName);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
 
     // create clientRecords_
     FormHostRecord formHostRecord;
@@ -2364,7 +2374,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfos_002, TestSiz
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetRunningFormInfos_002 start";
     // Clean all formRecords
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     // create formRecord
     int64_t otherFormId = 800;
     int callingUid = 20000;
@@ -2373,7 +2383,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfos_002, TestSiz
     std::string bundleName = "A";
     formItemInfo.SetHostBundleName(bundleName);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
 
     std::vector<RunningFormInfo> runningFormInfos;
     bool isUnusedInclude = false;
@@ -2395,7 +2405,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfosByBundleName_
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetRunningFormInfosByBundleName_001 start";
     // Clean all formRecords
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     // create formRecord
     int64_t otherFormId = 800;
     int callingUid = 20000;
@@ -2404,7 +2414,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfosByBundleName_
     std::string bundleName = "A";
     formItemInfo.SetHostBundleName(bundleName);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord formHostRecord;
     formHostRecord.SetFormHostClient(token_);
     formHostRecord.SetHostBundleName(bundleName);
@@ -2432,7 +2442,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfosByBundleName_
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetRunningFormInfosByBundleName_002 start";
     // Clean all formRecords
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     // create formRecord
     int64_t otherFormId = 800;
     int callingUid = 20000;
@@ -2442,7 +2452,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfosByBundleName_
     std::string bundleName = "A";
     formItemInfo.SetHostBundleName(bundleName);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
 
     std::vector<RunningFormInfo> runningFormInfos;
     bool isUnusedInclude = false;
@@ -2465,7 +2475,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfosByBundleName_
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetRunningFormInfosByBundleName_003 start";
     // Clean all formRecords
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     // create formRecord
     int64_t otherFormId = 800;
     int callingUid = 20000;
@@ -2475,7 +2485,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfosByBundleName_
     std::string bundleName = "";
     formItemInfo.SetHostBundleName(bundleName);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
 
     std::vector<RunningFormInfo> runningFormInfos;
     bool isUnusedInclude = false;
@@ -2498,7 +2508,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfosByBundleName_
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetRunningFormInfosByBundleName_004 start";
     // Clean all formRecords
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     // create formRecord
     int64_t otherFormId = 800;
     int callingUid = 20000;
@@ -2509,7 +2519,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRunningFormInfosByBundleName_
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     GTEST_LOG_(INFO) << "providerUserId = " << record.providerUserId;
     GTEST_LOG_(INFO) << "formTempFlag = " << record.formTempFlag;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord formHostRecord;
     formHostRecord.SetFormHostClient(token_);
     formHostRecord.SetHostBundleName(bundleName);
@@ -2601,7 +2611,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetUnusedFormInstancesByFilter_0
     formDbInfo.formId = FORM_ID_ONE;
     formDbInfo.formUserUids.emplace_back(0);
     formDbInfo.bundleName = FORM_HOST_BUNDLE_NAME;
-    FormDbCache::GetInstance().formDBInfos_.emplace_back(formDbInfo);
+    FormDbCache::GetInstance().InsertFormDBInfoNolock(formDbInfo);
     MockGetBundleNameByUid(ERR_APPEXECFWK_FORM_GET_INFO_FAILED);
     MockGetAllFormInfo(0);
     FormInstancesFilter formInstancesFilter;
@@ -2639,7 +2649,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_0200, T
     FormRecord formRecord;
     formRecord.bundleName = FORM_HOST_BUNDLE_NAME;
     formRecord.formId = FORM_ID_ONE;
-    formDataMgr_.formRecords_.emplace(1, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(1, formRecord);
     FormHostRecord formHostRecord;
     formHostRecord.AddForm(1);
     formDataMgr_.clientRecords_.push_back(formHostRecord);
@@ -2664,8 +2674,8 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_0300, T
     FormRecord formRecord;
     formRecord.bundleName = FORM_BUNDLE_NAME;
     formRecord.moduleName = PARAM_PROVIDER_MODULE_NAME;
-    formDataMgr_.formRecords_.clear();
-    formDataMgr_.formRecords_.emplace(FORM_ID_ONE, formRecord);
+    formDataMgr_.ClearFormRecordsNolock();
+    formDataMgr_.EmplaceFormRecordNolock(FORM_ID_ONE, formRecord);
     FormInstancesFilter formInstancesFilter;
     formInstancesFilter.bundleName = FORM_HOST_BUNDLE_NAME;
     formInstancesFilter.isUnusedIncluded = false;
@@ -2703,7 +2713,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstanceById_0200, TestSi
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstanceById_0200 start";
     int64_t formId = FORM_ID_ONE;
     FormRecord formRecord;
-    formDataMgr_.formRecords_.emplace(formId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formId, formRecord);
     FormHostRecord formHostRecord;
     formHostRecord.AddForm(formId);
     formDataMgr_.clientRecords_.push_back(formHostRecord);
@@ -2723,7 +2733,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstanceById_0200, TestSi
 HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstanceById_0300, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstanceById_0300 start";
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     int64_t formId = FORM_ID_ONE;
     bool isUnusedInclude = false;
     FormInstance formInstance;
@@ -2744,7 +2754,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstanceById_0400, TestSi
     EXPECT_EQ(FormDbCache::GetInstance().formDBInfos_.size(), 0);
     FormDBInfo formDbInfo;
     formDbInfo.formId = FORM_ID_ONE;
-    FormDbCache::GetInstance().formDBInfos_.emplace_back(formDbInfo);
+    FormDbCache::GetInstance().InsertFormDBInfoNolock(formDbInfo);
     int64_t formId = FORM_ID_ONE;
     bool isUnusedInclude = true;
     FormInstance formInstance;
@@ -2764,7 +2774,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetUnusedFormInfos_0100, TestSiz
     FormDBInfo formDbInfo;
     formDbInfo.formId = 1;
     formDbInfo.formUserUids.emplace_back(FORM_USER_UIDS_ZERO);
-    FormDbCache::GetInstance().formDBInfos_.emplace_back(formDbInfo);
+    FormDbCache::GetInstance().InsertFormDBInfoNolock(formDbInfo);
     MockGetBundleNameByUid(ERR_APPEXECFWK_FORM_GET_INFO_FAILED);
     MockGetAllFormInfo(0);
     std::vector<RunningFormInfo> runningFormInfos;
@@ -2783,7 +2793,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetUnusedFormInfos_0100, TestSiz
 HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_001, TestSize.Level0)
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_001 start";
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormInstancesFilter instancesFilter;
     std::vector<FormInstance> formInstances;
     auto ret = formDataMgr_.GetFormInstancesByFilter(instancesFilter, formInstances);
@@ -2802,7 +2812,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_002, Te
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_002 start";
     // create formRecord
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormInstancesFilter instancesFilter;
     instancesFilter.bundleName = "com.example.text";
     std::vector<FormInstance> formInstances;
@@ -2822,7 +2832,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_003, Te
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_003 start";
     // create formRecord
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     FormInstancesFilter instancesFilter;
@@ -2832,7 +2842,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_003, Te
     int callingUid = 100;
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
     formDataMgr_.clientRecords_.emplace_back(hostRecord);
@@ -2854,7 +2864,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_004, Te
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_004 start";
     // create formRecord
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.demo";
@@ -2863,7 +2873,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_004, Te
     int callingUid = 100;
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
     formDataMgr_.clientRecords_.emplace_back(hostRecord);
@@ -2887,7 +2897,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_005, Te
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_005 start";
     // create formRecord
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.text";
@@ -2899,7 +2909,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_005, Te
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
     record.formId = otherFormId;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
     hostRecord.AddForm(otherFormId);
@@ -2925,7 +2935,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_006, Te
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_006 start";
     // create formRecord
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.text";
@@ -2939,7 +2949,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_006, Te
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
     record.formId = otherFormId;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
     hostRecord.AddForm(otherFormId);
@@ -2966,7 +2976,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_007, Te
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_007 start";
     // create formRecord
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.text";
@@ -2982,7 +2992,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_007, Te
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
     record.formId = otherFormId;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
     hostRecord.AddForm(otherFormId);
@@ -3010,7 +3020,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_008, Te
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_008 start";
     // create formRecord
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.text";
@@ -3026,7 +3036,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_008, Te
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
     record.formId = otherFormId;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
     hostRecord.AddForm(otherFormId);
@@ -3054,7 +3064,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_009, Te
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_009 start";
     // create formRecord
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.text";
@@ -3070,7 +3080,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_009, Te
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
     record.formId = otherFormId;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
     hostRecord.AddForm(otherFormId);
@@ -3098,7 +3108,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_0010, T
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstancesByFilter_0010 start";
     // create formRecord
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.text";
@@ -3114,7 +3124,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesByFilter_0010, T
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
     record.formId = otherFormId;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
     hostRecord.AddForm(otherFormId);
@@ -3159,7 +3169,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesById_001, TestSi
 HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstanceById_002, TestSize.Level0)
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstanceById_002 start";
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.text";
@@ -3174,7 +3184,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstanceById_002, TestSiz
     int callingUid = 100;
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
     hostRecord.AddForm(otherFormId);
@@ -3198,7 +3208,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstanceById_002, TestSiz
 HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesById_003, TestSize.Level0)
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstanceById_003 start";
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.text";
@@ -3213,7 +3223,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesById_003, TestSi
     int callingUid = 100;
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
     FormHostRecord hostRecord;
     hostRecord.AddForm(otherFormId);
     formDataMgr_.CreateHostRecord(formItemInfo, token_, 1000, hostRecord);
@@ -3237,7 +3247,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstancesById_003, TestSi
 HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstanceById_004, TestSize.Level0)
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormInstanceById_004 start";
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     FormItemInfo formItemInfo;
     formItemInfo.SetTemporaryFlag(false);
     std::string bundleName = "com.example.text";
@@ -3252,7 +3262,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormInstanceById_004, TestSiz
     int callingUid = 100;
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     int64_t otherFormId = 800;
-    formDataMgr_.formRecords_.emplace(otherFormId, record);
+    formDataMgr_.EmplaceFormRecordNolock(otherFormId, record);
 
     FormInstancesFilter instancesFilter;
     int64_t formId = 800;
@@ -3407,7 +3417,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateFormLocation_001, TestSize
     record.formLocation = Constants::FormLocation::FORM_CENTER;
     int64_t formId = 1;
     int32_t formLocation = 1;
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
     EXPECT_EQ(ERR_OK, formDataMgr_.UpdateFormLocation(formId, formLocation));
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_UpdateFormLocation_001 end";
 }
@@ -3425,31 +3435,31 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetRecordsByFormType_001, TestSi
     int64_t formId = 1;
     record1.formBundleType = BundleType::APP;
     record1.formVisibleNotifyState = static_cast<int32_t>(FormVisibilityType::VISIBLE);
-    formDataMgr_.formRecords_.emplace(formId, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record1);
 
     FormRecord record2;
     formId = 2;
     record2.formBundleType = BundleType::ATOMIC_SERVICE;
     record2.formVisibleNotifyState = static_cast<int32_t>(FormVisibilityType::VISIBLE);
-    formDataMgr_.formRecords_.emplace(formId, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record2);
 
     FormRecord record3;
     formId = 3;
     record3.formBundleType = BundleType::ATOMIC_SERVICE;
     record3.formVisibleNotifyState = static_cast<int32_t>(FormVisibilityType::UNKNOWN);
-    formDataMgr_.formRecords_.emplace(formId, record3);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record3);
 
     FormRecord record4;
     formId = 4;
     record4.formBundleType = BundleType::APP;
     record4.formVisibleNotifyState = static_cast<int32_t>(FormVisibilityType::INVISIBLE);
-    formDataMgr_.formRecords_.emplace(formId, record4);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record4);
 
     FormRecord record5;
     formId = 5;
     record5.formBundleType = BundleType::ATOMIC_SERVICE;
     record5.formVisibleNotifyState = static_cast<int32_t>(FormVisibilityType::INVISIBLE);
-    formDataMgr_.formRecords_.emplace(formId, record5);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record5);
 
     int32_t formRefreshType = Constants::REFRESH_ALL_FORM;
     std::vector<FormRecord> visibleFormRecords1;
@@ -3503,7 +3513,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormIdsByUserId_001, TestSize
     int formUserUid = 100;
     record.userId = formUserUid;
 
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
     std::vector<int64_t> formIds;
     formDataMgr_.GetFormIdsByUserId(formUserUid, formIds);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormIdsByUserId_001 end";
@@ -3751,7 +3761,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetTimerRefresh_001, TestSize.Le
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetTimerRefresh_001 start";
     int64_t formId = FORM_ID_ONE;
-    formDataMgr_.formRecords_.erase(formId);
+    formDataMgr_.EraseFormRecordNolock(formId);
     formDataMgr_.SetTimerRefresh(formId, true);
     EXPECT_EQ(formDataMgr_.formRecords_.find(formId) == formDataMgr_.formRecords_.end(), true);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetTimerRefresh_001 end";
@@ -3767,10 +3777,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetTimerRefresh_002, TestSize.Le
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetTimerRefresh_002 start";
     FormRecord formRecord;
     int64_t formId = FORM_ID_ONE;
-    formDataMgr_.formRecords_.emplace(formId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formId, formRecord);
     formDataMgr_.SetTimerRefresh(formId, true);
     auto itFormRecord = formDataMgr_.formRecords_.find(formId);
-    EXPECT_EQ(itFormRecord->second.isTimerRefresh, true);
+    EXPECT_EQ(itFormRecord->second->isTimerRefresh, true);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetTimerRefresh_002 end";
 }
 
@@ -3808,12 +3818,12 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetNoHostTempForms_001, TestSize
     formRecord.formId = FORM_ID_ZERO;
     formRecord.formTempFlag = false;
     int64_t formRecordKey1 = FORM_ID_ZERO;
-    formDataMgr_.formRecords_.emplace(formRecordKey1, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formRecordKey1, formRecord);
     int64_t formRecordKey2 = FORM_ID_ONE;
     FormRecord record;
     record.formId = FORM_ID_ONE;
     record.formTempFlag = true;
-    formDataMgr_.formRecords_.emplace(formRecordKey2, record);
+    formDataMgr_.EmplaceFormRecordNolock(formRecordKey2, record);
     std::map<int64_t, bool> foundFormsMap;
     std::map<FormIdKey, std::set<int64_t>> noHostTempFormsMap;
     int uid = FORM_USER_UIDS_ZERO;
@@ -3838,7 +3848,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetNoHostTempForms_002, TestSize
     record.formUserUids.push_back(FORM_USER_UIDS_ZERO);
     record.abilityName = "testAbility";
     record.bundleName = "testBundle";
-    formDataMgr_.formRecords_.emplace(formRecordKey, record);
+    formDataMgr_.EmplaceFormRecordNolock(formRecordKey, record);
     FormIdKey formIdKey(record.bundleName, record.abilityName);
     std::map<int64_t, bool> foundFormsMap;
     std::map<FormIdKey, std::set<int64_t>> noHostTempFormsMap;
@@ -3859,7 +3869,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetNoHostTempForms_002, TestSize
 HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetNoHostTempForms_003, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetNoHostTempForms_003 start";
-    formDataMgr_.formRecords_.clear();
+    formDataMgr_.ClearFormRecordsNolock();
     int64_t formRecordKey = FORM_ID_ONE;
     FormRecord record;
     record.formId = FORM_ID_ONE;
@@ -3867,7 +3877,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetNoHostTempForms_003, TestSize
     record.formUserUids.push_back(FORM_USER_UIDS_ZERO);
     record.abilityName = "testAbility2";
     record.bundleName = "testBundle2";
-    formDataMgr_.formRecords_.emplace(formRecordKey, record);
+    formDataMgr_.EmplaceFormRecordNolock(formRecordKey, record);
     FormIdKey formIdKey(record.bundleName, record.abilityName);
     std::map<int64_t, bool> foundFormsMap;
     std::map<FormIdKey, std::set<int64_t>> noHostTempFormsMap;
@@ -4249,7 +4259,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetRecordVisible_002, TestSize.L
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetRecordVisible_002 start";
     int64_t matchedFormId = FORM_ID_ZERO;
     FormRecord formRecord;
-    formDataMgr_.formRecords_.emplace(matchedFormId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(matchedFormId, formRecord);
     auto result = formDataMgr_.SetRecordVisible(matchedFormId, true);
     EXPECT_EQ(result, ERR_OK);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetRecordVisible_002 end";
@@ -4268,7 +4278,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_DeleteFormsByUserId_001, TestSiz
     formRecord.formTempFlag = true;
     formRecord.providerUserId = FORM_ID_ONE;
     formRecord.formId = FORM_ID_ONE;
-    formDataMgr_.formRecords_.emplace(usrId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(usrId, formRecord);
     std::vector<int64_t> removedFormIds;
     formDataMgr_.DeleteFormsByUserId(usrId, removedFormIds);
     EXPECT_NE(std::find(removedFormIds.begin(), removedFormIds.end(), formRecord.formId), removedFormIds.end());
@@ -4285,7 +4295,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_ClearFormRecords_001, TestSize.L
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_ClearFormRecords_001 start";
     int64_t formId = FORM_ID_ONE;
     FormRecord formRecord;
-    formDataMgr_.formRecords_.emplace(formId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formId, formRecord);
     formDataMgr_.tempForms_.emplace_back(formId);
     EXPECT_EQ(formDataMgr_.formRecords_.empty(), false);
     EXPECT_EQ(formDataMgr_.tempForms_.empty(), false);
@@ -4354,7 +4364,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetHostRefresh_001, TestSize.Lev
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetHostRefresh_001 start";
     int64_t formId = FORM_ID_ONE;
-    formDataMgr_.formRecords_.erase(formId);
+    formDataMgr_.EraseFormRecordNolock(formId);
     formDataMgr_.SetHostRefresh(formId, true);
     EXPECT_EQ(formDataMgr_.formRecords_.find(formId) == formDataMgr_.formRecords_.end(), true);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetHostRefresh_001 end";
@@ -4371,10 +4381,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetHostRefresh_002, TestSize.Lev
     FormRecord formRecord;
     int64_t formId = FORM_ID_ONE;
     formRecord.formId = formId;
-    formDataMgr_.formRecords_.emplace(formId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formId, formRecord);
     formDataMgr_.SetHostRefresh(formId, true);
     auto itFormRecord = formDataMgr_.formRecords_.find(formId);
-    EXPECT_EQ(itFormRecord->second.isHostRefresh, true);
+    EXPECT_EQ(itFormRecord->second->isHostRefresh, true);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetHostRefresh_002 end";
 }
 
@@ -4387,7 +4397,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_ClearWantCache_001, TestSize.Lev
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_ClearWantCache_001 start";
     int64_t formId = FORM_ID_ONE;
-    formDataMgr_.formRecords_.erase(formId);
+    formDataMgr_.EraseFormRecordNolock(formId);
     formDataMgr_.ClearWantCache(formId);
     EXPECT_EQ(formDataMgr_.formRecords_.find(formId) == formDataMgr_.formRecords_.end(), true);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_ClearWantCache_001 end";
@@ -4406,10 +4416,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_ClearWantCache_002, TestSize.Lev
     int64_t formId = FORM_ID_ONE;
     formRecord.formId = formId;
     formRecord.refreshWantMap[formId] = FormWant(want);
-    formDataMgr_.formRecords_.emplace(formId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formId, formRecord);
     formDataMgr_.ClearWantCache(formId);
     auto itFormRecord = formDataMgr_.formRecords_.find(formId);
-    EXPECT_TRUE(itFormRecord->second.refreshWantMap.empty());
+    EXPECT_TRUE(itFormRecord->second->refreshWantMap.empty());
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_ClearWantCache_002 end";
 }
 
@@ -4436,8 +4446,8 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_001, TestSize.Level0)
     // init record
     FormRecord record1 = formDataMgr_.CreateFormRecord(formItemInfo1, callingUid1, formId1);
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
-    formDataMgr_.formRecords_.emplace(formId1, record1);
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     // init clientRecords
     FormHostRecord formHostRecord1;
@@ -4525,8 +4535,8 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_003, TestSize.Level0)
     record1.conditionUpdate = conditionUpdate1;
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
 
-    formDataMgr_.formRecords_.emplace(formId1, record1);
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     RunningFormInfo runningFormInfo;
     std::vector<RunningFormInfo> runningFormInfos;
@@ -4634,13 +4644,13 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_005, TestSize.Level0)
     InitFormItemInfo(formId1, formItemInfo1, false);
     FormRecord record1 = formDataMgr_.CreateFormRecord(formItemInfo1, callingUid1, formId1);
     record1.providerUserId = providerUserId1;
-    formDataMgr_.formRecords_.emplace(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
 
     FormItemInfo formItemInfo2;
     InitFormItemInfo(formId2, formItemInfo2);
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
     record2.providerUserId = providerUserId2;
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     std::set<int64_t> matchedFormIds = { formId1 };
     std::map<int64_t, bool> foundFormsMap{};
@@ -4648,22 +4658,22 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_005, TestSize.Level0)
 
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid1, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() > 0);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() > 0);
 
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
 
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUid2);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUid2);
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
 
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUid2);
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUidTemp);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUid2);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUidTemp);
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() > 0 && foundFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() > 0 && foundFormsMap.size() == 1);
 
     matchedFormIds = { formId2 };
     formDataMgr_.GetNoHostInvalidTempForms(
@@ -4795,8 +4805,8 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_008, TestSize.Level0)
     FormRecord record1 = formDataMgr_.CreateFormRecord(formItemInfo1, callingUid1, formId1);
     record1.lowMemoryRecycleStatus = LowMemoryRecycleStatus::RECYCLABLE;
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
-    formDataMgr_.formRecords_.emplace(formId1, record1);
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     // init clientRecords
     FormHostRecord formHostRecord1;
@@ -4884,8 +4894,8 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_010, TestSize.Level0)
     record1.conditionUpdate = conditionUpdate1;
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
 
-    formDataMgr_.formRecords_.emplace(formId1, record1);
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     RunningFormInfo runningFormInfo;
     std::vector<RunningFormInfo> runningFormInfos;
@@ -4993,13 +5003,13 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_012, TestSize.Level0)
     InitFormItemInfo(formId1, formItemInfo1, false);
     FormRecord record1 = formDataMgr_.CreateFormRecord(formItemInfo1, callingUid1, formId1);
     record1.providerUserId = providerUserId1;
-    formDataMgr_.formRecords_.emplace(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
 
     FormItemInfo formItemInfo2;
     InitFormItemInfo(formId2, formItemInfo2);
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
     record2.providerUserId = providerUserId2;
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     std::set<int64_t> matchedFormIds = { formId1 };
     std::map<int64_t, bool> foundFormsMap{};
@@ -5007,22 +5017,22 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_012, TestSize.Level0)
 
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid1, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() > 0);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() > 0);
 
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
 
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUid2);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUid2);
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
 
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUid2);
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUidTemp);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUid2);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUidTemp);
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() > 0 && foundFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() > 0 && foundFormsMap.size() == 1);
 
     matchedFormIds = { formId2 };
     formDataMgr_.GetNoHostInvalidTempForms(
@@ -5171,11 +5181,11 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateFormRecordSetIsExistRecycl
     FormRecord formRecord;
     formRecord.formId = formId;
     formRecord.isExistRecycleTask = isExistRecycleTask;
-    formDataMgr->formRecords_.clear();
-    formDataMgr->formRecords_.emplace(formId, formRecord);
+    formDataMgr->ClearFormRecordsNolock();
+    formDataMgr->EmplaceFormRecordNolock(formId, formRecord);
     result = formDataMgr->UpdateFormRecordSetIsExistRecycleTask(formId, isExistRecycleTask);
     EXPECT_TRUE(result);
-    EXPECT_EQ(formDataMgr->formRecords_[formId].isExistRecycleTask, isExistRecycleTask);
+    EXPECT_EQ(formDataMgr->formRecords_[formId]->isExistRecycleTask, isExistRecycleTask);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormAbilityInfo_001 end";
 }
 
@@ -5208,7 +5218,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetExpectRecycledStatus_001, Tes
     std::shared_ptr<FormDataMgr> formDataMgr = std::make_shared<FormDataMgr>();
     FormRecord formRecord;
     formRecord.formId = FORM_ID_ZERO;
-    formDataMgr->formRecords_.emplace(FORM_ID_ZERO, formRecord);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ZERO, formRecord);
     formDataMgr->SetExpectRecycledStatus(FORM_ID_ZERO, true);
     EXPECT_TRUE(formDataMgr->IsExpectRecycled(FORM_ID_ZERO));
 
@@ -5225,10 +5235,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetExpectRecycledStatus_002, Tes
     std::shared_ptr<FormDataMgr> formDataMgr = std::make_shared<FormDataMgr>();
     FormRecord formRecord0;
     formRecord0.formId = FORM_ID_ZERO;
-    formDataMgr->formRecords_.emplace(FORM_ID_ZERO, formRecord0);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ZERO, formRecord0);
     FormRecord formRecord1;
     formRecord1.formId = FORM_ID_ONE;
-    formDataMgr->formRecords_.emplace(FORM_ID_ONE, formRecord1);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ONE, formRecord1);
 
     formDataMgr->SetExpectRecycledStatus({ FORM_ID_ZERO, FORM_ID_ONE }, true);
     EXPECT_TRUE(formDataMgr->IsExpectRecycled(FORM_ID_ZERO));
@@ -5247,7 +5257,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_ClearFormRecords_002, TestSize.L
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_ClearFormRecords_002 start";
     int64_t formId = FORM_ID_ONE;
     FormRecord formRecord;
-    formDataMgr_.formRecords_.emplace(formId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formId, formRecord);
     formDataMgr_.tempForms_.emplace_back(formId);
     EXPECT_EQ(formDataMgr_.formRecords_.empty(), false);
     EXPECT_EQ(formDataMgr_.tempForms_.empty(), false);
@@ -5316,7 +5326,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetHostRefresh_003, TestSize.Lev
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetHostRefresh_003 start";
     int64_t formId = FORM_ID_ONE;
-    formDataMgr_.formRecords_.erase(formId);
+    formDataMgr_.EraseFormRecordNolock(formId);
     formDataMgr_.SetHostRefresh(formId, true);
     EXPECT_EQ(formDataMgr_.formRecords_.find(formId) == formDataMgr_.formRecords_.end(), true);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetHostRefresh_003 end";
@@ -5333,10 +5343,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetHostRefresh_004, TestSize.Lev
     FormRecord formRecord;
     int64_t formId = FORM_ID_ONE;
     formRecord.formId = formId;
-    formDataMgr_.formRecords_.emplace(formId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formId, formRecord);
     formDataMgr_.SetHostRefresh(formId, true);
     auto itFormRecord = formDataMgr_.formRecords_.find(formId);
-    EXPECT_EQ(itFormRecord->second.isHostRefresh, true);
+    EXPECT_EQ(itFormRecord->second->isHostRefresh, true);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetHostRefresh_004 end";
 }
 
@@ -5349,7 +5359,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_ClearWantCache_003, TestSize.Lev
 {
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_ClearWantCache_003 start";
     int64_t formId = FORM_ID_ONE;
-    formDataMgr_.formRecords_.erase(formId);
+    formDataMgr_.EraseFormRecordNolock(formId);
     formDataMgr_.ClearWantCache(formId);
     EXPECT_EQ(formDataMgr_.formRecords_.find(formId) == formDataMgr_.formRecords_.end(), true);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_ClearWantCache_003 end";
@@ -5368,10 +5378,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_ClearWantCache_004, TestSize.Lev
     int64_t formId = FORM_ID_ONE;
     formRecord.formId = formId;
     formRecord.refreshWantMap[formId] = FormWant(want);
-    formDataMgr_.formRecords_.emplace(formId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formId, formRecord);
     formDataMgr_.ClearWantCache(formId);
     auto itFormRecord = formDataMgr_.formRecords_.find(formId);
-    EXPECT_TRUE(itFormRecord->second.refreshWantMap.empty());
+    EXPECT_TRUE(itFormRecord->second->refreshWantMap.empty());
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_ClearWantCache_004 end";
 }
 
@@ -5398,8 +5408,8 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_015, TestSize.Level0)
     // init record
     FormRecord record1 = formDataMgr_.CreateFormRecord(formItemInfo1, callingUid1, formId1);
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
-    formDataMgr_.formRecords_.emplace(formId1, record1);
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     // init clientRecords
     FormHostRecord formHostRecord1;
@@ -5487,8 +5497,8 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_017, TestSize.Level0)
     record1.conditionUpdate = conditionUpdate1;
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
 
-    formDataMgr_.formRecords_.emplace(formId1, record1);
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     RunningFormInfo runningFormInfo;
     std::vector<RunningFormInfo> runningFormInfos;
@@ -5596,13 +5606,13 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_019, TestSize.Level0)
     InitFormItemInfo(formId1, formItemInfo1, false);
     FormRecord record1 = formDataMgr_.CreateFormRecord(formItemInfo1, callingUid1, formId1);
     record1.providerUserId = providerUserId1;
-    formDataMgr_.formRecords_.emplace(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
 
     FormItemInfo formItemInfo2;
     InitFormItemInfo(formId2, formItemInfo2);
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
     record2.providerUserId = providerUserId2;
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     std::set<int64_t> matchedFormIds = { formId1 };
     std::map<int64_t, bool> foundFormsMap{};
@@ -5610,22 +5620,22 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_019, TestSize.Level0)
 
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid1, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() > 0);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() > 0);
 
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
 
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUid2);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUid2);
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
 
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUid2);
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUidTemp);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUid2);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUidTemp);
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() > 0 && foundFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() > 0 && foundFormsMap.size() == 1);
 
     matchedFormIds = { formId2 };
     formDataMgr_.GetNoHostInvalidTempForms(
@@ -5757,8 +5767,8 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_022, TestSize.Level0)
     FormRecord record1 = formDataMgr_.CreateFormRecord(formItemInfo1, callingUid1, formId1);
     record1.lowMemoryRecycleStatus = LowMemoryRecycleStatus::RECYCLABLE;
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
-    formDataMgr_.formRecords_.emplace(formId1, record1);
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     // init clientRecords
     FormHostRecord formHostRecord1;
@@ -5846,8 +5856,8 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_024, TestSize.Level0)
     record1.conditionUpdate = conditionUpdate1;
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
 
-    formDataMgr_.formRecords_.emplace(formId1, record1);
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     RunningFormInfo runningFormInfo;
     std::vector<RunningFormInfo> runningFormInfos;
@@ -5955,13 +5965,13 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_026, TestSize.Level0)
     InitFormItemInfo(formId1, formItemInfo1, false);
     FormRecord record1 = formDataMgr_.CreateFormRecord(formItemInfo1, callingUid1, formId1);
     record1.providerUserId = providerUserId1;
-    formDataMgr_.formRecords_.emplace(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
 
     FormItemInfo formItemInfo2;
     InitFormItemInfo(formId2, formItemInfo2);
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, callingUid2, formId2);
     record2.providerUserId = providerUserId2;
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     std::set<int64_t> matchedFormIds = { formId1 };
     std::map<int64_t, bool> foundFormsMap{};
@@ -5969,22 +5979,22 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_Coverage_026, TestSize.Level0)
 
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid1, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() > 0);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() > 0);
 
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
 
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUid2);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUid2);
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() == 0 && noHostTempFormsMap.size() == 1);
 
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUid2);
-    formDataMgr_.formRecords_[formId2].formUserUids.emplace_back(callingUidTemp);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUid2);
+    formDataMgr_.formRecords_[formId2]->formUserUids.emplace_back(callingUidTemp);
     formDataMgr_.GetNoHostInvalidTempForms(
         providerUserId2, callingUid2, matchedFormIds, noHostTempFormsMap, foundFormsMap);
-    EXPECT_TRUE(formDataMgr_.formRecords_[formId2].formUserUids.size() > 0 && foundFormsMap.size() == 1);
+    EXPECT_TRUE(formDataMgr_.formRecords_[formId2]->formUserUids.size() > 0 && foundFormsMap.size() == 1);
 
     matchedFormIds = { formId2 };
     formDataMgr_.GetNoHostInvalidTempForms(
@@ -6133,11 +6143,11 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateFormRecordSetIsExistRecycl
     FormRecord formRecord;
     formRecord.formId = formId;
     formRecord.isExistRecycleTask = isExistRecycleTask;
-    formDataMgr->formRecords_.clear();
-    formDataMgr->formRecords_.emplace(formId, formRecord);
+    formDataMgr->ClearFormRecordsNolock();
+    formDataMgr->EmplaceFormRecordNolock(formId, formRecord);
     result = formDataMgr->UpdateFormRecordSetIsExistRecycleTask(formId, isExistRecycleTask);
     EXPECT_TRUE(result);
-    EXPECT_EQ(formDataMgr->formRecords_[formId].isExistRecycleTask, isExistRecycleTask);
+    EXPECT_EQ(formDataMgr->formRecords_[formId]->isExistRecycleTask, isExistRecycleTask);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_UpdateFormRecordSetIsExistRecycleTask_002 end";
 }
 
@@ -6170,7 +6180,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetExpectRecycledStatus_003, Tes
     std::shared_ptr<FormDataMgr> formDataMgr = std::make_shared<FormDataMgr>();
     FormRecord formRecord;
     formRecord.formId = FORM_ID_ZERO;
-    formDataMgr->formRecords_.emplace(FORM_ID_ZERO, formRecord);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ZERO, formRecord);
     formDataMgr->SetExpectRecycledStatus(FORM_ID_ZERO, true);
     EXPECT_TRUE(formDataMgr->IsExpectRecycled(FORM_ID_ZERO));
 
@@ -6187,10 +6197,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetExpectRecycledStatus_004, Tes
     std::shared_ptr<FormDataMgr> formDataMgr = std::make_shared<FormDataMgr>();
     FormRecord formRecord0;
     formRecord0.formId = FORM_ID_ZERO;
-    formDataMgr->formRecords_.emplace(FORM_ID_ZERO, formRecord0);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ZERO, formRecord0);
     FormRecord formRecord1;
     formRecord1.formId = FORM_ID_ONE;
-    formDataMgr->formRecords_.emplace(FORM_ID_ONE, formRecord1);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ONE, formRecord1);
 
     formDataMgr->SetExpectRecycledStatus({ FORM_ID_ZERO, FORM_ID_ONE }, true);
     EXPECT_TRUE(formDataMgr->IsExpectRecycled(FORM_ID_ZERO));
@@ -6207,11 +6217,11 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetAddfinishAndSetUpdateFlag_001
     FormRecord formRecord0;
     formRecord0.formId = FORM_ID_ZERO;
     formRecord0.addFormFinish = false;
-    formDataMgr->formRecords_.emplace(FORM_ID_ZERO, formRecord0);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ZERO, formRecord0);
     FormRecord formRecord1;
     formRecord1.formId = FORM_ID_ONE;
     formRecord1.addFormFinish = true;
-    formDataMgr->formRecords_.emplace(FORM_ID_ONE, formRecord1);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ONE, formRecord1);
 
     formDataMgr->SetExpectRecycledStatus({ FORM_ID_ZERO, FORM_ID_ONE }, true);
     EXPECT_FALSE(formDataMgr->GetAddfinishAndSetUpdateFlag(20251230));
@@ -6230,7 +6240,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetIsNeedUpdateOnAddFinish_001,
     formRecord.formId = FORM_ID_ZERO;
     formRecord.addFormFinish = false;
     formRecord.isNeedUpdateFormOnAddFormFinish = true;
-    formDataMgr->formRecords_.emplace(FORM_ID_ZERO, formRecord);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ZERO, formRecord);
     FormRecord formRecord1;
     EXPECT_FALSE(formDataMgr->GetIsNeedUpdateOnAddFinish(20251230, formRecord1));
     EXPECT_TRUE(formDataMgr->GetIsNeedUpdateOnAddFinish(FORM_ID_ZERO, formRecord1));
@@ -6262,7 +6272,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HandleFormAddObserver_002, TestS
     FormHostRecord formHostRecord;
     formHostRecord.AddForm(FORM_ID_ONE);
     formDataMgr->clientRecords_.push_back(formHostRecord);
-    formDataMgr->formRecords_.emplace(FORM_ID_ONE, formRecord);
+    formDataMgr->EmplaceFormRecordNolock(FORM_ID_ONE, formRecord);
     std::string hostBundleName = "testBundleName";
     int32_t userId = 100;
     EXPECT_EQ(ERR_OK, formDataMgr->HandleFormAddObserver(hostBundleName, FORM_ID_ONE, userId));
@@ -6348,17 +6358,17 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetTempFormCountByUserId_002, Te
     FormItemInfo formItemInfo1;
     InitFormItemInfo(formId1, formItemInfo1);
     FormRecord record1 = formDataMgr_.CreateFormRecord(formItemInfo1, 0, userId);
-    formDataMgr_.formRecords_.emplace(formId1, record1);
+    formDataMgr_.EmplaceFormRecordNolock(formId1, record1);
 
     FormItemInfo formItemInfo2;
     InitFormItemInfo(formId2, formItemInfo2);
     FormRecord record2 = formDataMgr_.CreateFormRecord(formItemInfo2, 0, otherUserId);
-    formDataMgr_.formRecords_.emplace(formId2, record2);
+    formDataMgr_.EmplaceFormRecordNolock(formId2, record2);
 
     FormItemInfo formItemInfo3;
     InitFormItemInfo(formId3, formItemInfo3);
     FormRecord record3 = formDataMgr_.CreateFormRecord(formItemInfo3, 0, userId);
-    formDataMgr_.formRecords_.emplace(formId3, record3);
+    formDataMgr_.EmplaceFormRecordNolock(formId3, record3);
 
     EXPECT_EQ(2, formDataMgr_.GetTempFormCountByUserId(userId));
 
@@ -6513,7 +6523,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetUnusedFormInfos_001, TestSize
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetUnusedFormInfos_001 start";
 
     std::vector<RunningFormInfo> runningFormInfos;
-    FormDbCache::GetInstance().formDBInfos_.clear();
+    ClearFormDbCache();
 
     formDataMgr_.GetUnusedFormInfos(runningFormInfos);
     EXPECT_EQ(true, runningFormInfos.empty());
@@ -6556,10 +6566,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetFormLock_002, TestSize.Level0
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.SetFormLock(formId, lock));
-    EXPECT_EQ(true, formDataMgr_.formRecords_[formId].lockForm);
+    EXPECT_EQ(true, formDataMgr_.formRecords_[formId]->lockForm);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetFormLock_002 end";
 }
@@ -6600,7 +6610,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormLock_002, TestSize.Level0
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     record.lockForm = true;
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.GetFormLock(formId, lock));
     EXPECT_EQ(true, lock);
@@ -6643,10 +6653,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetFormProtect_002, TestSize.Lev
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.SetFormProtect(formId, protect));
-    EXPECT_EQ(true, formDataMgr_.formRecords_[formId].protectForm);
+    EXPECT_EQ(true, formDataMgr_.formRecords_[formId]->protectForm);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetFormProtect_002 end";
 }
@@ -6687,7 +6697,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormProtect_002, TestSize.Lev
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
     record.protectForm = true;
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.GetFormProtect(formId, protect));
     EXPECT_EQ(true, protect);
@@ -6730,10 +6740,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetFormEnable_002, TestSize.Leve
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.SetFormEnable(formId, enable));
-    EXPECT_EQ(true, formDataMgr_.formRecords_[formId].enableForm);
+    EXPECT_EQ(true, formDataMgr_.formRecords_[formId]->enableForm);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetFormEnable_002 end";
 }
@@ -6972,10 +6982,10 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_SetSpecification_004, TestSize.L
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, formDataMgr_.SetSpecification(formId, specification));
-    EXPECT_EQ(2, formDataMgr_.formRecords_[formId].specification);
+    EXPECT_EQ(2, formDataMgr_.formRecords_[formId]->specification);
 
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_SetSpecification_004 end";
 }
@@ -7081,7 +7091,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_MergeFormData_002, TestSize.Leve
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
     FormProviderData formProviderData;
     MockGetData(true, "test data");
 
@@ -7574,7 +7584,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HasNetworkConditionForm_001, Tes
     FormItemInfo form_item_info;
     InitFormItemInfo(formId, form_item_info);
     FormRecord record = formDataMgr_.CreateFormRecord(form_item_info, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
     EXPECT_FALSE(formDataMgr_.HasNetworkConditionForm());
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_HasNetworkConditionForm_001 end";
 }
@@ -7593,7 +7603,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HasNetworkConditionForm_002, Tes
     InitFormItemInfo(formId, form_item_info);
     FormRecord record = formDataMgr_.CreateFormRecord(form_item_info, callingUid);
     record.conditionUpdate = { 1 };
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
     EXPECT_TRUE(formDataMgr_.HasNetworkConditionForm());
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_HasNetworkConditionForm_002 end";
 }
@@ -7627,7 +7637,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_AllotFormRecord_010, TestSize.Le
     EXPECT_EQ(formId, recordResult.formId);
     EXPECT_TRUE(recordResult.conditionUpdate.size() > 0);
     EXPECT_TRUE(FormDataMgr::IsNetworkConditionForm(recordResult));
-    formDataMgr_.formRecords_.erase(formId);
+    formDataMgr_.EraseFormRecordNolock(formId);
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_AllotFormRecord_010 end";
 }
 
@@ -7665,7 +7675,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_CleanRemovedFormRecords_003, Tes
     InitFormItemInfo(formId, formItemInfo);
     formItemInfo.SetConditionUpdate({ 1 });
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     std::string bundleName = FORM_HOST_BUNDLE_NAME;
     std::set<int64_t> removedForms;
@@ -7697,7 +7707,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_CleanRemovedTempFormRecords_003,
     formItemInfo.SetConditionUpdate({ 1 });
     int32_t userId = 100;
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid, userId);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
     formDataMgr_.tempForms_.emplace_back(formId);
 
     formDataMgr_.CleanRemovedTempFormRecords(bundleName, userId, removedForms);
@@ -7721,7 +7731,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_DeleteFormsByUserId_002, TestSiz
     formRecord.providerUserId = formId;
     formRecord.formId = formId;
     formRecord.conditionUpdate = { 1 };
-    formDataMgr_.formRecords_.emplace(formId, formRecord);
+    formDataMgr_.EmplaceFormRecordNolock(formId, formRecord);
 
     std::vector<int64_t> removedFormIds;
     formDataMgr_.DeleteFormsByUserId(formId, removedFormIds);
@@ -7746,7 +7756,7 @@ HWTEST_F(FmsFormDataMgrTest, FormDataMgr_UpdateHostWant_Assign_001, TestSize.Lev
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid, userId);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     // Set initial hostWant parameters
     Want initialWant;
@@ -7761,7 +7771,7 @@ HWTEST_F(FmsFormDataMgrTest, FormDataMgr_UpdateHostWant_Assign_001, TestSize.Lev
     // Verify hostWant is replaced with new Want
     auto formRecord = formDataMgr_.formRecords_.find(formId);
     ASSERT_NE(formRecord, formDataMgr_.formRecords_.end());
-    Want resultWant = formRecord->second.hostWant.GetWant();
+    Want resultWant = formRecord->second->hostWant.GetWant();
     EXPECT_EQ(resultWant.GetStringParam("new_key"), "new_value");
     EXPECT_EQ(resultWant.GetStringParam("another_key"), "another_value");
     EXPECT_EQ(resultWant.GetStringParam("initial_key"), ""); // initial parameter should be cleared
@@ -7785,7 +7795,7 @@ HWTEST_F(FmsFormDataMgrTest, FormDataMgr_UpdateHostWant_Merge_001, TestSize.Leve
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid, userId);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     // Set initial hostWant parameters
     Want initialWant;
@@ -7801,7 +7811,7 @@ HWTEST_F(FmsFormDataMgrTest, FormDataMgr_UpdateHostWant_Merge_001, TestSize.Leve
     // Verify hostWant parameters are merged correctly
     auto formRecord = formDataMgr_.formRecords_.find(formId);
     ASSERT_NE(formRecord, formDataMgr_.formRecords_.end());
-    Want resultWant = formRecord->second.hostWant.GetWant();
+    Want resultWant = formRecord->second->hostWant.GetWant();
     EXPECT_EQ(resultWant.GetStringParam("existing_key"), "existing_value"); // Existing parameter preserved
     EXPECT_EQ(resultWant.GetStringParam("new_key"), "new_value"); // New parameter added
     EXPECT_EQ(resultWant.GetStringParam("shared_key"), "merged_shared_value"); // Shared parameter updated
@@ -7855,7 +7865,7 @@ HWTEST_F(FmsFormDataMgrTest, FormDataMgr_UpdateHostWantSize_001, TestSize.Level1
     FormItemInfo formItemInfo;
     InitFormItemInfo(formId, formItemInfo);
     FormRecord record = formDataMgr_.CreateFormRecord(formItemInfo, callingUid, userId);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     float width = 100.5f;
     float height = 200.8f;
@@ -7866,7 +7876,7 @@ HWTEST_F(FmsFormDataMgrTest, FormDataMgr_UpdateHostWantSize_001, TestSize.Level1
     // Verify size parameters are set correctly
     auto formRecord = formDataMgr_.formRecords_.find(formId);
     ASSERT_NE(formRecord, formDataMgr_.formRecords_.end());
-    Want resultWant = formRecord->second.hostWant.GetWant();
+    Want resultWant = formRecord->second->hostWant.GetWant();
     // Verify parameter existence first, then validate value to avoid false pass caused by default value
     EXPECT_TRUE(resultWant.GetParams().HasParam(Constants::PARAM_FORM_WIDTH_KEY));
     EXPECT_TRUE(resultWant.GetParams().HasParam(Constants::PARAM_FORM_HEIGHT_KEY));
@@ -7905,13 +7915,13 @@ HWTEST_F(FmsFormDataMgrTest, FormRecord_HostWant_GetWant_001, TestSize.Level1)
     testWant.SetParam("double_key", 3.14);
 
     record.hostWant = FormWant(testWant);
-    formDataMgr_.formRecords_.emplace(formId, record);
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
 
     // Verify hostWant property access and GetWant method
     auto formRecord = formDataMgr_.formRecords_.find(formId);
     ASSERT_NE(formRecord, formDataMgr_.formRecords_.end());
 
-    Want resultWant = formRecord->second.hostWant.GetWant();
+    Want resultWant = formRecord->second->hostWant.GetWant();
     EXPECT_EQ(resultWant.GetStringParam("string_key"), "string_value");
     EXPECT_EQ(resultWant.GetIntParam("int_key", 0), 42);
     EXPECT_EQ(resultWant.GetBoolParam("bool_key", false), true);
@@ -7920,3 +7930,87 @@ HWTEST_F(FmsFormDataMgrTest, FormRecord_HostWant_GetWant_001, TestSize.Level1)
     GTEST_LOG_(INFO) << "FormRecord_HostWant_GetWant_001 end";
 }
 
+/**
+ * @tc.number: FmsFormDataMgrTest_FormRecordIndex_001
+ * @tc.name: UpdateFormRecord
+ * @tc.desc: Verify that bundle and user scoped queries follow insert, update and delete of form records.
+ */
+HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_FormRecordIndex_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormDataMgrTest_FormRecordIndex_001 start";
+    formDataMgr_.ClearFormRecordsNolock();
+    FormRecord record;
+    record.bundleName = "com.form.provider.one";
+    record.moduleName = "entry";
+    record.userId = 100;
+    record.providerUserId = 100;
+    record.formId = 1;
+    formDataMgr_.EmplaceFormRecordNolock(record.formId, record);
+    record.formId = 2;
+    formDataMgr_.EmplaceFormRecordNolock(record.formId, record);
+
+    std::vector<FormRecord> formRecords;
+    EXPECT_TRUE(formDataMgr_.GetFormRecord("com.form.provider.one", formRecords, 100));
+    EXPECT_EQ(formRecords.size(), 2);
+
+    formDataMgr_.UpdateFormRecord(2, [](FormRecord &formRecord) {
+        formRecord.bundleName = "com.form.provider.two";
+        formRecord.userId = 101;
+    });
+    formRecords.clear();
+    EXPECT_TRUE(formDataMgr_.GetFormRecord("com.form.provider.one", "entry", formRecords));
+    EXPECT_EQ(formRecords.size(), 1);
+    std::vector<int64_t> formIds;
+    formDataMgr_.GetFormIdsByUserId(101, formIds);
+    ASSERT_EQ(formIds.size(), 1);
+    EXPECT_EQ(formIds[0], 2);
+
+    std::vector<int64_t> removedFormIds;
+    formDataMgr_.DeleteFormsByUserId(100, removedFormIds);
+    EXPECT_EQ(removedFormIds.size(), 2);
+    EXPECT_TRUE(formDataMgr_.formRecords_.empty());
+    EXPECT_TRUE(formDataMgr_.bundleFormIds_.empty());
+    EXPECT_TRUE(formDataMgr_.userFormIds_.empty());
+    GTEST_LOG_(INFO) << "FmsFormDataMgrTest_FormRecordIndex_001 end";
+}
+
+/**
+ * @tc.number: FmsFormDataMgrTest_GetFormRecordSnapshot_001
+ * @tc.name: GetFormRecordSnapshot
+ * @tc.desc: Verify that snapshots share the stored record and a write copies it first.
+ */
+HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormRecordSnapshot_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormRecordSnapshot_001 start";
+    formDataMgr_.ClearFormRecordsNolock();
+    int64_t formId = 1;
+    FormRecord record;
+    record.formId = formId;
+    record.needRefresh = false;
+    formDataMgr_.EmplaceFormRecordNolock(formId, record);
+    EXPECT_EQ(formDataMgr_.GetFormRecordSnapshot(2), nullptr);
+
+    std::shared_ptr<const FormRecord> snapshot = formDataMgr_.GetFormRecordSnapshot(formId);
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_EQ(snapshot, formDataMgr_.GetFormRecordSnapshot(formId));
+
+    formDataMgr_.SetNeedRefresh(formId, true);
+    std::shared_ptr<const FormRecord> newSnapshot = formDataMgr_.GetFormRecordSnapshot(formId);
+    ASSERT_NE(newSnapshot, nullptr);
+    EXPECT_NE(snapshot, newSnapshot);
+    EXPECT_FALSE(snapshot->needRefresh);
+    EXPECT_TRUE(newSnapshot->needRefresh);
+
+    // an unchanged value does not copy the shared record
+    formDataMgr_.SetNeedRefresh(formId, true);
+    EXPECT_EQ(newSnapshot, formDataMgr_.GetFormRecordSnapshot(formId));
+
+    // no snapshot shares the record, it is modified in place
+    snapshot = nullptr;
+    const FormRecord *storedRecord = newSnapshot.get();
+    newSnapshot = nullptr;
+    formDataMgr_.SetNeedRefresh(formId, false);
+    EXPECT_EQ(formDataMgr_.formRecords_[formId].get(), storedRecord);
+    EXPECT_FALSE(formDataMgr_.formRecords_[formId]->needRefresh);
+    GTEST_LOG_(INFO) << "FmsFormDataMgrTest_GetFormRecordSnapshot_001 end";
+}
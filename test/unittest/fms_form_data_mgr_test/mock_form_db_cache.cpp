@@ -94,7 +94,9 @@ void FormDbCache::GetAllFormInfo(std::vector<FormDBInfo> &formDBInfos)
             formDBInfos.emplace_back(formDBInfo);
         }
     } else {
-        formDBInfos = formDBInfos_;
+        for (const auto &item : formDBInfos_) {
+            formDBInfos.emplace_back(item.second);
+        }
     }
 }
 
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <future>
 #include <gtest/gtest.h>
 #include <map>
 #include <string>
@@ -24,12 +25,14 @@
 #include "datashare_helper.h"
 #define private public
 #include "data_center/form_data_proxy_record.h"
+#include "data_center/form_data_proxy_subscription_registry.h"
 #include "data_center/form_info/form_item_info.h"
 #undef private
 #include "bms_mgr/form_bms_helper.h"
 #include "form_constants.h"
 #include "data_center/form_data_mgr.h"
 #include "form_mgr_errors.h"
+#include "form_mgr/form_mgr_queue.h"
 #include "data_center/form_record/form_record.h"
 #include "common/util/form_util.h"
 #include "fms_log_wrapper.h"
@@ -49,6 +52,94 @@ const std::string TEST_DATA_URI = "com.form.app.test.uri";
 const std::string TEST_REQUIRED_READ_PERMISSON = "com.form.app.test.READ_PERMISSION";
 const std::string TEST_REQUIRED_WRITE_PERMISSON = "com.form.app.test.WRITE_PERMISSION";
 const std::string TEST_PROXY_SUBSCRIBE_ID = "12345678";
+const std::string TEST_PROVIDER_BUNDLE = "com.form.provider.test";
+constexpr int64_t TEST_FORM_ID_BASE = 1000;
+const std::vector<int32_t> TEST_FORM_COUNTS = {1, 16, 64};
+
+class CountingDataShareClient : public FormDataShareClient {
+public:
+    CountingDataShareClient() : FormDataShareClient(TEST_PROVIDER_BUNDLE, nullptr) {}
+
+    std::vector<DataShare::OperationResult> SubscribeRdbData(const std::vector<std::string> &uris,
+        int64_t subscriberId, const RdbCallback &callback) override
+    {
+        subscribeUriCount_ += uris.size();
+        rdbCallback_ = callback;
+        if (!initialRdbNode_.data_.empty()) {
+            // DataShare sends the current data within the subscribe call
+            callback(initialRdbNode_);
+        }
+        return Succeed(uris);
+    }
+
+    std::vector<DataShare::OperationResult> SubscribePublishedData(const std::vector<std::string> &uris,
+        int64_t subscriberId, const PublishedCallback &callback) override
+    {
+        subscribeUriCount_ += uris.size();
+        publishedCallback_ = callback;
+        if (!initialPublishedNode_.datas_.empty()) {
+            callback(initialPublishedNode_);
+        }
+        return Succeed(uris);
+    }
+
+    std::vector<DataShare::OperationResult> Unsubscribe(bool isRdbType, const std::vector<std::string> &uris,
+        int64_t subscriberId) override
+    {
+        unsubscribeUriCount_ += uris.size();
+        return Succeed(uris);
+    }
+
+    std::vector<DataShare::OperationResult> SetSubsState(bool isRdbType, const std::vector<std::string> &uris,
+        int64_t subscriberId, bool subsState) override
+    {
+        setSubsStateCount_++;
+        return Succeed(uris);
+    }
+
+    static std::vector<DataShare::OperationResult> Succeed(const std::vector<std::string> &uris)
+    {
+        std::vector<DataShare::OperationResult> results;
+        for (const auto &uri : uris) {
+            results.emplace_back(uri, ERR_OK);
+        }
+        return results;
+    }
+
+    size_t subscribeUriCount_ = 0;
+    size_t unsubscribeUriCount_ = 0;
+    int32_t setSubsStateCount_ = 0;
+    RdbCallback rdbCallback_;
+    PublishedCallback publishedCallback_;
+    DataShare::RdbChangeNode initialRdbNode_;
+    DataShare::PublishedDataChangeNode initialPublishedNode_;
+};
+
+std::vector<std::shared_ptr<FormDataProxyRecord>> CreateSharedRecords(int32_t formCount, bool isRdbType,
+    int64_t formIdBase = TEST_FORM_ID_BASE)
+{
+    FormDataProxyRecord::SubscribeMap subscribeMap;
+    subscribeMap[TEST_DATA_URI].emplace(TEST_PROXY_SUBSCRIBE_ID);
+    std::vector<std::shared_ptr<FormDataProxyRecord>> records;
+    for (int32_t i = 0; i < formCount; i++) {
+        auto record = std::make_shared<FormDataProxyRecord>(formIdBase + i, TEST_PROVIDER_BUNDLE,
+            FormType::ETS, 1, 1);
+        if (isRdbType) {
+            record->SubscribeRdbFormData(subscribeMap);
+        } else {
+            record->SubscribePublishFormData(subscribeMap);
+        }
+        records.emplace_back(record);
+    }
+    return records;
+}
+
+void WaitFormMgrQueue()
+{
+    std::promise<void> done;
+    FormMgrQueue::GetInstance().ScheduleTask(0, [&done]() { done.set_value(); });
+    done.get_future().wait();
+}
 
 class FmsFormDataProxyRecordTest : public testing::Test {
 public:
@@ -2055,4 +2146,163 @@ HWTEST_F(FmsFormDataProxyRecordTest, FmsFormDataProxyRecordTest_GetSubscribeForm
 
     GTEST_LOG_(INFO) << "FmsFormDataProxyRecordTest_GetSubscribeFormDataProxies_002 end";
 }
+
+/**
+ * @tc.number: FmsFormDataProxyRecordTest_SharedSubscription_001
+ * @tc.name: SharedSubscription_Published
+ * @tc.desc: Verify that forms observing the same published data share one subscription, a change is
+ *           parsed once and updates every form, and the forms joining later get the last data.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormDataProxyRecordTest, FmsFormDataProxyRecordTest_SharedSubscription_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormDataProxyRecordTest_SharedSubscription_001 start";
+    FormDataProxySubscriptionRegistry &registry = FormDataProxySubscriptionRegistry::GetInstance();
+    MockGetFormRecord(true);
+    for (int32_t formCount : TEST_FORM_COUNTS) {
+        auto client = std::make_shared<CountingDataShareClient>();
+        registry.clientCreator_ = [client](const std::string &bundleName) { return client; };
+        auto records = CreateSharedRecords(formCount, false);
+        EXPECT_EQ(client->subscribeUriCount_, 1);
+        EXPECT_EQ(registry.GetSubscriptionCount(), 1);
+
+        auto mockFacade = std::make_shared<MockFormMgrAdapterFacade>();
+        MockFormMgrAdapterFacade::obj = mockFacade;
+        EXPECT_CALL(*mockFacade, UpdateForm(_, _, _, _))
+            .Times(formCount * 2)
+            .WillRepeatedly([](int64_t, int32_t, const FormProviderData &formProviderData,
+                const std::vector<FormDataProxy> &) {
+                EXPECT_EQ(formProviderData.GetDataString(),
+                    "{\"" + TEST_DATA_URI + R"(":{"name":"test","value":123}})");
+                return ERR_OK;
+            });
+        DataShare::PublishedDataChangeNode changeNode;
+        DataShare::PublishedDataItem item;
+        item.key_ = TEST_DATA_URI;
+        item.value_ = std::string(R"({"name": "test", "value": 123})");
+        changeNode.datas_.emplace_back(std::move(item));
+        int64_t decodeCount = registry.GetDecodeCount();
+        ASSERT_NE(client->publishedCallback_, nullptr);
+        client->publishedCallback_(changeNode);
+        EXPECT_EQ(registry.GetDecodeCount(), decodeCount + 1);
+
+        auto joinedRecords = CreateSharedRecords(formCount, false, TEST_FORM_ID_BASE + formCount);
+        EXPECT_EQ(client->subscribeUriCount_, 1);
+        WaitFormMgrQueue();
+        EXPECT_EQ(registry.GetDecodeCount(), decodeCount + 1);
+        MockFormMgrAdapterFacade::obj = nullptr;
+
+        records.clear();
+        joinedRecords.clear();
+        EXPECT_EQ(registry.GetSubscriptionCount(), 0);
+        EXPECT_EQ(client->unsubscribeUriCount_, 1);
+        registry.clientCreator_ = FormDataShareClient::Create;
+    }
+    GTEST_LOG_(INFO) << "FmsFormDataProxyRecordTest_SharedSubscription_001 end";
+}
+
+/**
+ * @tc.number: FmsFormDataProxyRecordTest_SharedSubscription_002
+ * @tc.name: SharedSubscription_Rdb
+ * @tc.desc: Verify that forms observing the same rdb data share one subscription, which stays enabled
+ *           while any of its forms is, a change is decoded once, and the forms joining later get the last data.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormDataProxyRecordTest, FmsFormDataProxyRecordTest_SharedSubscription_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormDataProxyRecordTest_SharedSubscription_002 start";
+    FormDataProxySubscriptionRegistry &registry = FormDataProxySubscriptionRegistry::GetInstance();
+    for (int32_t formCount : TEST_FORM_COUNTS) {
+        auto client = std::make_shared<CountingDataShareClient>();
+        registry.clientCreator_ = [client](const std::string &bundleName) { return client; };
+        auto records = CreateSharedRecords(formCount, true);
+        EXPECT_EQ(client->subscribeUriCount_, 1);
+        EXPECT_EQ(registry.GetSubscriptionCount(), 1);
+
+        auto mockFacade = std::make_shared<MockFormMgrAdapterFacade>();
+        MockFormMgrAdapterFacade::obj = mockFacade;
+        EXPECT_CALL(*mockFacade, UpdateForm(_, _, _, _))
+            .Times(formCount * 2)
+            .WillRepeatedly([](int64_t, int32_t, const FormProviderData &formProviderData,
+                const std::vector<FormDataProxy> &) {
+                EXPECT_EQ(formProviderData.GetDataString(), R"({"name":"test"})");
+                return ERR_OK;
+            });
+        DataShare::RdbChangeNode changeNode;
+        changeNode.data_.emplace_back(R"({"name": "test"})");
+        int64_t decodeCount = registry.GetDecodeCount();
+        ASSERT_NE(client->rdbCallback_, nullptr);
+        client->rdbCallback_(changeNode);
+        EXPECT_EQ(registry.GetDecodeCount(), decodeCount + 1);
+
+        auto joinedRecords = CreateSharedRecords(formCount, true, TEST_FORM_ID_BASE + formCount);
+        EXPECT_EQ(client->subscribeUriCount_, 1);
+        WaitFormMgrQueue();
+        EXPECT_EQ(registry.GetDecodeCount(), decodeCount + 1);
+        MockFormMgrAdapterFacade::obj = nullptr;
+        joinedRecords.clear();
+
+        FormDataProxyRecord::SubscribeMap subscribeMap;
+        subscribeMap[TEST_DATA_URI].emplace(TEST_PROXY_SUBSCRIBE_ID);
+        for (const auto &record : records) {
+            record->SetRdbSubsState(subscribeMap, false);
+        }
+        EXPECT_EQ(client->setSubsStateCount_, 1);
+        records.front()->SetRdbSubsState(subscribeMap, true);
+        EXPECT_EQ(client->setSubsStateCount_, 2);
+
+        records.clear();
+        EXPECT_EQ(registry.GetSubscriptionCount(), 0);
+        EXPECT_EQ(client->unsubscribeUriCount_, 1);
+        registry.clientCreator_ = FormDataShareClient::Create;
+    }
+    GTEST_LOG_(INFO) << "FmsFormDataProxyRecordTest_SharedSubscription_002 end";
+}
+
+/**
+ * @tc.number: FmsFormDataProxyRecordTest_SharedSubscription_003
+ * @tc.name: SharedSubscription_InitialData
+ * @tc.desc: Verify that the data DataShare sends within the subscribe call reaches the subscribing form.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormDataProxyRecordTest, FmsFormDataProxyRecordTest_SharedSubscription_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormDataProxyRecordTest_SharedSubscription_003 start";
+    FormDataProxySubscriptionRegistry &registry = FormDataProxySubscriptionRegistry::GetInstance();
+    MockGetFormRecord(true);
+    for (bool isRdbType : { true, false }) {
+        auto client = std::make_shared<CountingDataShareClient>();
+        std::string expectedData = R"({"name":"test"})";
+        if (isRdbType) {
+            client->initialRdbNode_.data_.emplace_back(R"({"name": "test"})");
+        } else {
+            DataShare::PublishedDataItem item;
+            item.key_ = TEST_DATA_URI;
+            item.value_ = std::string(R"({"name": "test"})");
+            client->initialPublishedNode_.datas_.emplace_back(std::move(item));
+            expectedData = "{\"" + TEST_DATA_URI + R"(":{"name":"test"}})";
+        }
+        registry.clientCreator_ = [client](const std::string &bundleName) { return client; };
+
+        auto mockFacade = std::make_shared<MockFormMgrAdapterFacade>();
+        MockFormMgrAdapterFacade::obj = mockFacade;
+        EXPECT_CALL(*mockFacade, UpdateForm(_, _, _, _))
+            .Times(1)
+            .WillOnce([expectedData](int64_t, int32_t, const FormProviderData &formProviderData,
+                const std::vector<FormDataProxy> &) {
+                EXPECT_EQ(formProviderData.GetDataString(), expectedData);
+                return ERR_OK;
+            });
+        auto records = CreateSharedRecords(1, isRdbType);
+        EXPECT_EQ(client->subscribeUriCount_, 1);
+        EXPECT_EQ(registry.GetSubscriptionCount(), 1);
+        WaitFormMgrQueue();
+        MockFormMgrAdapterFacade::obj = nullptr;
+
+        records.clear();
+        EXPECT_EQ(registry.GetSubscriptionCount(), 0);
+        registry.clientCreator_ = FormDataShareClient::Create;
+    }
+    GTEST_LOG_(INFO) << "FmsFormDataProxyRecordTest_SharedSubscription_003 end";
+}
 }
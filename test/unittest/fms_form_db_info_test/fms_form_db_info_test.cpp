@@ -487,4 +487,43 @@ HWTEST_F(FmsFormDbInfoTest, FmsFormDbInfoTest_0028, TestSize.Level1)
     EXPECT_EQ(innerInfo.GetFormName(), info.formName);
     GTEST_LOG_(INFO) << "FmsFormDbInfoTest_FmsFormDbInfoTest_0028 end";
 }
+
+/**
+ * @tc.name: FmsFormDbInfoTest_0029
+ * @tc.desc: Fun ToBinary and FromBinary.
+ * @tc.details: Verify that a binary record decodes to the same form data.
+ */
+HWTEST_F(FmsFormDbInfoTest, FmsFormDbInfoTest_0029, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormDbInfoTest_FmsFormDbInfoTest_0029 start";
+    FormDBInfo info = CreateDbInfo();
+    InnerFormInfo innerInfo(info);
+    std::vector<uint8_t> binary = innerInfo.ToBinary();
+    std::string value(binary.begin(), binary.end());
+    EXPECT_LT(value.size(), innerInfo.ToString().size());
+
+    InnerFormInfo decodedInfo;
+    EXPECT_TRUE(decodedInfo.FromBinary(value));
+    EXPECT_TRUE(decodedInfo.GetFormDBInfo().Compare(info));
+    GTEST_LOG_(INFO) << "FmsFormDbInfoTest_FmsFormDbInfoTest_0029 end";
+}
+
+/**
+ * @tc.name: FmsFormDbInfoTest_0030
+ * @tc.desc: Fun FromBinary.
+ * @tc.details: Verify that json text and truncated records are rejected.
+ */
+HWTEST_F(FmsFormDbInfoTest, FmsFormDbInfoTest_0030, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormDbInfoTest_FmsFormDbInfoTest_0030 start";
+    FormDBInfo info = CreateDbInfo();
+    InnerFormInfo innerInfo(info);
+    InnerFormInfo decodedInfo;
+    EXPECT_FALSE(decodedInfo.FromBinary(innerInfo.ToString()));
+
+    std::vector<uint8_t> binary = innerInfo.ToBinary();
+    std::string truncated(binary.begin(), binary.end() - 1);
+    EXPECT_FALSE(decodedInfo.FromBinary(truncated));
+    GTEST_LOG_(INFO) << "FmsFormDbInfoTest_FmsFormDbInfoTest_0030 end";
+}
 }
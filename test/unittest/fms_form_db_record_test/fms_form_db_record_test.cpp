@@ -29,6 +29,16 @@ using namespace OHOS;
 using namespace OHOS::AppExecFwk;
 
 namespace {
+void ClearFormDbCache()
+{
+    FormDbCache &formDbCache = FormDbCache::GetInstance();
+    formDbCache.formDBInfos_.clear();
+    formDbCache.bundleUserIndex_.clear();
+    formDbCache.providerUserIndex_.clear();
+    formDbCache.userIdFormCounts_.clear();
+    formDbCache.hostUidFormCounts_.clear();
+}
+
 class FmsFormDbRecordTest : public testing::Test {
 public:
     void InitFormRecord();
@@ -63,7 +73,7 @@ void FmsFormDbRecordTest::InitFormRecord()
 void FmsFormDbRecordTest::TearDown()
 {
     if (!FormDbCache::GetInstance().formDBInfos_.empty()) {
-        FormDbCache::GetInstance().formDBInfos_.clear();
+        ClearFormDbCache();
     }
     MockGetBundleNameByUid(ERR_OK);
 }
@@ -448,7 +458,7 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_017, TestSize.Level0)
     FormDbCache::GetInstance().DeleteFormDBInfoCache(formId);
 
     auto &formDBInfos = FormDbCache::GetInstance().formDBInfos_;
-    auto iter = find(formDBInfos.begin(), formDBInfos.end(), formDbInfo);
+    auto iter = formDBInfos.find(formId);
     EXPECT_EQ(iter, formDBInfos.end());
     GTEST_LOG_(INFO) << "FmsFormDbRecordTest_017 end";
 }
@@ -462,7 +472,7 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_018, TestSize.Level0)
     GTEST_LOG_(INFO) << "FmsFormDbRecordTest_018 start";
 
     int64_t formId = 100;
-    FormDbCache::GetInstance().formDBInfos_.clear();
+    ClearFormDbCache();
     FormDBInfo formDbInfo(formId, formRecord_);
     FormDBInfo findInfo;
     EXPECT_FALSE(FormDbCache::GetInstance().FindAndSaveFormDBInfoCache(formDbInfo, findInfo));
@@ -479,7 +489,7 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_019, TestSize.Level0)
     GTEST_LOG_(INFO) << "FmsFormDbRecordTest_019 start";
 
     int64_t formId = 100;
-    FormDbCache::GetInstance().formDBInfos_.clear();
+    ClearFormDbCache();
     FormDBInfo formDbInfo(formId, formRecord_);
     formDbInfo.formLocation = Constants::FormLocation::OTHER;
 
@@ -491,8 +501,9 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_019, TestSize.Level0)
     EXPECT_EQ(findInfo.formLocation, formDbInfo.formLocation);
 
     auto &formDBInfos = FormDbCache::GetInstance().formDBInfos_;
-    auto iter = find(formDBInfos.begin(), formDBInfos.end(), formDbInfo);
-    EXPECT_EQ(iter->formLocation, Constants::FormLocation::AI_SUGGESTION);
+    auto iter = formDBInfos.find(formId);
+    ASSERT_NE(iter, formDBInfos.end());
+    EXPECT_EQ(iter->second.formLocation, Constants::FormLocation::AI_SUGGESTION);
     GTEST_LOG_(INFO) << "FmsFormDbRecordTest_019 end";
 }
 
@@ -545,7 +556,7 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_GetFormCountsByUserId_001, Tes
     int32_t userId = 100;
     FormDBInfo formDBInfo;
     formDBInfo.userId = userId;
-    FormDbCache::GetInstance().formDBInfos_.emplace_back(formDBInfo);
+    FormDbCache::GetInstance().InsertFormDBInfoNolock(formDBInfo);
 
     EXPECT_EQ(1, FormDbCache::GetInstance().GetFormCountsByUserId(userId));
     GTEST_LOG_(INFO) << "FmsFormDbRecordTest_GetFormCountsByUserId_001 end";
@@ -565,7 +576,7 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_GetFormCountsByUserId_002, Tes
     int32_t queryUserId = 200;
     FormDBInfo formDBInfo;
     formDBInfo.userId = userId;
-    FormDbCache::GetInstance().formDBInfos_.emplace_back(formDBInfo);
+    FormDbCache::GetInstance().InsertFormDBInfoNolock(formDBInfo);
 
     EXPECT_EQ(0, FormDbCache::GetInstance().GetFormCountsByUserId(queryUserId));
     GTEST_LOG_(INFO) << "FmsFormDbRecordTest_GetFormCountsByUserId_002 end";
@@ -585,7 +596,7 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_GetFormCountsByHostBundleName_
     std::string hostBundleName = "com.test.bundle";
     FormDBInfo formDBInfo;
     formDBInfo.formUserUids.emplace_back(hostUid);
-    FormDbCache::GetInstance().formDBInfos_.emplace_back(formDBInfo);
+    FormDbCache::GetInstance().InsertFormDBInfoNolock(formDBInfo);
     MockGetBundleNameByUid(ERR_OK, hostBundleName);
 
     EXPECT_EQ(1, FormDbCache::GetInstance().GetFormCountsByHostBundleName(hostBundleName));
@@ -606,7 +617,7 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_GetFormCountsByHostBundleName_
     std::string hostBundleName = "com.test.bundle";
     FormDBInfo formDBInfo;
     formDBInfo.formUserUids.emplace_back(hostUid);
-    FormDbCache::GetInstance().formDBInfos_.emplace_back(formDBInfo);
+    FormDbCache::GetInstance().InsertFormDBInfoNolock(formDBInfo);
     MockGetBundleNameByUid(ERR_APPEXECFWK_FORM_GET_INFO_FAILED);
 
     EXPECT_EQ(0, FormDbCache::GetInstance().GetFormCountsByHostBundleName(hostBundleName));
@@ -627,7 +638,7 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_GetFormCountsByHostBundleName_
     std::string hostBundleName = "com.test.bundle";
     FormDBInfo formDBInfo;
     formDBInfo.formUserUids.emplace_back(hostUid);
-    FormDbCache::GetInstance().formDBInfos_.emplace_back(formDBInfo);
+    FormDbCache::GetInstance().InsertFormDBInfoNolock(formDBInfo);
     MockGetBundleNameByUid(ERR_OK, "com.other.bundle");
 
     EXPECT_EQ(0, FormDbCache::GetInstance().GetFormCountsByHostBundleName(hostBundleName));
@@ -653,4 +664,48 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_UpdateDBRecord_001, TestSize.L
 
     GTEST_LOG_(INFO) << "FmsFormDbRecordTest_UpdateDBRecord_001 end";
 }
+
+/**
+ * @tc.number: FmsFormDbRecordTest_FormDBInfoIndex_001
+ * @tc.name: InsertFormDBInfoNolock
+ * @tc.desc: Verify that the bundle and user indexes follow insert, update and erase.
+ */
+HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_FormDBInfoIndex_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormDbRecordTest_FormDBInfoIndex_001 start";
+    FormDbCache &formDbCache = FormDbCache::GetInstance();
+    ClearFormDbCache();
+    FormDBInfo formDBInfo;
+    formDBInfo.formId = 1;
+    formDBInfo.bundleName = "com.form.provider.one";
+    formDBInfo.userId = 100;
+    formDBInfo.providerUserId = 100;
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
+    formDBInfo.formId = 2;
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
+    EXPECT_EQ(2, formDbCache.GetAllFormInfoSize());
+    EXPECT_EQ(2, formDbCache.GetFormCountsByUserId(100));
+
+    formDBInfo.bundleName = "com.form.provider.two";
+    formDBInfo.userId = 101;
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
+    std::vector<FormDBInfo> dbFormInfos;
+    formDbCache.GetFormDBInfoCacheByBundleName("com.form.provider.one", 100, dbFormInfos);
+    EXPECT_EQ(1, dbFormInfos.size());
+    EXPECT_EQ(1, formDbCache.GetFormCountsByUserId(100));
+    EXPECT_EQ(1, formDbCache.GetFormCountsByUserId(101));
+
+    formDbCache.DeleteFormDBInfoCache(1);
+    dbFormInfos.clear();
+    formDbCache.GetFormDBInfoCacheByUserId(100, dbFormInfos);
+    EXPECT_EQ(1, dbFormInfos.size());
+    EXPECT_EQ(0, formDbCache.GetFormCountsByUserId(100));
+    EXPECT_TRUE(formDbCache.bundleUserIndex_.find(std::make_pair("com.form.provider.one", 100)) ==
+        formDbCache.bundleUserIndex_.end());
+
+    // the output is replaced rather than appended to
+    formDbCache.GetAllFormInfo(dbFormInfos);
+    EXPECT_EQ(1, dbFormInfos.size());
+    GTEST_LOG_(INFO) << "FmsFormDbRecordTest_FormDBInfoIndex_001 end";
+}
 }
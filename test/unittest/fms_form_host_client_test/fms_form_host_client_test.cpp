@@ -13,8 +13,12 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <functional>
+#include <future>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <thread>
 #define private public
 #include "form_host_client.h"
 #undef private
@@ -105,6 +109,54 @@ public:
     MOCK_METHOD1(ProcessShareFormResponse, void(int32_t result));
 };
 
+/**
+ * @brief Callback recording the uninstalled forms, and running a hook inside ProcessFormUpdate.
+ */
+class RecordFormCallback : public FormCallbackInterface {
+public:
+    RecordFormCallback() = default;
+    virtual ~RecordFormCallback() = default;
+
+    void ProcessFormUpdate(const FormJsInfo &formJsInfo) override
+    {
+        if (updateHook_) {
+            updateHook_(formJsInfo);
+        }
+    }
+
+    void ProcessFormUninstall(const int64_t formId) override
+    {
+        uninstalledFormIds_.emplace_back(formId);
+    }
+
+    void OnDeathReceived() override
+    {}
+
+    void OnError(const int32_t errorCode, const std::string &errorMsg) override
+    {}
+
+    std::function<void(const FormJsInfo &)> updateHook_;
+    std::vector<int64_t> uninstalledFormIds_;
+};
+
+int32_t GetFormCallbackCount(const sptr<FormHostClient> &formHostClient)
+{
+    size_t count = 0;
+    for (auto &shard : formHostClient->callbackShards_) {
+        std::lock_guard<std::mutex> lock(shard.callbackMutex);
+        count += shard.formCallbackMap.size();
+    }
+    return static_cast<int32_t>(count);
+}
+
+void ClearFormCallbacks(const sptr<FormHostClient> &formHostClient)
+{
+    for (auto &shard : formHostClient->callbackShards_) {
+        std::lock_guard<std::mutex> lock(shard.callbackMutex);
+        shard.formCallbackMap.clear();
+    }
+}
+
 /**
  * @tc.name: AddFormState_0100
  * @tc.desc: add form state
@@ -316,13 +368,13 @@ HWTEST_F(FmsFormHostClientTest, RemoveForm_0100, TestSize.Level1)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     std::shared_ptr<FormCallbackInterface> formCallback = nullptr;
     formHostClient->RemoveForm(formCallback, formId);
-    auto size = static_cast<int32_t>(formHostClient->formCallbackMap_.size());
+    auto size = GetFormCallbackCount(formHostClient);
     EXPECT_EQ(size, 1);
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest RemoveForm_0100 end";
 }
 
@@ -339,13 +391,13 @@ HWTEST_F(FmsFormHostClientTest, RemoveForm_0200, TestSize.Level1)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     formId = -1;
     formHostClient->RemoveForm(callback, formId);
-    auto size = static_cast<int32_t>(formHostClient->formCallbackMap_.size());
+    auto size = GetFormCallbackCount(formHostClient);
     EXPECT_EQ(size, 1);
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest RemoveForm_0200 end";
 }
 
@@ -362,13 +414,13 @@ HWTEST_F(FmsFormHostClientTest, RemoveForm_0300, TestSize.Level1)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     formId = 10;
     formHostClient->RemoveForm(callback, formId);
-    auto size = static_cast<int32_t>(formHostClient->formCallbackMap_.size());
+    auto size = GetFormCallbackCount(formHostClient);
     EXPECT_EQ(size, 1);
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest RemoveForm_0300 end";
 }
 
@@ -385,12 +437,12 @@ HWTEST_F(FmsFormHostClientTest, RemoveForm_0400, TestSize.Level1)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     formHostClient->RemoveForm(callback, formId);
-    auto size = static_cast<int32_t>(formHostClient->formCallbackMap_.size());
+    auto size = GetFormCallbackCount(formHostClient);
     EXPECT_EQ(size, 0);
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest RemoveForm_0400 end";
 }
 
@@ -407,11 +459,11 @@ HWTEST_F(FmsFormHostClientTest, ContainsForm_0100, TestSize.Level1)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     auto result = formHostClient->ContainsForm(formId);
     EXPECT_TRUE(result);
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest ContainsForm_0100 end";
 }
 
@@ -443,14 +495,14 @@ HWTEST_F(FmsFormHostClientTest, UpdateForm_0100, TestSize.Level0)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     EXPECT_CALL(*callback, ProcessFormUpdate(_)).Times(1);
     FormJsInfo formJsInfo;
     formJsInfo.formId = formId;
     formHostClient->UpdateForm(formJsInfo);
     testing::Mock::AllowLeak(callback.get());
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest UpdateForm_0100 end";
 }
 
@@ -467,12 +519,12 @@ HWTEST_F(FmsFormHostClientTest, UpdateForm_0200, TestSize.Level0)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     FormJsInfo formJsInfo;
     formJsInfo.formId = 2;
     formHostClient->UpdateForm(formJsInfo);
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest UpdateForm_0200 end";
 }
 
@@ -489,12 +541,12 @@ HWTEST_F(FmsFormHostClientTest, UpdateForm_0300, TestSize.Level0)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     FormJsInfo formJsInfo;
     formJsInfo.formId = -1;
     formHostClient->UpdateForm(formJsInfo);
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest UpdateForm_0300 end";
 }
 
@@ -511,7 +563,7 @@ HWTEST_F(FmsFormHostClientTest, OnAcquired_0200, TestSize.Level0)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     EXPECT_CALL(*callback, ProcessFormUpdate(_)).Times(1);
     FormJsInfo formJsInfo;
@@ -519,7 +571,7 @@ HWTEST_F(FmsFormHostClientTest, OnAcquired_0200, TestSize.Level0)
     sptr<MockFormToken> token = nullptr;
     formHostClient->OnAcquired(formJsInfo, token);
     testing::Mock::AllowLeak(callback.get());
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest OnAcquired_0200 end";
 }
 
@@ -536,14 +588,14 @@ HWTEST_F(FmsFormHostClientTest, OnUpdate_0100, TestSize.Level0)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     EXPECT_CALL(*callback, ProcessFormUpdate(_)).Times(1);
     FormJsInfo formJsInfo;
     formJsInfo.formId = formId;
     formHostClient->OnUpdate(formJsInfo);
     testing::Mock::AllowLeak(callback.get());
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest OnUpdate_0100 end";
 }
 
@@ -560,7 +612,7 @@ HWTEST_F(FmsFormHostClientTest, OnUninstall_0200, TestSize.Level0)
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
     int64_t formId = 10;
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     EXPECT_CALL(*callback, ProcessFormUninstall(_)).Times(1);
     std::vector<int64_t> formIds;
@@ -569,7 +621,7 @@ HWTEST_F(FmsFormHostClientTest, OnUninstall_0200, TestSize.Level0)
     formIds.emplace_back(formId);
     formHostClient->OnUninstall(formIds);
     testing::Mock::AllowLeak(callback.get());
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     formIds.clear();
     formIds.emplace_back(-1);
     formHostClient->OnUninstall(formIds);
@@ -615,14 +667,14 @@ HWTEST_F(FmsFormHostClientTest, OnRecycleForm_0100, TestSize.Level0)
     auto callback = std::make_shared<FormCallback>();
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
-    formHostClient->formCallbackMap_.emplace(2, callbackSet);
+    formHostClient->GetCallbackShard(2).formCallbackMap.emplace(2, callbackSet);
     
     formId = 1;
     formHostClient->OnRecycleForm(formId);
 
     formId = 2;
     formHostClient->OnRecycleForm(formId);
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
 
     GTEST_LOG_(INFO) << "FmsFormHostClientTest OnRecycleForm_0100 end";
 }
@@ -640,7 +692,7 @@ HWTEST_F(FmsFormHostClientTest, OnEnableForm_0300, TestSize.Level0)
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
     int64_t formId = 10;
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     EXPECT_CALL(*callback, ProcessEnableForm(_)).Times(1);
     std::vector<int64_t> formIds;
@@ -648,7 +700,7 @@ HWTEST_F(FmsFormHostClientTest, OnEnableForm_0300, TestSize.Level0)
     formIds.emplace_back(formId);
     formHostClient->OnEnableForm(formIds, true);
     testing::Mock::AllowLeak(callback.get());
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest OnEnableForm_0300 end";
 }
 
@@ -668,7 +720,7 @@ HWTEST_F(FmsFormHostClientTest, AddForm_0100, TestSize.Level1)
     ASSERT_NE(nullptr, formCallback);
     formHostClient->AddForm(formCallback, formJsInfo);
     EXPECT_EQ(
-        formHostClient->formCallbackMap_.find(formJsInfo.formId) != formHostClient->formCallbackMap_.end(), true);
+        formHostClient->ContainsForm(formJsInfo.formId), true);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest AddForm_0100 end";
 }
 
@@ -686,7 +738,7 @@ HWTEST_F(FmsFormHostClientTest, AddForm_0200, TestSize.Level1)
     formJsInfo.formId = -1;
     formHostClient->AddForm(formCallback, formJsInfo);
     EXPECT_EQ(
-        formHostClient->formCallbackMap_.find(formJsInfo.formId) == formHostClient->formCallbackMap_.end(), true);
+        formHostClient->ContainsForm(formJsInfo.formId), false);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest AddForm_0200 end";
 }
 
@@ -706,7 +758,7 @@ HWTEST_F(FmsFormHostClientTest, OnError_0100, TestSize.Level1)
     formJsInfo.formId = 2;
     std::shared_ptr<FormCallbackInterface> formCallback = std::make_shared<FormCallback>();
     formHostClient->AddForm(formCallback, formJsInfo);
-    formHostClient->etsFormIds_.emplace(3);
+    formHostClient->GetCallbackShard(3).etsFormIds.emplace(3);
     int32_t errorCode = 1;
     std::string errorMsg = "this is errorMsg";
     formHostClient->OnError(errorCode, errorMsg);
@@ -730,7 +782,7 @@ HWTEST_F(FmsFormHostClientTest, OnError_0200, TestSize.Level1)
     formJsInfo.formId = 2;
     std::shared_ptr<FormCallbackInterface> formCallback = std::make_shared<FormCallback>();
     formHostClient->AddForm(nullptr, formJsInfo);
-    formHostClient->etsFormIds_.emplace(3);
+    formHostClient->GetCallbackShard(3).etsFormIds.emplace(3);
     int32_t errorCode = 1;
     std::string errorMsg = "this is errorMsg";
     formHostClient->OnError(errorCode, errorMsg, formIds);
@@ -750,7 +802,7 @@ HWTEST_F(FmsFormHostClientTest, OnDueControlForm_001, TestSize.Level0)
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
     int64_t formId = 10;
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     EXPECT_CALL(*callback, ProcessDueControlForm(_, _)).Times(1);
     std::vector<int64_t> formIds;
@@ -758,7 +810,7 @@ HWTEST_F(FmsFormHostClientTest, OnDueControlForm_001, TestSize.Level0)
     formIds.emplace_back(formId);
     formHostClient->OnDueControlForm(formIds, true, true);
     testing::Mock::AllowLeak(callback.get());
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest OnDueControlForm_001 end";
 }
 
@@ -775,7 +827,7 @@ HWTEST_F(FmsFormHostClientTest, OnCheckForm_001, TestSize.Level0)
     std::set<std::shared_ptr<FormCallbackInterface>> callbackSet;
     callbackSet.emplace(callback);
     int64_t formId = 10;
-    formHostClient->formCallbackMap_.emplace(formId, callbackSet);
+    formHostClient->GetCallbackShard(formId).formCallbackMap.emplace(formId, callbackSet);
 
     EXPECT_CALL(*callback, ProcessCheckForm()).Times(1);
     std::vector<int64_t> formIds;
@@ -783,7 +835,104 @@ HWTEST_F(FmsFormHostClientTest, OnCheckForm_001, TestSize.Level0)
     formIds.emplace_back(formId);
     formHostClient->OnCheckForm(formIds);
     testing::Mock::AllowLeak(callback.get());
-    formHostClient->formCallbackMap_.clear();
+    ClearFormCallbacks(formHostClient);
     GTEST_LOG_(INFO) << "FmsFormHostClientTest OnCheckForm_001 end";
 }
+
+/**
+ * @tc.number: UpdateForm_Shard_0100
+ * @tc.name: UpdateForm
+ * @tc.desc: Verify a callback can remove its form from inside the update, callbacks run out of the lock.
+ */
+HWTEST_F(FmsFormHostClientTest, UpdateForm_Shard_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormHostClientTest UpdateForm_Shard_0100 start";
+    sptr<FormHostClient> formHostClient = FormHostClient::GetInstance();
+    auto callback = std::make_shared<RecordFormCallback>();
+    FormJsInfo formJsInfo;
+    formJsInfo.formId = 11;
+    formHostClient->AddForm(callback, formJsInfo);
+    std::weak_ptr<RecordFormCallback> weakCallback = callback;
+    callback->updateHook_ = [formHostClient, weakCallback](const FormJsInfo &info) {
+        formHostClient->RemoveForm(weakCallback.lock(), info.formId);
+    };
+
+    formHostClient->UpdateForm(formJsInfo);
+    EXPECT_FALSE(formHostClient->ContainsForm(formJsInfo.formId));
+    ClearFormCallbacks(formHostClient);
+    GTEST_LOG_(INFO) << "FmsFormHostClientTest UpdateForm_Shard_0100 end";
+}
+
+/**
+ * @tc.number: UpdateForm_Shard_0200
+ * @tc.name: UpdateForm
+ * @tc.desc: Verify a blocked callback of one form does not block the updates and adds of other forms.
+ */
+HWTEST_F(FmsFormHostClientTest, UpdateForm_Shard_0200, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormHostClientTest UpdateForm_Shard_0200 start";
+    sptr<FormHostClient> formHostClient = FormHostClient::GetInstance();
+    std::promise<void> entered;
+    std::promise<void> release;
+    std::shared_future<void> releaseFuture = release.get_future().share();
+    auto slowCallback = std::make_shared<RecordFormCallback>();
+    slowCallback->updateHook_ = [&entered, releaseFuture](const FormJsInfo &info) {
+        entered.set_value();
+        releaseFuture.wait();
+    };
+    FormJsInfo slowFormJsInfo;
+    slowFormJsInfo.formId = 1;
+    formHostClient->AddForm(slowCallback, slowFormJsInfo);
+
+    std::atomic<int32_t> updateCount = 0;
+    auto callback = std::make_shared<RecordFormCallback>();
+    callback->updateHook_ = [&updateCount](const FormJsInfo &info) {
+        updateCount++;
+    };
+    FormJsInfo formJsInfo;
+    // same shard as the blocked form
+    formJsInfo.formId = 1 + static_cast<int64_t>(FormHostClient::CALLBACK_SHARD_COUNT);
+    formHostClient->AddForm(callback, formJsInfo);
+
+    std::thread slowThread([formHostClient, slowFormJsInfo]() {
+        formHostClient->UpdateForm(slowFormJsInfo);
+    });
+    entered.get_future().wait();
+    formHostClient->UpdateForm(formJsInfo);
+    FormJsInfo newFormJsInfo;
+    newFormJsInfo.formId = 1 + 2 * static_cast<int64_t>(FormHostClient::CALLBACK_SHARD_COUNT);
+    formHostClient->AddForm(callback, newFormJsInfo);
+    formHostClient->UpdateForm(newFormJsInfo);
+    EXPECT_EQ(updateCount.load(), 2);
+    release.set_value();
+    slowThread.join();
+    ClearFormCallbacks(formHostClient);
+    GTEST_LOG_(INFO) << "FmsFormHostClientTest UpdateForm_Shard_0200 end";
+}
+
+/**
+ * @tc.number: OnUninstall_Shard_0100
+ * @tc.name: OnUninstall
+ * @tc.desc: Verify the forms of a batch are notified in the given order across shards.
+ */
+HWTEST_F(FmsFormHostClientTest, OnUninstall_Shard_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormHostClientTest OnUninstall_Shard_0100 start";
+    sptr<FormHostClient> formHostClient = FormHostClient::GetInstance();
+    auto callback = std::make_shared<RecordFormCallback>();
+    const int64_t shardCount = static_cast<int64_t>(FormHostClient::CALLBACK_SHARD_COUNT);
+    std::vector<int64_t> formIds = { 1 + shardCount, 2, 1, 3 + shardCount, 1 + 2 * shardCount };
+    for (int64_t formId : formIds) {
+        FormJsInfo formJsInfo;
+        formJsInfo.formId = formId;
+        formHostClient->AddForm(callback, formJsInfo);
+    }
+    std::vector<int64_t> uninstallFormIds = { -1, 100 };
+    uninstallFormIds.insert(uninstallFormIds.end(), formIds.begin(), formIds.end());
+
+    formHostClient->OnUninstall(uninstallFormIds);
+    EXPECT_EQ(callback->uninstalledFormIds_, formIds);
+    ClearFormCallbacks(formHostClient);
+    GTEST_LOG_(INFO) << "FmsFormHostClientTest OnUninstall_Shard_0100 end";
+}
 }
\ No newline at end of file
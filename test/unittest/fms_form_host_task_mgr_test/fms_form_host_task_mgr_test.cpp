@@ -18,16 +18,47 @@
 #define private public
 #include "form_host/form_host_task_mgr.h"
 #undef private
+#include "mock_form_host_client.h"
 #include "mock_form_provider_client.h"
 #include "form_host_interface.h"
 #include "fms_log_wrapper.h"
+#include "form_mgr_errors.h"
 #include "gmock/gmock.h"
+#include "ipc_types.h"
 
 using namespace testing::ext;
 using namespace OHOS;
 using namespace OHOS::AppExecFwk;
 
 namespace {
+class MockBatchFormHost : public MockFormHostClient {
+public:
+    void OnUpdate(const FormJsInfo &formInfo) override
+    {
+        updateCount_++;
+    }
+
+    int32_t OnBatchUpdate(const std::vector<FormJsInfo> &formInfos) override
+    {
+        batchCallCount_++;
+        if (batchResult_ != ERR_OK) {
+            int32_t result = batchResult_;
+            batchResult_ = nextBatchResult_;
+            return result;
+        }
+        batchCount_++;
+        batchFormCount_ += static_cast<int32_t>(formInfos.size());
+        return ERR_OK;
+    }
+
+    int32_t batchResult_ = ERR_OK;
+    int32_t nextBatchResult_ = ERR_OK;
+    int32_t batchCallCount_ = 0;
+    int32_t updateCount_ = 0;
+    int32_t batchCount_ = 0;
+    int32_t batchFormCount_ = 0;
+};
+
 class FormHostTaskMgrTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -438,4 +469,117 @@ HWTEST_F(FormHostTaskMgrTest, FormHostTaskMgr_0024, TestSize.Level0)
     formTaskMgr.HostDied(remoteHost);
     GTEST_LOG_(INFO) << "FormHostTaskMgr_0024 end";
 }
-}
\ No newline at end of file
+
+/**
+ * @tc.name: FormHostTaskMgr_0025
+ * @tc.desc: test updates of one host are coalesced per form and sent in one batch
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormHostTaskMgrTest, FormHostTaskMgr_0025, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "FormHostTaskMgr_0025 start";
+    FormHostTaskMgr formTaskMgr;
+    sptr<MockBatchFormHost> formHost = new (std::nothrow) MockBatchFormHost();
+    sptr<IRemoteObject> remoteObject = formHost->AsObject();
+    FormRecord record;
+    formTaskMgr.PostUpdateTaskToHost(1, record, remoteObject);
+    formTaskMgr.PostUpdateTaskToHost(2, record, remoteObject);
+    formTaskMgr.PostUpdateTaskToHost(1, record, remoteObject);
+    EXPECT_EQ(formTaskMgr.updateBuffers_[remoteObject.GetRefPtr()].updates.size(), 2);
+
+    formTaskMgr.FlushUpdatesToHost(remoteObject);
+    EXPECT_EQ(formHost->batchCount_, 1);
+    EXPECT_EQ(formHost->batchFormCount_, 2);
+    EXPECT_EQ(formHost->updateCount_, 0);
+    EXPECT_TRUE(formTaskMgr.updateBuffers_.empty());
+
+    formTaskMgr.PostUpdateTaskToHost(1, record, remoteObject);
+    formTaskMgr.PostUpdateTaskToHost(2, record, remoteObject);
+    formTaskMgr.FlushUpdatesToHost(remoteObject);
+    EXPECT_EQ(formHost->batchCount_, 2);
+    GTEST_LOG_(INFO) << "FormHostTaskMgr_0025 end";
+}
+
+/**
+ * @tc.name: FormHostTaskMgr_0026
+ * @tc.desc: test a host without the batch call keeps getting single updates
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormHostTaskMgrTest, FormHostTaskMgr_0026, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "FormHostTaskMgr_0026 start";
+    FormHostTaskMgr formTaskMgr;
+    sptr<MockBatchFormHost> formHost = new (std::nothrow) MockBatchFormHost();
+    formHost->batchResult_ = IPC_STUB_UNKNOW_TRANS_ERR;
+    formHost->nextBatchResult_ = IPC_STUB_UNKNOW_TRANS_ERR;
+    sptr<IRemoteObject> remoteObject = formHost->AsObject();
+    FormRecord record;
+    formTaskMgr.PostUpdateTaskToHost(1, record, remoteObject);
+    formTaskMgr.PostUpdateTaskToHost(2, record, remoteObject);
+    formTaskMgr.FlushUpdatesToHost(remoteObject);
+    EXPECT_EQ(formHost->updateCount_, 2);
+    EXPECT_EQ(formTaskMgr.batchUpdateUnsupported_.count(remoteObject.GetRefPtr()), 1);
+
+    formTaskMgr.PostUpdateTaskToHost(1, record, remoteObject);
+    formTaskMgr.PostUpdateTaskToHost(2, record, remoteObject);
+    formTaskMgr.FlushUpdatesToHost(remoteObject);
+    EXPECT_EQ(formHost->updateCount_, 4);
+    EXPECT_EQ(formHost->batchCallCount_, 1);
+    EXPECT_EQ(formHost->batchCount_, 0);
+
+    formTaskMgr.HostDied(remoteObject);
+    EXPECT_TRUE(formTaskMgr.batchUpdateUnsupported_.empty());
+    GTEST_LOG_(INFO) << "FormHostTaskMgr_0026 end";
+}
+
+/**
+ * @tc.name: FormHostTaskMgr_0027
+ * @tc.desc: test a single buffered update uses OnUpdate and host death drops the buffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormHostTaskMgrTest, FormHostTaskMgr_0027, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "FormHostTaskMgr_0027 start";
+    FormHostTaskMgr formTaskMgr;
+    sptr<MockBatchFormHost> formHost = new (std::nothrow) MockBatchFormHost();
+    sptr<IRemoteObject> remoteObject = formHost->AsObject();
+    FormRecord record;
+    formTaskMgr.PostUpdateTaskToHost(1, record, remoteObject);
+    formTaskMgr.FlushUpdatesToHost(remoteObject);
+    EXPECT_EQ(formHost->updateCount_, 1);
+    EXPECT_EQ(formHost->batchCount_, 0);
+
+    formTaskMgr.PostUpdateTaskToHost(1, record, remoteObject);
+    formTaskMgr.HostDied(remoteObject);
+    EXPECT_TRUE(formTaskMgr.updateBuffers_.empty());
+    GTEST_LOG_(INFO) << "FormHostTaskMgr_0027 end";
+}
+
+/**
+ * @tc.name: FormHostTaskMgr_0028
+ * @tc.desc: test a failed batch falls back to single updates and the next batch tries the batch call again
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormHostTaskMgrTest, FormHostTaskMgr_0028, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "FormHostTaskMgr_0028 start";
+    FormHostTaskMgr formTaskMgr;
+    sptr<MockBatchFormHost> formHost = new (std::nothrow) MockBatchFormHost();
+    formHost->batchResult_ = ERR_APPEXECFWK_FORM_COMMON_CODE;
+    sptr<IRemoteObject> remoteObject = formHost->AsObject();
+    FormRecord record;
+    formTaskMgr.PostUpdateTaskToHost(1, record, remoteObject);
+    formTaskMgr.PostUpdateTaskToHost(2, record, remoteObject);
+    formTaskMgr.FlushUpdatesToHost(remoteObject);
+    EXPECT_EQ(formHost->updateCount_, 2);
+    EXPECT_TRUE(formTaskMgr.batchUpdateUnsupported_.empty());
+
+    formTaskMgr.PostUpdateTaskToHost(1, record, remoteObject);
+    formTaskMgr.PostUpdateTaskToHost(2, record, remoteObject);
+    formTaskMgr.FlushUpdatesToHost(remoteObject);
+    EXPECT_EQ(formHost->batchCallCount_, 2);
+    EXPECT_EQ(formHost->batchCount_, 1);
+    EXPECT_EQ(formHost->updateCount_, 2);
+    GTEST_LOG_(INFO) << "FormHostTaskMgr_0028 end";
+}
+}
@@ -14,8 +14,11 @@
  */
 
 #include <gtest/gtest.h>
+#include <unordered_set>
 
+#define private public
 #include "data_center/form_info/form_info_rdb_storage_mgr.h"
+#undef private
 #include "form_mgr_errors.h"
 
 using namespace testing::ext;
@@ -28,6 +31,8 @@ void MockQueryData(bool mockRet);
 void MockInit(bool mockRet);
 void MockInsertData(bool mockRet);
 void MockDeleteData(bool mockRet);
+void MockWriteBatch(bool mockRet);
+size_t GetMockWriteBatchSize();
 void MockFormRdbDataMgrInit(bool mockRet);
 
 class FmsFormInfoRdbStorageMgrTest : public testing::Test {
@@ -242,5 +247,86 @@ HWTEST_F(FmsFormInfoRdbStorageMgrTest, FmsFormInfoRdbStorageMgrTest_014, TestSiz
     MockInit(true);
     EXPECT_EQ(result, ERR_APPEXECFWK_FORM_COMMON_CODE);
 }
+
+/**
+ * @tc.name: FmsFormInfoRdbStorageMgrTest_015
+ * @tc.desc: Test DeleteStorageFormDatas deletes form data and status data of all forms in one batch
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormInfoRdbStorageMgrTest, FmsFormInfoRdbStorageMgrTest_015, TestSize.Level0)
+{
+    std::vector<std::string> formIds = { "1", "2", "3" };
+    auto result = FormInfoRdbStorageMgr::GetInstance().DeleteStorageFormDatas(formIds);
+    EXPECT_EQ(result, ERR_OK);
+    EXPECT_EQ(GetMockWriteBatchSize(), formIds.size() * 2);
+
+    MockWriteBatch(false);
+    result = FormInfoRdbStorageMgr::GetInstance().DeleteStorageFormDatas(formIds);
+    MockWriteBatch(true);
+    EXPECT_EQ(result, ERR_APPEXECFWK_FORM_COMMON_CODE);
+}
+
+/**
+ * @tc.name: FmsFormInfoRdbStorageMgrTest_016
+ * @tc.desc: Test batch variants of UpdateBundleFormInfos, RemoveBundleFormInfos and UpdateFormVersionCode
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormInfoRdbStorageMgrTest, FmsFormInfoRdbStorageMgrTest_016, TestSize.Level0)
+{
+    FormRdbWriteBatch batch;
+    EXPECT_EQ(FormInfoRdbStorageMgr::GetInstance().UpdateBundleFormInfos("", "formInfo", batch),
+        ERR_APPEXECFWK_FORM_INVALID_PARAM);
+    EXPECT_EQ(FormInfoRdbStorageMgr::GetInstance().RemoveBundleFormInfos("", batch),
+        ERR_APPEXECFWK_FORM_INVALID_PARAM);
+    EXPECT_TRUE(batch.IsEmpty());
+
+    EXPECT_EQ(FormInfoRdbStorageMgr::GetInstance().UpdateBundleFormInfos("bundleA", "formInfo", batch), ERR_OK);
+    EXPECT_EQ(FormInfoRdbStorageMgr::GetInstance().RemoveBundleFormInfos("bundleB", batch), ERR_OK);
+    FormInfoRdbStorageMgr::GetInstance().UpdateFormVersionCode(batch);
+    EXPECT_EQ(batch.Size(), static_cast<size_t>(3));
+
+    EXPECT_EQ(FormInfoRdbStorageMgr::GetInstance().WriteBatch(batch), ERR_OK);
+    EXPECT_EQ(GetMockWriteBatchSize(), static_cast<size_t>(3));
+    MockWriteBatch(false);
+    EXPECT_EQ(FormInfoRdbStorageMgr::GetInstance().WriteBatch(batch), ERR_APPEXECFWK_FORM_COMMON_CODE);
+    MockWriteBatch(true);
+}
+
+/**
+ * @tc.name: FmsFormInfoRdbStorageMgrTest_017
+ * @tc.desc: Test SaveEntries parses entries concurrently, drops duplicated formIds, migrates json entries
+ *           and deletes bad entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormInfoRdbStorageMgrTest, FmsFormInfoRdbStorageMgrTest_017, TestSize.Level0)
+{
+    constexpr int64_t formCount = 1000;
+    std::unordered_map<std::string, std::string> value;
+    for (int64_t formId = 1; formId <= formCount; formId++) {
+        FormDBInfo formDBInfo;
+        formDBInfo.formId = formId;
+        formDBInfo.bundleName = "bundle";
+        std::string formInfo = InnerFormInfo(formDBInfo).ToString();
+        if (formId % 2 == 0) {
+            std::vector<uint8_t> binary = InnerFormInfo(formDBInfo).ToBinary();
+            formInfo.assign(binary.begin(), binary.end());
+        }
+        value.emplace("formId_" + std::to_string(formId), formInfo);
+        value.emplace("formId_dup_" + std::to_string(formId), formInfo);
+    }
+    value.emplace("formId_bad", "{bad json");
+
+    std::vector<InnerFormInfo> innerFormInfos;
+    FormInfoRdbStorageMgr::GetInstance().SaveEntries(value, innerFormInfos);
+    EXPECT_EQ(innerFormInfos.size(), static_cast<size_t>(formCount));
+    // json rows of odd formIds are rewritten in the binary format under the key of their formId, the json
+    // rows read under another key are deleted as well as the bad row.
+    EXPECT_EQ(GetMockWriteBatchSize(), static_cast<size_t>(formCount + formCount / 2 + 1));
+
+    std::unordered_set<int64_t> formIds;
+    for (const auto &innerFormInfo : innerFormInfos) {
+        EXPECT_TRUE(formIds.emplace(innerFormInfo.GetFormId()).second);
+    }
+}
 }
 }
\ No newline at end of file
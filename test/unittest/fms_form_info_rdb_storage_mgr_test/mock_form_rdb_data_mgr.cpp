@@ -23,6 +23,8 @@ bool g_mockQueryDataRet = true;
 bool g_mockInitRet = true;
 bool g_mockInsertDataRet = true;
 bool g_mockDeleteDataRet = true;
+bool g_mockWriteBatchRet = true;
+size_t g_writeBatchSize = 0;
 
 void MockQueryData(bool mockRet)
 {
@@ -44,6 +46,16 @@ void MockDeleteData(bool mockRet)
     g_mockDeleteDataRet = mockRet;
 }
 
+void MockWriteBatch(bool mockRet)
+{
+    g_mockWriteBatchRet = mockRet;
+}
+
+size_t GetMockWriteBatchSize()
+{
+    return g_writeBatchSize;
+}
+
 }
 }
 
@@ -76,6 +88,15 @@ ErrCode FormRdbDataMgr::InsertData(const std::string &tableName, const std::stri
     return ERR_APPEXECFWK_FORM_COMMON_CODE;
 }
 
+ErrCode FormRdbDataMgr::InsertData(const std::string &tableName, const std::string &key,
+    const std::string &value, const std::vector<uint8_t> &binaryValue)
+{
+    if (g_mockInsertDataRet) {
+        return ERR_OK;
+    }
+    return ERR_APPEXECFWK_FORM_COMMON_CODE;
+}
+
 ErrCode FormRdbDataMgr::DeleteData(const std::string &tableName, const std::string &key)
 {
     if (g_mockDeleteDataRet) {
@@ -84,6 +105,15 @@ ErrCode FormRdbDataMgr::DeleteData(const std::string &tableName, const std::stri
     return ERR_APPEXECFWK_FORM_COMMON_CODE;
 }
 
+ErrCode FormRdbDataMgr::WriteBatch(const FormRdbWriteBatch &batch)
+{
+    g_writeBatchSize = batch.Size();
+    if (g_mockWriteBatchRet) {
+        return ERR_OK;
+    }
+    return ERR_APPEXECFWK_FORM_COMMON_CODE;
+}
+
 RdbStoreDataCallBackFormInfoStorage::RdbStoreDataCallBackFormInfoStorage(const std::string &rdbPath)
 {
 }
@@ -474,5 +474,41 @@ HWTEST_F(FmsFormInfoStorageTest, FmsFormInfoStorageTest_024, TestSize.Level1)
     EXPECT_TRUE(formInfoStorage_->FormInfoStorage::IsEquipmentLevelFiltered(formInfo));
     GTEST_LOG_(INFO) << "FmsFormInfoStorageTest_024 end";
 }
+
+/*
+* @tc.name: FmsFormInfoStorageTest_025
+* @tc.desc: Test function FormInfoStoragesToBinary and FormInfoStoragesFromBinary
+* @tc.type: FUNC
+*/
+HWTEST_F(FmsFormInfoStorageTest, FmsFormInfoStorageTest_025, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormInfoStorageTest_025 start";
+    AppExecFwk::FormInfo formInfo;
+    formInfo.bundleName = "bundle";
+    formInfo.moduleName = "entry";
+    formInfo.name = "widget";
+    formInfo.supportDimensions = {1, 2};
+    std::vector<AAFwk::FormInfoStorage> formInfoStorages;
+    formInfoStorages.emplace_back(100, std::vector<AppExecFwk::FormInfo> { formInfo, formInfo });
+    formInfoStorages.emplace_back(101, std::vector<AppExecFwk::FormInfo> { formInfo });
+
+    std::vector<uint8_t> binary = AAFwk::FormInfoStoragesToBinary(formInfoStorages);
+    std::string value(binary.begin(), binary.end());
+    nlohmann::json jsonObject = formInfoStorages;
+    EXPECT_LT(value.size(), jsonObject.dump().size());
+
+    std::vector<AAFwk::FormInfoStorage> decoded;
+    EXPECT_TRUE(AAFwk::FormInfoStoragesFromBinary(value, decoded));
+    ASSERT_EQ(decoded.size(), formInfoStorages.size());
+    EXPECT_EQ(decoded[0].userId, 100);
+    ASSERT_EQ(decoded[0].formInfos.size(), static_cast<size_t>(2));
+    EXPECT_EQ(decoded[0].formInfos[0].name, formInfo.name);
+    EXPECT_EQ(decoded[0].formInfos[0].supportDimensions, formInfo.supportDimensions);
+    EXPECT_EQ(decoded[1].userId, 101);
+
+    std::vector<AAFwk::FormInfoStorage> bad;
+    EXPECT_FALSE(AAFwk::FormInfoStoragesFromBinary(jsonObject.dump(), bad));
+    GTEST_LOG_(INFO) << "FmsFormInfoStorageTest_025 end";
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
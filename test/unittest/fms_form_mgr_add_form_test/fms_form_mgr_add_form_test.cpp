@@ -653,7 +653,7 @@ HWTEST_F(FmsFormMgrAddFormTestExt, AddForm_008, TestSize.Level0)
     GTEST_LOG_(INFO) << "fms_form_mgr_add_form_test_008 start";
     CreateProviderData();
     // clear old data
-    FormDataMgr::GetInstance().formRecords_.clear();
+    FormDataMgr::GetInstance().ClearFormRecordsNolock();
     FormDataMgr::GetInstance().tempForms_.clear();
     std::vector<FormDBInfo> oldFormDBInfos;
     FormDbCache::GetInstance().GetAllFormInfo(oldFormDBInfos);
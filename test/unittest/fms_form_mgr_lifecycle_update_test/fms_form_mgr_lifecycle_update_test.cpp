@@ -195,7 +195,7 @@ HWTEST_F(FmsFormMgrLifecycleUpdateTest, FmsFormMgrLifecycleUpdateTest_LifecycleU
     FormRecord record = FormDataMgr::GetInstance().CreateFormRecord(formItemInfo, callingUid);
     // needRefresh:true
     record.needRefresh = true;
-    FormDataMgr::GetInstance().formRecords_.emplace(formId, record);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, FormMgr::GetInstance().LifecycleUpdate(formIds, token_, true));
 
@@ -236,7 +236,7 @@ HWTEST_F(FmsFormMgrLifecycleUpdateTest, FmsFormMgrLifecycleUpdateTest_LifecycleU
     record.needRefresh = false;
     // versionUpgrade:false
     record.versionUpgrade = false;
-    FormDataMgr::GetInstance().formRecords_.emplace(formId, record);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formId, record);
 
     EXPECT_EQ(ERR_OK, FormMgr::GetInstance().LifecycleUpdate(formIds, token_, true));
 
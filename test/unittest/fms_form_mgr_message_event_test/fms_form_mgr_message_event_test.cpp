@@ -336,7 +336,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_002, TestSize.Level0)
     formDBInfo.formName = "aa";
     FormDBInfo formDBInfos;
     formDBInfos.formName = "aa";
-    formDbCache.formDBInfos_.emplace_back(formDBInfos);
+    formDbCache.InsertFormDBInfoNolock(formDBInfos);
     formDbCache.SaveFormInfoNolock(formDBInfo);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_002 end";
 }
@@ -354,7 +354,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_003, TestSize.Level0)
     formDBInfo.formName = "aa";
     FormDBInfo formDBInfos;
     formDBInfos.formName = "bb";
-    formDbCache.formDBInfos_.emplace_back(formDBInfos);
+    formDbCache.InsertFormDBInfoNolock(formDBInfos);
     formDbCache.SaveFormInfoNolock(formDBInfo);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_003 end";
 }
@@ -370,7 +370,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_004, TestSize.Level0)
     FormDbCache formDbCache;
     FormDBInfo formDBInfos;
     formDBInfos.formId = 1;
-    formDbCache.formDBInfos_.emplace_back(formDBInfos);
+    formDbCache.InsertFormDBInfoNolock(formDBInfos);
     int64_t formIds = 1;
     FormDBInfo record;
     EXPECT_EQ(ERR_OK, formDbCache.GetDBRecord(formIds, record));
@@ -388,7 +388,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_005, TestSize.Level0)
     FormDbCache formDbCache;
     FormDBInfo formDBInfos;
     formDBInfos.formId = 1;
-    formDbCache.formDBInfos_.emplace_back(formDBInfos);
+    formDbCache.InsertFormDBInfoNolock(formDBInfos);
     int64_t formIds = 2;
     FormDBInfo record;
     EXPECT_EQ(ERR_APPEXECFWK_FORM_NOT_EXIST_ID, formDbCache.GetDBRecord(formIds, record));
@@ -409,7 +409,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_006, TestSize.Level0)
     std::map<int64_t, bool> foundFormsMap;
     FormDBInfo formDBInfo;
     formDBInfo.userId = 1;
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     EXPECT_EQ(ERR_OK, formDbCache.GetNoHostDBForms(uid, noHostFormDBList, foundFormsMap));
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_006 end";
 }
@@ -429,11 +429,11 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_007, TestSize.Level0)
     FormDBInfo formDBInfo;
     formDBInfo.userId = 2;
     formDBInfo.formUserUids.emplace_back(uid);
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     FormDBInfo formDBInfos;
     formDBInfos.userId = 1;
     formDBInfos.formUserUids.emplace_back(uid);
-    formDbCache.formDBInfos_.emplace_back(formDBInfos);
+    formDbCache.InsertFormDBInfoNolock(formDBInfos);
     EXPECT_EQ(ERR_OK, formDbCache.GetNoHostDBForms(uid, noHostFormDBList, foundFormsMap));
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_007 end";
 }
@@ -452,7 +452,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_008, TestSize.Level0)
     FormDBInfo formDBInfo;
     formDBInfo.bundleName = "aa";
     formDBInfo.moduleName = "bb";
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     EXPECT_EQ(1, formDbCache.GetMatchCount(bundleName, moduleName));
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_008 end";
 }
@@ -469,7 +469,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_009, TestSize.Level0)
     int32_t userId = 1;
     FormDBInfo formDBInfo;
     formDBInfo.userId = 1;
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     formDbCache.DeleteDBFormsByUserId(userId);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_009 end";
 }
@@ -486,7 +486,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_010, TestSize.Level0)
     int32_t userId = 1;
     FormDBInfo formDBInfo;
     formDBInfo.userId = 2;
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     formDbCache.DeleteDBFormsByUserId(userId);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_010 end";
 }
@@ -507,7 +507,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_011, TestSize.Level0)
     std::map<int64_t, bool> foundFormsMap;
     FormDBInfo formDBInfo;
     formDBInfo.userId = 2;
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     formDbCache.GetNoHostInvalidDBForms(userId, callingUid, matchedFormIds, noHostDBFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_011 end";
 }
@@ -528,7 +528,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_012, TestSize.Level0)
     std::map<int64_t, bool> foundFormsMap;
     FormDBInfo formDBInfo;
     formDBInfo.userId = 1;
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     formDbCache.GetNoHostInvalidDBForms(userId, callingUid, matchedFormIds, noHostDBFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_012 end";
 }
@@ -550,7 +550,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_013, TestSize.Level0)
     FormDBInfo formDBInfo;
     formDBInfo.userId = 1;
     formDBInfo.formUserUids.emplace_back(2);
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     formDbCache.GetNoHostInvalidDBForms(userId, callingUid, matchedFormIds, noHostDBFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_013 end";
 }
@@ -575,7 +575,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_014, TestSize.Level0)
     formDBInfo.formId = 3;
     formDBInfo.userId = 1;
     formDBInfo.formUserUids.emplace_back(2);
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     formDbCache.GetNoHostInvalidDBForms(userId, callingUid, matchedFormIds, noHostDBFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_014 end";
 }
@@ -600,7 +600,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_015, TestSize.Level0)
     formDBInfo.formId = 3;
     formDBInfo.userId = 1;
     formDBInfo.formUserUids.emplace_back(2);
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     formDbCache.GetNoHostInvalidDBForms(userId, callingUid, matchedFormIds, noHostDBFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_015 end";
 }
@@ -627,7 +627,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_016, TestSize.Level0)
     formDBInfo.bundleName = "com.form.start";
     formDBInfo.abilityName = "bbbbbb";
     formDBInfo.formUserUids.emplace_back(2);
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     // set noHostDBFormsMap
     std::map<FormIdKey, std::set<int64_t>> noHostDBFormsMap;
     FormIdKey formIdKey(formDBInfo.bundleName, formDBInfo.abilityName);
@@ -660,7 +660,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_017, TestSize.Level0)
     host.insert(formId);
     noHostDBFormsMap.emplace(formIdKey, host);
     // set formDBInfos_
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     std::map<int64_t, bool> foundFormsMap;
     formDbCache.BatchDeleteNoHostDBForms(callingUid, noHostDBFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_017 end";
@@ -688,7 +688,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_018, TestSize.Level0)
     host.insert(formId);
     noHostDBFormsMap.emplace(formIdKey, host);
     // set formDBInfos_
-    formDbCache.formDBInfos_.emplace_back(formDBInfo);
+    formDbCache.InsertFormDBInfoNolock(formDBInfo);
     std::map<int64_t, bool> foundFormsMap;
     formDbCache.BatchDeleteNoHostDBForms(callingUid, noHostDBFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_018 end";
@@ -720,7 +720,7 @@ HWTEST_F(FmsFormMgrMessageEventTest, FormDbCache_019, TestSize.Level0)
     formDBInfoes.formId = 2;
     formDBInfoes.bundleName = "aaaaaaaa";
     formDBInfoes.abilityName = "sssssss";
-    formDbCache.formDBInfos_.emplace_back(formDBInfoes);
+    formDbCache.InsertFormDBInfoNolock(formDBInfoes);
     std::map<int64_t, bool> foundFormsMap;
     formDbCache.BatchDeleteNoHostDBForms(callingUid, noHostDBFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FmsFormMgrMessageEventTest FormDbCache_019 end";
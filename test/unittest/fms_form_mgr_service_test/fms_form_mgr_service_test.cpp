@@ -1078,10 +1078,10 @@ HWTEST_F(FmsFormMgrServiceTest, FormMgrService_0051, TestSize.Level1)
 HWTEST_F(FmsFormMgrServiceTest, FormMgrService_0052, TestSize.Level1)
 {
     // Add temp formRecords to FormDataMgr
-    FormDataMgr::GetInstance().formRecords_.clear();
+    FormDataMgr::GetInstance().ClearFormRecordsNolock();
     FormRecord formRecord;
     formRecord.formTempFlag = true;
-    FormDataMgr::GetInstance().formRecords_.emplace(0, formRecord);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(0, formRecord);
     // HiDumpTemporaryFormInfos
     FormMgrService formMgrService;
     std::string args;
@@ -916,5 +916,102 @@ HWTEST_F(FmsFormRdbDataMgrTest, FmsFormRdbDataMgrTest_034, TestSize.Level1)
 
     GTEST_LOG_(INFO) << "FmsFormRdbDataMgrTest_034 end";
 }
+
+/**
+ * @tc.name: FmsFormRdbDataMgrTest_035
+ * @tc.desc: Test WriteBatch commits mixed puts and deletes in one transaction.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormRdbDataMgrTest, FmsFormRdbDataMgrTest_035, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormRdbDataMgrTest_035 start";
+
+    FormRdbWriteBatch batch;
+    EXPECT_EQ(FormRdbDataMgr::GetInstance().WriteBatch(batch), ERR_OK);
+
+    batch.Put("no_table", TEST_KEY, TEST_VALUE);
+    EXPECT_EQ(FormRdbDataMgr::GetInstance().WriteBatch(batch), ERR_APPEXECFWK_FORM_COMMON_CODE);
+
+    FormRdbDataMgr::GetInstance().rdbStore_ = nullptr;
+    FormRdbTableConfig formRdbTableConfig;
+    formRdbTableConfig.tableName = TEST_TABLE;
+    formRdbTableConfig.createTableSql = TEST_TABLE_CREATE_SQL;
+    EXPECT_EQ(FormRdbDataMgr::GetInstance().InitFormRdbTable(formRdbTableConfig), ERR_OK);
+    FormRdbDataMgr::GetInstance().rdbStore_ = rdbStoreMock_;
+
+    FormRdbWriteBatch mixedBatch;
+    mixedBatch.Put(TEST_TABLE, TEST_KEY, TEST_VALUE);
+    mixedBatch.Put(TEST_TABLE, TEST_KEY + "1", TEST_VALUE);
+    mixedBatch.Delete(TEST_TABLE, TEST_KEY + "2");
+    EXPECT_EQ(mixedBatch.Size(), static_cast<size_t>(3));
+
+    int64_t batchCount = FormRdbDataMgr::GetInstance().batchCount_.load();
+    EXPECT_CALL(*rdbStoreMock_, BeginTransaction()).Times(1).WillOnce(Return(E_OK));
+    EXPECT_CALL(*rdbStoreMock_, InsertWithConflictResolution(_, _, _, _)).Times(2).WillRepeatedly(Return(E_OK));
+    EXPECT_CALL(*rdbStoreMock_, Delete(_, An<const AbsRdbPredicates &>())).Times(1).WillOnce(Return(E_OK));
+    EXPECT_CALL(*rdbStoreMock_, Commit()).Times(1).WillOnce(Return(E_OK));
+    EXPECT_CALL(*rdbStoreMock_, IsSlaveDiffFromMaster()).Times(1).WillOnce(Return(false));
+    EXPECT_EQ(FormRdbDataMgr::GetInstance().WriteBatch(mixedBatch), ERR_OK);
+    EXPECT_EQ(FormRdbDataMgr::GetInstance().batchCount_.load(), batchCount + 1);
+    EXPECT_GE(FormRdbDataMgr::GetInstance().maxBatchSize_.load(), 3);
+
+    EXPECT_CALL(*rdbStoreMock_, BeginTransaction()).Times(1).WillOnce(Return(E_OK));
+    EXPECT_CALL(*rdbStoreMock_, InsertWithConflictResolution(_, _, _, _)).Times(1).WillOnce(Return(NativeRdb::E_SQLITE_ERROR));
+    EXPECT_CALL(*rdbStoreMock_, RollBack()).Times(1).WillOnce(Return(E_OK));
+    EXPECT_CALL(*rdbStoreMock_, Commit()).Times(0);
+    EXPECT_EQ(FormRdbDataMgr::GetInstance().WriteBatch(mixedBatch), ERR_APPEXECFWK_FORM_COMMON_CODE);
+
+    FormRdbDataMgr::GetInstance().rdbStore_ = nullptr;
+    GTEST_LOG_(INFO) << "FmsFormRdbDataMgrTest_035 end";
+}
+
+/**
+ * @tc.name: FmsFormRdbDataMgrTest_036
+ * @tc.desc: Test every put of WriteBatch counts its data size.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormRdbDataMgrTest, FmsFormRdbDataMgrTest_036, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormRdbDataMgrTest_036 start";
+    FormRdbWriteBatch batch;
+    batch.Put(TEST_TABLE, TEST_KEY, TEST_VALUE);
+    EXPECT_EQ(batch.dataSize_, TEST_KEY.size() + TEST_VALUE.size());
+
+    NativeRdb::ValuesBucket valuesBucket;
+    valuesBucket.PutString("FORM_ID", TEST_KEY);
+    valuesBucket.PutBlob("IMAGES", std::vector<uint8_t>(TEST_VALUE.begin(), TEST_VALUE.end()));
+    valuesBucket.PutInt("STATE", 1);
+    size_t dataSize = batch.dataSize_;
+    batch.Put(TEST_TABLE, valuesBucket);
+    EXPECT_EQ(batch.dataSize_, dataSize + TEST_KEY.size() + TEST_VALUE.size() + sizeof(int64_t));
+    GTEST_LOG_(INFO) << "FmsFormRdbDataMgrTest_036 end";
+}
+
+/**
+ * @tc.name: FmsFormRdbDataMgrTest_037
+ * @tc.desc: Test a binary put keeps the json value for versions that only read VALUE.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FmsFormRdbDataMgrTest, FmsFormRdbDataMgrTest_037, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsFormRdbDataMgrTest_037 start";
+    FormRdbWriteBatch batch;
+    std::vector<uint8_t> binaryValue = { 1, 2, 3 };
+    batch.Put(TEST_TABLE, TEST_KEY, TEST_VALUE, binaryValue);
+    ASSERT_EQ(batch.Size(), static_cast<size_t>(1));
+    EXPECT_EQ(batch.dataSize_, TEST_KEY.size() + TEST_VALUE.size() + binaryValue.size());
+
+    const NativeRdb::ValuesBucket &valuesBucket = batch.operations_[0].valuesBucket;
+    NativeRdb::ValueObject valueObject;
+    ASSERT_TRUE(valuesBucket.GetObject("VALUE", valueObject));
+    std::string value;
+    EXPECT_EQ(valueObject.GetString(value), E_OK);
+    EXPECT_EQ(value, TEST_VALUE);
+    ASSERT_TRUE(valuesBucket.GetObject("BINARY_VALUE", valueObject));
+    std::vector<uint8_t> blob;
+    EXPECT_EQ(valueObject.GetBlob(blob), E_OK);
+    EXPECT_EQ(blob, binaryValue);
+    GTEST_LOG_(INFO) << "FmsFormRdbDataMgrTest_037 end";
+}
 }
 }
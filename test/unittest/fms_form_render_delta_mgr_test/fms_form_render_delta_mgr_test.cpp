@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#define private public
+#include "form_render/form_render_delta_mgr.h"
+#undef private
+#include "fms_log_wrapper.h"
+#include "form_constants.h"
+#include "message_parcel.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int64_t FORM_ID = 100000;
+constexpr int32_t ITEM_COUNT = 64;
+
+nlohmann::json BuildData(int32_t changedItem)
+{
+    nlohmann::json data = nlohmann::json::object();
+    for (int32_t i = 0; i < ITEM_COUNT; i++) {
+        data["item" + std::to_string(i)] = "value of item " + std::to_string(i);
+    }
+    if (changedItem >= 0) {
+        data["item" + std::to_string(changedItem)] = "changed";
+    }
+    return data;
+}
+
+void BuildRenderData(int32_t changedItem, int32_t renderType, FormJsInfo &formJsInfo, Want &want)
+{
+    nlohmann::json data = BuildData(changedItem);
+    formJsInfo.formId = FORM_ID;
+    formJsInfo.formProviderData = FormProviderData(data);
+    formJsInfo.formData = formJsInfo.formProviderData.GetDataString();
+    want.SetParam(Constants::FORM_RENDER_TYPE_KEY, renderType);
+}
+
+class FormRenderDeltaMgrTest : public testing::Test {
+public:
+    void TearDown();
+};
+
+void FormRenderDeltaMgrTest::TearDown()
+{
+    FormRenderDeltaMgr::GetInstance().InvalidateAll();
+}
+
+/**
+ * @tc.name: FormRenderDeltaMgrTest_0001
+ * @tc.desc: test the merge patch turns the source into the target.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderDeltaMgrTest, FormRenderDeltaMgrTest_0001, TestSize.Level0)
+{
+    nlohmann::json source = { {"a", 1}, {"b", { {"c", "x"}, {"d", true} }}, {"e", {1, 2}} };
+    nlohmann::json target = { {"a", 1}, {"b", { {"c", "y"} }}, {"e", {1, 2, 3}}, {"f", "new"} };
+    nlohmann::json patch;
+    EXPECT_TRUE(FormRenderDeltaMgr::CreateMergePatch(source, target, patch));
+    EXPECT_FALSE(patch.contains("a"));
+    nlohmann::json patched = source;
+    patched.merge_patch(patch);
+    EXPECT_EQ(patched, target);
+
+    target["f"] = nullptr;
+    EXPECT_FALSE(FormRenderDeltaMgr::CreateMergePatch(source, target, patch));
+}
+
+/**
+ * @tc.name: FormRenderDeltaMgrTest_0002
+ * @tc.desc: test an update is only sent as a patch once the previous revision is acknowledged.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderDeltaMgrTest, FormRenderDeltaMgrTest_0002, TestSize.Level0)
+{
+    FormRenderDeltaMgr &deltaMgr = FormRenderDeltaMgr::GetInstance();
+    FormJsInfo first;
+    Want firstWant;
+    BuildRenderData(-1, Constants::RENDER_FORM, first, firstWant);
+    std::string fullData = first.formData;
+    deltaMgr.PrepareRenderData(first, firstWant);
+    EXPECT_EQ(first.formData, fullData);
+    EXPECT_EQ(firstWant.GetIntParam(Constants::FORM_DATA_REVISION, 0), 1);
+    EXPECT_FALSE(firstWant.HasParameter(Constants::FORM_DATA_PATCH_BASE_REVISION));
+
+    FormJsInfo unacked;
+    Want unackedWant;
+    BuildRenderData(1, Constants::UPDATE_RENDERING_FORM, unacked, unackedWant);
+    fullData = unacked.formData;
+    deltaMgr.PrepareRenderData(unacked, unackedWant);
+    EXPECT_EQ(unacked.formData, fullData);
+    EXPECT_EQ(unackedWant.GetIntParam(Constants::FORM_DATA_REVISION, 0), 2);
+    FormProviderData formProviderData;
+    EXPECT_FALSE(deltaMgr.OnRenderTaskDone(FORM_ID, unackedWant, formProviderData));
+
+    FormJsInfo patched;
+    Want patchedWant;
+    BuildRenderData(2, Constants::UPDATE_RENDERING_FORM, patched, patchedWant);
+    fullData = patched.formData;
+    deltaMgr.PrepareRenderData(patched, patchedWant);
+    EXPECT_LT(patched.formData.size(), fullData.size());
+    EXPECT_EQ(patchedWant.GetIntParam(Constants::FORM_DATA_PATCH_BASE_REVISION, 0), 2);
+    EXPECT_EQ(patchedWant.GetIntParam(Constants::FORM_DATA_REVISION, 0), 3);
+
+    nlohmann::json data = BuildData(1);
+    data.merge_patch(nlohmann::json::parse(patched.formData));
+    EXPECT_EQ(data, BuildData(2));
+}
+
+/**
+ * @tc.name: FormRenderDeltaMgrTest_0003
+ * @tc.desc: test a patch the render service could not apply is resent as full data.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderDeltaMgrTest, FormRenderDeltaMgrTest_0003, TestSize.Level0)
+{
+    FormRenderDeltaMgr &deltaMgr = FormRenderDeltaMgr::GetInstance();
+    FormJsInfo first;
+    Want firstWant;
+    BuildRenderData(-1, Constants::RENDER_FORM, first, firstWant);
+    deltaMgr.PrepareRenderData(first, firstWant);
+    FormProviderData formProviderData;
+    EXPECT_FALSE(deltaMgr.OnRenderTaskDone(FORM_ID, firstWant, formProviderData));
+
+    FormJsInfo patched;
+    Want patchedWant;
+    BuildRenderData(1, Constants::UPDATE_RENDERING_FORM, patched, patchedWant);
+    deltaMgr.PrepareRenderData(patched, patchedWant);
+    EXPECT_TRUE(patchedWant.HasParameter(Constants::FORM_DATA_PATCH_BASE_REVISION));
+
+    patchedWant.SetParam(Constants::FORM_DATA_PATCH_MISMATCH, true);
+    EXPECT_TRUE(deltaMgr.OnRenderTaskDone(FORM_ID, patchedWant, formProviderData));
+    EXPECT_EQ(formProviderData.GetData(), BuildData(1));
+    EXPECT_TRUE(deltaMgr.states_.empty());
+}
+
+/**
+ * @tc.name: FormRenderDeltaMgrTest_0004
+ * @tc.desc: test an invalidated form and a small form are sent as full data.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderDeltaMgrTest, FormRenderDeltaMgrTest_0004, TestSize.Level0)
+{
+    FormRenderDeltaMgr &deltaMgr = FormRenderDeltaMgr::GetInstance();
+    FormJsInfo first;
+    Want firstWant;
+    BuildRenderData(-1, Constants::RENDER_FORM, first, firstWant);
+    deltaMgr.PrepareRenderData(first, firstWant);
+    FormProviderData formProviderData;
+    EXPECT_FALSE(deltaMgr.OnRenderTaskDone(FORM_ID, firstWant, formProviderData));
+    deltaMgr.Invalidate(FORM_ID);
+
+    FormJsInfo update;
+    Want updateWant;
+    BuildRenderData(1, Constants::UPDATE_RENDERING_FORM, update, updateWant);
+    deltaMgr.PrepareRenderData(update, updateWant);
+    EXPECT_FALSE(updateWant.HasParameter(Constants::FORM_DATA_PATCH_BASE_REVISION));
+
+    FormJsInfo small;
+    small.formId = FORM_ID;
+    nlohmann::json data = { {"a", 1} };
+    small.formProviderData = FormProviderData(data);
+    small.formData = small.formProviderData.GetDataString();
+    Want smallWant;
+    deltaMgr.PrepareRenderData(small, smallWant);
+    EXPECT_FALSE(smallWant.HasParameter(Constants::FORM_DATA_REVISION));
+    EXPECT_TRUE(deltaMgr.states_.empty());
+}
+
+/**
+ * @tc.name: FormRenderDeltaMgrTest_0005
+ * @tc.desc: test the full provider data is not marshalled along with a patch.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderDeltaMgrTest, FormRenderDeltaMgrTest_0005, TestSize.Level0)
+{
+    FormRenderDeltaMgr &deltaMgr = FormRenderDeltaMgr::GetInstance();
+    FormJsInfo first;
+    Want firstWant;
+    BuildRenderData(-1, Constants::RENDER_FORM, first, firstWant);
+    deltaMgr.PrepareRenderData(first, firstWant);
+    FormProviderData formProviderData;
+    EXPECT_FALSE(deltaMgr.OnRenderTaskDone(FORM_ID, firstWant, formProviderData));
+
+    FormJsInfo patched;
+    Want patchedWant;
+    BuildRenderData(1, Constants::UPDATE_RENDERING_FORM, patched, patchedWant);
+    MessageParcel fullParcel;
+    EXPECT_TRUE(fullParcel.WriteParcelable(&patched));
+    deltaMgr.PrepareRenderData(patched, patchedWant);
+    EXPECT_TRUE(patchedWant.HasParameter(Constants::FORM_DATA_PATCH_BASE_REVISION));
+    EXPECT_TRUE(patched.formProviderData.GetData().empty());
+    MessageParcel patchParcel;
+    EXPECT_TRUE(patchParcel.WriteParcelable(&patched));
+    EXPECT_LT(patchParcel.GetDataSize() * 2, fullParcel.GetDataSize());
+
+    patchedWant.SetParam(Constants::FORM_DATA_PATCH_MISMATCH, true);
+    EXPECT_TRUE(deltaMgr.OnRenderTaskDone(FORM_ID, patchedWant, formProviderData));
+    EXPECT_EQ(formProviderData.GetData(), BuildData(1));
+}
+}
@@ -188,9 +188,9 @@ HWTEST_F(FmsFormSetNextRefreshTest, FmsFormSetNextRefreshTest_SetNextRefreshTime
     theItem.userId = userId;
     theItem.settedTime = 1;
     FormTimerMgr::GetInstance().dynamicRefreshTasks_.clear();
-    FormTimerMgr::GetInstance().dynamicRefreshTasks_.emplace_back(theItem);
+    FormTimerMgr::GetInstance().AddDynamicItemNolock(theItem);
     // check dynamicRefreshTasks_
-    EXPECT_EQ(1, FormTimerMgr::GetInstance().dynamicRefreshTasks_.begin()->settedTime);
+    EXPECT_EQ(1, FormTimerMgr::GetInstance().dynamicRefreshTasks_.begin()->second.settedTime);
 
     // Create IntervalTimerTasks_
     FormTimer task(formId, 3 * Constants::MIN_PERIOD, userId);
@@ -200,7 +200,7 @@ HWTEST_F(FmsFormSetNextRefreshTest, FmsFormSetNextRefreshTest_SetNextRefreshTime
 
     EXPECT_EQ(ERR_OK, formSetNextRefresh_->SetNextRefreshTime(formId, nextTime));
     // check dynamicRefreshTasks_
-    EXPECT_EQ(true, FormTimerMgr::GetInstance().dynamicRefreshTasks_.begin()->settedTime != 1);
+    EXPECT_EQ(true, FormTimerMgr::GetInstance().dynamicRefreshTasks_.begin()->second.settedTime != 1);
 
     GTEST_LOG_(INFO) << "FmsFormSetNextRefreshTest_SetNextRefreshTime_005 end";
 }
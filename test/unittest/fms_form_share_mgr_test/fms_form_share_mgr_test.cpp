@@ -338,7 +338,7 @@ HWTEST_F(FmsFormShareMgrTest, FmsFormShareMgrTest_ShareForm_001, TestSize.Level0
     formInfo.formName = PARAM_FORM_NAME;
     formInfo.formId = formJsInfo.formId;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
     EXPECT_EQ(PARAM_FORM_NAME, formInfo1.formName);
@@ -368,7 +368,7 @@ HWTEST_F(FmsFormShareMgrTest, FmsFormShareMgrTest_ShareForm_002, TestSize.Level0
     formInfo.formName = PARAM_FORM_NAME;
     formInfo.formId = formJsInfo.formId;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
     EXPECT_EQ(PARAM_FORM_NAME, formInfo1.formName);
@@ -403,7 +403,7 @@ HWTEST_F(FmsFormShareMgrTest, FmsFormShareMgrTest_ShareForm_003, TestSize.Level0
     formInfo.formName = PARAM_FORM_NAME;
     formInfo.formId = formJsInfo.formId;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
     EXPECT_EQ(PARAM_FORM_NAME, formInfo1.formName);
@@ -434,7 +434,7 @@ HWTEST_F(FmsFormShareMgrTest, FmsFormShareMgrTest_ShareForm_004, TestSize.Level0
     formInfo.formId = formJsInfo.formId;
     formInfo.bundleName = FORM_NULL_BUNDLE_NAME;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
 
@@ -521,7 +521,7 @@ HWTEST_F(FmsFormShareMgrTest, HandleProviderShareData_001, TestSize.Level0)
     formInfo.formName = PARAM_FORM_NAME;
     formInfo.formId = formJsInfo.formId;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
     EXPECT_EQ(PARAM_FORM_NAME, formInfo1.formName);
@@ -559,7 +559,7 @@ HWTEST_F(FmsFormShareMgrTest, HandleProviderShareData_002, TestSize.Level0)
     formInfo.formName = PARAM_FORM_NAME;
     formInfo.formId = formJsInfo.formId;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
     EXPECT_EQ(PARAM_FORM_NAME, formInfo1.formName);
@@ -598,7 +598,7 @@ HWTEST_F(FmsFormShareMgrTest, HandleProviderShareData_003, TestSize.Level0)
     formInfo.formName = PARAM_FORM_NAME;
     formInfo.formId = formJsInfo.formId;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
     EXPECT_EQ(PARAM_FORM_NAME, formInfo1.formName);
@@ -639,7 +639,7 @@ HWTEST_F(FmsFormShareMgrTest, ShareForm_001, TestSize.Level0)
     formInfo.formName = PARAM_FORM_NAME;
     formInfo.formId = formJsInfo.formId;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
     EXPECT_EQ(PARAM_FORM_NAME, formInfo1.formName);
@@ -674,7 +674,7 @@ HWTEST_F(FmsFormShareMgrTest, ShareForm_002, TestSize.Level0)
     formInfo.formName = PARAM_FORM_NAME;
     formInfo.formId = formJsInfo.formId;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
     EXPECT_EQ(PARAM_FORM_NAME, formInfo1.formName);
@@ -2239,7 +2239,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0007, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.formId = formIds;
     formInfo.formTempFlag = true;
-    FormDataMgr::GetInstance().formRecords_.emplace(formIds, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->GetNoHostTempForms(uid, noHostTempFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FormDataMgr_0007 end";
 }
@@ -2263,7 +2263,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0008, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.formId = formIds;
     formInfo.formTempFlag = false;
-    FormDataMgr::GetInstance().formRecords_.emplace(formIds, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->GetNoHostTempForms(uid, noHostTempFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FormDataMgr_0008 end";
 }
@@ -2546,8 +2546,8 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0023, TestSize.Level0)
     bool isVisible = true;
     FormDataMgr formDataMgr;
     FormRecord formInfo;
-    formDataMgr.formRecords_.emplace(matchedFormId, formInfo);
-    formDataMgr.formRecords_.emplace(matchedFormIds, formInfo);
+    formDataMgr.EmplaceFormRecordNolock(matchedFormId, formInfo);
+    formDataMgr.EmplaceFormRecordNolock(matchedFormIds, formInfo);
     EXPECT_EQ(ERR_OK, formDataMgr.SetRecordVisible(matchedFormId, isVisible));
     GTEST_LOG_(INFO) << "FormDataMgr_0023 end";
 }
@@ -2586,7 +2586,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0025, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.userId = formIds;
     formInfo.formTempFlag = true;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->DeleteFormsByUserId(userId, removedFormIds);
     GTEST_LOG_(INFO) << "FormDataMgr_0025 end";
 }
@@ -2609,7 +2609,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0026, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.userId = formIds;
     formInfo.formTempFlag = false;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->DeleteFormsByUserId(userId, removedFormIds);
     GTEST_LOG_(INFO) << "FormDataMgr_0026 end";
 }
@@ -2632,7 +2632,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0027, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.userId = formIds;
     formInfo.formTempFlag = false;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->DeleteFormsByUserId(userId, removedFormIds);
     GTEST_LOG_(INFO) << "FormDataMgr_0027 end";
 }
@@ -2655,7 +2655,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0028, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.userId = formIds;
     formInfo.formTempFlag = true;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->tempForms_.emplace_back(formIds);
     formDataMgr->DeleteFormsByUserId(userId, removedFormIds);
     GTEST_LOG_(INFO) << "FormDataMgr_0028 end";
@@ -2701,7 +2701,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0030, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.userId = formIds;
     formInfo.formTempFlag = true;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->GetNoHostInvalidTempForms(userId, callingUid, matchedFormIds, noHostTempFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FormDataMgr_0030 end";
 }
@@ -2727,7 +2727,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0031, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.userId = formIds;
     formInfo.formTempFlag = false;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->GetNoHostInvalidTempForms(userId, callingUid, matchedFormIds, noHostTempFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FormDataMgr_0031 end";
 }
@@ -2753,7 +2753,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0032, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.userId = formIds;
     formInfo.formTempFlag = false;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->GetNoHostInvalidTempForms(userId, callingUid, matchedFormIds, noHostTempFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FormDataMgr_0032 end";
 }
@@ -2779,7 +2779,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0033, TestSize.Level0)
     formInfo.bundleName = "com.form.start";
     formInfo.userId = formIds;
     formInfo.formTempFlag = true;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->GetNoHostInvalidTempForms(userId, callingUid, matchedFormIds, noHostTempFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FormDataMgr_0033 end";
 }
@@ -2806,7 +2806,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0034, TestSize.Level0)
     formInfo.userId = formIds;
     formInfo.formUserUids.emplace_back(2);
     formInfo.formTempFlag = true;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->GetNoHostInvalidTempForms(userId, callingUid, matchedFormIds, noHostTempFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FormDataMgr_0034 end";
 }
@@ -2834,7 +2834,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0035, TestSize.Level0)
     formInfo.userId = formIds;
     formInfo.formUserUids.emplace_back(2);
     formInfo.formTempFlag = true;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     formDataMgr->GetNoHostInvalidTempForms(userId, callingUid, matchedFormIds, noHostTempFormsMap, foundFormsMap);
     GTEST_LOG_(INFO) << "FormDataMgr_0035 end";
 }
@@ -2861,7 +2861,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0036, TestSize.Level0)
     formInfo.userId = formIds;
     formInfo.formUserUids.emplace_back(2);
     formInfo.formTempFlag = true;
-    formDataMgr->formRecords_.emplace(formIds, formInfo);
+    formDataMgr->EmplaceFormRecordNolock(formIds, formInfo);
     // set noHostTempFormsMap
     FormIdKey formIdKey(formInfo.bundleName, formInfo.abilityName);
     std::map<FormIdKey, std::set<int64_t>> noHostTempFormsMap;
@@ -3291,7 +3291,7 @@ HWTEST_F(FmsFormShareMgrTest, FormDataMgr_0059, TestSize.Level0)
     bool isNeedFreeInstall = true;
     FormDataMgr formDataMgr;
     FormRecord formInfo;
-    formDataMgr.formRecords_.emplace(formId, formInfo);
+    formDataMgr.EmplaceFormRecordNolock(formId, formInfo);
     EXPECT_EQ(true, formDataMgr.SetRecordNeedFreeInstall(formId, isNeedFreeInstall));
     GTEST_LOG_(INFO) << "FormDataMgr_0059 end";
 }
@@ -3570,7 +3570,7 @@ HWTEST_F(FmsFormShareMgrTest, HandleProviderShareData_005, TestSize.Level1)
     formInfo.formName = PARAM_FORM_NAME;
     formInfo.formId = formJsInfo.formId;
     FormRecord formInfo1;
-    FormDataMgr::GetInstance().formRecords_.emplace(formJsInfo.formId, formInfo);
+    FormDataMgr::GetInstance().EmplaceFormRecordNolock(formJsInfo.formId, formInfo);
     bool ret = FormDataMgr::GetInstance().GetFormRecord(formJsInfo.formId, formInfo1);
     EXPECT_TRUE(ret);
     EXPECT_EQ(PARAM_FORM_NAME, formInfo1.formName);
@@ -378,7 +378,7 @@ HWTEST_F(FmsFormSingletonQueueBaseTest, FmsFormSingletonQueueBaseTest_NoWrapStra
  */
 HWTEST_F(FmsFormSingletonQueueBaseTest, FmsFormSingletonQueueBaseTest_ScheduleTask_Qos_001, TestSize.Level1)
 {
-    for (auto qos : { TaskQos::QOS_DEFAULT, TaskQos::QOS_DEADLINE_REQUEST }) {
+    for (auto qos : { TaskQos::QOS_DEFAULT, TaskQos::QOS_DEADLINE_REQUEST, TaskQos::QOS_BACKGROUND }) {
         std::string queueName = GenerateUniqueQueueName();
         FormSingletonQueueBase queue(queueName);
         std::atomic<bool> taskExecuted(false);
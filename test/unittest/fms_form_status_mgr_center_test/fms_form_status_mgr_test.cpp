@@ -322,4 +322,33 @@ HWTEST_F(FormStatusMgrTest, FormStatusMgrTest_ReportStatusInfoError, TestSize.Le
 
     GTEST_LOG_(INFO) << "FormStatusMgrTest_ReportStatusInfoError end";
 }
+/**
+ * @tc.name: FormStatusMgrTest_FormEventState
+ * @tc.desc: Verify event ids are unique counter values and the form event state is erased once unused
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormStatusMgrTest, FormStatusMgrTest_FormEventState, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "FormStatusMgrTest_FormEventState start";
+
+    int64_t formId = FORM_ID;
+    FormStatusMgr &statusMgr = FormStatusMgr::GetInstance();
+    statusMgr.SetFormEventId(formId);
+    std::string firstEventId = statusMgr.GetFormEventId(formId);
+    statusMgr.SetFormEventId(formId);
+    std::string secondEventId = statusMgr.GetFormEventId(formId);
+    EXPECT_FALSE(firstEventId.empty());
+    EXPECT_LT(std::stoll(firstEventId), std::stoll(secondEventId));
+
+    EXPECT_NE(statusMgr.GetFormEventQueue(formId), nullptr);
+    EXPECT_TRUE(statusMgr.HasFormEventQueue(formId));
+    statusMgr.DeleteFormEventId(formId);
+    EXPECT_EQ(statusMgr.GetFormEventId(formId), "");
+    EXPECT_TRUE(statusMgr.HasFormEventQueue(formId));
+    statusMgr.DeleteFormEventQueue(formId);
+    EXPECT_FALSE(statusMgr.HasFormEventQueue(formId));
+    EXPECT_EQ(statusMgr.formEventStateMap_.count(formId), 0);
+
+    GTEST_LOG_(INFO) << "FormStatusMgrTest_FormEventState end";
+}
 }  // namespace
\ No newline at end of file
@@ -69,4 +69,34 @@ HWTEST_F(FormStatusTableTest, GetFormStatusInfoTest, TestSize.Level0)
 
     GTEST_LOG_(INFO) << "GetFormStatusInfoTest end";
 }
+/**
+ * @tc.name: GetFormStatusInfoTest_002
+ * @tc.desc: Verify GetFormStatusInfo returns the static table entry
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormStatusTableTest, GetFormStatusInfoTest_002, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "GetFormStatusInfoTest_002 start";
+
+    const FormStatusTable &statusTable = FormStatusTable::GetInstance();
+    EXPECT_EQ(statusTable.GetFormStatusInfo(FormFsmStatus::INIT, FormFsmEvent::RENDER_FORM_DONE), nullptr);
+    EXPECT_EQ(statusTable.GetFormStatusInfo((FormFsmStatus)100, FormFsmEvent::RENDER_FORM), nullptr);
+    EXPECT_EQ(statusTable.GetFormStatusInfo(FormFsmStatus::RECYCLED, (FormFsmEvent)100), nullptr);
+
+    const FormStatusMachineInfo *info =
+        statusTable.GetFormStatusInfo(FormFsmStatus::RECYCLED, FormFsmEvent::RECOVER_FORM);
+    ASSERT_NE(info, nullptr);
+    EXPECT_EQ(info, statusTable.GetFormStatusInfo(FormFsmStatus::RECYCLED, FormFsmEvent::RECOVER_FORM));
+    EXPECT_EQ(info->curStatus, FormFsmStatus::RECYCLED);
+    EXPECT_EQ(info->event, FormFsmEvent::RECOVER_FORM);
+    EXPECT_EQ(info->nextStatus, FormFsmStatus::RECOVERING);
+    EXPECT_EQ(info->processType, FormFsmProcessType::PROCESS_TASK_DIRECT);
+
+    info = statusTable.GetFormStatusInfo(FormFsmStatus::RECOVERING, FormFsmEvent::RECOVER_FORM_DONE);
+    ASSERT_NE(info, nullptr);
+    EXPECT_EQ(info->nextStatus, FormFsmStatus::RENDERED);
+    EXPECT_EQ(info->processType, FormFsmProcessType::PROCESS_TASK_FROM_QUEUE);
+
+    GTEST_LOG_(INFO) << "GetFormStatusInfoTest_002 end";
+}
 }  // namespace
\ No newline at end of file
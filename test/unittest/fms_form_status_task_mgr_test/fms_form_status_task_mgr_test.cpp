@@ -804,18 +804,18 @@ HWTEST_F(FormStatusTaskMgrTest, RecycleForm_003, TestSize.Level1)
     auto formTaskMgr = std::make_shared<FormStatusTaskMgr>();
     ASSERT_NE(formTaskMgr, nullptr);
     int64_t formId = 999002;
-    FormRecord record;
-    record.formId = formId;
-    record.providerUserId = 100;
-    record.bundleName = "com.test.bundle";
-    record.formName = "test_form";
-    FormDataMgr::GetInstance().formRecords_[formId] = record;
+    FormItemInfo formItemInfo;
+    formItemInfo.SetFormId(formId);
+    formItemInfo.SetProviderBundleName("com.test.bundle");
+    formItemInfo.SetFormName("test_form");
+    FormDataMgr::GetInstance().AllotFormRecord(formItemInfo, 0, 100);
     FormStatusMgr::GetInstance().SetFormEventId(formId);
     sptr<MockIFormRender> mockRender = new (std::nothrow) MockIFormRender();
     ASSERT_NE(mockRender, nullptr);
     EXPECT_CALL(*mockRender, RecycleForm(_, _)).WillOnce(Return(ERR_APPEXECFWK_FORM_COMMON_CODE));
     sptr<IRemoteObject> remoteObjectOfHost = nullptr;
     formTaskMgr->RecycleForm(formId, remoteObjectOfHost, mockRender);
+    FormDataMgr::GetInstance().DeleteFormRecord(formId);
     GTEST_LOG_(INFO) << "RecycleForm_003 end";
 }
 
@@ -830,18 +830,18 @@ HWTEST_F(FormStatusTaskMgrTest, RecycleForm_004, TestSize.Level1)
     auto formTaskMgr = std::make_shared<FormStatusTaskMgr>();
     ASSERT_NE(formTaskMgr, nullptr);
     int64_t formId = 999003;
-    FormRecord record;
-    record.formId = formId;
-    record.providerUserId = 100;
-    record.bundleName = "com.test.bundle";
-    record.formName = "test_form";
-    FormDataMgr::GetInstance().formRecords_[formId] = record;
+    FormItemInfo formItemInfo;
+    formItemInfo.SetFormId(formId);
+    formItemInfo.SetProviderBundleName("com.test.bundle");
+    formItemInfo.SetFormName("test_form");
+    FormDataMgr::GetInstance().AllotFormRecord(formItemInfo, 0, 100);
     FormStatusMgr::GetInstance().SetFormEventId(formId);
     sptr<MockIFormRender> mockRender = new (std::nothrow) MockIFormRender();
     ASSERT_NE(mockRender, nullptr);
     EXPECT_CALL(*mockRender, RecycleForm(_, _)).WillOnce(Return(ERR_OK));
     sptr<IRemoteObject> remoteObjectOfHost = nullptr;
     formTaskMgr->RecycleForm(formId, remoteObjectOfHost, mockRender);
+    FormDataMgr::GetInstance().DeleteFormRecord(formId);
     GTEST_LOG_(INFO) << "RecycleForm_004 end";
 }
 
@@ -14,10 +14,12 @@
  */
 #include <chrono>
 #include <gtest/gtest.h>
+#include <tuple>
 
 #include "common_event.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
+#include "data_center/form_basic_info_mgr.h"
 #include "form_constants.h"
 #define private public
 #include "common/timer_mgr/form_refresh_limiter.h"
@@ -293,7 +295,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0102, TestSize.Level1)
     
     bool found = false;
     for (const auto& item : timerMgr.updateAtTimerTasks_) {
-        if (item.refreshTask.formId == formId) {
+        if (item.second.refreshTask.formId == formId) {
             found = true;
             break;
         }
@@ -326,7 +328,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0103, TestSize.Level1)
     
     bool found = false;
     for (const auto& item : timerMgr.updateAtTimerTasks_) {
-        if (item.refreshTask.formId == formId) {
+        if (item.second.refreshTask.formId == formId) {
             found = true;
             break;
         }
@@ -408,7 +410,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0106, TestSize.Level1)
     
     bool found = false;
     for (const auto& item : timerMgr.dynamicRefreshTasks_) {
-        if (item.formId == formId) {
+        if (item.second.formId == formId) {
             found = true;
             break;
         }
@@ -439,7 +441,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0107, TestSize.Level1)
     
     bool found = false;
     for (const auto& item : timerMgr.dynamicRefreshTasks_) {
-        if (item.formId == formId) {
+        if (item.second.formId == formId) {
             found = true;
             break;
         }
@@ -910,4 +912,144 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0129, TestSize.Level1)
     
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0129 end";
 }
-}
\ No newline at end of file
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0130
+ * @tc.name: OnIntervalTimeOut.
+ * @tc.desc: Test OnIntervalTimeOut only refreshes due tasks and queues them for the next period.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0130, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0130 start";
+    std::shared_ptr<FormTimerMgr> formTimerMgr = std::make_shared<FormTimerMgr>();
+    int64_t dueFormId = 20210730;
+    int64_t idleFormId = 20210731;
+    int64_t currentTime = FormUtil::GetCurrentMillisecond();
+    FormTimer dueTask(dueFormId, Constants::MIN_PERIOD, 0);
+    dueTask.refreshTime = currentTime - Constants::MIN_PERIOD;
+    FormTimer idleTask(idleFormId, Constants::MIN_PERIOD, 0);
+    idleTask.refreshTime = currentTime - 1;
+    for (const auto &task : { dueTask, idleTask }) {
+        formTimerMgr->intervalTimerTasks_.emplace(task.formId, task);
+        formTimerMgr->EnqueueIntervalTaskNolock(task);
+        formTimerMgr->refreshLimiter_.AddItem(task.formId);
+    }
+
+    formTimerMgr->OnIntervalTimeOut();
+
+    EXPECT_EQ(formTimerMgr->intervalTimerQueue_.size(), 2);
+    EXPECT_GE(formTimerMgr->intervalTimerTasks_[dueFormId].refreshTime, currentTime);
+    EXPECT_EQ(formTimerMgr->intervalTimerTasks_[idleFormId].refreshTime, currentTime - 1);
+    EXPECT_EQ(formTimerMgr->intervalTimerQueue_.begin()->second, idleFormId);
+
+    EXPECT_TRUE(formTimerMgr->DeleteIntervalTimer(dueFormId));
+    EXPECT_TRUE(formTimerMgr->DeleteIntervalTimer(idleFormId));
+    EXPECT_TRUE(formTimerMgr->intervalTimerQueue_.empty());
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0130 end";
+}
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0131
+ * @tc.name: FindNextAtTimerItem.
+ * @tc.desc: Test FindNextAtTimerItem picks the next update time and wraps to the first one of the day.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0131, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0131 start";
+    std::shared_ptr<FormTimerMgr> formTimerMgr = std::make_shared<FormTimerMgr>();
+    for (long updateAtTime : { 600L, 60L, 900L }) {
+        UpdateAtItem atItem;
+        atItem.updateAtTime = updateAtTime;
+        atItem.refreshTask.formId = updateAtTime;
+        formTimerMgr->AddUpdateAtItem(atItem);
+    }
+
+    UpdateAtItem foundItem;
+    EXPECT_TRUE(formTimerMgr->FindNextAtTimerItem(600L, foundItem));
+    EXPECT_EQ(foundItem.updateAtTime, 900L);
+    EXPECT_TRUE(formTimerMgr->FindNextAtTimerItem(900L, foundItem));
+    EXPECT_EQ(foundItem.updateAtTime, 60L);
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0131 end";
+}
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0132
+ * @tc.name: AddDynamicItemNolock.
+ * @tc.desc: Test a form keeps a single dynamic refresh item ordered by its latest setted time.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0132, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0132 start";
+    std::shared_ptr<FormTimerMgr> formTimerMgr = std::make_shared<FormTimerMgr>();
+    formTimerMgr->AddDynamicItemNolock(DynamicRefreshItem(1, 300));
+    formTimerMgr->AddDynamicItemNolock(DynamicRefreshItem(2, 200));
+    formTimerMgr->AddDynamicItemNolock(DynamicRefreshItem(1, 100));
+
+    EXPECT_EQ(formTimerMgr->dynamicRefreshTasks_.size(), 2);
+    EXPECT_EQ(formTimerMgr->dynamicRefreshTasks_.begin()->second.formId, 1);
+    DynamicRefreshItem dynamicItem;
+    EXPECT_TRUE(formTimerMgr->GetDynamicItem(1, dynamicItem));
+    EXPECT_EQ(dynamicItem.settedTime, 100);
+
+    auto itItem = formTimerMgr->FindDynamicItemNolock(1);
+    ASSERT_NE(itItem, formTimerMgr->dynamicRefreshTasks_.end());
+    formTimerMgr->EraseDynamicItemNolock(itItem);
+    EXPECT_FALSE(formTimerMgr->GetDynamicItem(1, dynamicItem));
+    EXPECT_TRUE(formTimerMgr->GetDynamicItem(2, dynamicItem));
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0132 end";
+}
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0133
+ * @tc.name: AlignIntervalTasksNolock.
+ * @tc.desc: Test tasks of a woken provider due within the align window join its refresh group.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0133, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0133 start";
+    std::shared_ptr<FormTimerMgr> formTimerMgr = std::make_shared<FormTimerMgr>();
+    formTimerMgr->alignWindow_ = Constants::MIN_PERIOD / 10;
+    int64_t currentTime = FormUtil::GetCurrentMillisecond();
+    // formId, bundleName, next fire time offset
+    const std::vector<std::tuple<int64_t, std::string, int64_t>> forms = {
+        { 20210740, "com.form.a", 0 },
+        { 20210741, "com.form.a", formTimerMgr->alignWindow_ / 2 },
+        { 20210742, "com.form.a", formTimerMgr->alignWindow_ * 2 },
+        { 20210743, "com.form.b", formTimerMgr->alignWindow_ / 2 },
+    };
+    for (const auto &[formId, bundleName, offset] : forms) {
+        FormBasicInfo basicInfo;
+        basicInfo.formId = formId;
+        basicInfo.bundleName = bundleName;
+        basicInfo.abilityName = "FormAbility";
+        FormBasicInfoMgr::GetInstance().AddFormBasicInfo(basicInfo);
+        FormTimer task(formId, Constants::MIN_PERIOD, 0);
+        task.refreshTime = currentTime + offset - Constants::MIN_PERIOD;
+        formTimerMgr->intervalTimerTasks_.emplace(formId, task);
+        formTimerMgr->refreshLimiter_.AddItem(formId);
+        if (offset != 0) {
+            formTimerMgr->EnqueueIntervalTaskNolock(task);
+        }
+    }
+
+    std::vector<FormTimer> dueTasks = { formTimerMgr->intervalTimerTasks_[20210740] };
+    std::vector<std::vector<FormTimer>> groups;
+    formTimerMgr->AlignIntervalTasksNolock(currentTime, dueTasks, groups);
+
+    ASSERT_EQ(groups.size(), 1);
+    ASSERT_EQ(groups[0].size(), 2);
+    EXPECT_EQ(groups[0][1].formId, 20210741);
+    EXPECT_EQ(dueTasks.size(), 2);
+    EXPECT_EQ(formTimerMgr->intervalTimerTasks_[20210741].refreshTime, currentTime);
+    EXPECT_EQ(formTimerMgr->intervalTimerQueue_.size(), 2);
+
+    formTimerMgr->alignWindow_ = 0;
+    groups.clear();
+    formTimerMgr->AlignIntervalTasksNolock(currentTime, dueTasks, groups);
+    EXPECT_EQ(groups.size(), 2);
+    for (const auto &form : forms) {
+        FormBasicInfoMgr::GetInstance().DeleteFormBasicInfo(std::get<0>(form));
+    }
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0133 end";
+}
+}
@@ -725,7 +725,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0038, TestSize.Level1)
     timerCfg.updateAtMin = Constants::MIN_TIME + 1;
     UpdateAtItem updateAtItem;
     updateAtItem.refreshTask.formId = 0;
-    formTimerMgr.updateAtTimerTasks_.emplace_back(updateAtItem);
+    formTimerMgr.updateAtTimerTasks_.emplace(updateAtItem.updateAtTime, updateAtItem);
     EXPECT_EQ(true, formTimerMgr.UpdateAtTimerValue(formId, timerCfg));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0038 end";
 }
@@ -745,7 +745,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0039, TestSize.Level1)
     timerCfg.updateAtMin = Constants::MIN_TIME + 1;
     UpdateAtItem updateAtItem;
     updateAtItem.refreshTask.formId = 0;
-    formTimerMgr.updateAtTimerTasks_.emplace_back(updateAtItem);
+    formTimerMgr.updateAtTimerTasks_.emplace(updateAtItem.updateAtTime, updateAtItem);
     EXPECT_EQ(false, formTimerMgr.UpdateAtTimerValue(formId, timerCfg));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0039 end";
 }
@@ -894,7 +894,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0048, TestSize.Level1)
     timerCfg.updateDuration = 2 * Constants::MIN_PERIOD;
     UpdateAtItem updateAtItem;
     updateAtItem.refreshTask.formId = 0;
-    formTimerMgr.updateAtTimerTasks_.emplace_back(updateAtItem);
+    formTimerMgr.updateAtTimerTasks_.emplace(updateAtItem.updateAtTime, updateAtItem);
     EXPECT_EQ(false, formTimerMgr.AtTimerToIntervalTimer(formId, timerCfg));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0048 end";
 }
@@ -946,7 +946,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0051, TestSize.Level1)
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.formId = 1;
     dynamicRefreshItem.userId = 2;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     EXPECT_EQ(false, formTimerMgr.SetNextRefreshTime(formId, nextGapTime, userId));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0051 end";
 }
@@ -966,7 +966,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0052, TestSize.Level1)
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.formId = 1;
     dynamicRefreshItem.userId = 3;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     EXPECT_EQ(false, formTimerMgr.SetNextRefreshTime(formId, nextGapTime, userId));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0052 end";
 }
@@ -986,7 +986,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0053, TestSize.Level1)
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.formId = 2;
     dynamicRefreshItem.userId = 2;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     EXPECT_EQ(false, formTimerMgr.SetNextRefreshTime(formId, nextGapTime, userId));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0053 end";
 }
@@ -1006,7 +1006,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0054, TestSize.Level1)
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.formId = 2;
     dynamicRefreshItem.userId = 3;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     EXPECT_EQ(false, formTimerMgr.SetNextRefreshTime(formId, nextGapTime, userId));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0054 end";
 }
@@ -1058,7 +1058,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0057, TestSize.Level1)
     UpdateAtItem updateAtItem;
     updateAtItem.updateAtTime = Constants::MIN_PERIOD;
     updateAtItem.refreshTask.isEnable = true;
-    formTimerMgr.updateAtTimerTasks_.emplace_back(updateAtItem);
+    formTimerMgr.updateAtTimerTasks_.emplace(updateAtItem.updateAtTime, updateAtItem);
     EXPECT_EQ(true, formTimerMgr.OnUpdateAtTrigger(updateTime));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0057 end";
 }
@@ -1076,7 +1076,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0058, TestSize.Level1)
     UpdateAtItem updateAtItem;
     updateAtItem.updateAtTime = Constants::MIN_PERIOD;
     updateAtItem.refreshTask.isEnable = false;
-    formTimerMgr.updateAtTimerTasks_.emplace_back(updateAtItem);
+    formTimerMgr.updateAtTimerTasks_.emplace(updateAtItem.updateAtTime, updateAtItem);
     EXPECT_EQ(true, formTimerMgr.OnUpdateAtTrigger(updateTime));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0058 end";
 }
@@ -1094,7 +1094,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0059, TestSize.Level1)
     UpdateAtItem updateAtItem;
     updateAtItem.updateAtTime = Constants::MIN_PERIOD + 1;
     updateAtItem.refreshTask.isEnable = false;
-    formTimerMgr.updateAtTimerTasks_.emplace_back(updateAtItem);
+    formTimerMgr.updateAtTimerTasks_.emplace(updateAtItem.updateAtTime, updateAtItem);
     EXPECT_EQ(true, formTimerMgr.OnUpdateAtTrigger(updateTime));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0059 end";
 }
@@ -1112,7 +1112,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0060, TestSize.Level1)
     UpdateAtItem updateAtItem;
     updateAtItem.updateAtTime = Constants::MIN_PERIOD + 1;
     updateAtItem.refreshTask.isEnable = true;
-    formTimerMgr.updateAtTimerTasks_.emplace_back(updateAtItem);
+    formTimerMgr.updateAtTimerTasks_.emplace(updateAtItem.updateAtTime, updateAtItem);
     EXPECT_EQ(true, formTimerMgr.OnUpdateAtTrigger(updateTime));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0060 end";
 }
@@ -1129,7 +1129,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0061, TestSize.Level1)
     int64_t updateTime = 40;
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.settedTime = 1;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     EXPECT_EQ(true, formTimerMgr.OnDynamicTimeTrigger(updateTime));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0061 end";
 }
@@ -1146,7 +1146,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0062, TestSize.Level1)
     int64_t updateTime = 40;
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.settedTime = 41;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     EXPECT_EQ(true, formTimerMgr.OnDynamicTimeTrigger(updateTime));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0062 end";
 }
@@ -1243,7 +1243,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0068, TestSize.Level1)
     int64_t formId = 1;
     UpdateAtItem updateAtItem;
     updateAtItem.refreshTask.formId = 0;
-    formTimerMgr.updateAtTimerTasks_.emplace_back(updateAtItem);
+    formTimerMgr.updateAtTimerTasks_.emplace(updateAtItem.updateAtTime, updateAtItem);
     EXPECT_EQ(false, formTimerMgr.GetUpdateAtTimer(formId, updateAtItem));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0068 end";
 }
@@ -1260,7 +1260,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0069, TestSize.Level1)
     int64_t formId = 1;
     UpdateAtItem updateAtItem;
     updateAtItem.refreshTask.formId = 1;
-    formTimerMgr.updateAtTimerTasks_.emplace_back(updateAtItem);
+    formTimerMgr.updateAtTimerTasks_.emplace(updateAtItem.updateAtTime, updateAtItem);
     EXPECT_EQ(true, formTimerMgr.GetUpdateAtTimer(formId, updateAtItem));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0069 end";
 }
@@ -1277,7 +1277,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0073, TestSize.Level1)
     int64_t formId = 1;
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.formId = 2;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     EXPECT_EQ(true, formTimerMgr.DeleteDynamicItem(formId));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0073 end";
 }
@@ -1294,7 +1294,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0074, TestSize.Level1)
     int64_t formId = 1;
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.formId = 1;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     EXPECT_EQ(true, formTimerMgr.DeleteDynamicItem(formId));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0074 end";
 }
@@ -1311,10 +1311,10 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0075, TestSize.Level1)
     int64_t formId = 1;
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.formId = 1;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     DynamicRefreshItem dynamicRefreshItems;
     dynamicRefreshItems.formId = 2;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItems);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItems);
     EXPECT_EQ(true, formTimerMgr.DeleteDynamicItem(formId));
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0075 end";
 }
@@ -1425,7 +1425,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0081, TestSize.Level1)
     FormTimerMgr formTimerMgr;
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.settedTime = 1;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     formTimerMgr.dynamicWakeUpTime_ = 1;
     EXPECT_EQ(true, formTimerMgr.UpdateDynamicAlarm());
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0081 end";
@@ -1442,7 +1442,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0082, TestSize.Level1)
     FormTimerMgr formTimerMgr;
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.settedTime = 1;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     formTimerMgr.dynamicWakeUpTime_ = 2;
     EXPECT_EQ(true, formTimerMgr.UpdateDynamicAlarm());
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0082 end";
@@ -1459,7 +1459,7 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0083, TestSize.Level1)
     FormTimerMgr formTimerMgr;
     DynamicRefreshItem dynamicRefreshItem;
     dynamicRefreshItem.settedTime = 1;
-    formTimerMgr.dynamicRefreshTasks_.emplace_back(dynamicRefreshItem);
+    formTimerMgr.AddDynamicItemNolock(dynamicRefreshItem);
     formTimerMgr.dynamicWakeUpTime_ = 2;
     formTimerMgr.currentDynamicWantAgent_ = std::make_shared<WantAgent>();
     EXPECT_EQ(true, formTimerMgr.UpdateDynamicAlarm());
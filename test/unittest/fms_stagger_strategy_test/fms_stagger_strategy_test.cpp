@@ -85,6 +85,7 @@ HWTEST_F(FmsStaggerStrategyTest, VisibleFilter_001, TestSize.Level1)
     for (int i = 0; i < 2; i++) {
         RefreshData data;
         data.formId = i + 1;
+        data.record = std::make_shared<const FormRecord>();
         batch.push_back(data);
     }
     strategy.Filter(batch, FormRefreshType::TYPE_NETWORK);
@@ -109,6 +110,7 @@ HWTEST_F(FmsStaggerStrategyTest, VisibleFilter_002, TestSize.Level1)
     for (int i = 0; i < 2; i++) {
         RefreshData data;
         data.formId = i + 1;
+        data.record = std::make_shared<const FormRecord>();
         batch.push_back(data);
     }
     strategy.Filter(batch, FormRefreshType::TYPE_PROVIDER);
@@ -13,7 +13,9 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#define private public
 #include "feature/bundle_forbidden/form_bundle_forbid_mgr.h"
+#undef private
 
 using namespace testing::ext;
 using namespace OHOS;
@@ -46,4 +48,24 @@ HWTEST_F(FormBundleForbidMgrTest, formbundleforbidmgr_001, TestSize.Level0)
     EXPECT_EQ(FormBundleForbidMgr::GetInstance().IsBundleForbidden(""), false);
     GTEST_LOG_(INFO) << "formbundleforbidmgr_001 end";
 }
+
+/**
+ * @tc.name: formbundleforbidmgr_002
+ * @tc.desc: test SetBundleForbiddenStatus publishes a new snapshot and leaves held snapshots unchanged.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormBundleForbidMgrTest, formbundleforbidmgr_002, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "formbundleforbidmgr_002 begin";
+    FormBundleForbidMgr &forbidMgr = FormBundleForbidMgr::GetInstance();
+    forbidMgr.isInitialized_ = true;
+    const std::string bundleName = "com.form.forbidden";
+    FormSnapshotSet::Snapshot before = forbidMgr.formBundleForbiddenSet_.GetSnapshot();
+    forbidMgr.SetBundleForbiddenStatus(bundleName, true);
+    EXPECT_TRUE(forbidMgr.IsBundleForbidden(bundleName));
+    EXPECT_EQ(before->count(bundleName), 0);
+    forbidMgr.SetBundleForbiddenStatus(bundleName, false);
+    EXPECT_FALSE(forbidMgr.IsBundleForbidden(bundleName));
+    GTEST_LOG_(INFO) << "formbundleforbidmgr_002 end";
+}
 } // namespace
\ No newline at end of file
@@ -2406,3 +2406,93 @@ HWTEST_F(FormInfoMgrTest, FormInfoMgr_AddBundleFormInfos_0400, TestSize.Level1)
     EXPECT_EQ(formInfoMgr_.bundleFormInfoMap_.size(), mapSizeBefore);
     GTEST_LOG_(INFO) << "FormInfoMgr_AddBundleFormInfos_0400 end";
 }
+
+/**
+ * @tc.name: FormInfoMgr_QueryIndex_0100
+ * @tc.desc: test repeated queries share one snapshot until the bundle changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormInfoMgrTest, FormInfoMgr_QueryIndex_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormInfoMgr_QueryIndex_0100 start";
+    auto bundleFormInfo = std::make_shared<BundleFormInfo>(FORM_BUNDLE_NAME_TEST);
+    FormInfoStorage formInfoStorage;
+    formInfoStorage.userId = USER_ID;
+    formInfoStorage.formInfos.push_back(GetTestFormInfo());
+    bundleFormInfo->formInfoStorages_.emplace_back(formInfoStorage);
+    formInfoMgr_.bundleFormInfoMap_[FORM_BUNDLE_NAME_TEST] = bundleFormInfo;
+    MockIsSACall(true);
+
+    FormInfosSnapshot first;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetFormsInfoByBundle(FORM_BUNDLE_NAME_TEST, first, USER_ID));
+    ASSERT_NE(first, nullptr);
+    std::vector<FormInfo> expectFormInfos;
+    bundleFormInfo->GetAllFormsInfo(expectFormInfos, USER_ID);
+    EXPECT_EQ(first->size(), expectFormInfos.size());
+    int64_t buildCount = formInfoMgr_.queryIndex_.GetBuildCount();
+    FormInfosSnapshot second;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetFormsInfoByBundle(FORM_BUNDLE_NAME_TEST, second, USER_ID));
+    EXPECT_EQ(first, second);
+    FormInfosSnapshot moduleFormInfos;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetFormsInfoByModule(FORM_BUNDLE_NAME_TEST, PARAM_MODULE_NAME_TEST,
+        moduleFormInfos, USER_ID));
+    ASSERT_NE(moduleFormInfos, nullptr);
+    EXPECT_EQ(moduleFormInfos->size(), expectFormInfos.size());
+    EXPECT_EQ(formInfoMgr_.queryIndex_.GetBuildCount(), buildCount);
+
+    FormInfosSnapshot allFormInfos;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetAllFormsInfo(allFormInfos, USER_ID));
+    FormInfosSnapshot allFormInfosAgain;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetAllFormsInfo(allFormInfosAgain, USER_ID));
+    EXPECT_EQ(allFormInfos, allFormInfosAgain);
+
+    formInfoMgr_.queryIndex_.Invalidate(FORM_BUNDLE_NAME_TEST);
+    FormInfosSnapshot third;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetFormsInfoByBundle(FORM_BUNDLE_NAME_TEST, third, USER_ID));
+    EXPECT_NE(first, third);
+    EXPECT_EQ(formInfoMgr_.queryIndex_.GetBuildCount(), buildCount + 1);
+    GTEST_LOG_(INFO) << "FormInfoMgr_QueryIndex_0100 end";
+}
+
+/**
+ * @tc.name: FormInfoMgr_QueryIndex_0200
+ * @tc.desc: test the cached filter result follows the dimensions and the removal of the bundle
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormInfoMgrTest, FormInfoMgr_QueryIndex_0200, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormInfoMgr_QueryIndex_0200 start";
+    auto bundleFormInfo = std::make_shared<BundleFormInfo>(FORM_BUNDLE_NAME_TEST);
+    FormInfoStorage formInfoStorage;
+    formInfoStorage.userId = USER_ID;
+    formInfoStorage.formInfos.push_back(GetTestFormInfo());
+    bundleFormInfo->formInfoStorages_.emplace_back(formInfoStorage);
+    formInfoMgr_.bundleFormInfoMap_[FORM_BUNDLE_NAME_TEST] = bundleFormInfo;
+    MockIsSACall(true);
+
+    FormInfoFilter filter;
+    filter.bundleName = FORM_BUNDLE_NAME_TEST;
+    filter.supportDimensions = {1};
+    FormInfosSnapshot matched;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetFormsInfoByFilter(filter, matched, USER_ID));
+    ASSERT_NE(matched, nullptr);
+    std::vector<FormInfo> expectFormInfos;
+    bundleFormInfo->GetFormsInfoByFilter(filter, expectFormInfos, USER_ID);
+    EXPECT_EQ(matched->size(), expectFormInfos.size());
+    FormInfosSnapshot matchedAgain;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetFormsInfoByFilter(filter, matchedAgain, USER_ID));
+    EXPECT_EQ(matched, matchedAgain);
+
+    filter.supportDimensions = {3};
+    FormInfosSnapshot unmatched;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetFormsInfoByFilter(filter, unmatched, USER_ID));
+    ASSERT_NE(unmatched, nullptr);
+    EXPECT_TRUE(unmatched->empty());
+
+    EXPECT_EQ(ERR_OK, formInfoMgr_.Remove(FORM_BUNDLE_NAME_TEST, USER_ID));
+    filter.supportDimensions = {1};
+    std::vector<FormInfo> formInfos;
+    EXPECT_EQ(ERR_OK, formInfoMgr_.GetFormsInfoByFilter(filter, formInfos, USER_ID));
+    EXPECT_TRUE(formInfos.empty());
+    GTEST_LOG_(INFO) << "FormInfoMgr_QueryIndex_0200 end";
+}
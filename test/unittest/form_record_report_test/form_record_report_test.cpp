@@ -263,4 +263,27 @@ HWTEST_F(FormRecordReportTest, FormRecordReport_012, TestSize.Level1)
     ASSERT_FALSE(iter->second.empty());
     EXPECT_EQ(iter->second.back().actualProxyRefreshTimes, 1);
 }
+
+/**
+ * @tc.name: FormRecordReport_013
+ * @tc.desc: test IncreaseUpdateTimes function counts aligned timer refreshes per form and per hour.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRecordReportTest, FormRecordReport_013, TestSize.Level1)
+{
+    int64_t formId = 1;
+    formRecordReport.SetFormRecordRecordInfo(formId, want);
+    formRecordReport.IncreaseUpdateTimes(formId, TYPE_ALIGNED_TIMER_REFRESH);
+    formRecordReport.IncreaseUpdateTimes(formId + 1, TYPE_ALIGNED_TIMER_REFRESH);
+    auto iter = formRecordReport.formRecordReportMap_.find(formId);
+    ASSERT_NE(iter, formRecordReport.formRecordReportMap_.end());
+    EXPECT_EQ(iter->second.back().alignedTimerRefreshTimes, 1);
+    auto savedWakeups = formRecordReport.GetSavedWakeupsPerHour();
+    ASSERT_FALSE(savedWakeups.empty());
+    int32_t total = 0;
+    for (const auto &bucket : savedWakeups) {
+        total += bucket.second;
+    }
+    EXPECT_EQ(total, 2);
+}
 } // namespace
\ No newline at end of file
@@ -22,6 +22,8 @@
 #include "form_mgr_errors.h"
 #define private public
 #include "form_render_record.h"
+#include "form_render_watchdog.h"
+#include "form_runtime_reaper.h"
 #undef private
 #include "gmock/gmock.h"
 #include "fms_log_wrapper.h"
@@ -44,6 +46,9 @@ constexpr int32_t SET_VISIBLE_CHANGE_FAILED = -1;
 constexpr int32_t FORM_ID = 1;
 constexpr char FORM_RENDERER_COMP_ID[] = "ohos.extra.param.key.form_comp_id";
 }
+
+void MockRecycledStatusData(const std::string &statusData);
+std::string GetRecoveredStatusData();
 #define private public
 class FormRenderRecordMock : public FormRenderRecord {
 public:
@@ -1161,7 +1166,8 @@ HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_058, TestSize.Level0)
     std::this_thread::sleep_for(std::chrono::milliseconds(500));
     formRenderRecordPtr_->GetEventHandler(true, false);
     formRenderRecordPtr_->threadState_ = std::make_unique<ThreadState>(1);
-    formRenderRecordPtr_->threadIsAlive_ = false;
+    formRenderRecordPtr_->checkedHeartbeat_ = formRenderRecordPtr_->heartbeat_.load();
+    formRenderRecordPtr_->probePending_ = true;
 
     EXPECT_EQ(TaskState::BLOCK, formRenderRecordPtr_->RunTask());
     GTEST_LOG_(INFO) << "FormRenderRecordTest_058 end";
@@ -1324,9 +1330,15 @@ HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_066, TestSize.Level1)
     ASSERT_NE(formRenderRecordPtr_, nullptr);
     formRenderRecordPtr_->threadState_ = std::make_unique<ThreadState>(1);
     ASSERT_NE(formRenderRecordPtr_->threadState_, nullptr);
+    formRenderRecordPtr_->threadState_->NextState();
+    uint64_t heartbeat = formRenderRecordPtr_->heartbeat_.load();
     formRenderRecordPtr_->MarkThreadAlive();
+    EXPECT_EQ(formRenderRecordPtr_->heartbeat_.load(), heartbeat + 1);
+    formRenderRecordPtr_->GetEventHandler(true, false);
+    formRenderRecordPtr_->probePending_ = true;
+    formRenderRecordPtr_->RunTask();
     EXPECT_EQ(formRenderRecordPtr_->threadState_->state_, 0);
-    EXPECT_EQ(formRenderRecordPtr_->threadIsAlive_, true);
+    EXPECT_EQ(formRenderRecordPtr_->probePending_, false);
     GTEST_LOG_(INFO) << "FormRenderRecordTest_066 end";
 }
 
@@ -1925,7 +1937,8 @@ HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_097, TestSize.Level1)
 HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_098, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "FormRenderRecordTest_098 start";
-    formRenderRecordPtr_->threadIsAlive_ = false;
+    formRenderRecordPtr_->checkedHeartbeat_ = formRenderRecordPtr_->heartbeat_.load();
+    formRenderRecordPtr_->probePending_ = true;
     formRenderRecordPtr_->threadState_ = std::make_unique<ThreadState>(0);
     formRenderRecordPtr_->Timer();
     GTEST_LOG_(INFO) << "FormRenderRecordTest_098 end";
@@ -4548,4 +4561,289 @@ HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_UpdateFormSizeOfGroups_005,
     EXPECT_NO_FATAL_FAILURE(formRenderRecordPtr_->UpdateFormSizeOfGroups(formId, formSurfaceInfo, formJsInfo));
 
     GTEST_LOG_(INFO) << "FormRenderRecordTest_UpdateFormSizeOfGroups_005 end";
-}
\ No newline at end of file
+}
+/**
+ * @tc.name: FormRenderRecordTest_HandleUpdateConfiguration_001
+ * @tc.desc: Verify HandleUpdateConfiguration defers the update of invisible forms and counts its cpu cost.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_HandleUpdateConfiguration_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_HandleUpdateConfiguration_001 start";
+    ASSERT_NE(formRenderRecordPtr_, nullptr);
+
+    int64_t visibleFormId = 21;
+    int64_t invisibleFormId = 22;
+    std::shared_ptr<AbilityRuntime::Context> context = nullptr;
+    std::shared_ptr<AbilityRuntime::Runtime> runtime = nullptr;
+    std::shared_ptr<OHOS::AppExecFwk::EventHandler> handler = nullptr;
+    formRenderRecordPtr_->formRendererGroupMap_.clear();
+    formRenderRecordPtr_->formRendererGroupMap_.emplace(visibleFormId,
+        std::make_shared<FormRendererGroup>(context, runtime, handler));
+    formRenderRecordPtr_->formRendererGroupMap_.emplace(invisibleFormId,
+        std::make_shared<FormRendererGroup>(context, runtime, handler));
+    formRenderRecordPtr_->RecordFormVisibility(visibleFormId, true);
+    formRenderRecordPtr_->RecordFormVisibility(invisibleFormId, false);
+
+    auto config = std::make_shared<OHOS::AppExecFwk::Configuration>();
+    auto cpuCost = std::make_shared<ConfigUpdateCpuCost>();
+    formRenderRecordPtr_->HandleUpdateConfiguration(config, cpuCost);
+    EXPECT_EQ(formRenderRecordPtr_->configStaleFormIds_.count(visibleFormId), 0);
+    EXPECT_EQ(formRenderRecordPtr_->configStaleFormIds_.count(invisibleFormId), 1);
+    EXPECT_EQ(cpuCost->threadCount_, 1);
+
+    formRenderRecordPtr_->formRendererGroupMap_.clear();
+    formRenderRecordPtr_->configStaleFormIds_.clear();
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_HandleUpdateConfiguration_001 end";
+}
+
+/**
+ * @tc.name: FormRenderRecordTest_HandleSetVisibleChange_001
+ * @tc.desc: Verify the deferred configuration is applied when the form becomes visible.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_HandleSetVisibleChange_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_HandleSetVisibleChange_001 start";
+    ASSERT_NE(formRenderRecordPtr_, nullptr);
+
+    int64_t formId = 23;
+    std::shared_ptr<AbilityRuntime::Context> context = nullptr;
+    std::shared_ptr<AbilityRuntime::Runtime> runtime = nullptr;
+    std::shared_ptr<OHOS::AppExecFwk::EventHandler> handler = nullptr;
+    formRenderRecordPtr_->formRendererGroupMap_.clear();
+    formRenderRecordPtr_->formRendererGroupMap_.emplace(formId,
+        std::make_shared<FormRendererGroup>(context, runtime, handler));
+    formRenderRecordPtr_->MarkConfigStale(formId);
+
+    EXPECT_EQ(ERR_OK, formRenderRecordPtr_->HandleSetVisibleChange(formId, false));
+    EXPECT_EQ(formRenderRecordPtr_->configStaleFormIds_.count(formId), 1);
+    EXPECT_EQ(ERR_OK, formRenderRecordPtr_->HandleSetVisibleChange(formId, true));
+    EXPECT_EQ(formRenderRecordPtr_->configStaleFormIds_.count(formId), 0);
+
+    formRenderRecordPtr_->formRendererGroupMap_.clear();
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_HandleSetVisibleChange_001 end";
+}
+
+/**
+ * @tc.name: FormRenderRecordTest_RunTask_001
+ * @tc.desc: Verify RunTask counts the checks without heartbeat only after a probe is posted.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_RunTask_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_RunTask_001 start";
+    ASSERT_NE(formRenderRecordPtr_, nullptr);
+    formRenderRecordPtr_->GetEventHandler(true, false);
+    formRenderRecordPtr_->threadState_ = std::make_unique<ThreadState>(2);
+    formRenderRecordPtr_->checkedHeartbeat_ = formRenderRecordPtr_->heartbeat_.load();
+
+    formRenderRecordPtr_->probePending_ = false;
+    formRenderRecordPtr_->RunTask();
+    EXPECT_EQ(formRenderRecordPtr_->threadState_->state_, 0);
+
+    formRenderRecordPtr_->checkedHeartbeat_ = formRenderRecordPtr_->heartbeat_.load();
+    formRenderRecordPtr_->probePending_ = true;
+    EXPECT_EQ(TaskState::RUNNING, formRenderRecordPtr_->RunTask());
+    EXPECT_EQ(formRenderRecordPtr_->threadState_->state_, 1);
+    EXPECT_EQ(TaskState::BLOCK, formRenderRecordPtr_->RunTask());
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_RunTask_001 end";
+}
+
+/**
+ * @tc.name: FormRenderRecordTest_FormRenderWatchdog_001
+ * @tc.desc: Verify the render records share one watchdog.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_FormRenderWatchdog_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_FormRenderWatchdog_001 start";
+    ASSERT_NE(formRenderRecordPtr_, nullptr);
+    auto otherRecord = FormRenderRecord::Create("bundleName2", "uid2");
+    ASSERT_NE(otherRecord, nullptr);
+    size_t recordCount = FormRenderWatchdog::GetInstance().GetRecordCount();
+    EXPECT_GE(recordCount, 1);
+
+    otherRecord->AddWatchDogThreadMonitor();
+    EXPECT_EQ(FormRenderWatchdog::GetInstance().GetRecordCount(), recordCount);
+    otherRecord->RemoveWatchDogThreadMonitor();
+    EXPECT_EQ(FormRenderWatchdog::GetInstance().GetRecordCount(), recordCount - 1);
+    otherRecord = nullptr;
+    EXPECT_EQ(FormRenderWatchdog::GetInstance().GetRecordCount(), recordCount - 1);
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_FormRenderWatchdog_001 end";
+}
+
+/**
+ * @tc.name: FormRenderRecordTest_ReapRuntime_001
+ * @tc.desc: Verify ReapRuntime skips the record without js thread or with a visible form.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_ReapRuntime_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_ReapRuntime_001 start";
+    ASSERT_NE(formRenderRecordPtr_, nullptr);
+    formRenderRecordPtr_->eventHandler_ = nullptr;
+    EXPECT_FALSE(formRenderRecordPtr_->IsRuntimeAlive());
+    EXPECT_FALSE(formRenderRecordPtr_->ReapRuntime());
+
+    int64_t formId = 31;
+    auto eventRunner = EventRunner::Create("ReapRuntime_001");
+    formRenderRecordPtr_->eventHandler_ = std::make_shared<EventHandler>(eventRunner);
+    EXPECT_TRUE(formRenderRecordPtr_->IsRuntimeAlive());
+    formRenderRecordPtr_->RecordFormVisibility(formId, true);
+    EXPECT_FALSE(formRenderRecordPtr_->ReapRuntime());
+    EXPECT_FALSE(formRenderRecordPtr_->IsFormReaped(formId));
+
+    formRenderRecordPtr_->RecordFormVisibility(formId, false);
+    formRenderRecordPtr_->eventHandler_ = nullptr;
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_ReapRuntime_001 end";
+}
+
+/**
+ * @tc.name: FormRenderRecordTest_ReapedForm_001
+ * @tc.desc: Verify the status data of a reaped form is handed over on recycle and dropped on delete.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_ReapedForm_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_ReapedForm_001 start";
+    ASSERT_NE(formRenderRecordPtr_, nullptr);
+    int64_t formId = 32;
+    ReapedForm reapedForm;
+    reapedForm.statusData = "statusData";
+    formRenderRecordPtr_->reapedForms_[formId] = reapedForm;
+    EXPECT_TRUE(formRenderRecordPtr_->IsFormReaped(formId));
+
+    std::string statusData;
+    EXPECT_EQ(ERR_OK, formRenderRecordPtr_->RecycleForm(formId, statusData));
+    EXPECT_EQ(statusData, "statusData");
+    EXPECT_FALSE(formRenderRecordPtr_->IsFormReaped(formId));
+
+    ReapedForm takenForm;
+    EXPECT_FALSE(formRenderRecordPtr_->TakeReapedForm(formId, takenForm));
+    formRenderRecordPtr_->reapedForms_[formId] = reapedForm;
+    EXPECT_TRUE(formRenderRecordPtr_->TakeReapedForm(formId, takenForm));
+    EXPECT_EQ(takenForm.statusData, "statusData");
+    EXPECT_FALSE(formRenderRecordPtr_->IsFormReaped(formId));
+
+    formRenderRecordPtr_->formRequests_.clear();
+    FormRequest request;
+    std::unordered_map<std::string, Ace::FormRequest> map;
+    map.emplace("1", request);
+    formRenderRecordPtr_->formRequests_.emplace(formId, map);
+    formRenderRecordPtr_->reapedForms_[formId] = reapedForm;
+    formRenderRecordPtr_->DeleteFormRequest(formId, "1");
+    EXPECT_FALSE(formRenderRecordPtr_->IsFormReaped(formId));
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_ReapedForm_001 end";
+}
+
+/**
+ * @tc.name: FormRenderRecordTest_ReapedForm_002
+ * @tc.desc: Verify a reaped form is recovered with the status data saved when its runtime was reaped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_ReapedForm_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_ReapedForm_002 start";
+    auto renderRecord = FormRenderRecord::Create("bundleName", "reapedForm002");
+    ASSERT_NE(renderRecord, nullptr);
+    renderRecord->runtime_ = std::make_shared<JsFormRuntime>();
+    int64_t formId = 33;
+    FormJsInfo formJsInfo;
+    formJsInfo.formId = formId;
+    formJsInfo.bundleName = "bundleName";
+    formJsInfo.moduleName = "moduleName";
+    formJsInfo.isDynamic = true;
+    Want want;
+    auto context = renderRecord->GetContext(formJsInfo, want);
+    ASSERT_NE(renderRecord->GetFormRendererGroup(formJsInfo, context, renderRecord->runtime_), nullptr);
+    FormRequest request;
+    request.compId = "1";
+    request.formJsInfo = formJsInfo;
+    std::unordered_map<std::string, Ace::FormRequest> requests;
+    requests.emplace(request.compId, request);
+    renderRecord->formRequests_.emplace(formId, requests);
+    renderRecord->RecordFormVisibility(formId, false);
+
+    MockRecycledStatusData("statusData");
+    EXPECT_TRUE(renderRecord->HandleReapInJsThread());
+    MockRecycledStatusData("");
+    EXPECT_TRUE(renderRecord->IsFormReaped(formId));
+    EXPECT_TRUE(renderRecord->formRendererGroupMap_.empty());
+    // the mocked group holds no request, give the recycled form its comp ids as a real group would
+    renderRecord->recycledFormCompIds_[formId] = { { request.compId }, request.compId };
+
+    renderRecord->RecoverReapedForm(formId);
+    EXPECT_TRUE(renderRecord->reapedForms_[formId].isRecovering);
+    want.SetParam(Constants::FORM_RENDER_TYPE_KEY, Constants::UPDATE_RENDERING_FORM);
+    EXPECT_EQ(ERR_OK, renderRecord->HandleUpdateForm(formJsInfo, want));
+    EXPECT_FALSE(renderRecord->IsFormReaped(formId));
+    EXPECT_EQ(GetRecoveredStatusData(), "statusData");
+    renderRecord->formRendererGroupMap_.clear();
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_ReapedForm_002 end";
+}
+
+/**
+ * @tc.name: FormRenderRecordTest_FormRuntimeReaper_001
+ * @tc.desc: Verify the reaper selects the least recently active idle records over the limit.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderRecordTest, FormRenderRecordTest_FormRuntimeReaper_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_FormRuntimeReaper_001 start";
+    auto &reaper = FormRuntimeReaper::GetInstance();
+    int64_t idleTime = reaper.GetIdleTime();
+    size_t maxLiveRuntimes = reaper.maxLiveRuntimes_;
+    reaper.SetIdleTime(1000);
+    reaper.SetMaxLiveRuntimes(1);
+
+    auto eventRunner = EventRunner::Create("FormRuntimeReaper_001");
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    std::vector<std::shared_ptr<FormRenderRecord>> records;
+    // active 5s, 3s and 0.5s ago
+    for (int64_t activeAgo : { 3000, 5000, 500 }) {
+        auto record = FormRenderRecord::Create("bundleName", "reaper" + std::to_string(activeAgo));
+        ASSERT_NE(record, nullptr);
+        record->eventHandler_ = std::make_shared<EventHandler>(eventRunner);
+        record->lastActiveTime_ = now - activeAgo;
+        records.emplace_back(record);
+    }
+    records.emplace_back(nullptr);
+
+    int64_t nextCheckDelayMs = 0;
+    auto reapRecords = reaper.SelectReapRecords(records, nextCheckDelayMs);
+    EXPECT_EQ(reaper.GetLiveRuntimeCount(), 3);
+    ASSERT_EQ(reapRecords.size(), 2);
+    EXPECT_EQ(reapRecords[0], records[1]);
+    EXPECT_EQ(reapRecords[1], records[0]);
+    EXPECT_EQ(nextCheckDelayMs, 0);
+
+    reaper.SetMaxLiveRuntimes(0);
+    reapRecords = reaper.SelectReapRecords(records, nextCheckDelayMs);
+    EXPECT_EQ(reapRecords.size(), 2);
+    EXPECT_GT(nextCheckDelayMs, 0);
+    EXPECT_LE(nextCheckDelayMs, 500);
+
+    // on low memory the recently active record is reaped as well
+    records[1]->RecordFormVisibility(1, true);
+    reaper.OnMemoryLevel(1);
+    reaper.SetMaxLiveRuntimes(3);
+    reapRecords = reaper.SelectReapRecords(records, nextCheckDelayMs);
+    ASSERT_EQ(reapRecords.size(), 2);
+    EXPECT_EQ(reapRecords[0], records[0]);
+    EXPECT_EQ(reapRecords[1], records[2]);
+    EXPECT_EQ(nextCheckDelayMs, 0);
+
+    reaper.OnMemoryLevel(0);
+    reapRecords = reaper.SelectReapRecords(records, nextCheckDelayMs);
+    EXPECT_TRUE(reapRecords.empty());
+    for (auto &record : records) {
+        if (record != nullptr) {
+            record->eventHandler_ = nullptr;
+        }
+    }
+    reaper.SetIdleTime(idleTime);
+    reaper.SetMaxLiveRuntimes(maxLiveRuntimes);
+    GTEST_LOG_(INFO) << "FormRenderRecordTest_FormRuntimeReaper_001 end";
+}
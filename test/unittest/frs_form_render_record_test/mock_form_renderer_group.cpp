@@ -15,11 +15,14 @@
 
 #include <gtest/gtest.h>
 
+#include "form_constants.h"
 #include "form_mgr_errors.h"
 #include "form_renderer_group.h"
 
 namespace {
     bool g_mockIsFormRequestsEmpty = true;
+    std::string g_mockRecycledStatusData;
+    std::string g_recoveredStatusData;
 }
 
 void MockIsFormRequestsEmpty(bool mockRet)
@@ -27,6 +30,16 @@ void MockIsFormRequestsEmpty(bool mockRet)
     g_mockIsFormRequestsEmpty = mockRet;
 }
 
+void MockRecycledStatusData(const std::string &statusData)
+{
+    g_mockRecycledStatusData = statusData;
+}
+
+std::string GetRecoveredStatusData()
+{
+    return g_recoveredStatusData;
+}
+
 namespace OHOS {
 namespace Ace {
 void FormRendererGroup::AddForm(const OHOS::AAFwk::Want& want, const OHOS::AppExecFwk::FormJsInfo& formJsInfo)
@@ -76,12 +89,15 @@ bool FormRendererGroup::IsFormRequestsEmpty()
 
 void FormRendererGroup::RecycleForm(std::string& statusData) const
 {
-    return;
+    statusData = g_mockRecycledStatusData;
 }
 
 void FormRendererGroup::RecoverRenderer(const std::vector<FormRequest>& formRequests, size_t currentCompIndex)
 {
-    return;
+    if (currentCompIndex < formRequests.size()) {
+        g_recoveredStatusData =
+            formRequests[currentCompIndex].want.GetStringParam(OHOS::AppExecFwk::Constants::FORM_STATUS_DATA);
+    }
 }
 }  // namespace Ace
 }  // namespace OHOS
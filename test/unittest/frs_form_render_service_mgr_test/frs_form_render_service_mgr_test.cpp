@@ -19,9 +19,11 @@
 #include "form_constants.h"
 #include "form_js_info.h"
 #include "form_mgr_errors.h"
+#include "form_module_checker.h"
 #define private public
 #include "form_memmgr_client.h"
 #include "form_render_service_mgr.h"
+#include "form_runtime_pool.h"
 #undef private
 #include "form_supply_stub.h"
 #include "gmock/gmock.h"
@@ -46,6 +48,22 @@ constexpr int32_t SET_VISIBLE_CHANGE_FAILED = -1;
 constexpr int32_t ERR_FAILED = -1;
 constexpr int32_t UPDATE_FORM_SIZE_FAILED = -1;
 constexpr int32_t SET_RENDERGROUPENABLEFLAG_CHANGE_FAILED = -1;
+
+std::shared_ptr<PrewarmedRuntime> CreatePrewarmedRuntime(const std::string &threadName)
+{
+    auto prewarmed = std::make_shared<PrewarmedRuntime>();
+    prewarmed->eventRunner = EventRunner::Create(threadName);
+    prewarmed->eventHandler = std::make_shared<EventHandler>(prewarmed->eventRunner);
+    prewarmed->runtime = std::make_shared<JsFormRuntime>();
+    // the options FormRuntimePool initializes the runtime with
+    auto &options = prewarmed->runtime->options_;
+    options.codePath = Constants::LOCAL_CODE_PATH;
+    options.loadAce = true;
+    options.isBundle = true;
+    options.isUnique = true;
+    options.moduleCheckerDelegate = std::make_shared<FormModuleChecker>();
+    return prewarmed;
+}
 }  // namespace
 
 class FormRenderServiceMgrTest : public testing::Test {
@@ -1567,4 +1585,165 @@ HWTEST_F(FormRenderServiceMgrTest, SetConfiguration_004, TestSize.Level0)
     formRenderServiceMgr.SetConfiguration(configuration);
     EXPECT_FALSE(formRenderServiceMgr.configuration_);
     GTEST_LOG_(INFO) << "SetConfiguration_004 end";
-}
\ No newline at end of file
+}
+/**
+ * @tc.name: OnMemoryLevel_001
+ * @tc.desc: Verify the runtime pool is not refilled while the memory is low.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderServiceMgrTest, OnMemoryLevel_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "OnMemoryLevel_001 start";
+    FormRenderServiceMgr formRenderServiceMgr;
+    constexpr int32_t memoryLevelLow = 1;
+    constexpr int32_t memoryLevelModerate = 0;
+    FormRuntimePool::GetInstance().SetCapacity(1);
+    formRenderServiceMgr.OnMemoryLevel(memoryLevelLow);
+    EXPECT_EQ(FormRuntimePool::GetInstance().GetIdleCount(), 0);
+    formRenderServiceMgr.PrewarmRuntime();
+    EXPECT_EQ(FormRuntimePool::GetInstance().GetIdleCount(), 0);
+    EXPECT_EQ(FormRuntimePool::GetInstance().Acquire(), nullptr);
+    formRenderServiceMgr.OnMemoryLevel(memoryLevelModerate);
+    GTEST_LOG_(INFO) << "OnMemoryLevel_001 end";
+}
+
+/**
+ * @tc.name: PrewarmRuntime_001
+ * @tc.desc: Verify no runtime is warmed when the runtime pool is disabled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderServiceMgrTest, PrewarmRuntime_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PrewarmRuntime_001 start";
+    FormRenderServiceMgr formRenderServiceMgr;
+    FormRuntimePool::GetInstance().SetCapacity(0);
+    formRenderServiceMgr.PrewarmRuntime();
+    EXPECT_EQ(FormRuntimePool::GetInstance().GetIdleCount(), 0);
+
+    auto formRenderRecord = FormRenderRecord::Create("bundleName", "uid");
+    ASSERT_NE(formRenderRecord, nullptr);
+    EXPECT_FALSE(formRenderRecord->isPrewarmed_);
+    EXPECT_EQ(formRenderRecord->prewarmedRuntime_, nullptr);
+    GTEST_LOG_(INFO) << "PrewarmRuntime_001 end";
+}
+
+/**
+ * @tc.name: PrewarmRuntime_002
+ * @tc.desc: Verify a new render record claims the pooled runtime and binds it to the bundle in its js thread.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderServiceMgrTest, PrewarmRuntime_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PrewarmRuntime_002 start";
+    auto prewarmed = CreatePrewarmedRuntime("PrewarmRuntime_002");
+    ASSERT_NE(prewarmed->eventRunner, nullptr);
+    auto runtime = prewarmed->runtime;
+    FormRuntimePool::GetInstance().SetCapacity(1);
+    FormRuntimePool::GetInstance().idleRuntimes_.emplace_back(prewarmed);
+
+    auto formRenderRecord = FormRenderRecord::Create("bundleName", "uid");
+    ASSERT_NE(formRenderRecord, nullptr);
+    EXPECT_TRUE(formRenderRecord->isPrewarmed_);
+    EXPECT_EQ(formRenderRecord->eventRunner_, prewarmed->eventRunner);
+    EXPECT_EQ(formRenderRecord->prewarmedRuntime_, runtime);
+    EXPECT_EQ(FormRuntimePool::GetInstance().GetIdleCount(), 0);
+
+    FormJsInfo formJsInfo;
+    formJsInfo.bundleName = "bundleName";
+    formJsInfo.moduleName = "moduleName";
+    bool isCreated = false;
+    auto createTask = [formRenderRecord, &formJsInfo, &isCreated]() {
+        isCreated = formRenderRecord->CreateRuntime(formJsInfo);
+    };
+    formRenderRecord->eventHandler_->PostSyncTask(createTask, "PrewarmRuntime_002");
+    EXPECT_TRUE(isCreated);
+    EXPECT_EQ(formRenderRecord->runtime_, runtime);
+    EXPECT_EQ(formRenderRecord->prewarmedRuntime_, nullptr);
+    FormRuntimePool::GetInstance().SetCapacity(0);
+    GTEST_LOG_(INFO) << "PrewarmRuntime_002 end";
+}
+
+/**
+ * @tc.name: PrewarmRuntime_003
+ * @tc.desc: Verify a bound pooled runtime carries the same bundle state as a cold created one.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderServiceMgrTest, PrewarmRuntime_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PrewarmRuntime_003 start";
+    FormJsInfo formJsInfo;
+    formJsInfo.bundleName = "bundleName";
+    formJsInfo.moduleName = "moduleName";
+    formJsInfo.jsFormCodePath = "/data/app/el1/bundle/public/bundleName/entry.hap";
+
+    FormRuntimePool::GetInstance().SetCapacity(0);
+    auto coldRecord = FormRenderRecord::Create("bundleName", "uid");
+    ASSERT_NE(coldRecord, nullptr);
+    EXPECT_FALSE(coldRecord->isPrewarmed_);
+    coldRecord->eventHandler_->PostSyncTask([coldRecord, &formJsInfo]() {
+        coldRecord->CreateRuntime(formJsInfo);
+    }, "PrewarmRuntime_003");
+    ASSERT_NE(coldRecord->runtime_, nullptr);
+
+    FormRuntimePool::GetInstance().SetCapacity(1);
+    FormRuntimePool::GetInstance().idleRuntimes_.emplace_back(CreatePrewarmedRuntime("PrewarmRuntime_003"));
+    auto boundRecord = FormRenderRecord::Create("bundleName", "uid");
+    ASSERT_NE(boundRecord, nullptr);
+    EXPECT_TRUE(boundRecord->isPrewarmed_);
+    auto prewarmedRuntime = boundRecord->prewarmedRuntime_;
+    boundRecord->eventHandler_->PostSyncTask([boundRecord, &formJsInfo]() {
+        boundRecord->CreateRuntime(formJsInfo);
+    }, "PrewarmRuntime_003");
+    ASSERT_NE(boundRecord->runtime_, nullptr);
+    EXPECT_EQ(boundRecord->runtime_, prewarmedRuntime);
+
+    const auto &coldOptions = coldRecord->runtime_->GetOptions();
+    const auto &boundOptions = boundRecord->runtime_->GetOptions();
+    EXPECT_EQ(boundOptions.bundleName, coldOptions.bundleName);
+    EXPECT_EQ(boundOptions.hapPath, coldOptions.hapPath);
+    EXPECT_EQ(boundOptions.codePath, coldOptions.codePath);
+    EXPECT_EQ(boundOptions.loadAce, coldOptions.loadAce);
+    EXPECT_EQ(boundOptions.isBundle, coldOptions.isBundle);
+    EXPECT_EQ(boundOptions.isUnique, coldOptions.isUnique);
+    EXPECT_NE(boundOptions.moduleCheckerDelegate, nullptr);
+    EXPECT_EQ(boundOptions.pkgContextInfoJsonStringMap, coldOptions.pkgContextInfoJsonStringMap);
+    EXPECT_EQ(boundOptions.packageNameList, coldOptions.packageNameList);
+    EXPECT_EQ(boundRecord->hapPath_, coldRecord->hapPath_);
+    EXPECT_EQ(boundRecord->runtime_->bundleName_, coldRecord->runtime_->bundleName_);
+    EXPECT_EQ(boundRecord->runtime_->moduleNameSet_, coldRecord->runtime_->moduleNameSet_);
+    FormRuntimePool::GetInstance().SetCapacity(0);
+    GTEST_LOG_(INFO) << "PrewarmRuntime_003 end";
+}
+
+/**
+ * @tc.name: PrewarmRuntime_004
+ * @tc.desc: Verify a pooled runtime not initialized as a cold start would be is released and not bound.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FormRenderServiceMgrTest, PrewarmRuntime_004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PrewarmRuntime_004 start";
+    auto prewarmed = CreatePrewarmedRuntime("PrewarmRuntime_004");
+    prewarmed->runtime->options_.bundleName = "otherBundleName";
+    auto runtime = prewarmed->runtime;
+    FormRuntimePool::GetInstance().SetCapacity(1);
+    FormRuntimePool::GetInstance().idleRuntimes_.emplace_back(prewarmed);
+    prewarmed.reset();
+
+    auto formRenderRecord = FormRenderRecord::Create("bundleName", "uid");
+    ASSERT_NE(formRenderRecord, nullptr);
+    EXPECT_TRUE(formRenderRecord->isPrewarmed_);
+    FormJsInfo formJsInfo;
+    formJsInfo.bundleName = "bundleName";
+    formJsInfo.moduleName = "moduleName";
+    formRenderRecord->eventHandler_->PostSyncTask([formRenderRecord, &formJsInfo]() {
+        formRenderRecord->CreateRuntime(formJsInfo);
+    }, "PrewarmRuntime_004");
+    EXPECT_FALSE(formRenderRecord->isPrewarmed_);
+    EXPECT_EQ(formRenderRecord->prewarmedRuntime_, nullptr);
+    ASSERT_NE(formRenderRecord->runtime_, nullptr);
+    EXPECT_NE(formRenderRecord->runtime_, runtime);
+    EXPECT_EQ(formRenderRecord->runtime_->GetOptions().bundleName, formJsInfo.bundleName);
+    FormRuntimePool::GetInstance().SetCapacity(0);
+    GTEST_LOG_(INFO) << "PrewarmRuntime_004 end";
+}